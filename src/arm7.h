@@ -44,10 +44,42 @@ typedef void (*arm_write16_fn_t)(void* user_data, uint32_t address, uint16_t dat
 typedef void (*arm_write8_fn_t)(void* user_data, uint32_t address, uint8_t data);
 typedef uint32_t (*arm_coproc_read_fn_t)(void* user_data, int coproc,int opcode,int Cn, int Cm,int Cp);
 typedef void (*arm_coproc_write_fn_t)(void* user_data, int coproc,int opcode,int Cn, int Cm,int Cp, uint32_t data);
+// Optional bulk LDM/STM: moves words 32 bit words between data and the word aligned address onwards when
+// they are all plain memory of one region, with the bus side effects (wait states, open bus, code
+// invalidation) of reading them through read32_seq, the first access nonsequential, or of writing them
+// through write32. Returns false without side effects to move the registers one at a time instead.
+typedef bool (*arm_block_transfer_fn_t)(void* user_data, uint32_t address, uint32_t* data, int words, bool write);
+// The same functions bound at compile time, see ARM7_STATIC_BUS
+typedef struct{
+  arm_read32_fn_t     read32;
+  arm_read16_fn_t     read16;
+  arm_read32_seq_fn_t read32_seq;
+  arm_read16_seq_fn_t read16_seq;
+  arm_read8_fn_t      read8;
+  arm_write32_fn_t    write32;
+  arm_write16_fn_t    write16;
+  arm_write8_fn_t     write8;
+  arm_coproc_read_fn_t coprocessor_read;
+  arm_coproc_write_fn_t coprocessor_write;
+  arm_block_transfer_fn_t block_transfer;
+}arm7_bus_t;
+// Optional functions used by the decoded block cache (see arm7_block_cache_t)
+// Returns a host pointer to the code backing address when it is plain memory that can be cached, or NULL
+// otherwise. bytes_mapped returns how many bytes from address share this answer.
+typedef const uint8_t* (*arm_code_ptr_fn_t)(void* user_data, uint32_t address, uint32_t* bytes_mapped);
+// Applies the bus side effects (wait states, open bus) of an opcode fetch that was served from the cache
+typedef void (*arm_cached_fetch_fn_t)(void* user_data, uint32_t address, const uint8_t* host, bool thumb, bool is_sequential);
+// Optional high level emulation of the BIOS SWIs. Called with the function number of the SWI (the
+// comment field in Thumb, bits 16-23 of it in ARM state) before the exception is taken. Returns true if
+// the system performed the SWI, the CPU then continues after the SWI instruction.
+typedef bool (*arm_swi_hle_fn_t)(void* user_data, uint32_t function);
+struct arm7_block_cache_t;
+struct arm7_t;
+typedef void (*arm7_handler_t)(struct arm7_t *cpu, uint32_t opcode);
 
 #define ARM_DEBUG_BRANCH_RING_SIZE 32
 #define ARM_DEBUG_SWI_RING_SIZE 32
-typedef struct {
+typedef struct arm7_t{
   // Registers
   /*
   0-15: R0-R15
@@ -62,6 +94,11 @@ typedef struct {
   34: SPSR_svc
   35: SPSR_abt
   36: SPSR_und
+
+  R8-R14 of the current mode are always kept in 8-14 so that instructions index them directly. A
+  mode change swaps the bank of the old mode back into its slots and swaps in the bank of the new
+  mode, so while a banked mode is active the user registers sit in that mode's slots.
+  arm7_unbank_registers restores the layout above.
   */
 
   uint32_t debug_branch_ring[ARM_DEBUG_BRANCH_RING_SIZE];
@@ -75,6 +112,14 @@ typedef struct {
   uint32_t i_cycles;//Executed i-cycles minus 1
   bool next_fetch_sequential;
   uint32_t registers[37];
+  uint8_t active_bank; // CPSR&0xf of the mode whose R8-R14 are in registers[8-14]
+  // Lazily evaluated NZCV flags. Flag setting ALU ops only record their operands here and the flags
+  // are computed into registers[CPSR] by arm7_flush_flags when something reads them.
+  uint64_t lazy_cv_result;
+  uint32_t lazy_cv_a, lazy_cv_b;
+  uint32_t lazy_nz_result;
+  uint8_t lazy_flags; // ARM7_LAZY_* bits of the flags that are out of date in registers[CPSR]
+  bool lazy_c;
   uint64_t executed_instructions;
   bool trigger_breakpoint;
   bool print_instructions;
@@ -92,15 +137,167 @@ typedef struct {
   arm_coproc_write_fn_t coprocessor_write;
   bool wait_for_interrupt; 
   uint32_t irq_table_address; 
+  // Decoded block cache, NULL when disabled. Like the callbacks above this lives outside of the
+  // emulated state and is rebound by the system every tick. 
+  struct arm7_block_cache_t* block_cache;
+  arm_code_ptr_fn_t     code_ptr;
+  arm_cached_fetch_fn_t cached_fetch;
+  arm_swi_hle_fn_t      swi_hle; // NULL runs every SWI in the BIOS
+  arm_block_transfer_fn_t block_transfer; // NULL moves every register of a LDM/STM on its own
+  // Code window: the region of code_ptr memory the last pipeline fetch came from. Fetches inside it
+  // read the host memory directly and only charge their timing through cached_fetch. Dropped with
+  // arm7_code_window_flush whenever the system changes its memory map.
+  const uint8_t* code_window_host;
+  uint32_t code_window_start, code_window_size;
+  uint32_t code_window_miss_start, code_window_miss_size; // Last range code_ptr couldn't map
+  // Handler tables of the system's compile time bus (arm7_bind_bus_handlers), NULL uses the tables
+  // that go through the function pointers above. Rebound by the system every tick like the callbacks.
+  const arm7_handler_t* arm_handlers;
+  const arm7_handler_t* thumb_handlers;
 } arm7_t;     
 
-typedef void (*arm7_handler_t)(arm7_t *cpu, uint32_t opcode);
 typedef struct{
 	arm7_handler_t handler;
 	char name[12];
 	char bitfield[33];
 }arm7_instruction_t;
 
+// Decoded block cache
+// Straight-line runs of opcodes are decoded once and kept with their handler so that the pipelined
+// fetch can be served from the cache instead of going through read32_seq/read16_seq. The system
+// still charges the wait states of every fetch through cached_fetch so timing is unchanged. 
+// Blocks never cross a cache page and are validated against a per host page generation counter 
+// that the system bumps on every write to code memory (arm7_block_cache_invalidate), so self
+// modifying code keeps working. arm7_block_cache_flush drops everything (mapping changes, state loads).
+#define ARM7_BLOCK_MAX_INSTRUCTIONS 32
+#define ARM7_BLOCK_CACHE_SIZE 2048
+#define ARM7_BLOCK_PAGE_SIZE 256
+#define ARM7_BLOCK_PAGE_TABLE_SIZE 16384
+
+// Thumb superinstructions
+// Compiled Thumb code is dominated by a few instruction pairs, which the block cache marks on the
+// first op of the pair when it decodes a block. arm7_exec_cached_fused runs such a pair in one call
+// with the second op specialized on the first one. The system's boundary still runs between the two
+// so the hardware is ticked for the first op, and an interrupt, DMA or breakpoint that lands there
+// leaves the second op to run on its own like it would without fusion.
+enum{
+  ARM7_FUSE_NONE,
+  ARM7_FUSE_CMP_BCC,   // CMP Rd,#imm or CMP Rd,Rs followed by a conditional branch
+  ARM7_FUSE_SHIFT_ADD, // LSL/MOV #imm feeding an ADD (address calculations)
+  ARM7_FUSE_LDR_LDR,   // Two LDRs from the same base register
+  ARM7_FUSE_BL,        // The two halves of a BL
+  ARM7_FUSE_COUNT
+};
+
+typedef struct{
+  arm7_handler_t handler;
+  uint32_t opcode;
+  bool always_execute; // Thumb, AL and NV condition codes don't need arm7_check_cond_code
+  bool thumb;
+  uint8_t fusion;      // ARM7_FUSE_* pair this op starts with the next op of its block
+}arm7_decoded_op_t;
+
+typedef struct{
+  uint32_t start_pc;
+  uint32_t end_pc;     // Exclusive
+  uint32_t epoch;      // 0 is never a valid epoch
+  uint32_t page;       // Index into page_gen
+  uint32_t page_gen;
+  uint64_t build;      // Unique id of this decode of the block
+  bool thumb;
+  const uint8_t* host; // NULL for a range of uncacheable memory
+  arm7_decoded_op_t ops[ARM7_BLOCK_MAX_INSTRUCTIONS];
+}arm7_block_t;
+
+typedef struct arm7_block_cache_t{
+  uint32_t epoch;
+  arm7_block_t* current;                // Block the fetch stream is currently inside of
+  const arm7_decoded_op_t* pipeline[3]; // Decoded ops matching cpu->prefetch_opcode (if their opcode matches)
+  uint64_t hits;
+  uint64_t builds;
+  uint64_t fused[ARM7_FUSE_COUNT];      // Pairs run by arm7_exec_cached_fused, by ARM7_FUSE_* kind
+  uint64_t fusion_fallbacks;            // Pairs the boundary split, their second op ran on its own
+  uint32_t page_gen[ARM7_BLOCK_PAGE_TABLE_SIZE];
+  arm7_block_t blocks[ARM7_BLOCK_CACHE_SIZE];
+}arm7_block_cache_t;
+
+// Runs the tail of the system's main loop for the instruction that just executed. Returns true if
+// the next iteration would go straight to executing another instruction (no DMA, interrupt, etc..)
+// and ticks can be reset for it.
+typedef bool (*arm7_boundary_fn_t)(void* ctx);
+
+// Idle loop detection
+// Games often spin in a short loop polling VCOUNT, DISPSTAT, IF or a RAM flag set by an IRQ instead
+// of halting. A loop is idle when its body only has ALU ops and loads (no stores, calls or mode
+// changes), every load reads memory the system says can't change before its next event, and the
+// registers are the same on two consecutive arrivals at the loop head. The system can then skip
+// ahead to its next event like it does for a halted CPU.
+#define ARM7_IDLE_LOOP_MAX_BYTES 32       // Longest distance from a loop head to its branch
+#define ARM7_IDLE_LOOP_MAX_CLOCKS 1024    // Longest loop iteration considered
+// Returns true if size bytes at address can only change at one of the system's events
+typedef bool (*arm7_idle_read_fn_t)(void* user_data, uint32_t address, int size);
+typedef struct{
+  uint32_t head, branch;        // Candidate loop, from its head to the backward branch
+  bool thumb;
+  bool code_rejected;           // The candidate's body has an op that isn't allowed in an idle loop
+  bool confirmed;               // The last arrival at head confirmed the loop idle
+  bool body_ok;                 // The body's loads were allowed with the registers of the last arrival
+  uint32_t registers[17];       // R0-R15 and CPSR at the last arrival at head
+  uint64_t clock;               // System clock at the last arrival at head
+  uint32_t iteration_clocks;    // Clocks between the last two arrivals at head
+  // Per game overrides
+  uint32_t override_head;       // Loop head that is treated as idle without checking its body (0 for none)
+  bool disabled;
+  // Statistics
+  uint64_t loops_detected;      // Times a loop went from running to confirmed idle
+  uint64_t clocks_skipped;
+  uint32_t last_head;           // Head of the last loop confirmed idle
+}arm7_idle_loop_t;
+// Per game override, applied when a ROM with game_code is loaded
+typedef struct{
+  char game_code[5];
+  uint32_t head;                // Loop head treated as idle without checking its body (0 for none)
+  bool disabled;                // Never skip idle loops in this game
+}arm7_idle_loop_override_t;
+
+// Threaded interpreter
+// Every handler is inlined into a single function and ends with its own fetch, decode and indirect
+// jump to the next handler (labels as values on GCC/Clang, a switch on other compilers), so the host
+// branch predictor gets a history per opcode class instead of one shared indirect call site.
+#ifndef ARM7_THREADED_INTERPRETER
+#define ARM7_THREADED_INTERPRETER 0
+#endif
+#ifndef ARM7_THREADED_COMPUTED_GOTO
+#if defined(__GNUC__) || defined(__clang__)
+#define ARM7_THREADED_COMPUTED_GOTO 1
+#else
+#define ARM7_THREADED_COMPUTED_GOTO 0
+#endif
+#endif
+
+// Lazy flags
+// Most flag results are overwritten before anything reads them (especially in Thumb code where 
+// nearly every ALU op sets them), so flag setting ops store the result and operands of the op and
+// the CPSR flags are only computed for condition codes, MRS, exceptions and mode changes. Builds
+// with ARM7_LAZY_FLAGS=0 compute the flags right away.
+#ifndef ARM7_LAZY_FLAGS
+#define ARM7_LAZY_FLAGS 1
+#endif
+#define ARM7_LAZY_NZ  (1<<0) // N and Z come from lazy_nz_result
+#define ARM7_LAZY_ADD (1<<1) // C and V come from lazy_cv_a+lazy_cv_b=lazy_cv_result
+#define ARM7_LAZY_SUB (1<<2) // C and V come from lazy_cv_a-lazy_cv_b=lazy_cv_result
+#define ARM7_LAZY_C   (1<<3) // C comes from lazy_c (barrel shifter carry out of a logical op)
+
+// Compile time bus
+// The handlers that access memory take a const arm7_bus_t*, NULL goes through the function pointers
+// of arm7_t. A system that defines ARM7_BUS (its static const arm7_bus_t), ARM7_BUS_PREFIX and
+// ARM7_BUS_ARM9 and then includes arm7_bus_handlers.h gets handler tables where the compiler
+// resolves those calls, so its RAM/ROM fast paths inline into the handlers. ARM7_STATIC_BUS=0 keeps
+// every core on the function pointers (e.g. to hook them for debugging).
+#ifndef ARM7_STATIC_BUS
+#define ARM7_STATIC_BUS 1
+#endif
+
 ////////////////////////
 // User API Functions //
 ////////////////////////
@@ -108,11 +305,49 @@ typedef struct{
 // This function initializes the internal state needed for the arm7 core emulation
 static arm7_t arm7_init(void* user_data);
 static void arm7_exec_instruction(arm7_t* cpu);
+// Same as arm7_exec_instruction/arm9_exec_instruction but serves fetches from cpu->block_cache
+static void arm7_exec_cached_instruction(arm7_t* cpu);
+static void arm9_exec_cached_instruction(arm7_t* cpu);
+// Same as arm7_exec_cached_instruction/arm9_exec_cached_instruction, but if the instruction starts a
+// fused Thumb pair it is followed by boundary and, if that returns true, by the second instruction.
+// Returns the number of instructions run (the second one starts 2 bytes after the first), the system
+// finishes the last one like after arm7_exec_cached_instruction. Returns 0 if boundary returned false,
+// the first instruction is then already finished.
+static int arm7_exec_cached_fused(arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx);
+static int arm9_exec_cached_fused(arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx);
+// Same as calling arm7_exec_instruction/arm9_exec_instruction followed by boundary until it returns
+// false, using the threaded interpreter. Returns false without side effects if the CPU needs the
+// regular path (halted, block cache, log compare or single stepping).
+static bool arm7_exec_threaded(arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx);
+static bool arm9_exec_threaded(arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx);
+// Makes the exec functions use the handler tables of a compile time bus (see ARM7_STATIC_BUS)
+static void arm7_bind_bus_handlers(arm7_t* cpu, const arm7_handler_t* arm_handlers, const arm7_handler_t* thumb_handlers);
+// Called after an instruction that started at branch_pc, returns true if it was a branch back to
+// the head of an idle loop (see arm7_idle_loop_t). Systems skip ahead a multiple of
+// idle->iteration_clocks and report it with arm7_idle_loop_skip.
+static FORCE_INLINE bool arm7_idle_loop_arrival(arm7_t* cpu, arm7_idle_loop_t* idle, uint32_t branch_pc, uint64_t clock, arm7_idle_read_fn_t read_ok);
+static void arm7_idle_loop_skip(arm7_idle_loop_t* idle, uint64_t clocks);
+static void arm7_idle_loop_apply_override(arm7_idle_loop_t* idle, const arm7_idle_loop_override_t* overrides, int count, const uint8_t game_code[4]);
+// Drops all cached blocks
+static void arm7_block_cache_flush(arm7_block_cache_t* cache);
+// Must be called when the memory code_ptr returns for an address changes
+static void arm7_code_window_flush(arm7_t* cpu);
+// Must be called when the host memory backing code is written
+static void arm7_block_cache_invalidate(arm7_block_cache_t* cache, const void* host_ptr);
+static void arm7_block_cache_invalidate_range(arm7_block_cache_t* cache, const void* host_ptr, size_t bytes);
 
 // Write the dissassembled opcode from mem_address into the out_disasm string up to out_size characters
 static void arm7_get_disasm(arm7_t * cpu, uint32_t mem_address, char* out_disasm, size_t out_size);
 // Used to send an interrupt to the emulated CPU. The n'th set bit triggers the n'th interrupt
 static void arm7_process_interrupts(arm7_t* cpu, uint32_t interrupts);
+// Swaps the banked registers back into the 37 register layout (e.g. for BESS). arm7_update_bank 
+// swaps in the bank of the current mode again, it is also needed after writing registers[CPSR]
+// directly or after filling the registers in the 37 register layout while unbanked (e.g. after init).
+static void arm7_unbank_registers(arm7_t* cpu);
+static FORCE_INLINE void arm7_update_bank(arm7_t* cpu);
+// Computes pending lazy flags into registers[CPSR]. Needed before registers[CPSR] is accessed 
+// directly, arm7_reg_read/arm7_reg_write already do this for the CPSR and SPSR. 
+static FORCE_INLINE void arm7_flush_flags(arm7_t* cpu);
 ///////////////////////////////////////////
 // Functions for Internal Implementation //
 ///////////////////////////////////////////
@@ -167,6 +402,10 @@ static void arm7t_soft_interrupt(arm7_t* cpu, uint32_t opcode);
 static void arm7t_branch(arm7_t* cpu, uint32_t opcode);
 static void arm7t_long_branch_link(arm7_t* cpu, uint32_t opcode);
 static void arm7t_unknown(arm7_t* cpu, uint32_t opcode);
+// Second ops of the fused Thumb pairs (see ARM7_FUSE_*)
+static FORCE_INLINE void arm7t_fused_cmp_bcc(arm7_t* cpu, uint32_t opcode);
+static FORCE_INLINE void arm7t_fused_shift_add(arm7_t* cpu, uint32_t opcode);
+static FORCE_INLINE void arm7t_fused_bl(arm7_t* cpu, uint32_t opcode);
 
 static FORCE_INLINE void arm9t_mult_ldst(arm7_t* cpu, uint32_t opcode);
 static FORCE_INLINE void arm9t_push_pop_reg(arm7_t* cpu, uint32_t opcode);
@@ -405,44 +644,229 @@ static const char* arm9_disasm_lookup_table[4096] = { 0 };
 static const char* arm7t_disasm_lookup_table[256] = { 0 };
 static const char* arm9t_disasm_lookup_table[256] = { 0 };
 
-static FORCE_INLINE unsigned arm7_reg_index(arm7_t* cpu, unsigned reg){
-  if(SB_LIKELY(reg<8))return reg;
-  int mode = cpu->registers[CPSR]&0xf;
+// Variants of the handlers with the decode key bits of the opcode fixed at compile time, generated by
+// tools/gen_arm7_handlers.py. arm7_init installs them in the lookup tables above.
+#ifndef ARM7_SPECIALIZED_HANDLERS
+#define ARM7_SPECIALIZED_HANDLERS 1
+#endif
+#if ARM7_SPECIALIZED_HANDLERS
+#include "arm7_specialized.h"
+#endif
 
-  const static int8_t lookup[10*16+8]={
-    -1,-1,-1,-1,-1,-1,-1,-1, //8 extra padding to remove the need to -8 from computation
-     8, 9,10,11,12,13,14,15,16,16, //mode 0x0 (user)
-    17,18,19,20,21,22,23,15,16,32, //mode 0x1 (fiq)
-     8, 9,10,11,12,24,25,15,16,33, //mode 0x2 (irq)
-     8, 9,10,11,12,26,27,15,16,34, //mode 0x3 (svc)
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //mode 0x4 (inv)
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //mode 0x5 (inv)
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //mode 0x6 (inv)
-     8, 9,10,11,12,28,29,15,16,35, //mode 0x7 (abt)
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //mode 0x8 (inv)
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //mode 0x9 (inv)
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //mode 0xA (inv)
-     8, 9,10,11,12,30,31,15,16,36, //mode 0xB (undefined)
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //mode 0xC (inv)
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //mode 0xD (inv)
-    -1,-1,-1,-1,-1,-1,-1,-1,-1,-1, //mode 0xE (inv)
-     8, 9,10,11,12,13,14,15,16,16, //mode 0xF (system)
-  };
-  int8_t r = lookup[mode*10+reg];
-  if(SB_LIKELY(r!=-1))return r; 
-  cpu->trigger_breakpoint=true;
-  printf("Undefined ARM mode: %d\n",mode);
-  return 0;
+// Every handler that accesses memory. Each one is implemented as <name>_bus, taking the bus its
+// accesses go through, and <name> is the variant that uses the function pointers of arm7_t.
+#define ARM7_BUS_HANDLERS(X) \
+  X(arm7_single_data_swap) X(arm7_half_word_transfer) X(arm7_single_word_transfer) X(arm7_block_transfer) \
+  X(arm7_coproc_reg_transfer) X(arm9_single_word_transfer) X(arm9_double_word_transfer) X(arm9_block_transfer) \
+  X(arm7t_pc_rel_ldst) X(arm7t_reg_off_ldst) X(arm7t_ldst_bh) X(arm7t_imm_off_ldst) \
+  X(arm7t_imm_off_ldst_bh) X(arm7t_stack_off_ldst) X(arm7t_push_pop_reg) X(arm7t_mult_ldst) \
+  X(arm9t_pc_rel_ldst) X(arm9t_reg_off_ldst) X(arm9t_imm_off_ldst) X(arm9t_stack_off_ldst) \
+  X(arm9t_push_pop_reg) X(arm9t_mult_ldst)
+
+// The bus handler tables are built out of the specialized handlers
+#if !ARM7_SPECIALIZED_HANDLERS
+#undef ARM7_STATIC_BUS
+#define ARM7_STATIC_BUS 0
+#endif
+
+// Memory accesses of the handlers, with a constant bus these fold into direct calls
+static FORCE_INLINE uint32_t arm7_bus_read32(arm7_t* cpu, const arm7_bus_t* bus, uint32_t address){
+  return bus? bus->read32(cpu->user_data,address): cpu->read32(cpu->user_data,address);
+}
+static FORCE_INLINE uint32_t arm7_bus_read16(arm7_t* cpu, const arm7_bus_t* bus, uint32_t address){
+  return bus? bus->read16(cpu->user_data,address): cpu->read16(cpu->user_data,address);
+}
+static FORCE_INLINE uint32_t arm7_bus_read32_seq(arm7_t* cpu, const arm7_bus_t* bus, uint32_t address, bool seq){
+  return bus? bus->read32_seq(cpu->user_data,address,seq): cpu->read32_seq(cpu->user_data,address,seq);
+}
+static FORCE_INLINE uint32_t arm7_bus_read16_seq(arm7_t* cpu, const arm7_bus_t* bus, uint32_t address, bool seq){
+  return bus? bus->read16_seq(cpu->user_data,address,seq): cpu->read16_seq(cpu->user_data,address,seq);
+}
+static FORCE_INLINE uint8_t arm7_bus_read8(arm7_t* cpu, const arm7_bus_t* bus, uint32_t address){
+  return bus? bus->read8(cpu->user_data,address): cpu->read8(cpu->user_data,address);
+}
+static FORCE_INLINE void arm7_bus_write32(arm7_t* cpu, const arm7_bus_t* bus, uint32_t address, uint32_t data){
+  if(bus)bus->write32(cpu->user_data,address,data);
+  else cpu->write32(cpu->user_data,address,data);
+}
+static FORCE_INLINE void arm7_bus_write16(arm7_t* cpu, const arm7_bus_t* bus, uint32_t address, uint16_t data){
+  if(bus)bus->write16(cpu->user_data,address,data);
+  else cpu->write16(cpu->user_data,address,data);
+}
+static FORCE_INLINE void arm7_bus_write8(arm7_t* cpu, const arm7_bus_t* bus, uint32_t address, uint8_t data){
+  if(bus)bus->write8(cpu->user_data,address,data);
+  else cpu->write8(cpu->user_data,address,data);
+}
+static FORCE_INLINE bool arm7_bus_block_transfer(arm7_t* cpu, const arm7_bus_t* bus, uint32_t address, uint32_t* data, int words, bool write){
+  arm_block_transfer_fn_t block_transfer = bus? bus->block_transfer: cpu->block_transfer;
+  return block_transfer&&block_transfer(cpu->user_data,address,data,words,write);
+}
+static FORCE_INLINE uint32_t arm7_bus_coprocessor_read(arm7_t* cpu, const arm7_bus_t* bus, int coproc,int opcode,int Cn, int Cm,int Cp){
+  return bus? bus->coprocessor_read(cpu->user_data,coproc,opcode,Cn,Cm,Cp): cpu->coprocessor_read(cpu->user_data,coproc,opcode,Cn,Cm,Cp);
+}
+static FORCE_INLINE void arm7_bus_coprocessor_write(arm7_t* cpu, const arm7_bus_t* bus, int coproc,int opcode,int Cn, int Cm,int Cp, uint32_t data){
+  if(bus)bus->coprocessor_write(cpu->user_data,coproc,opcode,Cn,Cm,Cp,data);
+  else cpu->coprocessor_write(cpu->user_data,coproc,opcode,Cn,Cm,Cp,data);
+}
+
+// Every handler used by the lookup tables above, each gets a label in the threaded interpreter
+#define ARM_THREADED_HANDLERS(X) \
+  X(arm7_data_processing) X(arm7_multiply) X(arm7_multiply_long) X(arm7_single_data_swap) \
+  X(arm7_branch_exchange) X(arm7_half_word_transfer) X(arm7_single_word_transfer) X(arm7_undefined) \
+  X(arm7_block_transfer) X(arm7_branch) X(arm7_coproc_data_transfer) X(arm7_coproc_data_op) \
+  X(arm7_coproc_reg_transfer) X(arm7_software_interrupt) X(arm7_mrs) X(arm7_msr) \
+  X(arm9_double_word_transfer) X(arm9_single_word_transfer) X(arm9_block_transfer) X(arm9_branch) \
+  X(arm9_qadd_qsub) X(arm9_signed_halfword_multiply) X(arm9_clz) X(arm9_branch_link_exchange) \
+  X(arm7t_mov_shift_reg) X(arm7t_add_sub) X(arm7t_mov_cmp_add_sub_imm) X(arm7t_alu_op) \
+  X(arm7t_hi_reg_op) X(arm7t_pc_rel_ldst) X(arm7t_reg_off_ldst) X(arm7t_ldst_bh) \
+  X(arm7t_imm_off_ldst) X(arm7t_imm_off_ldst_bh) X(arm7t_stack_off_ldst) X(arm7t_load_addr) \
+  X(arm7t_add_off_sp) X(arm7t_push_pop_reg) X(arm7t_mult_ldst) X(arm7t_cond_branch) \
+  X(arm7t_soft_interrupt) X(arm7t_branch) X(arm7t_long_branch_link) X(arm7t_unknown) \
+  X(arm9t_hi_reg_op) X(arm9t_pc_rel_ldst) X(arm9t_reg_off_ldst) X(arm9t_imm_off_ldst) \
+  X(arm9t_stack_off_ldst) X(arm9t_push_pop_reg) X(arm9t_mult_ldst)
+
+#define ARM_THREADED_ENUM(H) ARM_THREADED_##H,
+#define ARM_THREADED_FN(H) H,
+enum{
+  ARM_THREADED_HANDLERS(ARM_THREADED_ENUM)
+  ARM_THREADED_SKIP,    // Condition code failed, only the pipeline advances
+  ARM_THREADED_EXIT,    // Leave the threaded interpreter
+};
+static const arm7_handler_t arm_threaded_handlers[]={ARM_THREADED_HANDLERS(ARM_THREADED_FN)};
+// Handler index for each lookup table key, [0] for the ARM7 and [1] for the ARM9
+static uint8_t arm_threaded_arm_index[2][4096];
+static uint8_t arm_threaded_thumb_index[2][256];
+
+static FORCE_INLINE void arm7_compute_flags(arm7_t* cpu){
+  uint32_t cpsr = cpu->registers[CPSR];
+  int flags = cpu->lazy_flags;
+  if(flags&ARM7_LAZY_NZ){
+    uint32_t result = cpu->lazy_nz_result;
+    cpsr = (cpsr&0x3fffffff)|(result&0x80000000)|((result==0)<<30);
+  }
+  if(flags&(ARM7_LAZY_ADD|ARM7_LAZY_SUB)){
+    uint64_t a = cpu->lazy_cv_a;
+    uint64_t b = cpu->lazy_cv_b;
+    uint64_t result = cpu->lazy_cv_result;
+    bool C,V;
+    if(flags&ARM7_LAZY_ADD){
+      C = ARM7_BFE(result,32,1);
+      // if (b has the same sign as a and result has a different sign to b)
+      V = (((b ^ ~a) & (b ^ result)) >> 31)&1;
+    }else{
+      C = !ARM7_BFE(result,32,1);
+      // if (a has a different sign as b and result has a differnt sign to a)
+      V = (((a ^ b) & (a ^ result)) >> 31)&1;
+    }
+    cpsr = (cpsr&0xcfffffff)|(C<<29)|(V<<28);
+  }
+  if(flags&ARM7_LAZY_C)cpsr = (cpsr&~(1u<<29))|(cpu->lazy_c<<29);
+  cpu->registers[CPSR] = cpsr;
+  cpu->lazy_flags = 0;
+}
+static NO_INLINE void arm7_compute_flags_slow(arm7_t* cpu){arm7_compute_flags(cpu);}
+static FORCE_INLINE void arm7_flush_flags(arm7_t* cpu){
+  if(SB_UNLIKELY(cpu->lazy_flags))arm7_compute_flags_slow(cpu);
+}
+static FORCE_INLINE bool arm7_get_carry_flag(arm7_t* cpu){
+  arm7_flush_flags(cpu);
+  return ARM7_BFE(cpu->registers[CPSR],29,1);
+}
+// N and Z of a logical op, carry is the barrel shifter carry out or -1 if C is unchanged. V is kept.
+static FORCE_INLINE void arm7_set_logic_flags(arm7_t* cpu, uint32_t result, int carry){
+  cpu->lazy_nz_result = result;
+  cpu->lazy_flags|= ARM7_LAZY_NZ;
+  if(carry!=-1){
+    cpu->lazy_c = carry;
+    cpu->lazy_flags|= ARM7_LAZY_C;
+  }
+  if(!ARM7_LAZY_FLAGS)arm7_compute_flags(cpu);
+}
+// NZCV of a+b(+carry)=result or a-b(-borrow)=result where result still has the carry out in bit 32
+static FORCE_INLINE void arm7_set_arith_flags(arm7_t* cpu, int op, uint32_t a, uint32_t b, uint64_t result){
+  cpu->lazy_nz_result = result;
+  cpu->lazy_cv_a = a;
+  cpu->lazy_cv_b = b;
+  cpu->lazy_cv_result = result;
+  cpu->lazy_flags = ARM7_LAZY_NZ|op;
+  if(!ARM7_LAZY_FLAGS)arm7_compute_flags(cpu);
+}
+// Slots of R8-R14 of each mode (CPSR&0xf) in the 37 register layout, invalid modes use the user bank
+static const uint8_t arm7_bank_slots[16][7]={
+  { 8, 9,10,11,12,13,14}, //mode 0x0 (user)
+  {17,18,19,20,21,22,23}, //mode 0x1 (fiq)
+  { 8, 9,10,11,12,24,25}, //mode 0x2 (irq)
+  { 8, 9,10,11,12,26,27}, //mode 0x3 (svc)
+  { 8, 9,10,11,12,13,14}, //mode 0x4 (inv)
+  { 8, 9,10,11,12,13,14}, //mode 0x5 (inv)
+  { 8, 9,10,11,12,13,14}, //mode 0x6 (inv)
+  { 8, 9,10,11,12,28,29}, //mode 0x7 (abt)
+  { 8, 9,10,11,12,13,14}, //mode 0x8 (inv)
+  { 8, 9,10,11,12,13,14}, //mode 0x9 (inv)
+  { 8, 9,10,11,12,13,14}, //mode 0xA (inv)
+  { 8, 9,10,11,12,30,31}, //mode 0xB (undefined)
+  { 8, 9,10,11,12,13,14}, //mode 0xC (inv)
+  { 8, 9,10,11,12,13,14}, //mode 0xD (inv)
+  { 8, 9,10,11,12,13,14}, //mode 0xE (inv)
+  { 8, 9,10,11,12,13,14}, //mode 0xF (system)
+};
+// Slot of the SPSR of each mode, user and system mode (and invalid modes) have none and use the CPSR
+static const uint8_t arm7_spsr_slots[16]={16,32,33,34,16,16,16,35,16,16,16,36,16,16,16,16};
+
+static NO_INLINE void arm7_switch_bank(arm7_t* cpu, int mode){
+  if(!((0x888F>>mode)&1)){
+    cpu->trigger_breakpoint=true;
+    printf("Undefined ARM mode: %d\n",mode);
+  }
+  const uint8_t* from = arm7_bank_slots[cpu->active_bank];
+  const uint8_t* to = arm7_bank_slots[mode];
+  uint32_t* r = cpu->registers;
+  for(int i=0;i<7;++i){
+    if(from[i]==to[i])continue;
+    // Put the active register back into its slot, then bring in the one of the new mode. The user
+    // register that was swapped out ends up in the slot of the new mode until it is swapped back. 
+    uint32_t t = r[8+i]; r[8+i] = r[from[i]]; r[from[i]] = t;
+    t = r[8+i]; r[8+i] = r[to[i]]; r[to[i]] = t;
+  }
+  cpu->active_bank = mode;
+}
+static FORCE_INLINE void arm7_update_bank(arm7_t* cpu){
+  int mode = cpu->registers[CPSR]&0xf;
+  if(SB_UNLIKELY(mode!=cpu->active_bank))arm7_switch_bank(cpu,mode);
+}
+static void arm7_unbank_registers(arm7_t* cpu){
+  if(cpu->active_bank!=0)arm7_switch_bank(cpu,0);
+}
+// Writes the CPSR and swaps in the register bank of the new mode
+static FORCE_INLINE void arm7_write_cpsr(arm7_t* cpu, uint32_t value){
+  cpu->registers[CPSR] = value;
+  arm7_update_bank(cpu);
+}
+static FORCE_INLINE unsigned arm7_reg_index(arm7_t* cpu, unsigned reg){
+  // R0-R15 of the current mode are always in registers[0-15] 
+  if(SB_LIKELY(reg<=CPSR))return reg;
+  return arm7_spsr_slots[cpu->registers[CPSR]&0xf];
 }
 static FORCE_INLINE void arm7_reg_write(arm7_t*cpu, unsigned reg, uint32_t value){
-  cpu->registers[arm7_reg_index(cpu,reg)] = value;
+  if(SB_UNLIKELY(reg>=CPSR)){
+    arm7_flush_flags(cpu);
+    unsigned index = arm7_reg_index(cpu,reg);
+    cpu->registers[index] = value;
+    if(index==CPSR)arm7_update_bank(cpu);
+    return;
+  }
+  cpu->registers[reg] = value;
 } 
 static FORCE_INLINE void arm9_reg_write_r15_thumb(arm7_t*cpu, unsigned reg, uint32_t value){
-  cpu->registers[arm7_reg_index(cpu,reg)] = value;
+  arm7_reg_write(cpu,reg,value);
   if(SB_UNLIKELY(reg==PC))arm7_set_thumb_bit(cpu,value&1);
 } 
 static FORCE_INLINE uint32_t arm7_reg_read(arm7_t*cpu, unsigned reg){
-  return cpu->registers[arm7_reg_index(cpu,reg)];
+  if(SB_UNLIKELY(reg>=CPSR)){
+    arm7_flush_flags(cpu);
+    return cpu->registers[arm7_reg_index(cpu,reg)];
+  }
+  return cpu->registers[reg];
 }
 static FORCE_INLINE uint32_t arm7_reg_read_r15_adj(arm7_t*cpu, unsigned reg, int r15_off){
   uint32_t v = arm7_reg_read(cpu,reg);
@@ -564,6 +988,24 @@ static arm7_t arm7_init(void* user_data){
     arm9t_lookup_table[i]=inst_class==-1 ? NULL: arm9t_instruction_classes[inst_class].handler;
     arm9t_disasm_lookup_table[i]=inst_class==-1? NULL: arm9t_instruction_classes[inst_class].name;
   }
+  // Map the lookup tables to threaded interpreter labels
+  arm7_handler_t* tables[4]={arm7_lookup_table,arm9_lookup_table,arm7t_lookup_table,arm9t_lookup_table};
+  uint8_t* indices[4]={arm_threaded_arm_index[0],arm_threaded_arm_index[1],arm_threaded_thumb_index[0],arm_threaded_thumb_index[1]};
+  for(int t=0;t<4;++t){
+    for(int i=0;i<(t<2?4096:256);++i){
+      indices[t][i]=ARM_THREADED_EXIT;
+      for(int h=0;h<sizeof(arm_threaded_handlers)/sizeof(arm_threaded_handlers[0]);++h){
+        if(arm_threaded_handlers[h]==tables[t][i]){indices[t][i]=h;break;}
+      }
+    }
+  }
+#if ARM7_SPECIALIZED_HANDLERS
+  // The threaded interpreter has one label per class so this comes after its tables are built
+  const arm7_handler_t* specialized[4]={arm7_specialized_lookup_table,arm9_specialized_lookup_table,arm7t_specialized_lookup_table,arm9t_specialized_lookup_table};
+  for(int t=0;t<4;++t){
+    for(int i=0;i<(t<2?4096:256);++i)if(tables[t][i])tables[t][i]=specialized[t][i];
+  }
+#endif
   arm7_t arm = {.user_data = user_data};
   arm.prefetch_pc=-1;
   return arm;
@@ -577,18 +1019,18 @@ static FORCE_INLINE void arm7_set_thumb_bit(arm7_t* cpu, bool value){
 static FORCE_INLINE void arm7_process_interrupts(arm7_t* cpu, uint32_t interrupts){
   cpu->wait_for_interrupt=false;
   if(cpu->log_cmp_file||interrupts==0)return; //Log drives interrupts when enabled
+  arm7_flush_flags(cpu);
   uint32_t cpsr = cpu->registers[CPSR];
   bool I = ARM7_BFE(cpsr,7,1);
   if(I==0){
     //Interrupts are enabled when I ==0
     bool thumb = arm7_get_thumb_bit(cpu);
-    cpu->registers[R14_irq] = cpu->registers[PC]+4;
+    uint32_t lr = cpu->registers[PC]+4;
     cpu->registers[PC] = cpu->irq_table_address+ 0x18; 
     cpu->registers[SPSR_irq] = cpsr;
-    //Update mode to IRQ
-    cpu->registers[CPSR] = (cpsr&0xffffffE0)| 0x12;
-    //Disable interrupts(set I bit)
-    cpu->registers[CPSR] |= 1<<7;
+    //Update mode to IRQ and disable interrupts(set I bit)
+    arm7_write_cpsr(cpu,(cpsr&0xffffffE0)| 0x12|0x80);
+    cpu->registers[LR] = lr;
     cpu->i_cycles=1;
     arm7_set_thumb_bit(cpu,false); 
   }
@@ -656,6 +1098,7 @@ static void arm9_get_disasm(arm7_t * cpu, uint32_t mem_address, char* out_disasm
 static FORCE_INLINE bool arm7_check_cond_code(arm7_t *cpu, uint32_t opcode){
   uint32_t cond_code = ARM7_BFE(opcode,28,4);
   if(SB_LIKELY(cond_code==0xE))return true;
+  if(cpu->lazy_flags)arm7_compute_flags(cpu);
   uint32_t cpsr = cpu->registers[CPSR];
   bool N = ARM7_BFE(cpsr,31,1);
   bool Z = ARM7_BFE(cpsr,30,1);
@@ -780,6 +1223,202 @@ static void arm_check_log_file(arm7_t*cpu){
   }
   cpu->executed_instructions++;
 }
+static void arm7_bind_bus_handlers(arm7_t* cpu, const arm7_handler_t* arm_handlers, const arm7_handler_t* thumb_handlers){
+  cpu->arm_handlers = arm_handlers;
+  cpu->thumb_handlers = thumb_handlers;
+}
+// Checks the body of the candidate loop against the registers of the last arrival at its head. Load
+// addresses must only depend on registers the body doesn't write before the load.
+static bool arm7_idle_loop_body_ok(arm7_t* cpu, arm7_idle_loop_t* idle, arm7_idle_read_fn_t read_ok){
+  bool thumb = idle->thumb;
+  uint32_t size = thumb? 2: 4;
+  uint32_t bytes = 0;
+  const uint8_t* host = cpu->code_ptr? cpu->code_ptr(cpu->user_data,idle->head,&bytes): NULL;
+  if(!host||bytes<idle->branch-idle->head+size){idle->code_rejected=true;return false;}
+  const uint32_t* r = idle->registers;
+  uint32_t written = 0;
+  for(uint32_t offset=0;offset<=idle->branch-idle->head;offset+=size){
+    uint32_t pc = idle->head+offset;
+    bool last = pc==idle->branch;
+    int rd = -1;
+    int load_size = 0;
+    uint32_t load_regs = 0;
+    uint32_t address = 0;
+    bool allowed = true;
+    if(thumb){
+      uint16_t op = *(uint16_t*)(host+offset);
+      if(last){
+        // Conditional branch or B
+        allowed = ((op>>12)==0xD&&((op>>8)&0xf)<0xE)||(op>>11)==0x1C;
+      }else switch(op>>11){
+        case 0x00: case 0x01: case 0x02: case 0x03: rd = op&7; break; // Shift by immediate, ADD/SUB
+        case 0x04: case 0x05: case 0x06: case 0x07: rd = (op>>8)&7; break; // MOV/CMP/ADD/SUB immediate
+        case 0x08:
+          if(!(op&(1<<10))){rd = op&7; break;} // ALU op
+          // Hi register ops other than BX/BLX
+          if(((op>>8)&3)==3){allowed=false;break;}
+          if(((op>>8)&3)!=1)rd = (op&7)|((op>>4)&8);
+          break;
+        case 0x09: // LDR PC relative
+          rd = (op>>8)&7; load_size = 4; address = ((pc+4)&~3)+(op&0xff)*4;
+          break;
+        case 0x0A: case 0x0B:{ // Load with register offset
+          int Rb = (op>>3)&7, Ro = (op>>6)&7;
+          if(!(op&(1<<9))){
+            if(!(op&(1<<11))){allowed=false;break;}
+            load_size = op&(1<<10)? 1: 4;
+          }else{
+            int h = (op>>10)&3;
+            if(h==0){allowed=false;break;}
+            load_size = h==2? 2: h==1? 1: 2;
+          }
+          rd = op&7; load_regs = (1<<Rb)|(1<<Ro); address = r[Rb]+r[Ro];
+          break;
+        }
+        case 0x0D: case 0x0F:{ // LDR/LDRB immediate offset
+          int Rb = (op>>3)&7;
+          bool B = op&(1<<12);
+          rd = op&7; load_size = B? 1: 4; load_regs = 1<<Rb; address = r[Rb]+((op>>6)&31)*load_size;
+          break;
+        }
+        case 0x11:{ // LDRH immediate offset
+          int Rb = (op>>3)&7;
+          rd = op&7; load_size = 2; load_regs = 1<<Rb; address = r[Rb]+((op>>6)&31)*2;
+          break;
+        }
+        case 0x13: // LDR SP relative
+          rd = (op>>8)&7; load_size = 4; load_regs = 1<<13; address = r[13]+(op&0xff)*4;
+          break;
+        case 0x14: case 0x15: rd = (op>>8)&7; break; // ADD Rd, PC/SP
+        case 0x16: if((op>>8)==0xB0)rd = 13; else allowed = false; break; // ADD SP, imm
+        default: allowed = false; break;
+      }
+    }else{
+      uint32_t op = *(uint32_t*)(host+offset);
+      if((op>>28)==0xF)allowed = false;
+      else if(last)allowed = ((op>>24)&0xf)==0xA; // B (without link)
+      else if(((op>>26)&3)==0){
+        if(!(op&(1<<25))&&(op&0x90)==0x90){
+          // Halfword and signed loads without writeback (no multiplies, swaps or stores)
+          int sh = (op>>5)&3;
+          if(sh==0||!(op&(1<<20))||!(op&(1<<24))||(op&(1<<21))){allowed=false;}
+          else{
+            int Rn = (op>>16)&15;
+            uint32_t offset = op&(1<<22)? ((op>>4)&0xf0)|(op&0xf): r[op&15];
+            if(!(op&(1<<22)))load_regs|= 1<<(op&15);
+            rd = (op>>12)&15; load_size = sh==2? 1: 2; load_regs|= 1<<Rn;
+            address = (Rn==PC? pc+8: r[Rn]) + (op&(1<<23)? offset: -offset);
+          }
+        }else{
+          // Data processing, MRS/MSR/BX and the other ops in the TST/TEQ/CMP/CMN space without S aren't allowed
+          int opcode = (op>>21)&15;
+          bool test = opcode>=8&&opcode<=11;
+          if(test&&!(op&(1<<20)))allowed = false;
+          else if(!test)rd = (op>>12)&15;
+        }
+      }else if(((op>>26)&3)==1){
+        // LDR/LDRB with an immediate or unshifted register offset and without writeback
+        if(!(op&(1<<20))||!(op&(1<<24))||(op&(1<<21))||((op&(1<<25))&&(op&0xff0)))allowed = false;
+        else{
+          int Rn = (op>>16)&15;
+          uint32_t offset = op&(1<<25)? r[op&15]: op&0xfff;
+          if(op&(1<<25))load_regs|= 1<<(op&15);
+          rd = (op>>12)&15; load_size = op&(1<<22)? 1: 4; load_regs|= 1<<Rn;
+          address = (Rn==PC? pc+8: r[Rn]) + (op&(1<<23)? offset: -offset);
+        }
+      }else allowed = false;
+    }
+    if(!allowed||rd==PC||(load_regs&written)){idle->code_rejected=true;return false;}
+    if(load_size&&!read_ok(cpu->user_data,address&~(load_size-1),load_size))return false;
+    if(rd>=0)written|= 1<<rd;
+  }
+  return true;
+}
+static NO_INLINE bool arm7_idle_loop_check(arm7_t* cpu, arm7_idle_loop_t* idle, uint32_t branch_pc, uint64_t clock, arm7_idle_read_fn_t read_ok){
+  uint32_t head = cpu->registers[PC];
+  bool thumb = arm7_get_thumb_bit(cpu);
+  bool same_loop = idle->head==head&&idle->branch==branch_pc&&idle->thumb==thumb;
+  if(!same_loop){
+    idle->head = head;
+    idle->branch = branch_pc;
+    idle->thumb = thumb;
+    idle->code_rejected = false;
+  }
+  bool was_confirmed = idle->confirmed;
+  idle->confirmed = false;
+  if(idle->code_rejected)return false;
+  uint64_t iteration = clock-idle->clock;
+  idle->clock = clock;
+  arm7_flush_flags(cpu);
+  if(same_loop&&!memcmp(idle->registers,cpu->registers,sizeof(idle->registers))){
+    // The body was checked with these registers on the last arrival
+    // An iteration that took longer than the one before had an IRQ or DMA in it, which may have changed
+    // what the loop polls, so the loop is only idle after two iterations with the same timing.
+    bool same_timing = iteration==idle->iteration_clocks;
+    idle->iteration_clocks = iteration;
+    if(!idle->body_ok||!same_timing||!iteration||iteration>ARM7_IDLE_LOOP_MAX_CLOCKS)return false;
+    idle->confirmed = true;
+    if(!was_confirmed)idle->loops_detected++;
+    idle->last_head = head;
+    return true;
+  }
+  memcpy(idle->registers,cpu->registers,sizeof(idle->registers));
+  idle->body_ok = (idle->override_head&&head==idle->override_head)||arm7_idle_loop_body_ok(cpu,idle,read_ok);
+  return false;
+}
+static FORCE_INLINE bool arm7_idle_loop_arrival(arm7_t* cpu, arm7_idle_loop_t* idle, uint32_t branch_pc, uint64_t clock, arm7_idle_read_fn_t read_ok){
+  uint32_t head = cpu->registers[PC];
+  // Only backward branches (the pipeline was flushed) that are short or go to an overridden head
+  if(SB_LIKELY(branch_pc-head>=ARM7_IDLE_LOOP_MAX_BYTES&&(!idle->override_head||head!=idle->override_head)))return false;
+  if(cpu->prefetch_pc==head||idle->disabled)return false;
+  return arm7_idle_loop_check(cpu,idle,branch_pc,clock,read_ok);
+}
+static void arm7_idle_loop_apply_override(arm7_idle_loop_t* idle, const arm7_idle_loop_override_t* overrides, int count, const uint8_t game_code[4]){
+  for(int i=0;i<count;++i){
+    if(!overrides[i].game_code[0]||memcmp(overrides[i].game_code,game_code,4))continue;
+    idle->override_head = overrides[i].head;
+    idle->disabled = overrides[i].disabled;
+    printf("Applied idle loop override for %.4s (head: %08x%s)\n",overrides[i].game_code,overrides[i].head,overrides[i].disabled?", disabled":"");
+    return;
+  }
+}
+static void arm7_idle_loop_skip(arm7_idle_loop_t* idle, uint64_t clocks){
+  idle->clock+= clocks;
+  idle->clocks_skipped+= clocks;
+}
+static void arm7_code_window_flush(arm7_t* cpu){
+  cpu->code_window_size = cpu->code_window_miss_size = 0;
+}
+static NO_INLINE uint32_t arm7_code_window_miss(arm7_t* cpu, uint32_t address, bool thumb, bool seq){
+  if(cpu->code_ptr&&address-cpu->code_window_miss_start>=cpu->code_window_miss_size){
+    uint32_t start = address&~3;
+    uint32_t bytes = 0;
+    const uint8_t* host = cpu->code_ptr(cpu->user_data,start,&bytes);
+    if(host&&bytes>=4){
+      cpu->code_window_host = host;
+      cpu->code_window_start = start;
+      cpu->code_window_size = bytes&~3;
+      cpu->cached_fetch(cpu->user_data,address,host+(address-start),thumb,seq);
+      host+= (address&(thumb?~1:~3))-start;
+      return thumb? *(uint16_t*)host: *(uint32_t*)host;
+    }
+    // Remember the unmapped range (BIOS, MMIO, ...) so its fetches go straight to the callbacks
+    cpu->code_window_miss_start = start;
+    cpu->code_window_miss_size = host||!bytes? 4: bytes;
+  }
+  return thumb? cpu->read16_seq(cpu->user_data,address,seq): cpu->read32_seq(cpu->user_data,address,seq);
+}
+// Pipeline fetch, served from the code window when possible
+static FORCE_INLINE uint32_t arm7_fetch_opcode(arm7_t* cpu, uint32_t address, bool thumb, bool seq){
+  uint32_t offset = address-cpu->code_window_start;
+  if(SB_LIKELY(offset<cpu->code_window_size)){
+    cpu->cached_fetch(cpu->user_data,address,cpu->code_window_host+offset,thumb,seq);
+    // Opcode fetches are aligned like any other bus read (the PC can be misaligned on the ARM9)
+    const uint8_t* host = cpu->code_window_host+(offset&(thumb?~1:~3));
+    return thumb? *(uint16_t*)host: *(uint32_t*)host;
+  }
+  return arm7_code_window_miss(cpu,address,thumb,seq);
+}
 static void arm9_exec_instruction(arm7_t* cpu){
   if(cpu->wait_for_interrupt){
     cpu->i_cycles=1; 
@@ -789,14 +1428,14 @@ static void arm9_exec_instruction(arm7_t* cpu){
   if(cpu->prefetch_pc!=cpu->registers[PC]){
     if(thumb){
       cpu->registers[PC]&=~1;
-      cpu->prefetch_opcode[0]=cpu->read16_seq(cpu->user_data,cpu->registers[PC],false);
-      cpu->prefetch_opcode[1]=cpu->read16_seq(cpu->user_data,cpu->registers[PC]+2,true);
-      cpu->prefetch_opcode[2]=cpu->read16_seq(cpu->user_data,cpu->registers[PC]+4,true);
+      cpu->prefetch_opcode[0]=arm7_fetch_opcode(cpu,cpu->registers[PC],true,false);
+      cpu->prefetch_opcode[1]=arm7_fetch_opcode(cpu,cpu->registers[PC]+2,true,true);
+      cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+4,true,true);
     }else{
       cpu->registers[PC]&=~3;
-      cpu->prefetch_opcode[0]=cpu->read32_seq(cpu->user_data,cpu->registers[PC],false);
-      cpu->prefetch_opcode[1]=cpu->read32_seq(cpu->user_data,cpu->registers[PC]+4,true);
-      cpu->prefetch_opcode[2]=cpu->read32_seq(cpu->user_data,cpu->registers[PC]+8,true);
+      cpu->prefetch_opcode[0]=arm7_fetch_opcode(cpu,cpu->registers[PC],false,false);
+      cpu->prefetch_opcode[1]=arm7_fetch_opcode(cpu,cpu->registers[PC]+4,false,true);
+      cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+8,false,true);
     }
     cpu->debug_branch_ring[(cpu->debug_branch_ring_offset++)%ARM_DEBUG_BRANCH_RING_SIZE]=cpu->registers[PC];
   }
@@ -814,17 +1453,17 @@ static void arm9_exec_instruction(arm7_t* cpu){
     cpu->prefetch_pc = cpu->registers[PC];
     if(arm7_check_cond_code(cpu,opcode)){
       uint32_t key = ((opcode>>4)&0xf)| ((opcode>>16)&0xff0);
-      arm9_lookup_table[key](cpu,opcode);
+      (cpu->arm_handlers? cpu->arm_handlers: arm9_lookup_table)[key](cpu,opcode);
     }
     //Simulate the pipelined fetch(this needs to be here since the other HW state should be computed after the instruction fetch)
-    if(cpu->prefetch_pc==cpu->registers[PC])cpu->prefetch_opcode[2] =cpu->read32_seq(cpu->user_data,cpu->registers[PC]+8,cpu->next_fetch_sequential);
+    if(cpu->prefetch_pc==cpu->registers[PC])cpu->prefetch_opcode[2] =arm7_fetch_opcode(cpu,cpu->registers[PC]+8,false,cpu->next_fetch_sequential);
   }else{
     cpu->registers[PC] += 2;
     cpu->prefetch_pc = cpu->registers[PC];
     uint32_t key = ((opcode>>8)&0xff);
-    arm9t_lookup_table[key](cpu,opcode);
+    (cpu->thumb_handlers? cpu->thumb_handlers: arm9t_lookup_table)[key](cpu,opcode);
     //Simulate the pipelined fetch(this needs to be here since the other HW state should be computed after the instruction fetch)
-    if(cpu->prefetch_pc==cpu->registers[PC])cpu->prefetch_opcode[2]=cpu->read16_seq(cpu->user_data,cpu->registers[PC]+4,cpu->next_fetch_sequential);
+    if(cpu->prefetch_pc==cpu->registers[PC])cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+4,true,cpu->next_fetch_sequential);
   }
   if(SB_UNLIKELY(cpu->step_instructions)){
     --cpu->step_instructions;
@@ -843,14 +1482,14 @@ static FORCE_INLINE void arm7_exec_instruction(arm7_t* cpu){
   if(SB_UNLIKELY(cpu->prefetch_pc!=cpu->registers[PC])){
     if(thumb){
       cpu->registers[PC]&=~1;
-      cpu->prefetch_opcode[0]=cpu->read16_seq(cpu->user_data,cpu->registers[PC],false);
-      cpu->prefetch_opcode[1]=cpu->read16_seq(cpu->user_data,cpu->registers[PC]+2,true);
-      cpu->prefetch_opcode[2]=cpu->read16_seq(cpu->user_data,cpu->registers[PC]+4,true);
+      cpu->prefetch_opcode[0]=arm7_fetch_opcode(cpu,cpu->registers[PC],true,false);
+      cpu->prefetch_opcode[1]=arm7_fetch_opcode(cpu,cpu->registers[PC]+2,true,true);
+      cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+4,true,true);
     }else{
       cpu->registers[PC]&=~3;
-      cpu->prefetch_opcode[0]=cpu->read32_seq(cpu->user_data,cpu->registers[PC],false);
-      cpu->prefetch_opcode[1]=cpu->read32_seq(cpu->user_data,cpu->registers[PC]+4,true);
-      cpu->prefetch_opcode[2]=cpu->read32_seq(cpu->user_data,cpu->registers[PC]+8,true);
+      cpu->prefetch_opcode[0]=arm7_fetch_opcode(cpu,cpu->registers[PC],false,false);
+      cpu->prefetch_opcode[1]=arm7_fetch_opcode(cpu,cpu->registers[PC]+4,false,true);
+      cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+8,false,true);
     }
     cpu->debug_branch_ring[(cpu->debug_branch_ring_offset++)%ARM_DEBUG_BRANCH_RING_SIZE]=cpu->registers[PC];
   }
@@ -864,23 +1503,314 @@ static FORCE_INLINE void arm7_exec_instruction(arm7_t* cpu){
     cpu->prefetch_pc = cpu->registers[PC];
     if(SB_LIKELY(arm7_check_cond_code(cpu,opcode))){
       uint32_t key = ((opcode>>4)&0xf)| ((opcode>>16)&0xff0);
-    	arm7_lookup_table[key](cpu,opcode);
+    	(cpu->arm_handlers? cpu->arm_handlers: arm7_lookup_table)[key](cpu,opcode);
     }
     //Simulate the pipelined fetch(this needs to be here since the other HW state should be computed after the instruction fetch)
-    if(SB_LIKELY(cpu->prefetch_pc==cpu->registers[PC]))cpu->prefetch_opcode[2] =cpu->read32_seq(cpu->user_data,cpu->registers[PC]+8,cpu->next_fetch_sequential);
+    if(SB_LIKELY(cpu->prefetch_pc==cpu->registers[PC]))cpu->prefetch_opcode[2] =arm7_fetch_opcode(cpu,cpu->registers[PC]+8,false,cpu->next_fetch_sequential);
   }else{
     cpu->registers[PC] += 2;
     cpu->prefetch_pc = cpu->registers[PC];
     uint32_t key = ((opcode>>8)&0xff);
-    arm7t_lookup_table[key](cpu,opcode);
+    (cpu->thumb_handlers? cpu->thumb_handlers: arm7t_lookup_table)[key](cpu,opcode);
     //Simulate the pipelined fetch(this needs to be here since the other HW state should be computed after the instruction fetch)
-    if(SB_LIKELY(cpu->prefetch_pc==cpu->registers[PC]))cpu->prefetch_opcode[2]=cpu->read16_seq(cpu->user_data,cpu->registers[PC]+4,cpu->next_fetch_sequential);
+    if(SB_LIKELY(cpu->prefetch_pc==cpu->registers[PC]))cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+4,true,cpu->next_fetch_sequential);
   }
   if(SB_UNLIKELY(cpu->step_instructions)){
     --cpu->step_instructions;
     if(cpu->step_instructions==0)cpu->trigger_breakpoint =true;
   }
 }
+static FORCE_INLINE uint32_t arm7_block_page(const void* host_ptr){
+  return (((uintptr_t)host_ptr)/ARM7_BLOCK_PAGE_SIZE)&(ARM7_BLOCK_PAGE_TABLE_SIZE-1);
+}
+static void arm7_block_cache_flush(arm7_block_cache_t* cache){
+  if(!cache)return;
+  if(++cache->epoch==0)cache->epoch=1;
+  cache->current=NULL;
+  for(int i=0;i<3;++i)cache->pipeline[i]=NULL;
+}
+static FORCE_INLINE void arm7_block_cache_invalidate(arm7_block_cache_t* cache, const void* host_ptr){
+  if(cache)cache->page_gen[arm7_block_page(host_ptr)]++;
+}
+static void arm7_block_cache_invalidate_range(arm7_block_cache_t* cache, const void* host_ptr, size_t bytes){
+  if(!cache||!bytes)return;
+  uintptr_t first = ((uintptr_t)host_ptr)/ARM7_BLOCK_PAGE_SIZE;
+  uintptr_t pages = (((uintptr_t)host_ptr)+bytes-1)/ARM7_BLOCK_PAGE_SIZE-first+1;
+  if(pages>ARM7_BLOCK_PAGE_TABLE_SIZE)pages=ARM7_BLOCK_PAGE_TABLE_SIZE;
+  for(uintptr_t p=0;p<pages;++p)cache->page_gen[(first+p)&(ARM7_BLOCK_PAGE_TABLE_SIZE-1)]++;
+}
+static FORCE_INLINE bool arm7_block_is_valid(arm7_block_cache_t* cache, arm7_block_t* block){
+  return block->epoch==cache->epoch&&block->page_gen==cache->page_gen[block->page];
+}
+// ARM7_FUSE_* pair of the Thumb opcodes a and b
+static int arm7t_fusion_kind(uint16_t a, uint16_t b){
+  // Condition 0xE is undefined and 0xF is SWI
+  if(((a&0xF800)==0x2800||(a&0xFFC0)==0x4280)&&(b&0xF000)==0xD000&&ARM7_BFE(b,8,4)<0xE)return ARM7_FUSE_CMP_BCC;
+  int Rd = -1;
+  if((a&0xF800)==0x0000)Rd = ARM7_BFE(a,0,3);      // LSL Rd,Rs,#imm
+  else if((a&0xF800)==0x2000)Rd = ARM7_BFE(a,8,3); // MOV Rd,#imm
+  if(Rd!=-1){
+    if((b&0xFE00)==0x1800&&(ARM7_BFE(b,3,3)==Rd||ARM7_BFE(b,6,3)==Rd))return ARM7_FUSE_SHIFT_ADD;
+    // ADD with high registers, the PC is left to the regular handler
+    int hd = ARM7_BFE(b,0,3)|(ARM7_BFE(b,7,1)<<3), hs = ARM7_BFE(b,3,4);
+    if((b&0xFF00)==0x4400&&hd!=PC&&hs!=PC&&(hd==Rd||hs==Rd))return ARM7_FUSE_SHIFT_ADD;
+    return ARM7_FUSE_NONE;
+  }
+  // LDR Rd,[Rb,#imm] pairs where the first doesn't overwrite Rb, and LDR Rd,[SP,#imm] pairs
+  if((a&0xF800)==0x6800&&(b&0xF800)==0x6800&&ARM7_BFE(a,3,3)==ARM7_BFE(b,3,3)&&ARM7_BFE(a,0,3)!=ARM7_BFE(a,3,3))return ARM7_FUSE_LDR_LDR;
+  if((a&0xF800)==0x9800&&(b&0xF800)==0x9800)return ARM7_FUSE_LDR_LDR;
+  if((a&0xF800)==0xF000&&(b&0xF800)==0xF800)return ARM7_FUSE_BL;
+  return ARM7_FUSE_NONE;
+}
+static arm7_block_t* arm7_block_lookup(arm7_t* cpu, uint32_t pc, bool thumb, const arm7_handler_t* arm_table, const arm7_handler_t* thumb_table){
+  arm7_block_cache_t* cache = cpu->block_cache;
+  uint32_t index = ((pc>>1)^(pc>>13)^thumb)&(ARM7_BLOCK_CACHE_SIZE-1);
+  arm7_block_t* block = &cache->blocks[index];
+  if(block->start_pc==pc&&block->thumb==thumb&&arm7_block_is_valid(cache,block)){
+    cache->hits++;
+    return block;
+  }
+  uint32_t bytes = 0;
+  const uint8_t* host = cpu->code_ptr(cpu->user_data,pc,&bytes);
+  block->start_pc = pc;
+  block->thumb = thumb;
+  block->epoch = cache->epoch;
+  block->host = host;
+  block->page = arm7_block_page(host);
+  block->page_gen = cache->page_gen[block->page];
+  block->build = ++cache->builds;
+  if(!host){
+    // Remember the uncacheable range so fetches from it fall through to the callbacks quickly
+    block->end_pc = pc+(bytes?bytes:1);
+    if(block->end_pc<pc)block->end_pc=0xffffffff;
+    return block;
+  }
+  uint32_t page_bytes = ARM7_BLOCK_PAGE_SIZE-(((uintptr_t)host)&(ARM7_BLOCK_PAGE_SIZE-1));
+  if(bytes>page_bytes)bytes=page_bytes;
+  int size = thumb?2:4;
+  int count = bytes/size;
+  if(count>ARM7_BLOCK_MAX_INSTRUCTIONS)count=ARM7_BLOCK_MAX_INSTRUCTIONS;
+  for(int i=0;i<count;++i){
+    arm7_decoded_op_t* op = &block->ops[i];
+    if(thumb){
+      op->opcode = *(uint16_t*)(host+i*2);
+      op->handler = thumb_table[(op->opcode>>8)&0xff];
+      op->always_execute = true;
+      op->thumb = true;
+    }else{
+      op->opcode = *(uint32_t*)(host+i*4);
+      op->handler = arm_table[((op->opcode>>4)&0xf)| ((op->opcode>>16)&0xff0)];
+      op->always_execute = ARM7_BFE(op->opcode,28,4)>=0xE;
+      op->thumb = false;
+    }
+    op->fusion = ARM7_FUSE_NONE;
+  }
+  if(thumb)for(int i=0;i+1<count;++i)block->ops[i].fusion = arm7t_fusion_kind(block->ops[i].opcode,block->ops[i+1].opcode);
+  block->end_pc = pc+count*size;
+  if(count==0)block->host=NULL;
+  return block;
+}
+// Returns the decoded op for the fetch or NULL if the fetch must go through the bus callbacks
+static FORCE_INLINE const arm7_decoded_op_t* arm7_block_fetch(arm7_t* cpu, uint32_t address, bool thumb, bool seq, const arm7_handler_t* arm_table, const arm7_handler_t* thumb_table){
+  arm7_block_cache_t* cache = cpu->block_cache;
+  arm7_block_t* block = cache->current;
+  if(SB_UNLIKELY(!block||address-block->start_pc>=block->end_pc-block->start_pc||block->thumb!=thumb||!arm7_block_is_valid(cache,block))){
+    block = cache->current = arm7_block_lookup(cpu,address,thumb,arm_table,thumb_table);
+  }
+  if(!block->host)return NULL;
+  uint32_t offset = address-block->start_pc;
+  cpu->cached_fetch(cpu->user_data,address,block->host+offset,thumb,seq);
+  return &block->ops[offset>>(thumb?1:2)];
+}
+static FORCE_INLINE uint32_t arm7_block_fetch_opcode(arm7_t* cpu, uint32_t address, bool thumb, bool seq, int pipeline_slot, const arm7_handler_t* arm_table, const arm7_handler_t* thumb_table){
+  const arm7_decoded_op_t* op = arm7_block_fetch(cpu,address,thumb,seq,arm_table,thumb_table);
+  cpu->block_cache->pipeline[pipeline_slot]=op;
+  if(op)return op->opcode;
+  return thumb? cpu->read16_seq(cpu->user_data,address,seq): cpu->read32_seq(cpu->user_data,address,seq);
+}
+static FORCE_INLINE void arm_exec_cached_instruction(arm7_t* cpu, bool arm9, const arm7_handler_t* arm_table, const arm7_handler_t* thumb_table){
+  if(SB_UNLIKELY(cpu->wait_for_interrupt)){
+    cpu->i_cycles=1; 
+    return;
+  }
+  if(SB_UNLIKELY(cpu->log_cmp_file&&!arm9))arm_check_log_file(cpu);
+  arm7_block_cache_t* cache = cpu->block_cache;
+  bool thumb = arm7_get_thumb_bit(cpu);
+  if(SB_UNLIKELY(cpu->prefetch_pc!=cpu->registers[PC])){
+    cpu->registers[PC]&= thumb? ~1: ~3;
+    uint32_t pc = cpu->registers[PC];
+    int size = thumb? 2: 4;
+    cpu->prefetch_opcode[0]=arm7_block_fetch_opcode(cpu,pc,thumb,false,0,arm_table,thumb_table);
+    cpu->prefetch_opcode[1]=arm7_block_fetch_opcode(cpu,pc+size,thumb,true,1,arm_table,thumb_table);
+    cpu->prefetch_opcode[2]=arm7_block_fetch_opcode(cpu,pc+size*2,thumb,true,2,arm_table,thumb_table);
+    cpu->debug_branch_ring[(cpu->debug_branch_ring_offset++)%ARM_DEBUG_BRANCH_RING_SIZE]=cpu->registers[PC];
+  }
+  if(SB_UNLIKELY(cpu->log_cmp_file&&arm9)){
+    arm_check_log_file(cpu);
+    thumb = arm7_get_thumb_bit(cpu);
+  }
+
+  cpu->next_fetch_sequential=true;
+  uint32_t opcode = cpu->prefetch_opcode[0];
+  const arm7_decoded_op_t* op = cache->pipeline[0];
+  cpu->prefetch_opcode[0] = cpu->prefetch_opcode[1];
+  cpu->prefetch_opcode[1] = cpu->prefetch_opcode[2];
+  cache->pipeline[0] = cache->pipeline[1];
+  cache->pipeline[1] = cache->pipeline[2];
+  cache->pipeline[2] = NULL;
+  // The decoded op is only trusted if it still matches the opcode and mode in the pipeline, this keeps
+  // the cache correct when something else (log compare, MSR to the T bit, debugger) rewrote the pipeline. 
+  if(SB_UNLIKELY(op&&(op->opcode!=opcode||op->thumb!=thumb)))op=NULL;
+  if(thumb==false){
+    cpu->registers[PC] += 4;
+    cpu->prefetch_pc = cpu->registers[PC];
+    if(SB_LIKELY(op)){
+      if(SB_LIKELY(op->always_execute||arm7_check_cond_code(cpu,opcode)))op->handler(cpu,opcode);
+    }else if(SB_LIKELY(arm7_check_cond_code(cpu,opcode))){
+      uint32_t key = ((opcode>>4)&0xf)| ((opcode>>16)&0xff0);
+      arm_table[key](cpu,opcode);
+    }
+    if(SB_LIKELY(cpu->prefetch_pc==cpu->registers[PC]))cpu->prefetch_opcode[2]=arm7_block_fetch_opcode(cpu,cpu->registers[PC]+8,false,cpu->next_fetch_sequential,2,arm_table,thumb_table);
+  }else{
+    cpu->registers[PC] += 2;
+    cpu->prefetch_pc = cpu->registers[PC];
+    if(SB_LIKELY(op))op->handler(cpu,opcode);
+    else thumb_table[(opcode>>8)&0xff](cpu,opcode);
+    if(SB_LIKELY(cpu->prefetch_pc==cpu->registers[PC]))cpu->prefetch_opcode[2]=arm7_block_fetch_opcode(cpu,cpu->registers[PC]+4,true,cpu->next_fetch_sequential,2,arm_table,thumb_table);
+  }
+  if(SB_UNLIKELY(cpu->step_instructions)){
+    --cpu->step_instructions;
+    if(cpu->step_instructions==0)cpu->trigger_breakpoint =true;
+  }
+}
+static FORCE_INLINE void arm7_exec_cached_instruction(arm7_t* cpu){
+  arm_exec_cached_instruction(cpu,false,cpu->arm_handlers? cpu->arm_handlers: arm7_lookup_table,cpu->thumb_handlers? cpu->thumb_handlers: arm7t_lookup_table);
+}
+static void arm9_exec_cached_instruction(arm7_t* cpu){
+  arm_exec_cached_instruction(cpu,true,cpu->arm_handlers? cpu->arm_handlers: arm9_lookup_table,cpu->thumb_handlers? cpu->thumb_handlers: arm9t_lookup_table);
+}
+static FORCE_INLINE int arm_exec_cached_fused(arm7_t* cpu, bool arm9, arm7_boundary_fn_t boundary, void* ctx, const arm7_handler_t* arm_table, const arm7_handler_t* thumb_table){
+  arm7_block_cache_t* cache = cpu->block_cache;
+  const arm7_decoded_op_t* op = cache->pipeline[0];
+  int fusion = ARM7_FUSE_NONE;
+  // Only pairs decoded into the pipeline, and never when something looks at every instruction
+  if(op&&op->fusion&&op->opcode==cpu->prefetch_opcode[0]&&cpu->prefetch_pc==cpu->registers[PC]&&arm7_get_thumb_bit(cpu)&&
+     !cpu->wait_for_interrupt&&!cpu->log_cmp_file&&!cpu->step_instructions)fusion = op->fusion;
+  arm_exec_cached_instruction(cpu,arm9,arm_table,thumb_table);
+  if(SB_LIKELY(!fusion))return 1;
+  // The first op never branches, so the second one is next in the pipeline unless its block was rebuilt
+  const arm7_decoded_op_t* next = cache->pipeline[0];
+  if(SB_UNLIKELY(next!=op+1||next->opcode!=cpu->prefetch_opcode[0]||cpu->prefetch_pc!=cpu->registers[PC]))return 1;
+  if(!boundary(ctx)){
+    cache->fusion_fallbacks++;
+    return 0;
+  }
+  uint32_t opcode = cpu->prefetch_opcode[0];
+  cpu->next_fetch_sequential=true;
+  cpu->prefetch_opcode[0] = cpu->prefetch_opcode[1];
+  cpu->prefetch_opcode[1] = cpu->prefetch_opcode[2];
+  cache->pipeline[0] = cache->pipeline[1];
+  cache->pipeline[1] = cache->pipeline[2];
+  cache->pipeline[2] = NULL;
+  cpu->registers[PC] += 2;
+  cpu->prefetch_pc = cpu->registers[PC];
+  switch(fusion){
+    case ARM7_FUSE_CMP_BCC:   arm7t_fused_cmp_bcc(cpu,opcode); break;
+    case ARM7_FUSE_SHIFT_ADD: arm7t_fused_shift_add(cpu,opcode); break;
+    case ARM7_FUSE_BL:        arm7t_fused_bl(cpu,opcode); break;
+    default:                  next->handler(cpu,opcode); break;
+  }
+  cache->fused[fusion]++;
+  if(SB_LIKELY(cpu->prefetch_pc==cpu->registers[PC]))cpu->prefetch_opcode[2]=arm7_block_fetch_opcode(cpu,cpu->registers[PC]+4,true,cpu->next_fetch_sequential,2,arm_table,thumb_table);
+  return 2;
+}
+static int arm7_exec_cached_fused(arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx){
+  return arm_exec_cached_fused(cpu,false,boundary,ctx,cpu->arm_handlers? cpu->arm_handlers: arm7_lookup_table,cpu->thumb_handlers? cpu->thumb_handlers: arm7t_lookup_table);
+}
+static int arm9_exec_cached_fused(arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx){
+  return arm_exec_cached_fused(cpu,true,boundary,ctx,cpu->arm_handlers? cpu->arm_handlers: arm9_lookup_table,cpu->thumb_handlers? cpu->thumb_handlers: arm9t_lookup_table);
+}
+static NO_INLINE void arm_threaded_refill(arm7_t* cpu, bool thumb){
+  if(thumb){
+    cpu->registers[PC]&=~1;
+    cpu->prefetch_opcode[0]=arm7_fetch_opcode(cpu,cpu->registers[PC],true,false);
+    cpu->prefetch_opcode[1]=arm7_fetch_opcode(cpu,cpu->registers[PC]+2,true,true);
+    cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+4,true,true);
+  }else{
+    cpu->registers[PC]&=~3;
+    cpu->prefetch_opcode[0]=arm7_fetch_opcode(cpu,cpu->registers[PC],false,false);
+    cpu->prefetch_opcode[1]=arm7_fetch_opcode(cpu,cpu->registers[PC]+4,false,true);
+    cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+8,false,true);
+  }
+  cpu->debug_branch_ring[(cpu->debug_branch_ring_offset++)%ARM_DEBUG_BRANCH_RING_SIZE]=cpu->registers[PC];
+}
+// Start of arm7_exec_instruction up to the handler call, returns the handler index to run
+static FORCE_INLINE int arm_threaded_decode(arm7_t* cpu, bool arm9, bool* thumb, uint32_t* opcode){
+  bool t = arm7_get_thumb_bit(cpu);
+  if(SB_UNLIKELY(cpu->prefetch_pc!=cpu->registers[PC]))arm_threaded_refill(cpu,t);
+  uint32_t op = cpu->prefetch_opcode[0];
+  int index = t? arm_threaded_thumb_index[arm9][(op>>8)&0xff]: arm_threaded_arm_index[arm9][((op>>4)&0xf)|((op>>16)&0xff0)];
+  cpu->next_fetch_sequential=true;
+  cpu->prefetch_opcode[0] = cpu->prefetch_opcode[1];
+  cpu->prefetch_opcode[1] = cpu->prefetch_opcode[2];
+  cpu->registers[PC] += t? 2: 4;
+  cpu->prefetch_pc = cpu->registers[PC];
+  if(!t&&SB_UNLIKELY(!arm7_check_cond_code(cpu,op)))index = ARM_THREADED_SKIP;
+  *thumb = t;
+  *opcode = op;
+  return index;
+}
+// End of arm7_exec_instruction followed by the boundary and the start of the next instruction
+static FORCE_INLINE int arm_threaded_next(arm7_t* cpu, bool arm9, bool* thumb, uint32_t* opcode, arm7_boundary_fn_t boundary, void* ctx){
+  if(SB_LIKELY(cpu->prefetch_pc==cpu->registers[PC])){
+    if(*thumb)cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+4,true,cpu->next_fetch_sequential);
+    else cpu->prefetch_opcode[2]=arm7_fetch_opcode(cpu,cpu->registers[PC]+8,false,cpu->next_fetch_sequential);
+  }
+  if(SB_UNLIKELY(!boundary(ctx)||cpu->wait_for_interrupt))return ARM_THREADED_EXIT;
+  return arm_threaded_decode(cpu,arm9,thumb,opcode);
+}
+static FLATTEN bool arm_exec_threaded(arm7_t* cpu, bool arm9, arm7_boundary_fn_t boundary, void* ctx){
+  if(cpu->wait_for_interrupt||cpu->block_cache||cpu->log_cmp_file||cpu->step_instructions)return false;
+  bool thumb = arm7_get_thumb_bit(cpu);
+  uint32_t opcode = cpu->prefetch_opcode[0];
+  // Keys without a handler are left to the regular path
+  if(cpu->prefetch_pc==cpu->registers[PC]){
+    int index = thumb? arm_threaded_thumb_index[arm9][(opcode>>8)&0xff]: arm_threaded_arm_index[arm9][((opcode>>4)&0xf)|((opcode>>16)&0xff0)];
+    if(index==ARM_THREADED_EXIT)return false;
+  }
+  int next = arm_threaded_decode(cpu,arm9,&thumb,&opcode);
+#if ARM7_THREADED_COMPUTED_GOTO
+  #define ARM_THREADED_LABEL_ADDR(H) &&arm_threaded_label_##H,
+  #define ARM_THREADED_LABEL(H) arm_threaded_label_##H: H(cpu,opcode); \
+    next = arm_threaded_next(cpu,arm9,&thumb,&opcode,boundary,ctx); goto *labels[next];
+  static const void* labels[]={ARM_THREADED_HANDLERS(ARM_THREADED_LABEL_ADDR) &&arm_threaded_label_skip, &&arm_threaded_label_exit};
+  goto *labels[next];
+  ARM_THREADED_HANDLERS(ARM_THREADED_LABEL)
+  arm_threaded_label_skip:
+    next = arm_threaded_next(cpu,arm9,&thumb,&opcode,boundary,ctx); goto *labels[next];
+  arm_threaded_label_exit:
+    return true;
+  #undef ARM_THREADED_LABEL_ADDR
+  #undef ARM_THREADED_LABEL
+#else
+  #define ARM_THREADED_CASE(H) case ARM_THREADED_##H: H(cpu,opcode); break;
+  while(true){
+    switch(next){
+      ARM_THREADED_HANDLERS(ARM_THREADED_CASE)
+      case ARM_THREADED_SKIP: break;
+      default: return true;
+    }
+    next = arm_threaded_next(cpu,arm9,&thumb,&opcode,boundary,ctx);
+  }
+  #undef ARM_THREADED_CASE
+#endif
+}
+static bool arm7_exec_threaded(arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx){
+  return arm_exec_threaded(cpu,false,boundary,ctx);
+}
+static bool arm9_exec_threaded(arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx){
+  return arm_exec_threaded(cpu,true,boundary,ctx);
+}
 static FORCE_INLINE uint32_t arm7_rotr(uint32_t value, uint32_t rotate) {
   return ((uint64_t)value >> (rotate &31)) | ((uint64_t)value << (32-(rotate&31)));
 }
@@ -934,8 +1864,7 @@ static FORCE_INLINE uint32_t arm7_shift(arm7_t* arm, uint32_t opcode, uint64_t v
       break; 
     case 3: 
       if(shift_value==0){
-        uint32_t cpsr=arm->registers[CPSR];
-        int C = ARM7_BFE(cpsr,29,1); 
+        int C = arm7_get_carry_flag(arm); 
         //Rotate Extended (RRX)
         *carry = ARM7_BFE(value,0,1); value = (value>>1)|(C<<31);
 
@@ -989,9 +1918,9 @@ static FORCE_INLINE void arm7_data_processing(arm7_t* cpu, uint32_t opcode){
     /*SUB*/ case 2:  arm7_reg_write(cpu,Rd, result = Rn-Rm);     break;
     /*RSB*/ case 3:  arm7_reg_write(cpu,Rd, result = Rm-Rn);     break;
     /*ADD*/ case 4:  arm7_reg_write(cpu,Rd, result = Rn+Rm);     break;
-    /*ADC*/ case 5:  arm7_reg_write(cpu,Rd, result = Rn+Rm+ARM7_BFE(cpu->registers[CPSR],29,1));   break;
-    /*SBC*/ case 6:  arm7_reg_write(cpu,Rd, result = Rn-Rm+ARM7_BFE(cpu->registers[CPSR],29,1)-1); break;
-    /*RSC*/ case 7:  arm7_reg_write(cpu,Rd, result = Rm-Rn+ARM7_BFE(cpu->registers[CPSR],29,1)-1); break;
+    /*ADC*/ case 5:  arm7_reg_write(cpu,Rd, result = Rn+Rm+arm7_get_carry_flag(cpu));   break;
+    /*SBC*/ case 6:  arm7_reg_write(cpu,Rd, result = Rn-Rm+arm7_get_carry_flag(cpu)-1); break;
+    /*RSC*/ case 7:  arm7_reg_write(cpu,Rd, result = Rm-Rn+arm7_get_carry_flag(cpu)-1); break;
     /*TST*/ case 8:  result = Rn&Rm;     break;
     /*TEQ*/ case 9:  result = Rn^Rm;     break;
     /*CMP*/ case 10: result = Rn-Rm;     break;
@@ -1004,60 +1933,24 @@ static FORCE_INLINE void arm7_data_processing(arm7_t* cpu, uint32_t opcode){
   //Update flags
   if(S){
     //Rd is not valid for TST, TEQ, CMP, or CMN
-    {
-      uint32_t cpsr=cpu->registers[CPSR];
-      bool C = ARM7_BFE(cpsr,29,1);
-      bool N = ARM7_BFE(result,31,1);
-      bool Z = (result&0xffffffff)==0;
-      bool V = ARM7_BFE(cpsr,28,1);
-
-      switch(op){ 
-      // Logical Ops flags
-      /*AND*/ case 0:
-      /*EOR*/ case 1: 
-      /*TST*/ case 8: 
-      /*TEQ*/ case 9: 
-      /*ORR*/ case 12:
-      /*MOV*/ case 13:
-      /*BIC*/ case 14:
-      /*MVN*/ case 15: C = barrel_shifter_carry==-1? C: barrel_shifter_carry; break;
-
+    switch(op){ 
       /*SUB*/ case 2: 
       /*SBC*/ case 6:  
-      /*CMP*/ case 10: 
-        C = !ARM7_BFE(result,32,1);
-        // if (Rn has a different sign as Rm and result has a differnt sign to Rn)
-        V = (((Rn ^ Rm) & (Rn ^ result)) >> 31)&1;
-        break;
-
+      /*CMP*/ case 10: arm7_set_arith_flags(cpu,ARM7_LAZY_SUB,Rn,Rm,result); break;
       /*RSB*/ case 3: 
-      /*RSC*/ case 7: 
-        C = !ARM7_BFE(result,32,1);
-        // if (Rm has a different sign as Rn and result has a differnt sign to Rm)
-        V = (((Rm ^ Rn) & (Rm ^ result)) >> 31)&1;
-        break;
-
+      /*RSC*/ case 7:  arm7_set_arith_flags(cpu,ARM7_LAZY_SUB,Rm,Rn,result); break;
       /*ADD*/ case 4:
       /*ADC*/ case 5:
-      /*CMN*/ case 11: 
-        C = ARM7_BFE(result,32,1);
-        // if (Rm has the same sign as Rn and result has a different sign to Rm)
-        V = (((Rm ^ ~Rn) & (Rm ^ result)) >> 31)&1;
-        break;
-      }
-      cpsr&= 0x0fffffff;
-      cpsr|= (N?1:0)<<31;   
-      cpsr|= (Z?1:0)<<30;
-      cpsr|= (C?1:0)<<29; 
-      cpsr|= (V?1:0)<<28;
-      cpu->registers[CPSR] = cpsr;
+      /*CMN*/ case 11: arm7_set_arith_flags(cpu,ARM7_LAZY_ADD,Rn,Rm,result); break;
+      // Logical Ops flags
+      default: arm7_set_logic_flags(cpu,result,barrel_shifter_carry); break;
     }
     if(Rd==15){
       // When Rd is R15 and the S flag is set the result of the operation is placed in R15 
       // and the SPSR corresponding to the current mode is moved to the CPSR. This allows
       // state changes which atomically restore both PC and CPSR. This form of instruction
       // should not be used in User mode.
-      cpu->registers[CPSR] = arm7_reg_read(cpu,SPSR);
+      arm7_write_cpsr(cpu,arm7_reg_read(cpu,SPSR));
     }
   }
 }
@@ -1074,12 +1967,13 @@ static FORCE_INLINE void arm7_multiply(arm7_t* cpu, uint32_t opcode){
   else if(SB_BFE(Rs,24,8) == 0 || SB_BFE(Rs,24,8)== 0x000000ff)cpu->i_cycles = 3; 
   else cpu->i_cycles = 4; 
 
-  int64_t result = Rm*Rs;
+  uint64_t result = (uint64_t)Rm*(uint64_t)Rs;
   if(A){result+=Rn;cpu->i_cycles+=1;}
 
   arm7_reg_write(cpu,Rd,result);
 
   if(S){
+    arm7_flush_flags(cpu);
     uint32_t cpsr = cpu->registers[CPSR];
     bool N = ARM7_BFE(result,31,1);
     bool Z = (result&0xffffffff)==0;
@@ -1153,7 +2047,7 @@ static FORCE_INLINE void arm7_multiply_long(arm7_t* cpu, uint32_t opcode){
   int64_t Rs = arm7_reg_read(cpu,ARM7_BFE(opcode,8,4));
   int64_t Rm = arm7_reg_read(cpu,ARM7_BFE(opcode,0,4));
 
-  int64_t RdHiLo = arm7_reg_read(cpu,RdHi);
+  uint64_t RdHiLo = arm7_reg_read(cpu,RdHi);
   RdHiLo = (RdHiLo<<32)| arm7_reg_read(cpu,RdLo);
 
   if(U){
@@ -1171,7 +2065,8 @@ static FORCE_INLINE void arm7_multiply_long(arm7_t* cpu, uint32_t opcode){
    }
    
 
-  int64_t result =  Rm*Rs;
+  // Wrap around in unsigned arithmetic, a signed overflow lets the compiler assume N can't be set
+  uint64_t result = (uint64_t)Rm*(uint64_t)Rs;
   if(A){result+=RdHiLo;cpu->i_cycles+=1;}
 
  
@@ -1180,6 +2075,7 @@ static FORCE_INLINE void arm7_multiply_long(arm7_t* cpu, uint32_t opcode){
   arm7_reg_write(cpu,RdLo,result&0xffffffff);
 
   if(S){
+    arm7_flush_flags(cpu);
     uint32_t cpsr = cpu->registers[CPSR];
     bool N = ARM7_BFE(result,63,1);
     bool Z = result==0;
@@ -1194,17 +2090,17 @@ static FORCE_INLINE void arm7_multiply_long(arm7_t* cpu, uint32_t opcode){
   }
 
 }
-static FORCE_INLINE void arm7_single_data_swap(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7_single_data_swap_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool B = ARM7_BFE(opcode, 22,1);
   uint32_t addr = arm7_reg_read_r15_adj(cpu,ARM7_BFE(opcode,16,4),4);
   uint32_t Rd = ARM7_BFE(opcode,12,4);
   uint32_t Rm = ARM7_BFE(opcode,0,4);
   // Load
-  uint32_t read_data = B ? cpu->read8(cpu->user_data,addr): arm7_rotr(cpu->read32(cpu->user_data,addr),(addr&0x3)*8);
+  uint32_t read_data = B ? arm7_bus_read8(cpu,bus,addr): arm7_rotr(arm7_bus_read32(cpu,bus,addr),(addr&0x3)*8);
 
   uint32_t store_data = arm7_reg_read_r15_adj(cpu,Rm,8);
-  if(B==1)cpu->write8(cpu->user_data,addr,store_data);
-  else cpu->write32(cpu->user_data,addr,store_data);
+  if(B==1)arm7_bus_write8(cpu,bus,addr,store_data);
+  else arm7_bus_write32(cpu,bus,addr,store_data);
 
   arm7_reg_write(cpu,Rd,read_data);
   cpu->i_cycles=1;    
@@ -1227,7 +2123,7 @@ static FORCE_INLINE void arm9_branch_link_exchange(arm7_t* cpu, uint32_t opcode)
   cpu->prefetch_pc=-1;
   arm7_set_thumb_bit(cpu,thumb);
 }
-static FORCE_INLINE void arm7_half_word_transfer(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7_half_word_transfer_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool P = ARM7_BFE(opcode,24,1);
   bool U = ARM7_BFE(opcode,23,1);
   bool I = ARM7_BFE(opcode,22,1);
@@ -1249,14 +2145,14 @@ static FORCE_INLINE void arm7_half_word_transfer(arm7_t* cpu, uint32_t opcode){
   // Store before writeback
   if(L==0){ 
     uint32_t data = arm7_reg_read(cpu,Rd);
-    if(H==1)cpu->write16(cpu->user_data,addr,data);
-    else cpu->write8(cpu->user_data,addr,data);
+    if(H==1)arm7_bus_write16(cpu,bus,addr,data);
+    else arm7_bus_write8(cpu,bus,addr,data);
   }
   uint32_t write_back_addr = addr;
   if(!P) {write_back_addr+=increment;W=true;}
   if(W)arm7_reg_write(cpu,Rn,write_back_addr); 
   if(L==1){ // Load
-    uint32_t data = H ? arm7_rotr(cpu->read16(cpu->user_data,addr),(addr&0x1)*8): cpu->read8(cpu->user_data,addr);
+    uint32_t data = H ? arm7_rotr(arm7_bus_read16(cpu,bus,addr),(addr&0x1)*8): arm7_bus_read8(cpu,bus,addr);
     if(S){
       data&=0xffff;
       // Unaligned signed half words and signed byte loads sign extend the byte 
@@ -1270,7 +2166,7 @@ static FORCE_INLINE void arm7_half_word_transfer(arm7_t* cpu, uint32_t opcode){
   }
   
 }
-static FORCE_INLINE void arm7_single_word_transfer(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7_single_word_transfer_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool I = ARM7_BFE(opcode,25,1);
   bool P = ARM7_BFE(opcode,24,1);
   bool U = ARM7_BFE(opcode,23,1);
@@ -1291,8 +2187,8 @@ static FORCE_INLINE void arm7_single_word_transfer(arm7_t* cpu, uint32_t opcode)
   // Store before write back
   if(L==0){ 
     uint32_t data = arm7_reg_read_r15_adj(cpu,Rd,8);
-    if(B==1)cpu->write8(cpu->user_data,addr,data);
-    else cpu->write32(cpu->user_data,addr,data);
+    if(B==1)arm7_bus_write8(cpu,bus,addr,data);
+    else arm7_bus_write32(cpu,bus,addr,data);
   }
 
   //Write back address before load
@@ -1301,12 +2197,12 @@ static FORCE_INLINE void arm7_single_word_transfer(arm7_t* cpu, uint32_t opcode)
   if(W)arm7_reg_write(cpu,Rn,write_back_addr); 
 
   if(L==1){ // Load
-    uint32_t data = B ? cpu->read8(cpu->user_data,addr): arm7_rotr(cpu->read32(cpu->user_data,addr),(addr&0x3)*8);
+    uint32_t data = B ? arm7_bus_read8(cpu,bus,addr): arm7_rotr(arm7_bus_read32(cpu,bus,addr),(addr&0x3)*8);
     arm7_reg_write(cpu,Rd,data); 
     cpu->i_cycles=1; 
   }
 }
-static FORCE_INLINE void arm9_single_word_transfer(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm9_single_word_transfer_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool I = ARM7_BFE(opcode,25,1);
   bool P = ARM7_BFE(opcode,24,1);
   bool U = ARM7_BFE(opcode,23,1);
@@ -1327,8 +2223,8 @@ static FORCE_INLINE void arm9_single_word_transfer(arm7_t* cpu, uint32_t opcode)
   // Store before write back
   if(L==0){ 
     uint32_t data = arm7_reg_read_r15_adj(cpu,Rd,8);
-    if(B==1)cpu->write8(cpu->user_data,addr,data);
-    else cpu->write32(cpu->user_data,addr,data);
+    if(B==1)arm7_bus_write8(cpu,bus,addr,data);
+    else arm7_bus_write32(cpu,bus,addr,data);
   }
 
   //Write back address before load
@@ -1337,12 +2233,12 @@ static FORCE_INLINE void arm9_single_word_transfer(arm7_t* cpu, uint32_t opcode)
   if(W)arm7_reg_write(cpu,Rn,write_back_addr); 
 
   if(L==1){ // Load
-    uint32_t data = B ? cpu->read8(cpu->user_data,addr): arm7_rotr(cpu->read32(cpu->user_data,addr),(addr&0x3)*8);
+    uint32_t data = B ? arm7_bus_read8(cpu,bus,addr): arm7_rotr(arm7_bus_read32(cpu,bus,addr),(addr&0x3)*8);
     arm9_reg_write_r15_thumb(cpu,Rd,data); 
     cpu->i_cycles=1; 
   }
 }
-static FORCE_INLINE void arm9_double_word_transfer(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm9_double_word_transfer_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   // cccc 000P UIW0 nnnn dddd oooo 11S1 oooo
   bool P = ARM7_BFE(opcode,24,1);
   bool U = ARM7_BFE(opcode,23,1);
@@ -1365,8 +2261,8 @@ static FORCE_INLINE void arm9_double_word_transfer(arm7_t* cpu, uint32_t opcode)
   if(S){ 
     uint32_t data0 = arm7_reg_read_r15_adj(cpu,Rd,8);
     uint32_t data1 = arm7_reg_read_r15_adj(cpu,Rd+1,8);
-    cpu->write32(cpu->user_data,addr,data0);
-    cpu->write32(cpu->user_data,addr+4,data1);
+    arm7_bus_write32(cpu,bus,addr,data0);
+    arm7_bus_write32(cpu,bus,addr+4,data1);
   }
 
   //Write back address before load
@@ -1375,8 +2271,8 @@ static FORCE_INLINE void arm9_double_word_transfer(arm7_t* cpu, uint32_t opcode)
   if(W)arm7_reg_write(cpu,Rn,write_back_addr); 
 
   if(S==0){ // Load
-    uint32_t data0 = cpu->read32(cpu->user_data,addr);
-    uint32_t data1 = cpu->read32(cpu->user_data,addr+4);
+    uint32_t data0 = arm7_bus_read32(cpu,bus,addr);
+    uint32_t data1 = arm7_bus_read32(cpu,bus,addr+4);
     arm9_reg_write_r15_thumb(cpu,Rd,data0);   
     arm9_reg_write_r15_thumb(cpu,Rd+1,data1); 
     cpu->i_cycles=1; 
@@ -1384,14 +2280,16 @@ static FORCE_INLINE void arm9_double_word_transfer(arm7_t* cpu, uint32_t opcode)
 }
 static FORCE_INLINE void arm7_undefined(arm7_t* cpu, uint32_t opcode){
   bool thumb = arm7_get_thumb_bit(cpu);
-  cpu->registers[R14_und] = cpu->registers[PC]-(thumb?0:4);
+  uint32_t lr = cpu->registers[PC]-(thumb?0:4);
   cpu->registers[PC] = cpu->irq_table_address+0x4; 
+  arm7_flush_flags(cpu);
   uint32_t cpsr = cpu->registers[CPSR];
   cpu->registers[SPSR_und] = cpsr;
   //Update mode to supervisor and block irqs
-  cpu->registers[CPSR] = (cpsr&0xffffffE0)| 0x1b|0x80;
+  arm7_write_cpsr(cpu,(cpsr&0xffffffE0)| 0x1b|0x80);
+  cpu->registers[LR] = lr;
   arm7_set_thumb_bit(cpu,false);
-  printf("Unhandled Instruction Class (arm7_undefined) Opcode: %x PC:%08x\n",opcode, cpu->registers[R14_und]);
+  printf("Unhandled Instruction Class (arm7_undefined) Opcode: %x PC:%08x\n",opcode, cpu->registers[LR]);
   cpu->i_cycles=1;
   //cpu->trigger_breakpoint = true;
 }
@@ -1427,7 +2325,21 @@ static FORCE_INLINE void arm9_qadd_qsub(arm7_t* cpu, uint32_t opcode){
   cpu->registers[CPSR]|= Q<<27;
   arm7_reg_write(cpu,Rd,result);
 }
-static FORCE_INLINE void arm7_block_transfer(arm7_t* cpu, uint32_t opcode){
+// Bulk path of the block transfers (see arm_block_transfer_fn_t), false if the system can't move the
+// whole transfer at once. Callers leave out user bank transfers and write backs to a base in the list,
+// so the write back can happen after all of the accesses.
+static FORCE_INLINE bool arm7_block_transfer_bulk(arm7_t* cpu, const arm7_bus_t* bus, bool L, int reglist, int num_regs, uint32_t addr, int r15_off){
+  uint32_t data[16];
+  int n = 0;
+  if(!L){
+    for(int i=0;i<16;++i)if(ARM7_BFE(reglist,i,1))data[n++]=cpu->registers[i]+(i==15?r15_off:0);
+    return arm7_bus_block_transfer(cpu,bus,addr&~3,data,num_regs,true);
+  }
+  if(!arm7_bus_block_transfer(cpu,bus,addr&~3,data,num_regs,false))return false;
+  for(int i=0;i<16;++i)if(ARM7_BFE(reglist,i,1))cpu->registers[i]=data[n++];
+  return true;
+}
+static FORCE_INLINE void arm7_block_transfer_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   int P = ARM7_BFE(opcode,24,1);
   int U = ARM7_BFE(opcode,23,1);
   int S = ARM7_BFE(opcode,22,1);
@@ -1466,6 +2378,7 @@ static FORCE_INLINE void arm7_block_transfer(arm7_t* cpu, uint32_t opcode){
   int num_regs = 0; 
   for(int i=0;i<16;++i) if(ARM7_BFE(reglist,i,1)==1)num_regs+=1;
   int base_addr = addr;
+  bool bulk = cpu->block_transfer? !S&&reglist&&!(w&&ARM7_BFE(reglist,Rn,1)): false;
   if(reglist==0){
     // Handle Empty Rlist case: R15 loaded/stored (ARMv4 only), and Rb=Rb+/-40h (ARMv4-v5).
     reglist = 1<<15;
@@ -1488,6 +2401,11 @@ static FORCE_INLINE void arm7_block_transfer(arm7_t* cpu, uint32_t opcode){
 
   bool user_bank_transfer = S && (!L || !SB_BFE(reglist,15,1));
 
+  if(bulk&&arm7_block_transfer_bulk(cpu,bus,L,reglist,num_regs,addr,r15_off)){
+    if(w)arm7_reg_write(cpu,Rn,base_addr);
+    if(L)cpu->i_cycles=1;
+    return;
+  }
   for(int i=0;i<16;++i){
     //Writeback happens on second cycle
     //Todo, does post increment force writeback? 
@@ -1495,12 +2413,12 @@ static FORCE_INLINE void arm7_block_transfer(arm7_t* cpu, uint32_t opcode){
     if(ARM7_BFE(reglist,i,1)==0)continue;  
 
     // When S is set the registers are read from the user bank
-    int reg_index = user_bank_transfer ? i : arm7_reg_index(cpu,i);
+    int reg_index = user_bank_transfer&&i>=8&&i<15 ? arm7_bank_slots[cpu->active_bank][i-8] : i;
     //Store happens before writeback 
     int a = addr;
     //Inexplicablly SRAM accesses are not DWORD aligned. GBA suite memory test can be used to verify this. 
     if((a&0xfe000000)!=0x0e000000)a&=~3;
-    if(!L) cpu->write32(cpu->user_data, a,cpu->registers[reg_index] + (i==15?r15_off:0));
+    if(!L) arm7_bus_write32(cpu,bus,a,cpu->registers[reg_index] + (i==15?r15_off:0));
 
     //Writeback happens on second cycle
     if(++cycle==1 && w){
@@ -1510,7 +2428,7 @@ static FORCE_INLINE void arm7_block_transfer(arm7_t* cpu, uint32_t opcode){
     // R15 is stored at PC+12
    if(L){
       int bank = ARM7_BFE(addr,24,8);
-      cpu->registers[reg_index]=cpu->read32_seq(cpu->user_data, a,bank==last_bank);
+      cpu->registers[reg_index]=arm7_bus_read32_seq(cpu,bus,a,bank==last_bank);
       last_bank=bank;
    }
 
@@ -1519,12 +2437,12 @@ static FORCE_INLINE void arm7_block_transfer(arm7_t* cpu, uint32_t opcode){
     // If the instruction is a LDM then SPSR_<mode> is transferred to CPSR at
     // the same time as R15 is loaded.
     if(L&& S&& i==15){
-      cpu->registers[CPSR] = arm7_reg_read(cpu,SPSR);
+      arm7_write_cpsr(cpu,arm7_reg_read(cpu,SPSR));
     }
   }
   if(L)cpu->i_cycles=1;
 }
-static FORCE_INLINE void arm9_block_transfer(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm9_block_transfer_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   int P = ARM7_BFE(opcode,24,1);
   int U = ARM7_BFE(opcode,23,1);
   int S = ARM7_BFE(opcode,22,1);
@@ -1563,6 +2481,7 @@ static FORCE_INLINE void arm9_block_transfer(arm7_t* cpu, uint32_t opcode){
   int num_regs = 0; 
   for(int i=0;i<16;++i) if(ARM7_BFE(reglist,i,1)==1)num_regs+=1;
   int base_addr = addr;
+  bool bulk = cpu->block_transfer? !S&&reglist&&!(w&&ARM7_BFE(reglist,Rn,1)): false;
   if(reglist==0){
     // Handle Empty Rlist case: R15 loaded/stored (ARMv4 only), and Rb=Rb+/-40h (ARMv4-v5).
     num_regs = 16;
@@ -1583,6 +2502,12 @@ static FORCE_INLINE void arm9_block_transfer(arm7_t* cpu, uint32_t opcode){
   int last_bank = -1;
 
   bool user_bank_transfer = S && (!L || !SB_BFE(reglist,15,1));
+  if(bulk&&arm7_block_transfer_bulk(cpu,bus,L,reglist,num_regs,addr,r15_off)){
+    if(L&&ARM7_BFE(reglist,15,1))arm7_set_thumb_bit(cpu,cpu->registers[PC]&1);
+    if(w)arm7_reg_write(cpu,Rn,base_addr);
+    if(L)cpu->i_cycles=1;
+    return;
+  }
   for(int i=0;i<16;++i){
     //Writeback happens on second cycle
     //Todo, does post increment force writeback? 
@@ -1590,15 +2515,15 @@ static FORCE_INLINE void arm9_block_transfer(arm7_t* cpu, uint32_t opcode){
     if(ARM7_BFE(reglist,i,1)==0)continue;  
 
     // When S is set the registers are read from the user bank
-    int reg_index = user_bank_transfer ? i : arm7_reg_index(cpu,i);
+    int reg_index = user_bank_transfer&&i>=8&&i<15 ? arm7_bank_slots[cpu->active_bank][i-8] : i;
     //Store happens before writeback 
     int a = addr;
-    if(!L) cpu->write32(cpu->user_data, a,cpu->registers[reg_index] + (i==15?r15_off:0));
+    if(!L) arm7_bus_write32(cpu,bus,a,cpu->registers[reg_index] + (i==15?r15_off:0));
 
     // R15 is stored at PC+12
    if(L){
       int bank = ARM7_BFE(addr,24,8);
-      cpu->registers[reg_index]=cpu->read32_seq(cpu->user_data, a,bank==last_bank);
+      cpu->registers[reg_index]=arm7_bus_read32_seq(cpu,bus,a,bank==last_bank);
       last_bank=bank;
       if(PC==reg_index)arm7_set_thumb_bit(cpu,cpu->registers[PC]&1);
    }
@@ -1611,7 +2536,7 @@ static FORCE_INLINE void arm9_block_transfer(arm7_t* cpu, uint32_t opcode){
     // If the instruction is a LDM then SPSR_<mode> is transferred to CPSR at
     // the same time as R15 is loaded.
     if(L&& S&& i==15){
-      cpu->registers[CPSR] = arm7_reg_read(cpu,SPSR);
+      arm7_write_cpsr(cpu,arm7_reg_read(cpu,SPSR));
 
     }
   }
@@ -1660,7 +2585,7 @@ static FORCE_INLINE void arm7_coproc_data_op(arm7_t* cpu, uint32_t opcode){
   printf("Unhandled Instruction Class (arm7_coproc_data_op) Opcode: %x\n",opcode);
   cpu->trigger_breakpoint = true;
 }
-static FORCE_INLINE void arm7_coproc_reg_transfer(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7_coproc_reg_transfer_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   int coprocessor_opcode = SB_BFE(opcode,21,3);
   bool coprocessor_read = SB_BFE(opcode,20,1);
   int Cn = SB_BFE(opcode,16,4);
@@ -1669,31 +2594,25 @@ static FORCE_INLINE void arm7_coproc_reg_transfer(arm7_t* cpu, uint32_t opcode){
   int Cp = SB_BFE(opcode,5,3);
   int Cm = SB_BFE(opcode,0,4);
   if(coprocessor_read){
-    if(!cpu->coprocessor_read){
+    if(!(bus? bus->coprocessor_read: cpu->coprocessor_read)){
       printf("Coprocessor Read Issued without bound coprocessor_read handler: %x\n",opcode);
       return;
     } 
-    uint32_t data = cpu->coprocessor_read(cpu->user_data,Pn,coprocessor_opcode,Cn,Cm,Cp);
+    uint32_t data = arm7_bus_coprocessor_read(cpu,bus,Pn,coprocessor_opcode,Cn,Cm,Cp);
     arm7_reg_write(cpu,Rd,data);
   }else{
-    if(!cpu->coprocessor_write){
+    if(!(bus? bus->coprocessor_write: cpu->coprocessor_write)){
       printf("Coprocessor Write Issued without bound coprocessor_write handler: %x\n",opcode);
       return;
     } 
     uint32_t data = arm7_reg_read_r15_adj(cpu,Rd,8);
-    cpu->coprocessor_write(cpu->user_data,Pn,coprocessor_opcode,Cn,Cm,Cp,data);
+    arm7_bus_coprocessor_write(cpu,bus,Pn,coprocessor_opcode,Cn,Cm,Cp,data);
   }
 }
 static FORCE_INLINE void arm7_software_interrupt(arm7_t* cpu, uint32_t opcode){
   bool thumb = arm7_get_thumb_bit(cpu);
-  cpu->registers[R14_svc] = cpu->registers[PC];
-  cpu->registers[PC] = cpu->irq_table_address+0x8; 
-  uint32_t cpsr = cpu->registers[CPSR];
-  cpu->registers[SPSR_svc] = cpsr;
-  //Update mode to supervisor and block irqs
-  cpu->registers[CPSR] = (cpsr&0xffffffE0)| 0x13|0x80;
   uint32_t swi_number = SB_BFE(opcode,0,24);
-  if(arm7_get_thumb_bit(cpu))swi_number = SB_BFE(opcode,0,8);
+  if(thumb)swi_number = SB_BFE(opcode,0,8);
   int id = -1;
   for(int i=0;i<ARM_DEBUG_SWI_RING_SIZE&&i<cpu->debug_swi_ring_offset;++i){
     if(cpu->debug_swi_ring[i]==swi_number){id=i;break;}
@@ -1704,6 +2623,19 @@ static FORCE_INLINE void arm7_software_interrupt(arm7_t* cpu, uint32_t opcode){
   }
   cpu->debug_swi_ring[id]= swi_number; 
   cpu->debug_swi_ring_times[id]++; 
+  if(cpu->swi_hle&&cpu->swi_hle(cpu->user_data,thumb? swi_number: swi_number>>16)){
+    // Returning from the BIOS refills the pipeline
+    cpu->next_fetch_sequential=false;
+    return;
+  }
+  uint32_t lr = cpu->registers[PC];
+  cpu->registers[PC] = cpu->irq_table_address+0x8; 
+  arm7_flush_flags(cpu);
+  uint32_t cpsr = cpu->registers[CPSR];
+  cpu->registers[SPSR_svc] = cpsr;
+  //Update mode to supervisor and block irqs
+  arm7_write_cpsr(cpu,(cpsr&0xffffffE0)| 0x13|0x80);
+  cpu->registers[LR] = lr;
   arm7_set_thumb_bit(cpu,false);
 }
 
@@ -1884,23 +2816,23 @@ static FORCE_INLINE void arm9t_hi_reg_op(arm7_t* cpu, uint32_t opcode){
     arm7_data_processing(cpu, arm_op);
   }
 }
-static FORCE_INLINE void arm9t_pc_rel_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm9t_pc_rel_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   int offset = ARM7_BFE(opcode,0,8)*4;
   int Rd = ARM7_BFE(opcode,8,3);
   uint32_t addr = (cpu->registers[PC]+offset+2)&(~3);
-  uint32_t data = cpu->read32(cpu->user_data,addr);
+  uint32_t data = arm7_bus_read32(cpu,bus,addr);
   arm9_reg_write_r15_thumb(cpu,Rd,data);  
   cpu->i_cycles++;
 }
-static FORCE_INLINE void arm7t_pc_rel_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7t_pc_rel_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   int offset = ARM7_BFE(opcode,0,8)*4;
   int Rd = ARM7_BFE(opcode,8,3);
   uint32_t addr = (cpu->registers[PC]+offset+2)&(~3);
-  uint32_t data = cpu->read32(cpu->user_data,addr);
+  uint32_t data = arm7_bus_read32(cpu,bus,addr);
   arm7_reg_write(cpu,Rd,data);  
   cpu->i_cycles++;
 }
-static FORCE_INLINE void arm7t_reg_off_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7t_reg_off_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool B = ARM7_BFE(opcode,10,1);
   bool L = ARM7_BFE(opcode,11,1);
   int Ro = ARM7_BFE(opcode,6,3);
@@ -1915,16 +2847,16 @@ static FORCE_INLINE void arm7t_reg_off_ldst(arm7_t* cpu, uint32_t opcode){
   // Store before write back
   if(L==0){ 
     uint32_t data = arm7_reg_read_r15_adj(cpu,Rd,r15_off);
-    if(B==1)cpu->write8(cpu->user_data,addr,data);
-    else cpu->write32(cpu->user_data,addr,data);
+    if(B==1)arm7_bus_write8(cpu,bus,addr,data);
+    else arm7_bus_write32(cpu,bus,addr,data);
   }else{ // Load
-    uint32_t data = B ? cpu->read8(cpu->user_data,addr): arm7_rotr(cpu->read32(cpu->user_data,addr),(addr&0x3)*8);
+    uint32_t data = B ? arm7_bus_read8(cpu,bus,addr): arm7_rotr(arm7_bus_read32(cpu,bus,addr),(addr&0x3)*8);
     arm7_reg_write(cpu,Rd,data);  
     cpu->i_cycles++;
   }
 }
 
-static FORCE_INLINE void arm9t_reg_off_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm9t_reg_off_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool B = ARM7_BFE(opcode,10,1);
   bool L = ARM7_BFE(opcode,11,1);
   int Ro = ARM7_BFE(opcode,6,3);
@@ -1939,16 +2871,16 @@ static FORCE_INLINE void arm9t_reg_off_ldst(arm7_t* cpu, uint32_t opcode){
   // Store before write back
   if(L==0){ 
     uint32_t data = arm7_reg_read_r15_adj(cpu,Rd,r15_off);
-    if(B==1)cpu->write8(cpu->user_data,addr,data);
-    else cpu->write32(cpu->user_data,addr,data);
+    if(B==1)arm7_bus_write8(cpu,bus,addr,data);
+    else arm7_bus_write32(cpu,bus,addr,data);
   }else{ // Load
-    uint32_t data = B ? cpu->read8(cpu->user_data,addr): arm7_rotr(cpu->read32(cpu->user_data,addr),(addr&0x3)*8);
+    uint32_t data = B ? arm7_bus_read8(cpu,bus,addr): arm7_rotr(arm7_bus_read32(cpu,bus,addr),(addr&0x3)*8);
     arm9_reg_write_r15_thumb(cpu,Rd,data);  
     cpu->i_cycles++;
   }
 
 }
-static FORCE_INLINE void arm7t_ldst_bh(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7t_ldst_bh_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   int op = ARM7_BFE(opcode,10,2);
   int Ro = ARM7_BFE(opcode,6,3);
   int Rb = ARM7_BFE(opcode,3,3);
@@ -1966,26 +2898,26 @@ static FORCE_INLINE void arm7t_ldst_bh(arm7_t* cpu, uint32_t opcode){
       data = arm7_reg_read_r15_adj(cpu,Rd,r15_off);
       break;
     case 1: //Load Sign Extended Byte
-      data = cpu->read8(cpu->user_data,addr);
+      data = arm7_bus_read8(cpu,bus,addr);
       cpu->i_cycles++;
       if(ARM7_BFE(data,7,1))data|=0xffffff00;
       break; 
     case 2: //Load Halfword
-      data = arm7_rotr(cpu->read16(cpu->user_data,addr),(addr&0x1)*8);
+      data = arm7_rotr(arm7_bus_read16(cpu,bus,addr),(addr&0x1)*8);
       cpu->i_cycles++;
       break;          
     case 3: //Load Sign Extended Half
-      data = arm7_rotr(cpu->read16(cpu->user_data,addr),(addr&0x1)*8)&0xffff;
+      data = arm7_rotr(arm7_bus_read16(cpu,bus,addr),(addr&0x1)*8)&0xffff;
       cpu->i_cycles++;
       //Unaligned halfwords sign extend the byte
       if((addr&1)&&ARM7_BFE(data,7,1))data|=0xffffff00;
       else if(ARM7_BFE(data,15,1))data|=0xffff0000;
       break; 
   }
-  if(op==0)cpu->write16(cpu->user_data,addr,data);
+  if(op==0)arm7_bus_write16(cpu,bus,addr,data);
   else arm7_reg_write(cpu,Rd,data);
 }
-static FORCE_INLINE void arm7t_imm_off_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7t_imm_off_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool B = ARM7_BFE(opcode,12,1);
   bool L = ARM7_BFE(opcode,11,1);
   int offset = ARM7_BFE(opcode,6,5);
@@ -1998,15 +2930,15 @@ static FORCE_INLINE void arm7t_imm_off_ldst(arm7_t* cpu, uint32_t opcode){
   addr += offset;
   if(L==0){ // Store
     uint32_t data = arm7_reg_read(cpu,Rd);
-    if(B==1)cpu->write8(cpu->user_data,addr,data);
-    else cpu->write32(cpu->user_data,addr,data);
+    if(B==1)arm7_bus_write8(cpu,bus,addr,data);
+    else arm7_bus_write32(cpu,bus,addr,data);
   }else{ // Load
-    uint32_t data = B ? cpu->read8(cpu->user_data,addr): arm7_rotr(cpu->read32(cpu->user_data,addr),(addr&0x3)*8);
+    uint32_t data = B ? arm7_bus_read8(cpu,bus,addr): arm7_rotr(arm7_bus_read32(cpu,bus,addr),(addr&0x3)*8);
     cpu->i_cycles++;
     arm7_reg_write(cpu,Rd,data);  
   }
 }
-static FORCE_INLINE void arm9t_imm_off_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm9t_imm_off_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool B = ARM7_BFE(opcode,12,1);
   bool L = ARM7_BFE(opcode,11,1);
   int offset = ARM7_BFE(opcode,6,5);
@@ -2019,16 +2951,16 @@ static FORCE_INLINE void arm9t_imm_off_ldst(arm7_t* cpu, uint32_t opcode){
   addr += offset;
   if(L==0){ // Store
     uint32_t data = arm7_reg_read(cpu,Rd);
-    if(B==1)cpu->write8(cpu->user_data,addr,data);
-    else cpu->write32(cpu->user_data,addr,data);
+    if(B==1)arm7_bus_write8(cpu,bus,addr,data);
+    else arm7_bus_write32(cpu,bus,addr,data);
   }else{ // Load
-    uint32_t data = B ? cpu->read8(cpu->user_data,addr): arm7_rotr(cpu->read32(cpu->user_data,addr),(addr&0x3)*8);
+    uint32_t data = B ? arm7_bus_read8(cpu,bus,addr): arm7_rotr(arm7_bus_read32(cpu,bus,addr),(addr&0x3)*8);
     cpu->i_cycles++;
     arm9_reg_write_r15_thumb(cpu,Rd,data);  
   }
 }
 
-static FORCE_INLINE void arm7t_imm_off_ldst_bh(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7t_imm_off_ldst_bh_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool L = ARM7_BFE(opcode,11,1);
   int offset = ARM7_BFE(opcode,6,5);
   
@@ -2039,14 +2971,14 @@ static FORCE_INLINE void arm7t_imm_off_ldst_bh(arm7_t* cpu, uint32_t opcode){
   uint32_t data=0;
   if(L==0){ // Store
     data = arm7_reg_read(cpu,Rd);
-    cpu->write16(cpu->user_data,addr,data);
+    arm7_bus_write16(cpu,bus,addr,data);
   }else{ // Load
-    data = arm7_rotr(cpu->read16(cpu->user_data,addr),(addr&0x1)*8);
+    data = arm7_rotr(arm7_bus_read16(cpu,bus,addr),(addr&0x1)*8);
     arm7_reg_write(cpu,Rd,data);  
     cpu->i_cycles++;
   }
 }
-static FORCE_INLINE void arm7t_stack_off_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7t_stack_off_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool L = ARM7_BFE(opcode,11,1);
   uint64_t Rd = ARM7_BFE(opcode,8,3);
   int offset = ARM7_BFE(opcode,0,8);
@@ -2056,14 +2988,14 @@ static FORCE_INLINE void arm7t_stack_off_ldst(arm7_t* cpu, uint32_t opcode){
   uint32_t data; 
   if(L==0){ // Store
     data = arm7_reg_read(cpu,Rd);
-    cpu->write32(cpu->user_data,addr,data);
+    arm7_bus_write32(cpu,bus,addr,data);
   }else{ // Load
-    data = arm7_rotr(cpu->read32(cpu->user_data,addr),(addr&0x3)*8);
+    data = arm7_rotr(arm7_bus_read32(cpu,bus,addr),(addr&0x3)*8);
     arm7_reg_write(cpu,Rd,data);  
     cpu->i_cycles++;
   }
 }
-static FORCE_INLINE void arm9t_stack_off_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm9t_stack_off_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool L = ARM7_BFE(opcode,11,1);
   uint64_t Rd = ARM7_BFE(opcode,8,3);
   int offset = ARM7_BFE(opcode,0,8);
@@ -2073,9 +3005,9 @@ static FORCE_INLINE void arm9t_stack_off_ldst(arm7_t* cpu, uint32_t opcode){
   uint32_t data; 
   if(L==0){ // Store
     data = arm7_reg_read(cpu,Rd);
-    cpu->write32(cpu->user_data,addr,data);
+    arm7_bus_write32(cpu,bus,addr,data);
   }else{ // Load
-    data = arm7_rotr(cpu->read32(cpu->user_data,addr),(addr&0x3)*8);
+    data = arm7_rotr(arm7_bus_read32(cpu,bus,addr),(addr&0x3)*8);
     arm9_reg_write_r15_thumb(cpu,Rd,data);  
     cpu->i_cycles++;
   }
@@ -2097,7 +3029,7 @@ static FORCE_INLINE void arm7t_add_off_sp(arm7_t* cpu, uint32_t opcode){
   uint32_t value = arm7_reg_read(cpu,13);
   arm7_reg_write(cpu,13,value+offset);
 }
-static FORCE_INLINE void arm7t_push_pop_reg(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7t_push_pop_reg_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool push_or_pop = ARM7_BFE(opcode,11,1);
   bool include_pc_lr = ARM7_BFE(opcode,8,1);
   uint32_t r_list = ARM7_BFE(opcode,0,8);
@@ -2107,9 +3039,9 @@ static FORCE_INLINE void arm7t_push_pop_reg(arm7_t* cpu, uint32_t opcode){
 
   uint32_t arm_op = (0xe<<28)|(4<<25)|(P<<24)|(U<<23)|(W<<21)|(push_or_pop<<20)|(13<<16)|r_list;
   if(include_pc_lr)arm_op|=push_or_pop? 0x8000 : 0x4000;
-  arm7_block_transfer(cpu,arm_op);
+  arm7_block_transfer_bus(cpu,arm_op,bus);
 }
-static FORCE_INLINE void arm9t_push_pop_reg(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm9t_push_pop_reg_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool push_or_pop = ARM7_BFE(opcode,11,1);
   bool include_pc_lr = ARM7_BFE(opcode,8,1);
   uint32_t r_list = ARM7_BFE(opcode,0,8);
@@ -2119,9 +3051,9 @@ static FORCE_INLINE void arm9t_push_pop_reg(arm7_t* cpu, uint32_t opcode){
 
   uint32_t arm_op = (0xe<<28)|(4<<25)|(P<<24)|(U<<23)|(W<<21)|(push_or_pop<<20)|(13<<16)|r_list;
   if(include_pc_lr)arm_op|=push_or_pop? 0x8000 : 0x4000;
-  arm9_block_transfer(cpu,arm_op);
+  arm9_block_transfer_bus(cpu,arm_op,bus);
 }
-static FORCE_INLINE void arm7t_mult_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm7t_mult_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool write_or_read = ARM7_BFE(opcode,11,1);
   int Rb = ARM7_BFE(opcode,8,3);
   uint32_t r_list = ARM7_BFE(opcode,0,8);
@@ -2131,9 +3063,9 @@ static FORCE_INLINE void arm7t_mult_ldst(arm7_t* cpu, uint32_t opcode){
   int W = 1;
   // Maps to LDMIA, STMIA opcode
   uint32_t arm_op = (0xe<<28)|(4<<25)|(P<<24)|(U<<23)|(W<<21)|(write_or_read<<20)|(Rb<<16)|r_list;
-  arm7_block_transfer(cpu,arm_op);
+  arm7_block_transfer_bus(cpu,arm_op,bus);
 }
-static FORCE_INLINE void arm9t_mult_ldst(arm7_t* cpu, uint32_t opcode){
+static FORCE_INLINE void arm9t_mult_ldst_bus(arm7_t* cpu, uint32_t opcode, const arm7_bus_t* bus){
   bool write_or_read = ARM7_BFE(opcode,11,1);
   int Rb = ARM7_BFE(opcode,8,3);
   uint32_t r_list = ARM7_BFE(opcode,0,8);
@@ -2143,7 +3075,7 @@ static FORCE_INLINE void arm9t_mult_ldst(arm7_t* cpu, uint32_t opcode){
   int W = 1;
   // Maps to LDMIA, STMIA opcode
   uint32_t arm_op = (0xe<<28)|(4<<25)|(P<<24)|(U<<23)|(W<<21)|(write_or_read<<20)|(Rb<<16)|r_list;
-  arm9_block_transfer(cpu,arm_op);
+  arm9_block_transfer_bus(cpu,arm_op,bus);
 }
 static FORCE_INLINE void arm7t_cond_branch(arm7_t* cpu, uint32_t opcode){
   int cond = ARM7_BFE(opcode,8,4);
@@ -2185,18 +3117,65 @@ static FORCE_INLINE void arm7t_long_branch_link(arm7_t* cpu, uint32_t opcode){
     if(!thumb_branch)arm7_set_thumb_bit(cpu,false);
   }
 }
+// Bcc after a CMP, the condition comes straight from the compared values (the flags stay lazy)
+static FORCE_INLINE void arm7t_fused_cmp_bcc(arm7_t* cpu, uint32_t opcode){
+  if(cpu->lazy_flags!=(ARM7_LAZY_NZ|ARM7_LAZY_SUB)){arm7t_cond_branch(cpu,opcode);return;}
+  uint32_t a = cpu->lazy_cv_a, b = cpu->lazy_cv_b;
+  bool taken;
+  switch(ARM7_BFE(opcode,8,4)){
+    case 0x0: taken = a==b; break;                   //EQ
+    case 0x1: taken = a!=b; break;                   //NE
+    case 0x2: taken = a>=b; break;                   //CS
+    case 0x3: taken = a<b;  break;                   //CC
+    case 0x8: taken = a>b;  break;                   //HI
+    case 0x9: taken = a<=b; break;                   //LS
+    case 0xA: taken = (int32_t)a>=(int32_t)b; break; //GE
+    case 0xB: taken = (int32_t)a<(int32_t)b;  break; //LT
+    case 0xC: taken = (int32_t)a>(int32_t)b;  break; //GT
+    case 0xD: taken = (int32_t)a<=(int32_t)b; break; //LE
+    default: arm7t_cond_branch(cpu,opcode); return;  //MI, PL, VS and VC need the result
+  }
+  if(taken){
+    int s_off = ARM7_BFE(opcode,0,8);
+    if(ARM7_BFE(s_off,7,1))s_off|=0xFFFFFF00;
+    cpu->registers[PC]+=s_off*2+2;
+    cpu->prefetch_pc=-1;
+  }
+}
+// ADD Rd,Rs,Rn or ADD Rd,Rs (high registers other than the PC) after a LSL/MOV
+static FORCE_INLINE void arm7t_fused_shift_add(arm7_t* cpu, uint32_t opcode){
+  if((opcode&0xFE00)==0x1800){
+    uint32_t a = cpu->registers[ARM7_BFE(opcode,3,3)];
+    uint32_t b = cpu->registers[ARM7_BFE(opcode,6,3)];
+    uint64_t result = (uint64_t)a+b;
+    cpu->registers[ARM7_BFE(opcode,0,3)] = result;
+    arm7_set_arith_flags(cpu,ARM7_LAZY_ADD,a,b,result);
+  }else cpu->registers[ARM7_BFE(opcode,0,3)|(ARM7_BFE(opcode,7,1)<<3)]+= cpu->registers[ARM7_BFE(opcode,3,4)];
+}
+// Second half of a BL, LR still has the target from the first half
+static FORCE_INLINE void arm7t_fused_bl(arm7_t* cpu, uint32_t opcode){
+  uint32_t pc = cpu->registers[PC];
+  cpu->registers[PC] = cpu->registers[LR]+(ARM7_BFE(opcode,0,11)<<1);
+  cpu->registers[LR] = pc|1;
+  cpu->prefetch_pc=-1;
+}
 static FORCE_INLINE void arm7t_unknown(arm7_t* cpu, uint32_t opcode){
   bool thumb = arm7_get_thumb_bit(cpu);
-  cpu->registers[R14_und] = cpu->registers[PC]-(thumb?0:4);
+  uint32_t lr = cpu->registers[PC]-(thumb?0:4);
   cpu->registers[PC] = cpu->irq_table_address+0x4; 
+  arm7_flush_flags(cpu);
   uint32_t cpsr = cpu->registers[CPSR];
   cpu->registers[SPSR_und] = cpsr;
   //Update mode to supervisor and block irqs
-  cpu->registers[CPSR] = (cpsr&0xffffffE0)| 0x1b|0x80;
+  arm7_write_cpsr(cpu,(cpsr&0xffffffE0)| 0x1b|0x80);
+  cpu->registers[LR] = lr;
   arm7_set_thumb_bit(cpu,false);
   printf("Unhandled Thumb Instruction Class: (arm7t_unknown) Opcode %x\n",opcode);
   printf("PC: %08x\n",cpu->registers[PC]);
   //cpu->trigger_breakpoint=true;
 }
+#define ARM7_BUS_HANDLER_FN(H) static FORCE_INLINE void H(arm7_t* cpu, uint32_t opcode){H##_bus(cpu,opcode,NULL);}
+ARM7_BUS_HANDLERS(ARM7_BUS_HANDLER_FN)
+#undef ARM7_BUS_HANDLER_FN
 
 #endif
@@ -0,0 +1,391 @@
+#ifndef ARM7_BIOS_HLE_H
+#define ARM7_BIOS_HLE_H 1
+
+#include <string.h>
+#include "arm7.h"
+
+// High level emulation of BIOS SWIs
+// Native versions of the copy, decompression and math SWIs the GBA and NDS BIOSes have in common.
+// The system dispatches the SWI number (see arm_swi_hle_fn_t) to these with hooks to its memory.
+// Memory is written in the same order and with the same access widths as the BIOS loops, so
+// overlapping copies and back references into VRAM behave like they do on hardware. A function
+// returns false before touching anything when it can't match the BIOS (memory that isn't plain RAM,
+// misaligned pointers, division by zero, output overwriting compressed data) and the system then lets
+// the BIOS run the SWI. If compressed data runs off the end of mapped memory the BIOS also reruns it
+// from the start.
+// Cycle costs are estimates of the BIOS loops and are charged as internal cycles.
+typedef struct{
+  void* user_data;
+  // Host memory backing reads from address (same contract as arm_code_ptr_fn_t)
+  const uint8_t* (*read_ptr)(void* user_data, uint32_t address, uint32_t* bytes_mapped);
+  // Host memory backing bytes bytes from address if it takes writes of width bytes without side
+  // effects, NULL otherwise. The system drops any code it cached from the range.
+  uint8_t* (*write_ptr)(void* user_data, uint32_t address, uint32_t bytes, int width);
+}arm7_hle_mem_t;
+
+static FORCE_INLINE const uint8_t* arm7_hle_read_range(const arm7_hle_mem_t* mem, uint32_t address, uint32_t bytes){
+  uint32_t mapped = 0;
+  const uint8_t* host = mem->read_ptr(mem->user_data,address,&mapped);
+  return host&&mapped>=bytes? host: NULL;
+}
+static FORCE_INLINE bool arm7_hle_overlaps(const uint8_t* a, uint32_t a_bytes, const uint8_t* b, uint32_t b_bytes){
+  return a<b+b_bytes&&b<a+a_bytes;
+}
+// Copies front to back one unit at a time like the BIOS, which repeats the data when the destination
+// overlaps the source from above
+static void arm7_hle_copy(uint8_t* dst, const uint8_t* src, uint32_t bytes, int width){
+  if(dst<=src||dst>=src+bytes){memmove(dst,src,bytes);return;}
+  // A unit is loaded completely before it's stored (CpuFastSet moves 8 words per LDM/STM)
+  for(uint32_t i=0;i<bytes;i+=width)memmove(dst+i,src+i,width);
+}
+// CpuSet: r0 source, r1 destination, r2 bits 0-20 unit count, bit 24 fill, bit 26 32 bit units
+static bool arm7_hle_cpu_set(arm7_t* cpu, const arm7_hle_mem_t* mem){
+  uint32_t src = cpu->registers[0], dst = cpu->registers[1], cnt = cpu->registers[2];
+  bool fill = ARM7_BFE(cnt,24,1);
+  int width = ARM7_BFE(cnt,26,1)? 4: 2;
+  uint32_t bytes = ARM7_BFE(cnt,0,21)*width;
+  if((src|dst)&(width-1))return false;
+  if(!bytes)return true;
+  const uint8_t* s = arm7_hle_read_range(mem,src,fill? width: bytes);
+  uint8_t* d = s? mem->write_ptr(mem->user_data,dst,bytes,width): NULL;
+  if(!d)return false;
+  if(fill){
+    uint8_t value[4];
+    memcpy(value,s,width);
+    for(uint32_t i=0;i<bytes;i+=width)memcpy(d+i,value,width);
+  }else arm7_hle_copy(d,s,bytes,width);
+  cpu->i_cycles+=bytes/width*(fill?5:7);
+  return true;
+}
+// CpuFastSet: like CpuSet with 32 bit units in blocks of 8 words
+static bool arm7_hle_cpu_fast_set(arm7_t* cpu, const arm7_hle_mem_t* mem){
+  uint32_t src = cpu->registers[0], dst = cpu->registers[1], cnt = cpu->registers[2];
+  bool fill = ARM7_BFE(cnt,24,1);
+  uint32_t bytes = ((ARM7_BFE(cnt,0,21)+7)&~7)*4;
+  if((src|dst)&3)return false;
+  if(!bytes)return true;
+  const uint8_t* s = arm7_hle_read_range(mem,src,fill? 4: bytes);
+  uint8_t* d = s? mem->write_ptr(mem->user_data,dst,bytes,4): NULL;
+  if(!d)return false;
+  if(fill){
+    uint32_t value;
+    memcpy(&value,s,4);
+    for(uint32_t i=0;i<bytes;i+=4)memcpy(d+i,&value,4);
+  }else arm7_hle_copy(d,s,bytes,32);
+  cpu->i_cycles+=bytes/4*(fill?1:2);
+  return true;
+}
+
+// Decompression. Every format starts with a word holding the type in bits 4-7 and the decompressed
+// size in bits 8-31. The Wram versions write bytes, the Vram versions write halfwords once both of
+// their bytes are known.
+typedef struct{
+  uint8_t* dst;
+  uint32_t size, out;
+  bool vram;
+  uint8_t pending;
+}arm7_hle_output_t;
+static bool arm7_hle_begin_output(arm7_hle_output_t* o, const arm7_hle_mem_t* mem, uint32_t dst, uint32_t size, int width){
+  o->size = size;
+  o->out = 0;
+  o->vram = width==2;
+  if(dst&(width-1))return false;
+  o->dst = size? mem->write_ptr(mem->user_data,dst,(size+width-1)&~(width-1),width): NULL;
+  return o->dst||!size;
+}
+static FORCE_INLINE void arm7_hle_put(arm7_hle_output_t* o, uint8_t data){
+  if(!o->vram)o->dst[o->out]=data;
+  else if(o->out&1){o->dst[o->out-1]=o->pending;o->dst[o->out]=data;}
+  else o->pending=data;
+  o->out++;
+}
+static FORCE_INLINE const uint8_t* arm7_hle_compressed_data(const arm7_hle_mem_t* mem, uint32_t src, uint32_t* mapped){
+  const uint8_t* s = (src&3)? NULL: mem->read_ptr(mem->user_data,src,mapped);
+  return s&&*mapped>=4? s: NULL;
+}
+// LZ77UnCompWram/LZ77UnCompVram: r0 source, r1 destination
+static bool arm7_hle_lz77(arm7_t* cpu, const arm7_hle_mem_t* mem, bool vram){
+  uint32_t mapped = 0;
+  const uint8_t* s = arm7_hle_compressed_data(mem,cpu->registers[0],&mapped);
+  if(!s)return false;
+  uint32_t header; memcpy(&header,s,4);
+  arm7_hle_output_t o;
+  if(!arm7_hle_begin_output(&o,mem,cpu->registers[1],header>>8,vram?2:1))return false;
+  // Worst case the data is all literals with a flag byte per 8
+  if(arm7_hle_overlaps(s,4+o.size+(o.size+7)/8,o.dst,o.size))return false;
+  uint32_t in = 4;
+  while(o.out<o.size){
+    if(in>=mapped)return false;
+    uint8_t flags = s[in++];
+    for(int b=0;b<8&&o.out<o.size;++b,flags<<=1){
+      if(!(flags&0x80)){
+        if(in>=mapped)return false;
+        arm7_hle_put(&o,s[in++]);
+        continue;
+      }
+      if(in+2>mapped)return false;
+      uint32_t disp = (((s[in]&0xf)<<8)|s[in+1])+1;
+      int length = (s[in]>>4)+3;
+      in+=2;
+      if(disp>o.out)return false;
+      // Back references read the destination, including bytes a Vram write hasn't stored yet
+      while(length--&&o.out<o.size)arm7_hle_put(&o,o.dst[o.out-disp]);
+    }
+  }
+  cpu->i_cycles+=o.size*6+in*4;
+  return true;
+}
+// RLUnCompWram/RLUnCompVram: r0 source, r1 destination
+static bool arm7_hle_rl(arm7_t* cpu, const arm7_hle_mem_t* mem, bool vram){
+  uint32_t mapped = 0;
+  const uint8_t* s = arm7_hle_compressed_data(mem,cpu->registers[0],&mapped);
+  if(!s)return false;
+  uint32_t header; memcpy(&header,s,4);
+  // The BIOS finishes a run that crosses the end of the data, so only streams whose runs end
+  // exactly on a word aligned size are handled here.
+  uint32_t size = header>>8, total = 0, in = 4;
+  if(size&3)return false;
+  while(total<size){
+    if(in+1>=mapped)return false;
+    uint8_t flag = s[in++];
+    uint32_t length = flag&0x80? (flag&0x7f)+3: (flag&0x7f)+1;
+    in+= flag&0x80? 1: length;
+    total+=length;
+  }
+  if(total!=size||in>mapped)return false;
+  arm7_hle_output_t o;
+  if(!arm7_hle_begin_output(&o,mem,cpu->registers[1],size,vram?2:1))return false;
+  if(arm7_hle_overlaps(s,in,o.dst,size))return false;
+  in = 4;
+  while(o.out<o.size){
+    uint8_t flag = s[in++];
+    if(flag&0x80){
+      int length = (flag&0x7f)+3;
+      uint8_t data = s[in++];
+      while(length--)arm7_hle_put(&o,data);
+    }else{
+      int length = (flag&0x7f)+1;
+      while(length--)arm7_hle_put(&o,s[in++]);
+    }
+  }
+  cpu->i_cycles+=o.size*5+in*3;
+  return true;
+}
+// HuffUnComp: r0 source, r1 destination. The header's bits 0-3 give the data size (4 or 8 bits),
+// followed by the tree size byte, the tree and a bitstream of words read from bit 31 down. Output is
+// written in words.
+static bool arm7_hle_huffman(arm7_t* cpu, const arm7_hle_mem_t* mem){
+  uint32_t mapped = 0;
+  const uint8_t* s = arm7_hle_compressed_data(mem,cpu->registers[0],&mapped);
+  if(!s||mapped<5)return false;
+  uint32_t header; memcpy(&header,s,4);
+  int bits = header&0xf;
+  if(bits!=4&&bits!=8)return false;
+  uint32_t in = 4+(s[4]+1)*2;
+  if(in&3)return false;
+  uint32_t size = header>>8;
+  uint8_t* d = NULL;
+  if(cpu->registers[1]&3)return false;
+  if(size&&!(d = mem->write_ptr(mem->user_data,cpu->registers[1],(size+3)&~3,4)))return false;
+  // The length of the bitstream isn't known up front
+  if(d&&arm7_hle_overlaps(s,mapped,d,size))return false;
+  const uint32_t root = 5;
+  uint32_t node = root;
+  uint32_t word = 0, out = 0;
+  int word_bits = 0;
+  while(out<size){
+    if(in+4>mapped)return false;
+    uint32_t stream; memcpy(&stream,s+in,4);
+    in+=4;
+    for(int i=31;i>=0&&out<size;--i){
+      int bit = (stream>>i)&1;
+      uint8_t n = s[node];
+      uint32_t child = (node&~1)+(n&0x3f)*2+2+bit;
+      if(child>=mapped)return false;
+      if(!(n&(bit?0x40:0x80))){node = child;continue;}
+      word|= (uint32_t)s[child]<<word_bits;
+      word_bits+=bits;
+      node = root;
+      if(word_bits==32){
+        memcpy(d+out,&word,4);
+        out+=4;
+        word = 0;
+        word_bits = 0;
+      }
+    }
+  }
+  cpu->i_cycles+=(in-4)*8*4+size*2;
+  return true;
+}
+
+// 32 bit wrapping multiply and divide like the ARM code of the BIOS
+static FORCE_INLINE int32_t arm7_hle_mul(int32_t a, int32_t b){return (int32_t)((uint32_t)a*(uint32_t)b);}
+static FORCE_INLINE int32_t arm7_hle_sdiv(int32_t a, int32_t b){return b==-1? (int32_t)(0u-(uint32_t)a): a/b;}
+// Div/DivArm: r0/r1 (r1/r0 for DivArm) -> r0 quotient, r1 remainder, r3 absolute quotient
+// The remainder takes the sign of the numerator like the Nintendo BIOS (some replacement BIOSes differ)
+static bool arm7_hle_div(arm7_t* cpu, bool arm_order){
+  int32_t num = cpu->registers[arm_order?1:0], den = cpu->registers[arm_order?0:1];
+  // The BIOS's results for these don't follow the usual rules
+  if(!den||(num==INT32_MIN&&den==-1))return false;
+  int32_t quot = num/den;
+  int32_t rem  = num%den;
+  cpu->registers[0] = quot;
+  cpu->registers[1] = rem;
+  cpu->registers[3] = quot<0? -(uint32_t)quot: (uint32_t)quot;
+  cpu->i_cycles+=arm_order? 40: 36;
+  return true;
+}
+// Sqrt: r0 -> floor(sqrt(r0)), r0 is unsigned
+static bool arm7_hle_sqrt(arm7_t* cpu){
+  uint32_t value = cpu->registers[0];
+  uint32_t root = 0;
+  for(uint32_t bit = 1u<<30;bit;bit>>=2){
+    if(value>=root+bit){value-=root+bit;root = (root>>1)+bit;}
+    else root>>=1;
+  }
+  cpu->registers[0] = root;
+  cpu->i_cycles+=60;
+  return true;
+}
+// The BIOS's polynomial for atan of a 1.14 fixed point tangent in [-1,1]
+static int32_t arm7_hle_arctan_poly(int32_t i){
+  int32_t a = -(arm7_hle_mul(i,i)>>14);
+  int32_t b = (arm7_hle_mul(0xA9,a)>>14)+0x390;
+  b = (arm7_hle_mul(b,a)>>14)+0x91C;
+  b = (arm7_hle_mul(b,a)>>14)+0xFB6;
+  b = (arm7_hle_mul(b,a)>>14)+0x16AA;
+  b = (arm7_hle_mul(b,a)>>14)+0x2081;
+  b = (arm7_hle_mul(b,a)>>14)+0x3651;
+  b = (arm7_hle_mul(b,a)>>14)+0xA2F9;
+  return arm7_hle_mul(i,b)>>16;
+}
+// ArcTan: r0 tangent (1.14 fixed point) -> r0 angle
+static bool arm7_hle_arctan(arm7_t* cpu){
+  cpu->registers[0] = arm7_hle_arctan_poly((int32_t)cpu->registers[0]);
+  cpu->i_cycles+=40;
+  return true;
+}
+// ArcTan2: r0 x, r1 y (1.14 fixed point) -> r0 angle 0-0xFFFF
+static bool arm7_hle_arctan2(arm7_t* cpu){
+  int32_t x = cpu->registers[0], y = cpu->registers[1];
+  int32_t x14 = (int32_t)((uint32_t)x<<14), y14 = (int32_t)((uint32_t)y<<14);
+  int32_t angle;
+  if(!y)angle = x>=0? 0: 0x8000;
+  else if(!x)angle = y>=0? 0x4000: 0xC000;
+  else if(y>=0){
+    if(x>=0&&x>=y)angle = arm7_hle_arctan_poly(arm7_hle_sdiv(y14,x));
+    else if(x<0&&-x>=y)angle = arm7_hle_arctan_poly(arm7_hle_sdiv(y14,x))+0x8000;
+    else angle = 0x4000-arm7_hle_arctan_poly(arm7_hle_sdiv(x14,y));
+  }else{
+    if(x<=0&&-x>-y)angle = arm7_hle_arctan_poly(arm7_hle_sdiv(y14,x))+0x8000;
+    else if(x>0&&x>=-y)angle = arm7_hle_arctan_poly(arm7_hle_sdiv(y14,x))+0x10000;
+    else angle = 0xC000-arm7_hle_arctan_poly(arm7_hle_sdiv(x14,y));
+  }
+  cpu->registers[0] = angle&0xffff;
+  cpu->i_cycles+=60;
+  return true;
+}
+// GetCRC16 (NDS): r0 initial CRC, r1 address, r2 length in bytes -> r0 CRC-16 (reflected polynomial
+// 0xA001) of the halfwords in the range
+static bool arm7_hle_crc16(arm7_t* cpu, const arm7_hle_mem_t* mem){
+  uint32_t crc = cpu->registers[0], address = cpu->registers[1], bytes = cpu->registers[2]&~1;
+  // The BIOS shifts the upper bits of a wider initial value into the result
+  if(crc>0xffff||(address&1))return false;
+  if(!bytes)return true;
+  const uint8_t* s = arm7_hle_read_range(mem,address,bytes);
+  if(!s)return false;
+  for(uint32_t i=0;i<bytes;i+=2){
+    uint16_t data; memcpy(&data,s+i,2);
+    crc^=data;
+    for(int b=0;b<16;++b)crc = crc&1? (crc>>1)^0xA001: crc>>1;
+  }
+  cpu->registers[0] = crc;
+  cpu->i_cycles+=bytes*20;
+  return true;
+}
+
+// Registers the math SWIs return results in (r0-r15 bit mask), for the verification below
+#define ARM7_HLE_R0_OUTPUT  (1<<0)
+#define ARM7_HLE_DIV_OUTPUTS ((1<<0)|(1<<1)|(1<<3))
+// Runs the system's native version of a SWI with the given memory hooks, returns false to leave the
+// SWI to the BIOS. outputs is set to the registers the SWI returns results in.
+typedef bool (*arm7_hle_run_fn_t)(arm7_t* cpu, const arm7_hle_mem_t* mem, uint32_t function, uint32_t* outputs);
+
+// Verification mode: arm7_hle_verify_begin runs the native version of a SWI, records its results and
+// undoes it, then leaves the SWI to the BIOS. arm7_hle_verify_check has to be called after every
+// instruction and compares the BIOS results with the recorded ones once the CPU is back at the caller.
+// A native version may write one range of at most ARM7_HLE_VERIFY_MAX_BYTES, larger ones aren't
+// verified.
+#define ARM7_HLE_VERIFY_MAX_BYTES (256*1024)
+typedef struct{
+  bool pending;
+  uint32_t function;
+  uint32_t return_pc, return_mode;
+  uint32_t outputs;
+  uint32_t registers[16];
+  const arm7_hle_mem_t* mem;
+  uint8_t* dst;
+  uint32_t address, bytes;
+  uint8_t data[ARM7_HLE_VERIFY_MAX_BYTES];
+  uint64_t verified, mismatches;
+}arm7_hle_verify_t;
+static const uint8_t* arm7_hle_verify_read_ptr(void* user_data, uint32_t address, uint32_t* bytes_mapped){
+  const arm7_hle_mem_t* mem = ((arm7_hle_verify_t*)user_data)->mem;
+  return mem->read_ptr(mem->user_data,address,bytes_mapped);
+}
+static uint8_t* arm7_hle_verify_write_ptr(void* user_data, uint32_t address, uint32_t bytes, int width){
+  arm7_hle_verify_t* v = (arm7_hle_verify_t*)user_data;
+  if(v->dst||bytes>ARM7_HLE_VERIFY_MAX_BYTES)return NULL;
+  uint8_t* host = v->mem->write_ptr(v->mem->user_data,address,bytes,width);
+  if(!host)return NULL;
+  v->dst = host;
+  v->address = address;
+  v->bytes = bytes;
+  memcpy(v->data,host,bytes);
+  return host;
+}
+static bool arm7_hle_verify_begin(arm7_hle_verify_t* v, arm7_t* cpu, const arm7_hle_mem_t* mem, uint32_t function, arm7_hle_run_fn_t run){
+  // A SWI called while the BIOS still runs a verified one (from an interrupt handler) isn't checked
+  if(v->pending)return false;
+  uint32_t registers[16];
+  memcpy(registers,cpu->registers,sizeof(registers));
+  uint32_t i_cycles = cpu->i_cycles;
+  arm7_hle_mem_t recorder = {v,arm7_hle_verify_read_ptr,arm7_hle_verify_write_ptr};
+  v->mem = mem;
+  v->dst = NULL;
+  v->bytes = 0;
+  v->outputs = 0;
+  if(run(cpu,&recorder,function,&v->outputs)){
+    // Keep the native results and give the BIOS the memory it would have seen
+    for(uint32_t i=0;i<v->bytes;++i){uint8_t t = v->dst[i]; v->dst[i] = v->data[i]; v->data[i] = t;}
+    memcpy(v->registers,cpu->registers,sizeof(v->registers));
+    memcpy(cpu->registers,registers,sizeof(registers));
+    cpu->i_cycles = i_cycles;
+    v->pending = true;
+    v->function = function;
+    v->return_pc = cpu->registers[PC];
+    v->return_mode = cpu->registers[CPSR]&0x1f;
+  }else if(v->dst)memcpy(v->dst,v->data,v->bytes);
+  return false;
+}
+static void arm7_hle_verify_check(arm7_hle_verify_t* v, arm7_t* cpu, const char* cpu_name){
+  if(SB_LIKELY(!v->pending||cpu->registers[PC]!=v->return_pc||(cpu->registers[CPSR]&0x1f)!=v->return_mode))return;
+  v->pending = false;
+  v->verified++;
+  bool match = true;
+  for(int r=0;r<16;++r){
+    if(!((v->outputs>>r)&1)||cpu->registers[r]==v->registers[r])continue;
+    printf("%s BIOS HLE mismatch in SWI 0x%02x: r%d is 0x%08x in the BIOS, 0x%08x native\n",
+      cpu_name,v->function,r,cpu->registers[r],v->registers[r]);
+    match = false;
+  }
+  for(uint32_t i=0;i<v->bytes;++i){
+    if(v->dst[i]==v->data[i])continue;
+    printf("%s BIOS HLE mismatch in SWI 0x%02x: [0x%08x] is 0x%02x in the BIOS, 0x%02x native\n",
+      cpu_name,v->function,v->address+i,v->dst[i],v->data[i]);
+    match = false;
+    break;
+  }
+  if(!match)v->mismatches++;
+}
+#endif
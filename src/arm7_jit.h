@@ -0,0 +1,677 @@
+#ifndef ARM7_JIT_H
+#define ARM7_JIT_H 1
+
+#include <stddef.h>
+#include "arm7.h"
+
+// x86-64 backend for the decoded block cache
+// Hot blocks of arm7_block_cache_t are compiled into host code that strings together the pipeline
+// bookkeeping of arm7_exec_cached_instruction with direct calls to each opcode's handler, so the
+// per instruction decode, lookup and indirect dispatch disappear. After every instruction the code
+// calls the system's boundary function which runs the tail of its main loop (so hardware is ticked
+// exactly as often as with the interpreter) and decides if compiled code may keep running. Anything
+// unusual (branches, interrupts, DMA, writes to the block's code, mode switches) leaves the compiled
+// code and resumes in the interpreter.
+#if defined(__x86_64__) && (defined(__linux__)||defined(__FreeBSD__)) && !defined(__ANDROID__)
+#define ARM7_JIT_SUPPORTED 1
+#include <sys/mman.h>
+#else
+#define ARM7_JIT_SUPPORTED 0
+#endif
+
+#define ARM7_JIT_CODE_SIZE (8*1024*1024)
+#define ARM7_JIT_MAX_BLOCK_CODE (32*1024)
+#ifndef ARM7_JIT_HOT_THRESHOLD
+#define ARM7_JIT_HOT_THRESHOLD 16
+#endif
+
+typedef struct{
+  uint64_t build;      // arm7_block_t::build this was compiled from
+  uint8_t* code;       // NULL until the block gets hot
+  uint32_t hits;
+  uint32_t count;      // Instructions with an entry point (0 if the block is too short to compile)
+  uint16_t entry[ARM7_BLOCK_MAX_INSTRUCTIONS];
+}arm7_jit_block_t;
+
+// Cycle budget
+// A system whose boundary function only advances its clocks while none of its components has an
+// event due can let compiled code skip the call after simple instructions (ALU ops and the loads and
+// stores of the inline memory path below that stayed on its pages). Before it returns true the
+// boundary function sets cycles to how many cycles the CPU may run before anything else happens (0
+// to be called after every instruction). Compiled code then adds the cycles of the instructions it
+// skips the call for to pending and the boundary function ticks them together with its own. Adding
+// them up is exact since nothing but the clocks would have changed in the skipped calls. A handler
+// that may touch the hardware first calls flush, which ticks pending on its own.
+typedef struct{
+  int32_t cycles;
+  uint32_t pending;
+  uint32_t counter;          // Offset in user_data of the uint32_t that together with arm7_t::i_cycles counts an instruction's cycles, both are cleared for the next one
+  void (*flush)(void* ctx);
+  void* ctx;                 // Passed to flush, set by the system before compiled code runs
+  uint64_t skipped;          // Boundary calls compiled code skipped
+}arm7_jit_budget_t;
+
+// Inline memory accesses
+// LDR/STR(B/H) with an immediate or register offset look the page of their address up in the
+// system's page table from compiled code. When the page maps the access to host memory the data is
+// moved directly, with the same wait states, open bus value and code invalidation the system's
+// handlers produce. Everything else goes through the op's handler. Page table entries are 8 bytes:
+// uint32_t offset of the page's memory from user_data, uint16_t mask of the address bits inside it,
+// uint8_t flags and uint8_t non sequential read (low nibble) and write (high nibble) cycles.
+typedef void (*arm7_jit_access_fn_t)(void* user_data, uint32_t address, int request_size);
+typedef void (*arm7_jit_code_write_fn_t)(void* user_data, const uint8_t* host);
+typedef struct{
+  const void* pages;          // NULL runs every access through the handlers
+  uint32_t page_shift, page_limit;
+  uint8_t read_flag, write_flag, write8_flag;
+  uint8_t rom_flag;           // Pages whose memory starts at the pointer at rom_base in user_data, only word loads use them
+  uint32_t rom_base;
+  uint8_t code_flag;          // Writes to pages with this flag (every write if 0) invalidate code
+  arm7_jit_code_write_fn_t code_write; // Invalidates code at host, NULL bumps the page in the CPU's block cache
+  arm7_jit_access_fn_t access; // Charges an access (request_size 3 for words, 1 otherwise), NULL adds the page's cycles to the uint32_t at slow_cycles in user_data
+  uint32_t slow_cycles;
+  uint32_t openbus;           // Offset of the open bus word in user_data
+  bool openbus_word;          // Accesses leave the whole word around the address there (the old one for stores) instead of the value moved
+  arm7_jit_budget_t* budget;  // NULL calls the boundary function after every instruction
+}arm7_jit_system_t;
+
+typedef struct{
+  uint8_t* code;         // Code buffer, allocated on first use
+  bool writable;         // The buffer is mapped read/write (for emitting) instead of read/execute
+  size_t used;
+  size_t exit_offset;    // Epilogue of the entry trampoline at the start of the buffer
+  uint32_t epoch;        // Block cache epoch the compiled code belongs to
+  arm7_boundary_fn_t boundary; // Boundary function the compiled code calls
+  arm7_jit_system_t system;    // Memory and cycle budget the compiled code uses, see arm7_jit_set_system
+  bool unavailable;      // Executable memory couldn't be allocated
+  uint64_t compiled_blocks;
+  uint64_t runs;
+  arm7_jit_block_t blocks[ARM7_BLOCK_CACHE_SIZE];
+}arm7_jit_t;
+
+// Tries to run the instruction at cpu->registers[PC] (and the ones after it) from compiled code.
+// Returns false without side effects if it can't, otherwise the boundary function has already been
+// called for every executed instruction.
+static bool arm7_jit_run(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx);
+static bool arm9_jit_run(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx);
+// Same as arm7_jit_run/arm9_jit_run in two steps: returns the compiled code for the instruction at
+// cpu->registers[PC] (NULL if it can't run from compiled code), which arm7_jit_enter then runs. The
+// system may do its own work in between as long as it leaves the CPU and its memory alone.
+static const uint8_t* arm7_jit_entry(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary);
+static const uint8_t* arm9_jit_entry(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary);
+static void arm7_jit_enter(arm7_jit_t* jit, arm7_t* cpu, void* ctx, const uint8_t* entry);
+// Releases the executable memory
+static void arm7_jit_free(arm7_jit_t* jit);
+// Sets what compiled code may do without the handlers and the boundary function, compiled code is
+// dropped when it changes. The system is compared byte for byte, so clear it before filling it in.
+static void arm7_jit_set_system(arm7_jit_t* jit, const arm7_jit_system_t* system);
+
+// Lockstep verification
+// The system enters compiled code with arm7_jit_verify_boundary and its own boundary function in
+// arm7_jit_verify_t, so the instructions of the run get counted. Then it replays them from a copy of
+// its state taken before the run, with the interpreter followed by its boundary function after each,
+// and compares both results with arm7_jit_verify_cpu (and its own state byte for byte). Copying the
+// state is slow, so systems only verify one in every few runs.
+typedef struct{
+  arm7_boundary_fn_t boundary;
+  void* ctx;
+  uint32_t instructions;
+  uint32_t countdown;
+  uint64_t verified, mismatches;
+}arm7_jit_verify_t;
+static bool arm7_jit_verify_boundary(void* user_data){
+  arm7_jit_verify_t* v = (arm7_jit_verify_t*)user_data;
+  v->instructions++;
+  return v->boundary(v->ctx);
+}
+// Returns true if the next run is one of every interval runs that get verified, and resets the
+// instruction count
+static bool arm7_jit_verify_due(arm7_jit_verify_t* v, uint32_t interval){
+  v->instructions = 0;
+  if(v->countdown){v->countdown--;return false;}
+  v->countdown = interval-1;
+  return true;
+}
+// Compares the registers and pipeline of the CPU that ran compiled code with the one the interpreter
+// replayed from start_pc and prints the first difference. The host side fields of interpreted are
+// then made to match compiled so that the system can compare the rest of its state byte for byte.
+static bool arm7_jit_verify_cpu(arm7_jit_verify_t* v, const arm7_t* compiled, arm7_t* interpreted, uint32_t start_pc, const char* cpu_name){
+  arm7_t a = *compiled, b = *interpreted;
+  arm7_flush_flags(&a);
+  arm7_flush_flags(&b);
+  bool match = true;
+  for(int r=0;r<37&&match;++r){
+    if(a.registers[r]==b.registers[r])continue;
+    printf("%s JIT mismatch after %u instructions from 0x%08x: r%d is 0x%08x compiled, 0x%08x interpreted\n",
+      cpu_name,v->instructions,start_pc,r,a.registers[r],b.registers[r]);
+    match = false;
+  }
+  if(match&&(memcmp(a.prefetch_opcode,b.prefetch_opcode,sizeof(a.prefetch_opcode))||a.prefetch_pc!=b.prefetch_pc||
+             a.i_cycles!=b.i_cycles||a.next_fetch_sequential!=b.next_fetch_sequential||a.wait_for_interrupt!=b.wait_for_interrupt)){
+    printf("%s JIT mismatch after %u instructions from 0x%08x: pipeline or timing differs\n",cpu_name,v->instructions,start_pc);
+    match = false;
+  }
+  interpreted->user_data = compiled->user_data;
+  interpreted->block_cache = compiled->block_cache;
+  interpreted->code_window_host = compiled->code_window_host;
+  interpreted->code_window_start = compiled->code_window_start;
+  interpreted->code_window_size = compiled->code_window_size;
+  interpreted->code_window_miss_start = compiled->code_window_miss_start;
+  interpreted->code_window_miss_size = compiled->code_window_miss_size;
+  return match;
+}
+
+static void arm7_jit_set_system(arm7_jit_t* jit, const arm7_jit_system_t* system){
+  if(!memcmp(&jit->system,system,sizeof(*system)))return;
+  memcpy(&jit->system,system,sizeof(*system));
+  jit->epoch = 0; // Never a valid block cache epoch, the next entry resets
+}
+
+#if ARM7_JIT_SUPPORTED
+
+typedef void (*arm7_jit_enter_fn_t)(arm7_t* cpu, void* user_data, arm7_block_cache_t* cache, void* ctx, const uint8_t* entry);
+
+typedef struct{
+  uint8_t* p;
+}arm7_jit_emitter_t;
+
+static FORCE_INLINE void arm7_jit_u8(arm7_jit_emitter_t* e, uint8_t v){*e->p++=v;}
+static FORCE_INLINE void arm7_jit_u32(arm7_jit_emitter_t* e, uint32_t v){memcpy(e->p,&v,4);e->p+=4;}
+static FORCE_INLINE void arm7_jit_u64(arm7_jit_emitter_t* e, uint64_t v){memcpy(e->p,&v,8);e->p+=8;}
+static void arm7_jit_bytes(arm7_jit_emitter_t* e, const char* bytes, int size){memcpy(e->p,bytes,size);e->p+=size;}
+
+// rbx holds the arm7_t, r12 the user_data, r13 the block cache and r14 the boundary context.
+#define ARM7_JIT_CPU(field) ((uint32_t)offsetof(arm7_t,field))
+#define ARM7_JIT_CACHE(field) ((uint32_t)offsetof(arm7_block_cache_t,field))
+
+// mov byte [rbx+disp], imm8
+static void arm7_jit_store8_cpu(arm7_jit_emitter_t* e, uint32_t disp, uint8_t imm){arm7_jit_bytes(e,"\xC6\x83",2);arm7_jit_u32(e,disp);arm7_jit_u8(e,imm);}
+// mov dword [rbx+disp], imm32
+static void arm7_jit_store32_cpu(arm7_jit_emitter_t* e, uint32_t disp, uint32_t imm){arm7_jit_bytes(e,"\xC7\x83",2);arm7_jit_u32(e,disp);arm7_jit_u32(e,imm);}
+// add dword [rbx+disp], imm8
+static void arm7_jit_add32_cpu(arm7_jit_emitter_t* e, uint32_t disp, uint8_t imm){arm7_jit_bytes(e,"\x83\x83",2);arm7_jit_u32(e,disp);arm7_jit_u8(e,imm);}
+// mov eax, [rbx+disp]
+static void arm7_jit_load_eax_cpu(arm7_jit_emitter_t* e, uint32_t disp){arm7_jit_bytes(e,"\x8B\x83",2);arm7_jit_u32(e,disp);}
+// mov [rbx+disp], eax
+static void arm7_jit_store_eax_cpu(arm7_jit_emitter_t* e, uint32_t disp){arm7_jit_bytes(e,"\x89\x83",2);arm7_jit_u32(e,disp);}
+// cmp eax, [rbx+disp]
+static void arm7_jit_cmp_eax_cpu(arm7_jit_emitter_t* e, uint32_t disp){arm7_jit_bytes(e,"\x3B\x83",2);arm7_jit_u32(e,disp);}
+// mov qword [r13+disp], ptr
+static void arm7_jit_store_ptr_cache(arm7_jit_emitter_t* e, uint32_t disp, const void* ptr){
+  if(!ptr){arm7_jit_bytes(e,"\x49\xC7\x85",3);arm7_jit_u32(e,disp);arm7_jit_u32(e,0);return;}
+  arm7_jit_bytes(e,"\x48\xB8",2);arm7_jit_u64(e,(uintptr_t)ptr);
+  arm7_jit_bytes(e,"\x49\x89\x85",3);arm7_jit_u32(e,disp);
+}
+// cmp dword [r13+disp], imm32
+static void arm7_jit_cmp32_cache(arm7_jit_emitter_t* e, uint32_t disp, uint32_t imm){arm7_jit_bytes(e,"\x41\x81\xBD",3);arm7_jit_u32(e,disp);arm7_jit_u32(e,imm);}
+// mov rax, fn; call rax
+static void arm7_jit_call(arm7_jit_emitter_t* e, const void* fn){arm7_jit_bytes(e,"\x48\xB8",2);arm7_jit_u64(e,(uintptr_t)fn);arm7_jit_bytes(e,"\xFF\xD0",2);}
+// Emits a rel32 jump (0xE9) or conditional jump (0x0F 0x8x) to target, returns where the offset is
+// stored so it can be patched when target isn't known yet.
+static uint8_t* arm7_jit_jump(arm7_jit_emitter_t* e, uint8_t cc, const uint8_t* target){
+  if(cc){arm7_jit_u8(e,0x0F);arm7_jit_u8(e,cc);}
+  else arm7_jit_u8(e,0xE9);
+  uint8_t* rel = e->p;
+  arm7_jit_u32(e,target?(uint32_t)(target-(rel+4)):0);
+  return rel;
+}
+static void arm7_jit_patch(uint8_t* rel, const uint8_t* target){
+  uint32_t v = (uint32_t)(target-(rel+4));
+  memcpy(rel,&v,4);
+}
+#define ARM7_JIT_JAE 0x83
+#define ARM7_JIT_JZ  0x84
+#define ARM7_JIT_JNZ 0x85
+#define ARM7_JIT_JGE 0x8D
+
+// Instructions that only change registers and flags (no memory, PC or mode changes), which the
+// boundary function doesn't need to see
+static bool arm7_jit_alu_op(uint32_t opcode, bool thumb){
+  if(thumb){
+    if(opcode<0x4400)return true;                         // Shifts, ADD/SUB, MOV/CMP/ADD/SUB #imm, ALU ops
+    if((opcode&0xFC00)==0x4400){                          // Hi register ADD/CMP/MOV, BX excluded
+      int op = ARM7_BFE(opcode,8,2);
+      int Rd = ARM7_BFE(opcode,0,3)|(ARM7_BFE(opcode,7,1)<<3);
+      return op==1||(op!=3&&Rd!=PC);
+    }
+    return (opcode&0xF000)==0xA000||(opcode&0xFF00)==0xB000; // ADD Rd,PC/SP,#imm and ADD SP,#imm
+  }
+  if((opcode>>28)==0xF||(opcode&0x0C000000))return false;
+  if((opcode&0x02000090)==0x90)return false;              // Multiplies and the extra loads/stores
+  if((opcode&0x01900000)==0x01000000)return false;        // TST/TEQ/CMP/CMN without S: MRS, MSR, BX, ..
+  return ARM7_BFE(opcode,12,4)!=PC;
+}
+// Loads and stores the inline memory path handles
+typedef struct{
+  bool load;
+  int size;          // 1, 2 or 4 bytes
+  int rd;
+  int base, index;   // Registers adding up to the address (-1 for none)
+  uint32_t offset;   // Added to them
+  bool arm;          // ARM loads set i_cycles to 1, Thumb ones add 1
+}arm7_jit_mem_op_t;
+static bool arm7_jit_decode_mem_op(uint32_t opcode, bool thumb, uint32_t address, arm7_jit_mem_op_t* m){
+  *m = (arm7_jit_mem_op_t){.size=4,.base=-1,.index=-1};
+  if(!thumb){
+    // LDR/STR(B) Rd,[Rn,#+-imm] without write back
+    if((opcode>>28)==0xF||(opcode&0x0F200000)!=0x05000000)return false;
+    m->rd = ARM7_BFE(opcode,12,4);
+    if(m->rd==PC)return false;
+    m->arm = true;
+    m->load = ARM7_BFE(opcode,20,1);
+    m->size = ARM7_BFE(opcode,22,1)? 1: 4;
+    m->base = ARM7_BFE(opcode,16,4);
+    m->offset = ARM7_BFE(opcode,23,1)? ARM7_BFE(opcode,0,12): -ARM7_BFE(opcode,0,12);
+    if(m->base==PC){m->base=-1;m->offset+=address+8;}
+    return true;
+  }
+  m->rd = ARM7_BFE(opcode,0,3);
+  m->load = ARM7_BFE(opcode,11,1);
+  if((opcode&0xF800)==0x4800){                            // LDR Rd,[PC,#imm]
+    m->rd = ARM7_BFE(opcode,8,3);
+    m->offset = ((address+4)&~3)+ARM7_BFE(opcode,0,8)*4;
+  }else if((opcode&0xF000)==0x5000){                      // LDR/STR(B/H) Rd,[Rb,Ro]
+    m->base = ARM7_BFE(opcode,3,3);
+    m->index = ARM7_BFE(opcode,6,3);
+    if(ARM7_BFE(opcode,9,1)){
+      int op = ARM7_BFE(opcode,10,2);
+      if(op==1||op==3)return false;                       // Sign extending loads
+      m->load = op==2;
+      m->size = 2;
+    }else if(ARM7_BFE(opcode,10,1))m->size = 1;
+  }else if((opcode&0xE000)==0x6000){                      // LDR/STR(B) Rd,[Rb,#imm]
+    m->base = ARM7_BFE(opcode,3,3);
+    m->size = ARM7_BFE(opcode,12,1)? 1: 4;
+    m->offset = ARM7_BFE(opcode,6,5)*m->size;
+  }else if((opcode&0xF000)==0x8000){                      // LDRH/STRH Rd,[Rb,#imm]
+    m->base = ARM7_BFE(opcode,3,3);
+    m->size = 2;
+    m->offset = ARM7_BFE(opcode,6,5)*2;
+  }else if((opcode&0xF000)==0x9000){                      // LDR/STR Rd,[SP,#imm]
+    m->rd = ARM7_BFE(opcode,8,3);
+    m->base = 13;
+    m->offset = ARM7_BFE(opcode,0,8)*4;
+  }else return false;
+  return true;
+}
+// mov eax, r15d; shr eax, shift; mov rdx, pages; lea rdx, [rdx+rax*8]
+static void arm7_jit_page_lookup(arm7_jit_emitter_t* e, const arm7_jit_system_t* sys){
+  arm7_jit_bytes(e,"\x44\x89\xF8\xC1\xE8",5);arm7_jit_u8(e,sys->page_shift);
+  arm7_jit_bytes(e,"\x48\xBA",2);arm7_jit_u64(e,(uintptr_t)sys->pages);
+  arm7_jit_bytes(e,"\x48\x8D\x14\xC2",4);
+}
+// [r12+disp] addressing with the register in reg (0-7) for opcode
+static void arm7_jit_op_user_data(arm7_jit_emitter_t* e, const char* op, int op_size, int reg, uint32_t disp){
+  arm7_jit_u8(e,0x41);arm7_jit_bytes(e,op,op_size);arm7_jit_u8(e,0x84|(reg<<3));arm7_jit_u8(e,0x24);arm7_jit_u32(e,disp);
+}
+// Emits a load/store that runs on the host memory when its page allows it and calls the handler
+// otherwise (after flushing the cycle budget, which is then exhausted so the boundary function sees
+// whatever the handler did)
+static void arm7_jit_emit_mem_op(arm7_jit_emitter_t* e, const arm7_jit_system_t* sys, const arm7_jit_mem_op_t* m, const arm7_decoded_op_t* op){
+  const uint32_t reg = ARM7_JIT_CPU(registers);
+  uint8_t* slow[4];
+  int num_slow = 0;
+  // r15d = address
+  if(m->base<0){arm7_jit_bytes(e,"\x41\xBF",2);arm7_jit_u32(e,m->offset);}
+  else{
+    arm7_jit_bytes(e,"\x44\x8B\xBB",3);arm7_jit_u32(e,reg+m->base*4);
+    if(m->index>=0){arm7_jit_bytes(e,"\x44\x03\xBB",3);arm7_jit_u32(e,reg+m->index*4);}
+    if(m->offset){arm7_jit_bytes(e,"\x41\x81\xC7",3);arm7_jit_u32(e,m->offset);}
+  }
+  arm7_jit_bytes(e,"\x41\x81\xFF",3);arm7_jit_u32(e,sys->page_limit);   // cmp r15d, limit
+  slow[num_slow++] = arm7_jit_jump(e,ARM7_JIT_JAE,NULL);
+  arm7_jit_page_lookup(e,sys);
+  uint8_t required = m->load? sys->read_flag: m->size==1? sys->write8_flag: sys->write_flag;
+  bool rom = sys->rom_flag&&m->load&&m->size==4;
+  arm7_jit_bytes(e,"\xF6\x42\x06",3);arm7_jit_u8(e,required);           // test byte [rdx+6], flag
+  slow[num_slow++] = arm7_jit_jump(e,ARM7_JIT_JZ,NULL);
+  if(sys->rom_flag&&!rom){
+    arm7_jit_bytes(e,"\xF6\x42\x06",3);arm7_jit_u8(e,sys->rom_flag);
+    slow[num_slow++] = arm7_jit_jump(e,ARM7_JIT_JNZ,NULL);
+  }
+  // Wait states
+  if(sys->access){
+    arm7_jit_bytes(e,"\x4C\x89\xE7\x44\x89\xFE",6);                   // mov rdi, r12; mov esi, r15d
+    arm7_jit_u8(e,0xBA);arm7_jit_u32(e,m->size==4?3:1);                   // mov edx, request_size
+    arm7_jit_call(e,(const void*)sys->access);
+    arm7_jit_page_lookup(e,sys);
+  }else{
+    arm7_jit_bytes(e,"\x0F\xB6\x42\x07",4);                             // movzx eax, byte [rdx+7]
+    if(m->load)arm7_jit_bytes(e,"\x83\xE0\x0F",3);                      // and eax, 15
+    else arm7_jit_bytes(e,"\xC1\xE8\x04",3);                            // shr eax, 4
+    arm7_jit_op_user_data(e,"\x01",1,0,sys->slow_cycles);                 // add [r12+disp], eax
+  }
+  // rcx = host address of the word around the address
+  arm7_jit_bytes(e,"\x4C\x89\xE1",3);                                    // mov rcx, r12
+  if(rom){
+    arm7_jit_bytes(e,"\xF6\x42\x06",3);arm7_jit_u8(e,sys->rom_flag);
+    arm7_jit_bytes(e,"\x49\x0F\x45\x8C\x24",5);arm7_jit_u32(e,sys->rom_base); // cmovnz rcx, [r12+disp]
+  }
+  arm7_jit_bytes(e,"\x8B\x02\x48\x01\xC1",5);                          // mov eax, [rdx]; add rcx, rax
+  arm7_jit_bytes(e,"\x0F\xB7\x42\x04\x83\xC8\x03\x44\x21\xF8",10);  // movzx eax, word [rdx+4]; or eax, 3; and eax, r15d
+  arm7_jit_bytes(e,"\x83\xE0\xFC\x48\x01\xC1",6);                      // and eax, ~3; add rcx, rax
+  if(m->size<4){
+    arm7_jit_bytes(e,"\x44\x89\xFE\x83\xE6",5);arm7_jit_u8(e,m->size==2?2:3); // mov esi, r15d; and esi, byte offset
+  }
+  if(m->load){
+    if(m->size==4)arm7_jit_bytes(e,"\x8B\x01",2);                        // mov eax, [rcx]
+    else if(m->size==2)arm7_jit_bytes(e,"\x0F\xB7\x04\x31",4);         // movzx eax, word [rcx+rsi]
+    else arm7_jit_bytes(e,"\x0F\xB6\x04\x31",4);                       // movzx eax, byte [rcx+rsi]
+    if(sys->openbus_word&&m->size<4){
+      arm7_jit_bytes(e,"\x8B\x39",2);                                    // mov edi, [rcx]
+      arm7_jit_op_user_data(e,"\x89",1,7,sys->openbus);
+    }else arm7_jit_op_user_data(e,"\x89",1,0,sys->openbus);
+    if(m->size>1){
+      // Misaligned loads rotate
+      arm7_jit_bytes(e,"\x44\x89\xF9\x83\xE1",5);arm7_jit_u8(e,m->size-1); // mov ecx, r15d; and ecx, size-1
+      arm7_jit_bytes(e,"\xC1\xE1\x03\xD3\xC8",5);                      // shl ecx, 3; ror eax, cl
+    }
+    arm7_jit_store_eax_cpu(e,reg+m->rd*4);
+    if(m->arm)arm7_jit_store32_cpu(e,ARM7_JIT_CPU(i_cycles),1);
+    else arm7_jit_add32_cpu(e,ARM7_JIT_CPU(i_cycles),1);
+  }else{
+    arm7_jit_load_eax_cpu(e,reg+m->rd*4);
+    if(sys->openbus_word){
+      arm7_jit_bytes(e,"\x8B\x39",2);
+      arm7_jit_op_user_data(e,"\x89",1,7,sys->openbus);
+    }else{
+      if(m->size==2)arm7_jit_bytes(e,"\x0F\xB7\xC0",3);                 // movzx eax, ax
+      if(m->size==1)arm7_jit_bytes(e,"\x0F\xB6\xC0",3);                 // movzx eax, al
+      arm7_jit_op_user_data(e,"\x89",1,0,sys->openbus);
+    }
+    if(m->size==4)arm7_jit_bytes(e,"\x89\x01",2);                        // mov [rcx], eax
+    else if(m->size==2)arm7_jit_bytes(e,"\x66\x89\x04\x31",4);         // mov [rcx+rsi], ax
+    else arm7_jit_bytes(e,"\x88\x04\x31",3);                            // mov [rcx+rsi], al
+    uint8_t* no_code = NULL;
+    if(sys->code_flag){
+      arm7_jit_bytes(e,"\xF6\x42\x06",3);arm7_jit_u8(e,sys->code_flag);
+      no_code = arm7_jit_jump(e,ARM7_JIT_JZ,NULL);
+    }
+    if(sys->code_write){
+      arm7_jit_bytes(e,"\x4C\x89\xE7\x48\x89\xCE",6);                 // mov rdi, r12; mov rsi, rcx
+      arm7_jit_call(e,(const void*)sys->code_write);
+    }else{
+      // add dword [r13+page_gen+((rcx/ARM7_BLOCK_PAGE_SIZE)&(ARM7_BLOCK_PAGE_TABLE_SIZE-1))*4], 1
+      arm7_jit_bytes(e,"\x48\x89\xC8\x48\xC1\xE8",6);arm7_jit_u8(e,__builtin_ctz(ARM7_BLOCK_PAGE_SIZE));
+      arm7_jit_u8(e,0x25);arm7_jit_u32(e,ARM7_BLOCK_PAGE_TABLE_SIZE-1);
+      arm7_jit_bytes(e,"\x41\x83\x84\x85",4);arm7_jit_u32(e,ARM7_JIT_CACHE(page_gen));arm7_jit_u8(e,1);
+    }
+    if(no_code)arm7_jit_patch(no_code,e->p);
+  }
+  uint8_t* done = arm7_jit_jump(e,0,NULL);
+  for(int i=0;i<num_slow;++i)arm7_jit_patch(slow[i],e->p);
+  arm7_jit_budget_t* budget = sys->budget;
+  if(budget){
+    arm7_jit_bytes(e,"\x48\xB8",2);arm7_jit_u64(e,(uintptr_t)budget);   // mov rax, budget
+    arm7_jit_bytes(e,"\x48\x8B\xB8",3);arm7_jit_u32(e,offsetof(arm7_jit_budget_t,ctx)); // mov rdi, [rax+ctx]
+    arm7_jit_call(e,(const void*)budget->flush);
+  }
+  arm7_jit_bytes(e,"\x48\x89\xDF",3);
+  arm7_jit_u8(e,0xBE);arm7_jit_u32(e,op->opcode);
+  arm7_jit_call(e,(const void*)op->handler);
+  if(budget){
+    arm7_jit_bytes(e,"\x48\xB8",2);arm7_jit_u64(e,(uintptr_t)budget);
+    arm7_jit_bytes(e,"\xC7\x80",2);arm7_jit_u32(e,offsetof(arm7_jit_budget_t,cycles));arm7_jit_u32(e,0); // mov dword [rax+cycles], 0
+  }
+  arm7_jit_patch(done,e->p);
+}
+// Skips the call to the boundary function if the cycles of the instruction fit in the budget,
+// returns where to patch the jump to the boundary call
+static uint8_t* arm7_jit_emit_budget(arm7_jit_emitter_t* e, const arm7_jit_budget_t* budget, uint8_t** boundary_call){
+  arm7_jit_bytes(e,"\x48\xBA",2);arm7_jit_u64(e,(uintptr_t)budget);     // mov rdx, budget
+  arm7_jit_op_user_data(e,"\x8B",1,0,budget->counter);                    // mov eax, [r12+counter]
+  arm7_jit_bytes(e,"\x03\x83",2);arm7_jit_u32(e,ARM7_JIT_CPU(i_cycles)); // add eax, [rbx+i_cycles]
+  arm7_jit_bytes(e,"\x3B\x82",2);arm7_jit_u32(e,offsetof(arm7_jit_budget_t,cycles)); // cmp eax, [rdx+cycles]
+  boundary_call[0] = arm7_jit_jump(e,ARM7_JIT_JGE,NULL);
+  arm7_jit_bytes(e,"\x80\xBB",2);arm7_jit_u32(e,ARM7_JIT_CPU(trigger_breakpoint));arm7_jit_u8(e,0); // cmp byte [rbx+disp], 0
+  boundary_call[1] = arm7_jit_jump(e,ARM7_JIT_JNZ,NULL);
+  arm7_jit_bytes(e,"\x29\x82",2);arm7_jit_u32(e,offsetof(arm7_jit_budget_t,cycles));  // sub [rdx+cycles], eax
+  arm7_jit_bytes(e,"\x01\x82",2);arm7_jit_u32(e,offsetof(arm7_jit_budget_t,pending)); // add [rdx+pending], eax
+  arm7_jit_bytes(e,"\x48\x83\x82",3);arm7_jit_u32(e,offsetof(arm7_jit_budget_t,skipped));arm7_jit_u8(e,1); // add qword [rdx+skipped], 1
+  arm7_jit_op_user_data(e,"\xC7",1,0,budget->counter);arm7_jit_u32(e,0);  // mov dword [r12+counter], 0
+  arm7_jit_store32_cpu(e,ARM7_JIT_CPU(i_cycles),0);
+  return arm7_jit_jump(e,0,NULL);
+}
+
+static bool arm7_jit_check_cond(arm7_t* cpu, uint32_t opcode){return arm7_check_cond_code(cpu,opcode);}
+// Finishes an instruction whose block was invalidated by its own execution (the pipelined fetch has
+// to see the new code)
+static void arm7_jit_refill(arm7_t* cpu){
+  bool thumb = arm7_get_thumb_bit(cpu);
+  if(cpu->prefetch_pc==cpu->registers[PC])cpu->prefetch_opcode[2]=arm7_block_fetch_opcode(cpu,cpu->registers[PC]+(thumb?4:8),thumb,cpu->next_fetch_sequential,2,cpu->arm_handlers? cpu->arm_handlers: arm7_lookup_table,cpu->thumb_handlers? cpu->thumb_handlers: arm7t_lookup_table);
+}
+static void arm9_jit_refill(arm7_t* cpu){
+  bool thumb = arm7_get_thumb_bit(cpu);
+  if(cpu->prefetch_pc==cpu->registers[PC])cpu->prefetch_opcode[2]=arm7_block_fetch_opcode(cpu,cpu->registers[PC]+(thumb?4:8),thumb,cpu->next_fetch_sequential,2,cpu->arm_handlers? cpu->arm_handlers: arm9_lookup_table,cpu->thumb_handlers? cpu->thumb_handlers: arm9t_lookup_table);
+}
+static void arm7_jit_free(arm7_jit_t* jit){
+  if(jit->code)munmap(jit->code,ARM7_JIT_CODE_SIZE);
+  jit->code=NULL;
+}
+// The buffer is never writable and executable at the same time, it is switched to read/write while
+// code is emitted and back to read/execute before compiled code runs.
+static bool arm7_jit_set_writable(arm7_jit_t* jit, bool writable){
+  if(jit->writable==writable)return true;
+  if(mprotect(jit->code,ARM7_JIT_CODE_SIZE,writable? PROT_READ|PROT_WRITE: PROT_READ|PROT_EXEC)){
+    printf("Failed to change the protection of the ARM JIT code buffer, using the interpreter\n");
+    arm7_jit_free(jit);
+    jit->unavailable=true;
+    return false;
+  }
+  jit->writable=writable;
+  return true;
+}
+// Drops all compiled code and (re)emits the entry trampoline
+static bool arm7_jit_reset(arm7_jit_t* jit, uint32_t epoch){
+  if(!jit->code){
+    if(jit->unavailable)return false;
+    void* mem = mmap(NULL,ARM7_JIT_CODE_SIZE,PROT_READ|PROT_WRITE,MAP_PRIVATE|MAP_ANONYMOUS,-1,0);
+    if(mem==MAP_FAILED){
+      printf("Failed to allocate memory for the ARM JIT, using the interpreter\n");
+      jit->unavailable=true;
+      return false;
+    }
+    jit->code = (uint8_t*)mem;
+    jit->writable = true;
+  }
+  if(!arm7_jit_set_writable(jit,true))return false;
+  arm7_jit_emitter_t e = {jit->code};
+  // push rbx, r12-r15; mov rbx,rdi; mov r12,rsi; mov r13,rdx; mov r14,rcx; jmp r8
+  arm7_jit_bytes(&e,"\x53\x41\x54\x41\x55\x41\x56\x41\x57",9);
+  arm7_jit_bytes(&e,"\x48\x89\xFB\x49\x89\xF4\x49\x89\xD5\x49\x89\xCE",12);
+  arm7_jit_bytes(&e,"\x41\xFF\xE0",3);
+  jit->exit_offset = e.p-jit->code;
+  // pop r15-r12, rbx; ret
+  arm7_jit_bytes(&e,"\x41\x5F\x41\x5E\x41\x5D\x41\x5C\x5B\xC3",10);
+  jit->used = e.p-jit->code;
+  jit->epoch = epoch;
+  jit->boundary = NULL;
+  for(int i=0;i<ARM7_BLOCK_CACHE_SIZE;++i)jit->blocks[i].build=0;
+  return true;
+}
+// Compiled code for instruction i of a block mirrors the steady state of arm7_exec_cached_instruction
+// (no refetch needed, the pipeline holds ops i..i+2 of the block). The last three ops of a block get no
+// code since their pipelined fetch lands outside of it.
+static bool arm7_jit_compile(arm7_jit_t* jit, arm7_t* cpu, arm7_block_t* block, arm7_jit_block_t* jb, arm7_boundary_fn_t boundary, bool arm9){
+  arm7_block_cache_t* cache = cpu->block_cache;
+  int size = block->thumb?2:4;
+  int ops = (block->end_pc-block->start_pc)/size;
+  jb->code = jit->code;
+  jb->count = ops>3? ops-3: 0;
+  if(jb->count==0)return true;
+  if(jit->used+ARM7_JIT_MAX_BLOCK_CODE>ARM7_JIT_CODE_SIZE){
+    // Out of space, start over. Flushing the cache invalidates every block compiled so far.
+    arm7_block_cache_flush(cache);
+    jb->count = 0;
+    return false;
+  }
+  if(!arm7_jit_set_writable(jit,true)){
+    jb->count = 0;
+    return false;
+  }
+  arm7_jit_emitter_t e = {jit->code+jit->used};
+  uint8_t* block_code = e.p;
+  const uint8_t* exit = jit->code+jit->exit_offset;
+  uint8_t* branch_exits[ARM7_BLOCK_MAX_INSTRUCTIONS];
+  uint8_t* refill_exits[ARM7_BLOCK_MAX_INSTRUCTIONS*2];
+  int num_refill_exits=0;
+  uint32_t reg_pc = ARM7_JIT_CPU(registers)+PC*4;
+  const arm7_jit_system_t* sys = &jit->system;
+  // Ops that leave the hardware alone unless they call their handler (which flushes the budget)
+  bool simple[ARM7_BLOCK_MAX_INSTRUCTIONS];
+  bool inline_mem[ARM7_BLOCK_MAX_INSTRUCTIONS];
+  arm7_jit_mem_op_t mem_ops[ARM7_BLOCK_MAX_INSTRUCTIONS];
+  for(int i=0;i<(int)jb->count;++i){
+    inline_mem[i] = sys->pages&&arm7_jit_decode_mem_op(block->ops[i].opcode,block->thumb,block->start_pc+i*size,&mem_ops[i]);
+    simple[i] = inline_mem[i]||arm7_jit_alu_op(block->ops[i].opcode,block->thumb);
+  }
+  for(int i=0;i<(int)jb->count;++i){
+    const arm7_decoded_op_t* op = &block->ops[i];
+    jb->entry[i] = e.p-block_code;
+    // Pipeline shift
+    arm7_jit_store8_cpu(&e,ARM7_JIT_CPU(next_fetch_sequential),1);
+    arm7_jit_store32_cpu(&e,ARM7_JIT_CPU(prefetch_opcode)+0,block->ops[i+1].opcode);
+    arm7_jit_store32_cpu(&e,ARM7_JIT_CPU(prefetch_opcode)+4,block->ops[i+2].opcode);
+    arm7_jit_store_ptr_cache(&e,ARM7_JIT_CACHE(pipeline)+0,&block->ops[i+1]);
+    arm7_jit_store_ptr_cache(&e,ARM7_JIT_CACHE(pipeline)+8,&block->ops[i+2]);
+    arm7_jit_store_ptr_cache(&e,ARM7_JIT_CACHE(pipeline)+16,NULL);
+    arm7_jit_add32_cpu(&e,reg_pc,size);
+    arm7_jit_load_eax_cpu(&e,reg_pc);
+    arm7_jit_store_eax_cpu(&e,ARM7_JIT_CPU(prefetch_pc));
+    // Execute
+    uint8_t* skip = NULL;
+    if(!op->always_execute){
+      arm7_jit_bytes(&e,"\x48\x89\xDF",3);               // mov rdi, rbx
+      arm7_jit_u8(&e,0xBE);arm7_jit_u32(&e,op->opcode);  // mov esi, opcode
+      arm7_jit_call(&e,(const void*)arm7_jit_check_cond);
+      arm7_jit_bytes(&e,"\x84\xC0",2);                   // test al, al
+      skip = arm7_jit_jump(&e,ARM7_JIT_JZ,NULL);
+    }
+    if(inline_mem[i])arm7_jit_emit_mem_op(&e,sys,&mem_ops[i],op);
+    else{
+      arm7_jit_bytes(&e,"\x48\x89\xDF",3);
+      arm7_jit_u8(&e,0xBE);arm7_jit_u32(&e,op->opcode);
+      arm7_jit_call(&e,(const void*)op->handler);
+    }
+    if(skip)arm7_jit_patch(skip,e.p);
+    // Branches leave compiled code, they don't fetch
+    arm7_jit_load_eax_cpu(&e,reg_pc);
+    arm7_jit_cmp_eax_cpu(&e,ARM7_JIT_CPU(prefetch_pc));
+    branch_exits[i] = arm7_jit_jump(&e,ARM7_JIT_JNZ,NULL);
+    // So do writes to the code of this block (or a flush)
+    arm7_jit_cmp32_cache(&e,ARM7_JIT_CACHE(epoch),cache->epoch);
+    refill_exits[num_refill_exits++] = arm7_jit_jump(&e,ARM7_JIT_JNZ,NULL);
+    arm7_jit_cmp32_cache(&e,ARM7_JIT_CACHE(page_gen)+block->page*4,block->page_gen);
+    refill_exits[num_refill_exits++] = arm7_jit_jump(&e,ARM7_JIT_JNZ,NULL);
+    // Pipelined fetch: cached_fetch(user_data, address, host, thumb, next_fetch_sequential)
+    arm7_jit_bytes(&e,"\x4C\x89\xE7",3);                                    // mov rdi, r12
+    arm7_jit_u8(&e,0xBE);arm7_jit_u32(&e,block->start_pc+(i+3)*size);      // mov esi, address
+    arm7_jit_bytes(&e,"\x48\xBA",2);arm7_jit_u64(&e,(uintptr_t)(block->host+(i+3)*size)); // mov rdx, host
+    arm7_jit_u8(&e,0xB9);arm7_jit_u32(&e,block->thumb);                     // mov ecx, thumb
+    arm7_jit_bytes(&e,"\x44\x0F\xB6\x83",4);arm7_jit_u32(&e,ARM7_JIT_CPU(next_fetch_sequential)); // movzx r8d, byte [rbx+disp]
+    arm7_jit_call(&e,(const void*)cpu->cached_fetch);
+    arm7_jit_store32_cpu(&e,ARM7_JIT_CPU(prefetch_opcode)+8,block->ops[i+3].opcode);
+    arm7_jit_store_ptr_cache(&e,ARM7_JIT_CACHE(pipeline)+16,&block->ops[i+3]);
+    // Tick the system and check that the next instruction can run here. Within the cycle budget
+    // the next simple op runs right away, the boundary function has nothing to do but tick clocks.
+    uint8_t* next = NULL;
+    if(sys->budget&&i+1<(int)jb->count&&simple[i]&&simple[i+1]){
+      uint8_t* boundary_call[2];
+      next = arm7_jit_emit_budget(&e,sys->budget,boundary_call);
+      for(int j=0;j<2;++j)arm7_jit_patch(boundary_call[j],e.p);
+    }
+    arm7_jit_bytes(&e,"\x4C\x89\xF7",3);                                    // mov rdi, r14
+    arm7_jit_call(&e,(const void*)boundary);
+    arm7_jit_bytes(&e,"\x84\xC0",2);
+    arm7_jit_jump(&e,ARM7_JIT_JZ,exit);
+    arm7_jit_bytes(&e,"\xF6\x83",2);arm7_jit_u32(&e,ARM7_JIT_CPU(wait_for_interrupt));arm7_jit_u8(&e,1); // test byte [rbx+disp], 1
+    arm7_jit_jump(&e,ARM7_JIT_JNZ,exit);
+    arm7_jit_bytes(&e,"\xF7\x83",2);arm7_jit_u32(&e,ARM7_JIT_CPU(registers)+CPSR*4);arm7_jit_u32(&e,1<<5); // test dword [rbx+disp], T
+    arm7_jit_jump(&e,block->thumb?ARM7_JIT_JZ:ARM7_JIT_JNZ,exit);
+    if(next)arm7_jit_patch(next,e.p);
+  }
+  // Falls through to the exit after the last compiled instruction
+  arm7_jit_jump(&e,0,exit);
+  uint8_t* branch_exit = e.p;
+  arm7_jit_bytes(&e,"\x4C\x89\xF7",3);
+  arm7_jit_call(&e,(const void*)boundary);
+  arm7_jit_jump(&e,0,exit);
+  uint8_t* refill_exit = e.p;
+  arm7_jit_bytes(&e,"\x48\x89\xDF",3);
+  arm7_jit_call(&e,arm9?(const void*)arm9_jit_refill:(const void*)arm7_jit_refill);
+  arm7_jit_bytes(&e,"\x4C\x89\xF7",3);
+  arm7_jit_call(&e,(const void*)boundary);
+  arm7_jit_jump(&e,0,exit);
+  for(int i=0;i<(int)jb->count;++i)arm7_jit_patch(branch_exits[i],branch_exit);
+  for(int i=0;i<num_refill_exits;++i)arm7_jit_patch(refill_exits[i],refill_exit);
+
+  jb->code = block_code;
+  jit->used = e.p-jit->code;
+  jit->compiled_blocks++;
+  return true;
+}
+static FORCE_INLINE const uint8_t* arm_jit_entry(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary, bool arm9){
+  arm7_block_cache_t* cache = cpu->block_cache;
+  if(!cache||jit->unavailable)return NULL;
+  if(SB_UNLIKELY(cpu->wait_for_interrupt||cpu->log_cmp_file||cpu->step_instructions))return NULL;
+  if(cpu->prefetch_pc!=cpu->registers[PC])return NULL;
+  // The pipeline has to hold three consecutive ops of a valid block
+  const arm7_decoded_op_t* op = cache->pipeline[0];
+  if(!op)return NULL;
+  size_t block_index = ((const uint8_t*)op-(const uint8_t*)cache->blocks)/sizeof(arm7_block_t);
+  arm7_block_t* block = &cache->blocks[block_index];
+  uint32_t index = op-block->ops;
+  bool thumb = arm7_get_thumb_bit(cpu);
+  if(block->thumb!=thumb||!block->host||!arm7_block_is_valid(cache,block))return NULL;
+  if(cache->pipeline[1]!=op+1||cache->pipeline[2]!=op+2)return NULL;
+  if(cpu->prefetch_opcode[0]!=op[0].opcode||cpu->prefetch_opcode[1]!=op[1].opcode||cpu->prefetch_opcode[2]!=op[2].opcode)return NULL;
+
+  if(jit->epoch!=cache->epoch||!jit->code||(jit->boundary&&jit->boundary!=boundary)){
+    if(!arm7_jit_reset(jit,cache->epoch))return NULL;
+  }
+  jit->boundary = boundary;
+  arm7_jit_block_t* jb = &jit->blocks[block_index];
+  if(jb->build!=block->build){
+    jb->build = block->build;
+    jb->code = NULL;
+    jb->hits = 0;
+  }
+  if(!jb->code){
+    if(++jb->hits<ARM7_JIT_HOT_THRESHOLD)return NULL;
+    if(!arm7_jit_compile(jit,cpu,block,jb,boundary,arm9))return NULL;
+  }
+  if(index>=jb->count)return NULL;
+  if(!arm7_jit_set_writable(jit,false))return NULL;
+  cache->current = block;
+  return jb->code+jb->entry[index];
+}
+static void arm7_jit_enter(arm7_jit_t* jit, arm7_t* cpu, void* ctx, const uint8_t* entry){
+  jit->runs++;
+  // Nothing skips the boundary function before it has set the budget
+  if(jit->system.budget)jit->system.budget->cycles = 0;
+  ((arm7_jit_enter_fn_t)jit->code)(cpu,cpu->user_data,cpu->block_cache,ctx,entry);
+}
+static FORCE_INLINE bool arm_jit_run(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx, bool arm9){
+  const uint8_t* entry = arm_jit_entry(jit,cpu,boundary,arm9);
+  if(!entry)return false;
+  arm7_jit_enter(jit,cpu,ctx,entry);
+  return true;
+}
+static bool arm7_jit_run(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx){
+  return arm_jit_run(jit,cpu,boundary,ctx,false);
+}
+static bool arm9_jit_run(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx){
+  return arm_jit_run(jit,cpu,boundary,ctx,true);
+}
+static const uint8_t* arm7_jit_entry(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary){return arm_jit_entry(jit,cpu,boundary,false);}
+static const uint8_t* arm9_jit_entry(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary){return arm_jit_entry(jit,cpu,boundary,true);}
+#else
+static bool arm7_jit_run(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx){return false;}
+static bool arm9_jit_run(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary, void* ctx){return false;}
+static const uint8_t* arm7_jit_entry(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary){return NULL;}
+static const uint8_t* arm9_jit_entry(arm7_jit_t* jit, arm7_t* cpu, arm7_boundary_fn_t boundary){return NULL;}
+static void arm7_jit_enter(arm7_jit_t* jit, arm7_t* cpu, void* ctx, const uint8_t* entry){}
+static void arm7_jit_free(arm7_jit_t* jit){}
+#endif
+
+#endif
@@ -0,0 +1,3021 @@
+// This file is autogenerated by tools/gen_arm7_handlers.py do not edit
+
+#ifndef ARM7_SPECIALIZED_H
+#define ARM7_SPECIALIZED_H 1
+
+static void arm7_block_transfer_a800(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08000000u);}
+static void arm7_block_transfer_a810(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08100000u);}
+static void arm7_block_transfer_a820(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08200000u);}
+static void arm7_block_transfer_a830(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08300000u);}
+static void arm7_block_transfer_a840(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08400000u);}
+static void arm7_block_transfer_a850(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08500000u);}
+static void arm7_block_transfer_a860(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08600000u);}
+static void arm7_block_transfer_a870(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08700000u);}
+static void arm7_block_transfer_a880(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08800000u);}
+static void arm7_block_transfer_a890(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08900000u);}
+static void arm7_block_transfer_a8a0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08a00000u);}
+static void arm7_block_transfer_a8b0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08b00000u);}
+static void arm7_block_transfer_a8c0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08c00000u);}
+static void arm7_block_transfer_a8d0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08d00000u);}
+static void arm7_block_transfer_a8e0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08e00000u);}
+static void arm7_block_transfer_a8f0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x08f00000u);}
+static void arm7_block_transfer_a900(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09000000u);}
+static void arm7_block_transfer_a910(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09100000u);}
+static void arm7_block_transfer_a920(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09200000u);}
+static void arm7_block_transfer_a930(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09300000u);}
+static void arm7_block_transfer_a940(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09400000u);}
+static void arm7_block_transfer_a950(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09500000u);}
+static void arm7_block_transfer_a960(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09600000u);}
+static void arm7_block_transfer_a970(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09700000u);}
+static void arm7_block_transfer_a980(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09800000u);}
+static void arm7_block_transfer_a990(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09900000u);}
+static void arm7_block_transfer_a9a0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09a00000u);}
+static void arm7_block_transfer_a9b0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09b00000u);}
+static void arm7_block_transfer_a9c0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09c00000u);}
+static void arm7_block_transfer_a9d0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09d00000u);}
+static void arm7_block_transfer_a9e0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09e00000u);}
+static void arm7_block_transfer_a9f0(arm7_t* cpu, uint32_t opcode){arm7_block_transfer(cpu,(opcode&0xf00fffffu)|0x09f00000u);}
+static void arm7_branch_aa00(arm7_t* cpu, uint32_t opcode){arm7_branch(cpu,(opcode&0xf0ffffffu)|0x0a000000u);}
+static void arm7_branch_ab00(arm7_t* cpu, uint32_t opcode){arm7_branch(cpu,(opcode&0xf0ffffffu)|0x0b000000u);}
+static void arm7_branch_exchange_a121(arm7_t* cpu, uint32_t opcode){arm7_branch_exchange(cpu,(opcode&0xf00fff0fu)|0x01200010u);}
+static void arm7_data_processing_a000(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00000000u);}
+static void arm7_data_processing_a001(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00000010u);}
+static void arm7_data_processing_a002(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00000020u);}
+static void arm7_data_processing_a003(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00000030u);}
+static void arm7_data_processing_a004(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00000040u);}
+static void arm7_data_processing_a005(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00000050u);}
+static void arm7_data_processing_a006(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00000060u);}
+static void arm7_data_processing_a007(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00000070u);}
+static void arm7_data_processing_a008(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00000080u);}
+static void arm7_data_processing_a00a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x000000a0u);}
+static void arm7_data_processing_a00c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x000000c0u);}
+static void arm7_data_processing_a00e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x000000e0u);}
+static void arm7_data_processing_a010(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00100000u);}
+static void arm7_data_processing_a011(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00100010u);}
+static void arm7_data_processing_a012(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00100020u);}
+static void arm7_data_processing_a013(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00100030u);}
+static void arm7_data_processing_a014(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00100040u);}
+static void arm7_data_processing_a015(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00100050u);}
+static void arm7_data_processing_a016(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00100060u);}
+static void arm7_data_processing_a017(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00100070u);}
+static void arm7_data_processing_a018(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00100080u);}
+static void arm7_data_processing_a01a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x001000a0u);}
+static void arm7_data_processing_a01c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x001000c0u);}
+static void arm7_data_processing_a01e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x001000e0u);}
+static void arm7_data_processing_a020(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00200000u);}
+static void arm7_data_processing_a021(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00200010u);}
+static void arm7_data_processing_a022(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00200020u);}
+static void arm7_data_processing_a023(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00200030u);}
+static void arm7_data_processing_a024(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00200040u);}
+static void arm7_data_processing_a025(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00200050u);}
+static void arm7_data_processing_a026(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00200060u);}
+static void arm7_data_processing_a027(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00200070u);}
+static void arm7_data_processing_a028(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00200080u);}
+static void arm7_data_processing_a02a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x002000a0u);}
+static void arm7_data_processing_a02c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x002000c0u);}
+static void arm7_data_processing_a02e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x002000e0u);}
+static void arm7_data_processing_a030(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00300000u);}
+static void arm7_data_processing_a031(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00300010u);}
+static void arm7_data_processing_a032(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00300020u);}
+static void arm7_data_processing_a033(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00300030u);}
+static void arm7_data_processing_a034(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00300040u);}
+static void arm7_data_processing_a035(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00300050u);}
+static void arm7_data_processing_a036(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00300060u);}
+static void arm7_data_processing_a037(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00300070u);}
+static void arm7_data_processing_a038(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00300080u);}
+static void arm7_data_processing_a03a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x003000a0u);}
+static void arm7_data_processing_a03c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x003000c0u);}
+static void arm7_data_processing_a03e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x003000e0u);}
+static void arm7_data_processing_a040(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00400000u);}
+static void arm7_data_processing_a041(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00400010u);}
+static void arm7_data_processing_a042(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00400020u);}
+static void arm7_data_processing_a043(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00400030u);}
+static void arm7_data_processing_a044(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00400040u);}
+static void arm7_data_processing_a045(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00400050u);}
+static void arm7_data_processing_a046(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00400060u);}
+static void arm7_data_processing_a047(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00400070u);}
+static void arm7_data_processing_a048(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00400080u);}
+static void arm7_data_processing_a04a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x004000a0u);}
+static void arm7_data_processing_a04c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x004000c0u);}
+static void arm7_data_processing_a04e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x004000e0u);}
+static void arm7_data_processing_a050(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00500000u);}
+static void arm7_data_processing_a051(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00500010u);}
+static void arm7_data_processing_a052(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00500020u);}
+static void arm7_data_processing_a053(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00500030u);}
+static void arm7_data_processing_a054(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00500040u);}
+static void arm7_data_processing_a055(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00500050u);}
+static void arm7_data_processing_a056(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00500060u);}
+static void arm7_data_processing_a057(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00500070u);}
+static void arm7_data_processing_a058(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00500080u);}
+static void arm7_data_processing_a05a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x005000a0u);}
+static void arm7_data_processing_a05c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x005000c0u);}
+static void arm7_data_processing_a05e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x005000e0u);}
+static void arm7_data_processing_a060(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00600000u);}
+static void arm7_data_processing_a061(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00600010u);}
+static void arm7_data_processing_a062(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00600020u);}
+static void arm7_data_processing_a063(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00600030u);}
+static void arm7_data_processing_a064(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00600040u);}
+static void arm7_data_processing_a065(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00600050u);}
+static void arm7_data_processing_a066(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00600060u);}
+static void arm7_data_processing_a067(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00600070u);}
+static void arm7_data_processing_a068(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00600080u);}
+static void arm7_data_processing_a06a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x006000a0u);}
+static void arm7_data_processing_a06c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x006000c0u);}
+static void arm7_data_processing_a06e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x006000e0u);}
+static void arm7_data_processing_a070(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00700000u);}
+static void arm7_data_processing_a071(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00700010u);}
+static void arm7_data_processing_a072(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00700020u);}
+static void arm7_data_processing_a073(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00700030u);}
+static void arm7_data_processing_a074(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00700040u);}
+static void arm7_data_processing_a075(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00700050u);}
+static void arm7_data_processing_a076(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00700060u);}
+static void arm7_data_processing_a077(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00700070u);}
+static void arm7_data_processing_a078(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00700080u);}
+static void arm7_data_processing_a07a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x007000a0u);}
+static void arm7_data_processing_a07c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x007000c0u);}
+static void arm7_data_processing_a07e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x007000e0u);}
+static void arm7_data_processing_a080(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00800000u);}
+static void arm7_data_processing_a081(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00800010u);}
+static void arm7_data_processing_a082(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00800020u);}
+static void arm7_data_processing_a083(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00800030u);}
+static void arm7_data_processing_a084(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00800040u);}
+static void arm7_data_processing_a085(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00800050u);}
+static void arm7_data_processing_a086(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00800060u);}
+static void arm7_data_processing_a087(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00800070u);}
+static void arm7_data_processing_a088(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00800080u);}
+static void arm7_data_processing_a08a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x008000a0u);}
+static void arm7_data_processing_a08c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x008000c0u);}
+static void arm7_data_processing_a08e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x008000e0u);}
+static void arm7_data_processing_a090(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00900000u);}
+static void arm7_data_processing_a091(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00900010u);}
+static void arm7_data_processing_a092(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00900020u);}
+static void arm7_data_processing_a093(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00900030u);}
+static void arm7_data_processing_a094(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00900040u);}
+static void arm7_data_processing_a095(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00900050u);}
+static void arm7_data_processing_a096(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00900060u);}
+static void arm7_data_processing_a097(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00900070u);}
+static void arm7_data_processing_a098(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00900080u);}
+static void arm7_data_processing_a09a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x009000a0u);}
+static void arm7_data_processing_a09c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x009000c0u);}
+static void arm7_data_processing_a09e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x009000e0u);}
+static void arm7_data_processing_a0a0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a00000u);}
+static void arm7_data_processing_a0a1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a00010u);}
+static void arm7_data_processing_a0a2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a00020u);}
+static void arm7_data_processing_a0a3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a00030u);}
+static void arm7_data_processing_a0a4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a00040u);}
+static void arm7_data_processing_a0a5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a00050u);}
+static void arm7_data_processing_a0a6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a00060u);}
+static void arm7_data_processing_a0a7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a00070u);}
+static void arm7_data_processing_a0a8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a00080u);}
+static void arm7_data_processing_a0aa(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a000a0u);}
+static void arm7_data_processing_a0ac(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a000c0u);}
+static void arm7_data_processing_a0ae(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00a000e0u);}
+static void arm7_data_processing_a0b0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b00000u);}
+static void arm7_data_processing_a0b1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b00010u);}
+static void arm7_data_processing_a0b2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b00020u);}
+static void arm7_data_processing_a0b3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b00030u);}
+static void arm7_data_processing_a0b4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b00040u);}
+static void arm7_data_processing_a0b5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b00050u);}
+static void arm7_data_processing_a0b6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b00060u);}
+static void arm7_data_processing_a0b7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b00070u);}
+static void arm7_data_processing_a0b8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b00080u);}
+static void arm7_data_processing_a0ba(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b000a0u);}
+static void arm7_data_processing_a0bc(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b000c0u);}
+static void arm7_data_processing_a0be(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00b000e0u);}
+static void arm7_data_processing_a0c0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c00000u);}
+static void arm7_data_processing_a0c1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c00010u);}
+static void arm7_data_processing_a0c2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c00020u);}
+static void arm7_data_processing_a0c3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c00030u);}
+static void arm7_data_processing_a0c4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c00040u);}
+static void arm7_data_processing_a0c5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c00050u);}
+static void arm7_data_processing_a0c6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c00060u);}
+static void arm7_data_processing_a0c7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c00070u);}
+static void arm7_data_processing_a0c8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c00080u);}
+static void arm7_data_processing_a0ca(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c000a0u);}
+static void arm7_data_processing_a0cc(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c000c0u);}
+static void arm7_data_processing_a0ce(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00c000e0u);}
+static void arm7_data_processing_a0d0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d00000u);}
+static void arm7_data_processing_a0d1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d00010u);}
+static void arm7_data_processing_a0d2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d00020u);}
+static void arm7_data_processing_a0d3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d00030u);}
+static void arm7_data_processing_a0d4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d00040u);}
+static void arm7_data_processing_a0d5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d00050u);}
+static void arm7_data_processing_a0d6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d00060u);}
+static void arm7_data_processing_a0d7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d00070u);}
+static void arm7_data_processing_a0d8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d00080u);}
+static void arm7_data_processing_a0da(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d000a0u);}
+static void arm7_data_processing_a0dc(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d000c0u);}
+static void arm7_data_processing_a0de(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00d000e0u);}
+static void arm7_data_processing_a0e0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e00000u);}
+static void arm7_data_processing_a0e1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e00010u);}
+static void arm7_data_processing_a0e2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e00020u);}
+static void arm7_data_processing_a0e3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e00030u);}
+static void arm7_data_processing_a0e4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e00040u);}
+static void arm7_data_processing_a0e5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e00050u);}
+static void arm7_data_processing_a0e6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e00060u);}
+static void arm7_data_processing_a0e7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e00070u);}
+static void arm7_data_processing_a0e8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e00080u);}
+static void arm7_data_processing_a0ea(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e000a0u);}
+static void arm7_data_processing_a0ec(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e000c0u);}
+static void arm7_data_processing_a0ee(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00e000e0u);}
+static void arm7_data_processing_a0f0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f00000u);}
+static void arm7_data_processing_a0f1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f00010u);}
+static void arm7_data_processing_a0f2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f00020u);}
+static void arm7_data_processing_a0f3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f00030u);}
+static void arm7_data_processing_a0f4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f00040u);}
+static void arm7_data_processing_a0f5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f00050u);}
+static void arm7_data_processing_a0f6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f00060u);}
+static void arm7_data_processing_a0f7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f00070u);}
+static void arm7_data_processing_a0f8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f00080u);}
+static void arm7_data_processing_a0fa(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f000a0u);}
+static void arm7_data_processing_a0fc(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f000c0u);}
+static void arm7_data_processing_a0fe(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x00f000e0u);}
+static void arm7_data_processing_a110(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01100000u);}
+static void arm7_data_processing_a111(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01100010u);}
+static void arm7_data_processing_a112(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01100020u);}
+static void arm7_data_processing_a113(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01100030u);}
+static void arm7_data_processing_a114(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01100040u);}
+static void arm7_data_processing_a115(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01100050u);}
+static void arm7_data_processing_a116(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01100060u);}
+static void arm7_data_processing_a117(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01100070u);}
+static void arm7_data_processing_a118(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01100080u);}
+static void arm7_data_processing_a11a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x011000a0u);}
+static void arm7_data_processing_a11c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x011000c0u);}
+static void arm7_data_processing_a11e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x011000e0u);}
+static void arm7_data_processing_a130(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01300000u);}
+static void arm7_data_processing_a131(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01300010u);}
+static void arm7_data_processing_a132(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01300020u);}
+static void arm7_data_processing_a133(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01300030u);}
+static void arm7_data_processing_a134(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01300040u);}
+static void arm7_data_processing_a135(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01300050u);}
+static void arm7_data_processing_a136(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01300060u);}
+static void arm7_data_processing_a137(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01300070u);}
+static void arm7_data_processing_a138(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01300080u);}
+static void arm7_data_processing_a13a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x013000a0u);}
+static void arm7_data_processing_a13c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x013000c0u);}
+static void arm7_data_processing_a13e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x013000e0u);}
+static void arm7_data_processing_a150(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01500000u);}
+static void arm7_data_processing_a151(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01500010u);}
+static void arm7_data_processing_a152(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01500020u);}
+static void arm7_data_processing_a153(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01500030u);}
+static void arm7_data_processing_a154(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01500040u);}
+static void arm7_data_processing_a155(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01500050u);}
+static void arm7_data_processing_a156(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01500060u);}
+static void arm7_data_processing_a157(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01500070u);}
+static void arm7_data_processing_a158(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01500080u);}
+static void arm7_data_processing_a15a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x015000a0u);}
+static void arm7_data_processing_a15c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x015000c0u);}
+static void arm7_data_processing_a15e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x015000e0u);}
+static void arm7_data_processing_a170(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01700000u);}
+static void arm7_data_processing_a171(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01700010u);}
+static void arm7_data_processing_a172(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01700020u);}
+static void arm7_data_processing_a173(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01700030u);}
+static void arm7_data_processing_a174(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01700040u);}
+static void arm7_data_processing_a175(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01700050u);}
+static void arm7_data_processing_a176(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01700060u);}
+static void arm7_data_processing_a177(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01700070u);}
+static void arm7_data_processing_a178(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01700080u);}
+static void arm7_data_processing_a17a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x017000a0u);}
+static void arm7_data_processing_a17c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x017000c0u);}
+static void arm7_data_processing_a17e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x017000e0u);}
+static void arm7_data_processing_a180(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01800000u);}
+static void arm7_data_processing_a181(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01800010u);}
+static void arm7_data_processing_a182(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01800020u);}
+static void arm7_data_processing_a183(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01800030u);}
+static void arm7_data_processing_a184(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01800040u);}
+static void arm7_data_processing_a185(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01800050u);}
+static void arm7_data_processing_a186(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01800060u);}
+static void arm7_data_processing_a187(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01800070u);}
+static void arm7_data_processing_a188(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01800080u);}
+static void arm7_data_processing_a18a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x018000a0u);}
+static void arm7_data_processing_a18c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x018000c0u);}
+static void arm7_data_processing_a18e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x018000e0u);}
+static void arm7_data_processing_a190(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01900000u);}
+static void arm7_data_processing_a191(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01900010u);}
+static void arm7_data_processing_a192(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01900020u);}
+static void arm7_data_processing_a193(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01900030u);}
+static void arm7_data_processing_a194(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01900040u);}
+static void arm7_data_processing_a195(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01900050u);}
+static void arm7_data_processing_a196(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01900060u);}
+static void arm7_data_processing_a197(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01900070u);}
+static void arm7_data_processing_a198(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01900080u);}
+static void arm7_data_processing_a19a(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x019000a0u);}
+static void arm7_data_processing_a19c(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x019000c0u);}
+static void arm7_data_processing_a19e(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x019000e0u);}
+static void arm7_data_processing_a1a0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a00000u);}
+static void arm7_data_processing_a1a1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a00010u);}
+static void arm7_data_processing_a1a2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a00020u);}
+static void arm7_data_processing_a1a3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a00030u);}
+static void arm7_data_processing_a1a4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a00040u);}
+static void arm7_data_processing_a1a5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a00050u);}
+static void arm7_data_processing_a1a6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a00060u);}
+static void arm7_data_processing_a1a7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a00070u);}
+static void arm7_data_processing_a1a8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a00080u);}
+static void arm7_data_processing_a1aa(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a000a0u);}
+static void arm7_data_processing_a1ac(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a000c0u);}
+static void arm7_data_processing_a1ae(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01a000e0u);}
+static void arm7_data_processing_a1b0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b00000u);}
+static void arm7_data_processing_a1b1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b00010u);}
+static void arm7_data_processing_a1b2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b00020u);}
+static void arm7_data_processing_a1b3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b00030u);}
+static void arm7_data_processing_a1b4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b00040u);}
+static void arm7_data_processing_a1b5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b00050u);}
+static void arm7_data_processing_a1b6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b00060u);}
+static void arm7_data_processing_a1b7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b00070u);}
+static void arm7_data_processing_a1b8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b00080u);}
+static void arm7_data_processing_a1ba(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b000a0u);}
+static void arm7_data_processing_a1bc(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b000c0u);}
+static void arm7_data_processing_a1be(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01b000e0u);}
+static void arm7_data_processing_a1c0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c00000u);}
+static void arm7_data_processing_a1c1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c00010u);}
+static void arm7_data_processing_a1c2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c00020u);}
+static void arm7_data_processing_a1c3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c00030u);}
+static void arm7_data_processing_a1c4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c00040u);}
+static void arm7_data_processing_a1c5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c00050u);}
+static void arm7_data_processing_a1c6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c00060u);}
+static void arm7_data_processing_a1c7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c00070u);}
+static void arm7_data_processing_a1c8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c00080u);}
+static void arm7_data_processing_a1ca(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c000a0u);}
+static void arm7_data_processing_a1cc(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c000c0u);}
+static void arm7_data_processing_a1ce(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01c000e0u);}
+static void arm7_data_processing_a1d0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d00000u);}
+static void arm7_data_processing_a1d1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d00010u);}
+static void arm7_data_processing_a1d2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d00020u);}
+static void arm7_data_processing_a1d3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d00030u);}
+static void arm7_data_processing_a1d4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d00040u);}
+static void arm7_data_processing_a1d5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d00050u);}
+static void arm7_data_processing_a1d6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d00060u);}
+static void arm7_data_processing_a1d7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d00070u);}
+static void arm7_data_processing_a1d8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d00080u);}
+static void arm7_data_processing_a1da(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d000a0u);}
+static void arm7_data_processing_a1dc(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d000c0u);}
+static void arm7_data_processing_a1de(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01d000e0u);}
+static void arm7_data_processing_a1e0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e00000u);}
+static void arm7_data_processing_a1e1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e00010u);}
+static void arm7_data_processing_a1e2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e00020u);}
+static void arm7_data_processing_a1e3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e00030u);}
+static void arm7_data_processing_a1e4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e00040u);}
+static void arm7_data_processing_a1e5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e00050u);}
+static void arm7_data_processing_a1e6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e00060u);}
+static void arm7_data_processing_a1e7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e00070u);}
+static void arm7_data_processing_a1e8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e00080u);}
+static void arm7_data_processing_a1ea(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e000a0u);}
+static void arm7_data_processing_a1ec(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e000c0u);}
+static void arm7_data_processing_a1ee(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01e000e0u);}
+static void arm7_data_processing_a1f0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f00000u);}
+static void arm7_data_processing_a1f1(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f00010u);}
+static void arm7_data_processing_a1f2(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f00020u);}
+static void arm7_data_processing_a1f3(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f00030u);}
+static void arm7_data_processing_a1f4(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f00040u);}
+static void arm7_data_processing_a1f5(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f00050u);}
+static void arm7_data_processing_a1f6(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f00060u);}
+static void arm7_data_processing_a1f7(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f00070u);}
+static void arm7_data_processing_a1f8(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f00080u);}
+static void arm7_data_processing_a1fa(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f000a0u);}
+static void arm7_data_processing_a1fc(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f000c0u);}
+static void arm7_data_processing_a1fe(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fff0fu)|0x01f000e0u);}
+static void arm7_data_processing_a200(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02000000u);}
+static void arm7_data_processing_a210(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02100000u);}
+static void arm7_data_processing_a220(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02200000u);}
+static void arm7_data_processing_a230(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02300000u);}
+static void arm7_data_processing_a240(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02400000u);}
+static void arm7_data_processing_a250(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02500000u);}
+static void arm7_data_processing_a260(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02600000u);}
+static void arm7_data_processing_a270(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02700000u);}
+static void arm7_data_processing_a280(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02800000u);}
+static void arm7_data_processing_a290(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02900000u);}
+static void arm7_data_processing_a2a0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02a00000u);}
+static void arm7_data_processing_a2b0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02b00000u);}
+static void arm7_data_processing_a2c0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02c00000u);}
+static void arm7_data_processing_a2d0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02d00000u);}
+static void arm7_data_processing_a2e0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02e00000u);}
+static void arm7_data_processing_a2f0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x02f00000u);}
+static void arm7_data_processing_a310(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03100000u);}
+static void arm7_data_processing_a330(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03300000u);}
+static void arm7_data_processing_a350(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03500000u);}
+static void arm7_data_processing_a370(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03700000u);}
+static void arm7_data_processing_a380(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03800000u);}
+static void arm7_data_processing_a390(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03900000u);}
+static void arm7_data_processing_a3a0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03a00000u);}
+static void arm7_data_processing_a3b0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03b00000u);}
+static void arm7_data_processing_a3c0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03c00000u);}
+static void arm7_data_processing_a3d0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03d00000u);}
+static void arm7_data_processing_a3e0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03e00000u);}
+static void arm7_data_processing_a3f0(arm7_t* cpu, uint32_t opcode){arm7_data_processing(cpu,(opcode&0xf00fffffu)|0x03f00000u);}
+static void arm7_half_word_transfer_a00b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x000000b0u);}
+static void arm7_half_word_transfer_a01b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x001000b0u);}
+static void arm7_half_word_transfer_a01d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x001000d0u);}
+static void arm7_half_word_transfer_a01f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x001000f0u);}
+static void arm7_half_word_transfer_a02b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x002000b0u);}
+static void arm7_half_word_transfer_a03b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x003000b0u);}
+static void arm7_half_word_transfer_a03d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x003000d0u);}
+static void arm7_half_word_transfer_a03f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x003000f0u);}
+static void arm7_half_word_transfer_a04b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x004000b0u);}
+static void arm7_half_word_transfer_a05b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x005000b0u);}
+static void arm7_half_word_transfer_a05d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x005000d0u);}
+static void arm7_half_word_transfer_a05f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x005000f0u);}
+static void arm7_half_word_transfer_a06b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x006000b0u);}
+static void arm7_half_word_transfer_a07b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x007000b0u);}
+static void arm7_half_word_transfer_a07d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x007000d0u);}
+static void arm7_half_word_transfer_a07f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x007000f0u);}
+static void arm7_half_word_transfer_a08b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x008000b0u);}
+static void arm7_half_word_transfer_a09b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x009000b0u);}
+static void arm7_half_word_transfer_a09d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x009000d0u);}
+static void arm7_half_word_transfer_a09f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x009000f0u);}
+static void arm7_half_word_transfer_a0ab(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00a000b0u);}
+static void arm7_half_word_transfer_a0bb(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00b000b0u);}
+static void arm7_half_word_transfer_a0bd(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00b000d0u);}
+static void arm7_half_word_transfer_a0bf(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00b000f0u);}
+static void arm7_half_word_transfer_a0cb(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00c000b0u);}
+static void arm7_half_word_transfer_a0db(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00d000b0u);}
+static void arm7_half_word_transfer_a0dd(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00d000d0u);}
+static void arm7_half_word_transfer_a0df(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00d000f0u);}
+static void arm7_half_word_transfer_a0eb(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00e000b0u);}
+static void arm7_half_word_transfer_a0fb(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00f000b0u);}
+static void arm7_half_word_transfer_a0fd(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00f000d0u);}
+static void arm7_half_word_transfer_a0ff(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00f000f0u);}
+static void arm7_half_word_transfer_a10b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x010000b0u);}
+static void arm7_half_word_transfer_a11b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x011000b0u);}
+static void arm7_half_word_transfer_a11d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x011000d0u);}
+static void arm7_half_word_transfer_a11f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x011000f0u);}
+static void arm7_half_word_transfer_a12b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x012000b0u);}
+static void arm7_half_word_transfer_a13b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x013000b0u);}
+static void arm7_half_word_transfer_a13d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x013000d0u);}
+static void arm7_half_word_transfer_a13f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x013000f0u);}
+static void arm7_half_word_transfer_a14b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x014000b0u);}
+static void arm7_half_word_transfer_a15b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x015000b0u);}
+static void arm7_half_word_transfer_a15d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x015000d0u);}
+static void arm7_half_word_transfer_a15f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x015000f0u);}
+static void arm7_half_word_transfer_a16b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x016000b0u);}
+static void arm7_half_word_transfer_a17b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x017000b0u);}
+static void arm7_half_word_transfer_a17d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x017000d0u);}
+static void arm7_half_word_transfer_a17f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x017000f0u);}
+static void arm7_half_word_transfer_a18b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x018000b0u);}
+static void arm7_half_word_transfer_a19b(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x019000b0u);}
+static void arm7_half_word_transfer_a19d(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x019000d0u);}
+static void arm7_half_word_transfer_a19f(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x019000f0u);}
+static void arm7_half_word_transfer_a1ab(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01a000b0u);}
+static void arm7_half_word_transfer_a1bb(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01b000b0u);}
+static void arm7_half_word_transfer_a1bd(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01b000d0u);}
+static void arm7_half_word_transfer_a1bf(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01b000f0u);}
+static void arm7_half_word_transfer_a1cb(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01c000b0u);}
+static void arm7_half_word_transfer_a1db(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01d000b0u);}
+static void arm7_half_word_transfer_a1dd(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01d000d0u);}
+static void arm7_half_word_transfer_a1df(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01d000f0u);}
+static void arm7_half_word_transfer_a1eb(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01e000b0u);}
+static void arm7_half_word_transfer_a1fb(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01f000b0u);}
+static void arm7_half_word_transfer_a1fd(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01f000d0u);}
+static void arm7_half_word_transfer_a1ff(arm7_t* cpu, uint32_t opcode){arm7_half_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01f000f0u);}
+static void arm7_mrs_a100(arm7_t* cpu, uint32_t opcode){arm7_mrs(cpu,(opcode&0xf00fff0fu)|0x01000000u);}
+static void arm7_mrs_a140(arm7_t* cpu, uint32_t opcode){arm7_mrs(cpu,(opcode&0xf00fff0fu)|0x01400000u);}
+static void arm7_msr_a120(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x01200000u);}
+static void arm7_msr_a160(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x01600000u);}
+static void arm7_msr_a320(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200000u);}
+static void arm7_msr_a321(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200010u);}
+static void arm7_msr_a322(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200020u);}
+static void arm7_msr_a323(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200030u);}
+static void arm7_msr_a324(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200040u);}
+static void arm7_msr_a325(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200050u);}
+static void arm7_msr_a326(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200060u);}
+static void arm7_msr_a327(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200070u);}
+static void arm7_msr_a328(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200080u);}
+static void arm7_msr_a329(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03200090u);}
+static void arm7_msr_a32a(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x032000a0u);}
+static void arm7_msr_a32b(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x032000b0u);}
+static void arm7_msr_a32c(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x032000c0u);}
+static void arm7_msr_a32d(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x032000d0u);}
+static void arm7_msr_a32e(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x032000e0u);}
+static void arm7_msr_a32f(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x032000f0u);}
+static void arm7_msr_a360(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600000u);}
+static void arm7_msr_a361(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600010u);}
+static void arm7_msr_a362(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600020u);}
+static void arm7_msr_a363(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600030u);}
+static void arm7_msr_a364(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600040u);}
+static void arm7_msr_a365(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600050u);}
+static void arm7_msr_a366(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600060u);}
+static void arm7_msr_a367(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600070u);}
+static void arm7_msr_a368(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600080u);}
+static void arm7_msr_a369(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x03600090u);}
+static void arm7_msr_a36a(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x036000a0u);}
+static void arm7_msr_a36b(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x036000b0u);}
+static void arm7_msr_a36c(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x036000c0u);}
+static void arm7_msr_a36d(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x036000d0u);}
+static void arm7_msr_a36e(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x036000e0u);}
+static void arm7_msr_a36f(arm7_t* cpu, uint32_t opcode){arm7_msr(cpu,(opcode&0xf00fff0fu)|0x036000f0u);}
+static void arm7_multiply_a009(arm7_t* cpu, uint32_t opcode){arm7_multiply(cpu,(opcode&0xf00fff0fu)|0x00000090u);}
+static void arm7_multiply_a019(arm7_t* cpu, uint32_t opcode){arm7_multiply(cpu,(opcode&0xf00fff0fu)|0x00100090u);}
+static void arm7_multiply_a029(arm7_t* cpu, uint32_t opcode){arm7_multiply(cpu,(opcode&0xf00fff0fu)|0x00200090u);}
+static void arm7_multiply_a039(arm7_t* cpu, uint32_t opcode){arm7_multiply(cpu,(opcode&0xf00fff0fu)|0x00300090u);}
+static void arm7_multiply_long_a089(arm7_t* cpu, uint32_t opcode){arm7_multiply_long(cpu,(opcode&0xf00fff0fu)|0x00800090u);}
+static void arm7_multiply_long_a099(arm7_t* cpu, uint32_t opcode){arm7_multiply_long(cpu,(opcode&0xf00fff0fu)|0x00900090u);}
+static void arm7_multiply_long_a0a9(arm7_t* cpu, uint32_t opcode){arm7_multiply_long(cpu,(opcode&0xf00fff0fu)|0x00a00090u);}
+static void arm7_multiply_long_a0b9(arm7_t* cpu, uint32_t opcode){arm7_multiply_long(cpu,(opcode&0xf00fff0fu)|0x00b00090u);}
+static void arm7_multiply_long_a0c9(arm7_t* cpu, uint32_t opcode){arm7_multiply_long(cpu,(opcode&0xf00fff0fu)|0x00c00090u);}
+static void arm7_multiply_long_a0d9(arm7_t* cpu, uint32_t opcode){arm7_multiply_long(cpu,(opcode&0xf00fff0fu)|0x00d00090u);}
+static void arm7_multiply_long_a0e9(arm7_t* cpu, uint32_t opcode){arm7_multiply_long(cpu,(opcode&0xf00fff0fu)|0x00e00090u);}
+static void arm7_multiply_long_a0f9(arm7_t* cpu, uint32_t opcode){arm7_multiply_long(cpu,(opcode&0xf00fff0fu)|0x00f00090u);}
+static void arm7_single_data_swap_a109(arm7_t* cpu, uint32_t opcode){arm7_single_data_swap(cpu,(opcode&0xf00fff0fu)|0x01000090u);}
+static void arm7_single_data_swap_a149(arm7_t* cpu, uint32_t opcode){arm7_single_data_swap(cpu,(opcode&0xf00fff0fu)|0x01400090u);}
+static void arm7_single_word_transfer_a400(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04000000u);}
+static void arm7_single_word_transfer_a410(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04100000u);}
+static void arm7_single_word_transfer_a420(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04200000u);}
+static void arm7_single_word_transfer_a430(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04300000u);}
+static void arm7_single_word_transfer_a440(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04400000u);}
+static void arm7_single_word_transfer_a450(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04500000u);}
+static void arm7_single_word_transfer_a460(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04600000u);}
+static void arm7_single_word_transfer_a470(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04700000u);}
+static void arm7_single_word_transfer_a480(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04800000u);}
+static void arm7_single_word_transfer_a490(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04900000u);}
+static void arm7_single_word_transfer_a4a0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04a00000u);}
+static void arm7_single_word_transfer_a4b0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04b00000u);}
+static void arm7_single_word_transfer_a4c0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04c00000u);}
+static void arm7_single_word_transfer_a4d0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04d00000u);}
+static void arm7_single_word_transfer_a4e0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04e00000u);}
+static void arm7_single_word_transfer_a4f0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04f00000u);}
+static void arm7_single_word_transfer_a500(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05000000u);}
+static void arm7_single_word_transfer_a510(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05100000u);}
+static void arm7_single_word_transfer_a520(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05200000u);}
+static void arm7_single_word_transfer_a530(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05300000u);}
+static void arm7_single_word_transfer_a540(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05400000u);}
+static void arm7_single_word_transfer_a550(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05500000u);}
+static void arm7_single_word_transfer_a560(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05600000u);}
+static void arm7_single_word_transfer_a570(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05700000u);}
+static void arm7_single_word_transfer_a580(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05800000u);}
+static void arm7_single_word_transfer_a590(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05900000u);}
+static void arm7_single_word_transfer_a5a0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05a00000u);}
+static void arm7_single_word_transfer_a5b0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05b00000u);}
+static void arm7_single_word_transfer_a5c0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05c00000u);}
+static void arm7_single_word_transfer_a5d0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05d00000u);}
+static void arm7_single_word_transfer_a5e0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05e00000u);}
+static void arm7_single_word_transfer_a5f0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05f00000u);}
+static void arm7_single_word_transfer_a600(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06000000u);}
+static void arm7_single_word_transfer_a610(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06100000u);}
+static void arm7_single_word_transfer_a620(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06200000u);}
+static void arm7_single_word_transfer_a630(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06300000u);}
+static void arm7_single_word_transfer_a640(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06400000u);}
+static void arm7_single_word_transfer_a650(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06500000u);}
+static void arm7_single_word_transfer_a660(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06600000u);}
+static void arm7_single_word_transfer_a670(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06700000u);}
+static void arm7_single_word_transfer_a680(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06800000u);}
+static void arm7_single_word_transfer_a690(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06900000u);}
+static void arm7_single_word_transfer_a6a0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06a00000u);}
+static void arm7_single_word_transfer_a6b0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06b00000u);}
+static void arm7_single_word_transfer_a6c0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06c00000u);}
+static void arm7_single_word_transfer_a6d0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06d00000u);}
+static void arm7_single_word_transfer_a6e0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06e00000u);}
+static void arm7_single_word_transfer_a6f0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06f00000u);}
+static void arm7_single_word_transfer_a700(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07000000u);}
+static void arm7_single_word_transfer_a710(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07100000u);}
+static void arm7_single_word_transfer_a720(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07200000u);}
+static void arm7_single_word_transfer_a730(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07300000u);}
+static void arm7_single_word_transfer_a740(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07400000u);}
+static void arm7_single_word_transfer_a750(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07500000u);}
+static void arm7_single_word_transfer_a760(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07600000u);}
+static void arm7_single_word_transfer_a770(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07700000u);}
+static void arm7_single_word_transfer_a780(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07800000u);}
+static void arm7_single_word_transfer_a790(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07900000u);}
+static void arm7_single_word_transfer_a7a0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07a00000u);}
+static void arm7_single_word_transfer_a7b0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07b00000u);}
+static void arm7_single_word_transfer_a7c0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07c00000u);}
+static void arm7_single_word_transfer_a7d0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07d00000u);}
+static void arm7_single_word_transfer_a7e0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07e00000u);}
+static void arm7_single_word_transfer_a7f0(arm7_t* cpu, uint32_t opcode){arm7_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07f00000u);}
+static void arm7t_add_off_sp_tb0(arm7_t* cpu, uint32_t opcode){arm7t_add_off_sp(cpu,(opcode&0x00ffu)|0xb000u);}
+static void arm7t_add_sub_t18(arm7_t* cpu, uint32_t opcode){arm7t_add_sub(cpu,(opcode&0x01ffu)|0x1800u);}
+static void arm7t_add_sub_t1a(arm7_t* cpu, uint32_t opcode){arm7t_add_sub(cpu,(opcode&0x01ffu)|0x1a00u);}
+static void arm7t_add_sub_t1c(arm7_t* cpu, uint32_t opcode){arm7t_add_sub(cpu,(opcode&0x01ffu)|0x1c00u);}
+static void arm7t_add_sub_t1e(arm7_t* cpu, uint32_t opcode){arm7t_add_sub(cpu,(opcode&0x01ffu)|0x1e00u);}
+static void arm7t_alu_op_t40(arm7_t* cpu, uint32_t opcode){arm7t_alu_op(cpu,(opcode&0x00ffu)|0x4000u);}
+static void arm7t_alu_op_t41(arm7_t* cpu, uint32_t opcode){arm7t_alu_op(cpu,(opcode&0x00ffu)|0x4100u);}
+static void arm7t_alu_op_t42(arm7_t* cpu, uint32_t opcode){arm7t_alu_op(cpu,(opcode&0x00ffu)|0x4200u);}
+static void arm7t_alu_op_t43(arm7_t* cpu, uint32_t opcode){arm7t_alu_op(cpu,(opcode&0x00ffu)|0x4300u);}
+static void arm7t_branch_te0(arm7_t* cpu, uint32_t opcode){arm7t_branch(cpu,(opcode&0x07ffu)|0xe000u);}
+static void arm7t_cond_branch_td0(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd000u);}
+static void arm7t_cond_branch_td1(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd100u);}
+static void arm7t_cond_branch_td2(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd200u);}
+static void arm7t_cond_branch_td3(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd300u);}
+static void arm7t_cond_branch_td4(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd400u);}
+static void arm7t_cond_branch_td5(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd500u);}
+static void arm7t_cond_branch_td6(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd600u);}
+static void arm7t_cond_branch_td7(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd700u);}
+static void arm7t_cond_branch_td8(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd800u);}
+static void arm7t_cond_branch_td9(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xd900u);}
+static void arm7t_cond_branch_tda(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xda00u);}
+static void arm7t_cond_branch_tdb(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xdb00u);}
+static void arm7t_cond_branch_tdc(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xdc00u);}
+static void arm7t_cond_branch_tdd(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xdd00u);}
+static void arm7t_cond_branch_tde(arm7_t* cpu, uint32_t opcode){arm7t_cond_branch(cpu,(opcode&0x00ffu)|0xde00u);}
+static void arm7t_hi_reg_op_t44(arm7_t* cpu, uint32_t opcode){arm7t_hi_reg_op(cpu,(opcode&0x00ffu)|0x4400u);}
+static void arm7t_hi_reg_op_t45(arm7_t* cpu, uint32_t opcode){arm7t_hi_reg_op(cpu,(opcode&0x00ffu)|0x4500u);}
+static void arm7t_hi_reg_op_t46(arm7_t* cpu, uint32_t opcode){arm7t_hi_reg_op(cpu,(opcode&0x00ffu)|0x4600u);}
+static void arm7t_hi_reg_op_t47(arm7_t* cpu, uint32_t opcode){arm7t_hi_reg_op(cpu,(opcode&0x00ffu)|0x4700u);}
+static void arm7t_imm_off_ldst_bh_t80(arm7_t* cpu, uint32_t opcode){arm7t_imm_off_ldst_bh(cpu,(opcode&0x07ffu)|0x8000u);}
+static void arm7t_imm_off_ldst_bh_t88(arm7_t* cpu, uint32_t opcode){arm7t_imm_off_ldst_bh(cpu,(opcode&0x07ffu)|0x8800u);}
+static void arm7t_imm_off_ldst_t60(arm7_t* cpu, uint32_t opcode){arm7t_imm_off_ldst(cpu,(opcode&0x07ffu)|0x6000u);}
+static void arm7t_imm_off_ldst_t68(arm7_t* cpu, uint32_t opcode){arm7t_imm_off_ldst(cpu,(opcode&0x07ffu)|0x6800u);}
+static void arm7t_imm_off_ldst_t70(arm7_t* cpu, uint32_t opcode){arm7t_imm_off_ldst(cpu,(opcode&0x07ffu)|0x7000u);}
+static void arm7t_imm_off_ldst_t78(arm7_t* cpu, uint32_t opcode){arm7t_imm_off_ldst(cpu,(opcode&0x07ffu)|0x7800u);}
+static void arm7t_ldst_bh_t52(arm7_t* cpu, uint32_t opcode){arm7t_ldst_bh(cpu,(opcode&0x00ffu)|0x5200u);}
+static void arm7t_ldst_bh_t53(arm7_t* cpu, uint32_t opcode){arm7t_ldst_bh(cpu,(opcode&0x00ffu)|0x5300u);}
+static void arm7t_ldst_bh_t56(arm7_t* cpu, uint32_t opcode){arm7t_ldst_bh(cpu,(opcode&0x00ffu)|0x5600u);}
+static void arm7t_ldst_bh_t57(arm7_t* cpu, uint32_t opcode){arm7t_ldst_bh(cpu,(opcode&0x00ffu)|0x5700u);}
+static void arm7t_ldst_bh_t5a(arm7_t* cpu, uint32_t opcode){arm7t_ldst_bh(cpu,(opcode&0x00ffu)|0x5a00u);}
+static void arm7t_ldst_bh_t5b(arm7_t* cpu, uint32_t opcode){arm7t_ldst_bh(cpu,(opcode&0x00ffu)|0x5b00u);}
+static void arm7t_ldst_bh_t5e(arm7_t* cpu, uint32_t opcode){arm7t_ldst_bh(cpu,(opcode&0x00ffu)|0x5e00u);}
+static void arm7t_ldst_bh_t5f(arm7_t* cpu, uint32_t opcode){arm7t_ldst_bh(cpu,(opcode&0x00ffu)|0x5f00u);}
+static void arm7t_load_addr_ta0(arm7_t* cpu, uint32_t opcode){arm7t_load_addr(cpu,(opcode&0x07ffu)|0xa000u);}
+static void arm7t_load_addr_ta8(arm7_t* cpu, uint32_t opcode){arm7t_load_addr(cpu,(opcode&0x07ffu)|0xa800u);}
+static void arm7t_long_branch_link_te8(arm7_t* cpu, uint32_t opcode){arm7t_long_branch_link(cpu,(opcode&0x07ffu)|0xe800u);}
+static void arm7t_long_branch_link_tf0(arm7_t* cpu, uint32_t opcode){arm7t_long_branch_link(cpu,(opcode&0x07ffu)|0xf000u);}
+static void arm7t_long_branch_link_tf8(arm7_t* cpu, uint32_t opcode){arm7t_long_branch_link(cpu,(opcode&0x07ffu)|0xf800u);}
+static void arm7t_mov_cmp_add_sub_imm_t20(arm7_t* cpu, uint32_t opcode){arm7t_mov_cmp_add_sub_imm(cpu,(opcode&0x07ffu)|0x2000u);}
+static void arm7t_mov_cmp_add_sub_imm_t28(arm7_t* cpu, uint32_t opcode){arm7t_mov_cmp_add_sub_imm(cpu,(opcode&0x07ffu)|0x2800u);}
+static void arm7t_mov_cmp_add_sub_imm_t30(arm7_t* cpu, uint32_t opcode){arm7t_mov_cmp_add_sub_imm(cpu,(opcode&0x07ffu)|0x3000u);}
+static void arm7t_mov_cmp_add_sub_imm_t38(arm7_t* cpu, uint32_t opcode){arm7t_mov_cmp_add_sub_imm(cpu,(opcode&0x07ffu)|0x3800u);}
+static void arm7t_mov_shift_reg_t00(arm7_t* cpu, uint32_t opcode){arm7t_mov_shift_reg(cpu,(opcode&0x07ffu)|0x0000u);}
+static void arm7t_mov_shift_reg_t08(arm7_t* cpu, uint32_t opcode){arm7t_mov_shift_reg(cpu,(opcode&0x07ffu)|0x0800u);}
+static void arm7t_mov_shift_reg_t10(arm7_t* cpu, uint32_t opcode){arm7t_mov_shift_reg(cpu,(opcode&0x07ffu)|0x1000u);}
+static void arm7t_mult_ldst_tc0(arm7_t* cpu, uint32_t opcode){arm7t_mult_ldst(cpu,(opcode&0x07ffu)|0xc000u);}
+static void arm7t_mult_ldst_tc8(arm7_t* cpu, uint32_t opcode){arm7t_mult_ldst(cpu,(opcode&0x07ffu)|0xc800u);}
+static void arm7t_pc_rel_ldst_t48(arm7_t* cpu, uint32_t opcode){arm7t_pc_rel_ldst(cpu,(opcode&0x07ffu)|0x4800u);}
+static void arm7t_push_pop_reg_tb4(arm7_t* cpu, uint32_t opcode){arm7t_push_pop_reg(cpu,(opcode&0x00ffu)|0xb400u);}
+static void arm7t_push_pop_reg_tb5(arm7_t* cpu, uint32_t opcode){arm7t_push_pop_reg(cpu,(opcode&0x00ffu)|0xb500u);}
+static void arm7t_push_pop_reg_tbc(arm7_t* cpu, uint32_t opcode){arm7t_push_pop_reg(cpu,(opcode&0x00ffu)|0xbc00u);}
+static void arm7t_push_pop_reg_tbd(arm7_t* cpu, uint32_t opcode){arm7t_push_pop_reg(cpu,(opcode&0x00ffu)|0xbd00u);}
+static void arm7t_reg_off_ldst_t50(arm7_t* cpu, uint32_t opcode){arm7t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5000u);}
+static void arm7t_reg_off_ldst_t51(arm7_t* cpu, uint32_t opcode){arm7t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5100u);}
+static void arm7t_reg_off_ldst_t54(arm7_t* cpu, uint32_t opcode){arm7t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5400u);}
+static void arm7t_reg_off_ldst_t55(arm7_t* cpu, uint32_t opcode){arm7t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5500u);}
+static void arm7t_reg_off_ldst_t58(arm7_t* cpu, uint32_t opcode){arm7t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5800u);}
+static void arm7t_reg_off_ldst_t59(arm7_t* cpu, uint32_t opcode){arm7t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5900u);}
+static void arm7t_reg_off_ldst_t5c(arm7_t* cpu, uint32_t opcode){arm7t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5c00u);}
+static void arm7t_reg_off_ldst_t5d(arm7_t* cpu, uint32_t opcode){arm7t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5d00u);}
+static void arm7t_stack_off_ldst_t90(arm7_t* cpu, uint32_t opcode){arm7t_stack_off_ldst(cpu,(opcode&0x07ffu)|0x9000u);}
+static void arm7t_stack_off_ldst_t98(arm7_t* cpu, uint32_t opcode){arm7t_stack_off_ldst(cpu,(opcode&0x07ffu)|0x9800u);}
+static void arm9_block_transfer_a800(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08000000u);}
+static void arm9_block_transfer_a810(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08100000u);}
+static void arm9_block_transfer_a820(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08200000u);}
+static void arm9_block_transfer_a830(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08300000u);}
+static void arm9_block_transfer_a840(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08400000u);}
+static void arm9_block_transfer_a850(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08500000u);}
+static void arm9_block_transfer_a860(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08600000u);}
+static void arm9_block_transfer_a870(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08700000u);}
+static void arm9_block_transfer_a880(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08800000u);}
+static void arm9_block_transfer_a890(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08900000u);}
+static void arm9_block_transfer_a8a0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08a00000u);}
+static void arm9_block_transfer_a8b0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08b00000u);}
+static void arm9_block_transfer_a8c0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08c00000u);}
+static void arm9_block_transfer_a8d0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08d00000u);}
+static void arm9_block_transfer_a8e0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08e00000u);}
+static void arm9_block_transfer_a8f0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x08f00000u);}
+static void arm9_block_transfer_a900(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09000000u);}
+static void arm9_block_transfer_a910(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09100000u);}
+static void arm9_block_transfer_a920(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09200000u);}
+static void arm9_block_transfer_a930(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09300000u);}
+static void arm9_block_transfer_a940(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09400000u);}
+static void arm9_block_transfer_a950(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09500000u);}
+static void arm9_block_transfer_a960(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09600000u);}
+static void arm9_block_transfer_a970(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09700000u);}
+static void arm9_block_transfer_a980(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09800000u);}
+static void arm9_block_transfer_a990(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09900000u);}
+static void arm9_block_transfer_a9a0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09a00000u);}
+static void arm9_block_transfer_a9b0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09b00000u);}
+static void arm9_block_transfer_a9c0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09c00000u);}
+static void arm9_block_transfer_a9d0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09d00000u);}
+static void arm9_block_transfer_a9e0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09e00000u);}
+static void arm9_block_transfer_a9f0(arm7_t* cpu, uint32_t opcode){arm9_block_transfer(cpu,(opcode&0xf00fffffu)|0x09f00000u);}
+static void arm9_branch_aa00(arm7_t* cpu, uint32_t opcode){arm9_branch(cpu,(opcode&0xf0ffffffu)|0x0a000000u);}
+static void arm9_branch_ab00(arm7_t* cpu, uint32_t opcode){arm9_branch(cpu,(opcode&0xf0ffffffu)|0x0b000000u);}
+static void arm9_branch_link_exchange_a123(arm7_t* cpu, uint32_t opcode){arm9_branch_link_exchange(cpu,(opcode&0xf00fff0fu)|0x01200030u);}
+static void arm9_clz_a161(arm7_t* cpu, uint32_t opcode){arm9_clz(cpu,(opcode&0xf00fff0fu)|0x01600010u);}
+static void arm9_double_word_transfer_a00d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x000000d0u);}
+static void arm9_double_word_transfer_a00f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x000000f0u);}
+static void arm9_double_word_transfer_a02d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x002000d0u);}
+static void arm9_double_word_transfer_a02f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x002000f0u);}
+static void arm9_double_word_transfer_a04d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x004000d0u);}
+static void arm9_double_word_transfer_a04f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x004000f0u);}
+static void arm9_double_word_transfer_a06d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x006000d0u);}
+static void arm9_double_word_transfer_a06f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x006000f0u);}
+static void arm9_double_word_transfer_a08d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x008000d0u);}
+static void arm9_double_word_transfer_a08f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x008000f0u);}
+static void arm9_double_word_transfer_a0ad(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00a000d0u);}
+static void arm9_double_word_transfer_a0af(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00a000f0u);}
+static void arm9_double_word_transfer_a0cd(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00c000d0u);}
+static void arm9_double_word_transfer_a0cf(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00c000f0u);}
+static void arm9_double_word_transfer_a0ed(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00e000d0u);}
+static void arm9_double_word_transfer_a0ef(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x00e000f0u);}
+static void arm9_double_word_transfer_a10d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x010000d0u);}
+static void arm9_double_word_transfer_a10f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x010000f0u);}
+static void arm9_double_word_transfer_a12d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x012000d0u);}
+static void arm9_double_word_transfer_a12f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x012000f0u);}
+static void arm9_double_word_transfer_a14d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x014000d0u);}
+static void arm9_double_word_transfer_a14f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x014000f0u);}
+static void arm9_double_word_transfer_a16d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x016000d0u);}
+static void arm9_double_word_transfer_a16f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x016000f0u);}
+static void arm9_double_word_transfer_a18d(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x018000d0u);}
+static void arm9_double_word_transfer_a18f(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x018000f0u);}
+static void arm9_double_word_transfer_a1ad(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01a000d0u);}
+static void arm9_double_word_transfer_a1af(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01a000f0u);}
+static void arm9_double_word_transfer_a1cd(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01c000d0u);}
+static void arm9_double_word_transfer_a1cf(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01c000f0u);}
+static void arm9_double_word_transfer_a1ed(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01e000d0u);}
+static void arm9_double_word_transfer_a1ef(arm7_t* cpu, uint32_t opcode){arm9_double_word_transfer(cpu,(opcode&0xf00fff0fu)|0x01e000f0u);}
+static void arm9_qadd_qsub_a105(arm7_t* cpu, uint32_t opcode){arm9_qadd_qsub(cpu,(opcode&0xf00fff0fu)|0x01000050u);}
+static void arm9_qadd_qsub_a125(arm7_t* cpu, uint32_t opcode){arm9_qadd_qsub(cpu,(opcode&0xf00fff0fu)|0x01200050u);}
+static void arm9_qadd_qsub_a145(arm7_t* cpu, uint32_t opcode){arm9_qadd_qsub(cpu,(opcode&0xf00fff0fu)|0x01400050u);}
+static void arm9_qadd_qsub_a165(arm7_t* cpu, uint32_t opcode){arm9_qadd_qsub(cpu,(opcode&0xf00fff0fu)|0x01600050u);}
+static void arm9_signed_halfword_multiply_a108(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x01000080u);}
+static void arm9_signed_halfword_multiply_a10a(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x010000a0u);}
+static void arm9_signed_halfword_multiply_a10c(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x010000c0u);}
+static void arm9_signed_halfword_multiply_a10e(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x010000e0u);}
+static void arm9_signed_halfword_multiply_a128(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x01200080u);}
+static void arm9_signed_halfword_multiply_a12a(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x012000a0u);}
+static void arm9_signed_halfword_multiply_a12c(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x012000c0u);}
+static void arm9_signed_halfword_multiply_a12e(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x012000e0u);}
+static void arm9_signed_halfword_multiply_a148(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x01400080u);}
+static void arm9_signed_halfword_multiply_a14a(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x014000a0u);}
+static void arm9_signed_halfword_multiply_a14c(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x014000c0u);}
+static void arm9_signed_halfword_multiply_a14e(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x014000e0u);}
+static void arm9_signed_halfword_multiply_a168(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x01600080u);}
+static void arm9_signed_halfword_multiply_a16a(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x016000a0u);}
+static void arm9_signed_halfword_multiply_a16c(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x016000c0u);}
+static void arm9_signed_halfword_multiply_a16e(arm7_t* cpu, uint32_t opcode){arm9_signed_halfword_multiply(cpu,(opcode&0xf00fff0fu)|0x016000e0u);}
+static void arm9_single_word_transfer_a400(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04000000u);}
+static void arm9_single_word_transfer_a410(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04100000u);}
+static void arm9_single_word_transfer_a420(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04200000u);}
+static void arm9_single_word_transfer_a430(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04300000u);}
+static void arm9_single_word_transfer_a440(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04400000u);}
+static void arm9_single_word_transfer_a450(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04500000u);}
+static void arm9_single_word_transfer_a460(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04600000u);}
+static void arm9_single_word_transfer_a470(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04700000u);}
+static void arm9_single_word_transfer_a480(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04800000u);}
+static void arm9_single_word_transfer_a490(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04900000u);}
+static void arm9_single_word_transfer_a4a0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04a00000u);}
+static void arm9_single_word_transfer_a4b0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04b00000u);}
+static void arm9_single_word_transfer_a4c0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04c00000u);}
+static void arm9_single_word_transfer_a4d0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04d00000u);}
+static void arm9_single_word_transfer_a4e0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04e00000u);}
+static void arm9_single_word_transfer_a4f0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x04f00000u);}
+static void arm9_single_word_transfer_a500(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05000000u);}
+static void arm9_single_word_transfer_a510(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05100000u);}
+static void arm9_single_word_transfer_a520(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05200000u);}
+static void arm9_single_word_transfer_a530(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05300000u);}
+static void arm9_single_word_transfer_a540(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05400000u);}
+static void arm9_single_word_transfer_a550(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05500000u);}
+static void arm9_single_word_transfer_a560(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05600000u);}
+static void arm9_single_word_transfer_a570(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05700000u);}
+static void arm9_single_word_transfer_a580(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05800000u);}
+static void arm9_single_word_transfer_a590(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05900000u);}
+static void arm9_single_word_transfer_a5a0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05a00000u);}
+static void arm9_single_word_transfer_a5b0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05b00000u);}
+static void arm9_single_word_transfer_a5c0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05c00000u);}
+static void arm9_single_word_transfer_a5d0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05d00000u);}
+static void arm9_single_word_transfer_a5e0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05e00000u);}
+static void arm9_single_word_transfer_a5f0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffffu)|0x05f00000u);}
+static void arm9_single_word_transfer_a600(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06000000u);}
+static void arm9_single_word_transfer_a610(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06100000u);}
+static void arm9_single_word_transfer_a620(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06200000u);}
+static void arm9_single_word_transfer_a630(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06300000u);}
+static void arm9_single_word_transfer_a640(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06400000u);}
+static void arm9_single_word_transfer_a650(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06500000u);}
+static void arm9_single_word_transfer_a660(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06600000u);}
+static void arm9_single_word_transfer_a670(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06700000u);}
+static void arm9_single_word_transfer_a680(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06800000u);}
+static void arm9_single_word_transfer_a690(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06900000u);}
+static void arm9_single_word_transfer_a6a0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06a00000u);}
+static void arm9_single_word_transfer_a6b0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06b00000u);}
+static void arm9_single_word_transfer_a6c0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06c00000u);}
+static void arm9_single_word_transfer_a6d0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06d00000u);}
+static void arm9_single_word_transfer_a6e0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06e00000u);}
+static void arm9_single_word_transfer_a6f0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x06f00000u);}
+static void arm9_single_word_transfer_a700(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07000000u);}
+static void arm9_single_word_transfer_a710(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07100000u);}
+static void arm9_single_word_transfer_a720(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07200000u);}
+static void arm9_single_word_transfer_a730(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07300000u);}
+static void arm9_single_word_transfer_a740(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07400000u);}
+static void arm9_single_word_transfer_a750(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07500000u);}
+static void arm9_single_word_transfer_a760(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07600000u);}
+static void arm9_single_word_transfer_a770(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07700000u);}
+static void arm9_single_word_transfer_a780(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07800000u);}
+static void arm9_single_word_transfer_a790(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07900000u);}
+static void arm9_single_word_transfer_a7a0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07a00000u);}
+static void arm9_single_word_transfer_a7b0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07b00000u);}
+static void arm9_single_word_transfer_a7c0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07c00000u);}
+static void arm9_single_word_transfer_a7d0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07d00000u);}
+static void arm9_single_word_transfer_a7e0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07e00000u);}
+static void arm9_single_word_transfer_a7f0(arm7_t* cpu, uint32_t opcode){arm9_single_word_transfer(cpu,(opcode&0xf00fffefu)|0x07f00000u);}
+static void arm9t_hi_reg_op_t44(arm7_t* cpu, uint32_t opcode){arm9t_hi_reg_op(cpu,(opcode&0x00ffu)|0x4400u);}
+static void arm9t_hi_reg_op_t45(arm7_t* cpu, uint32_t opcode){arm9t_hi_reg_op(cpu,(opcode&0x00ffu)|0x4500u);}
+static void arm9t_hi_reg_op_t46(arm7_t* cpu, uint32_t opcode){arm9t_hi_reg_op(cpu,(opcode&0x00ffu)|0x4600u);}
+static void arm9t_hi_reg_op_t47(arm7_t* cpu, uint32_t opcode){arm9t_hi_reg_op(cpu,(opcode&0x00ffu)|0x4700u);}
+static void arm9t_imm_off_ldst_t60(arm7_t* cpu, uint32_t opcode){arm9t_imm_off_ldst(cpu,(opcode&0x07ffu)|0x6000u);}
+static void arm9t_imm_off_ldst_t68(arm7_t* cpu, uint32_t opcode){arm9t_imm_off_ldst(cpu,(opcode&0x07ffu)|0x6800u);}
+static void arm9t_imm_off_ldst_t70(arm7_t* cpu, uint32_t opcode){arm9t_imm_off_ldst(cpu,(opcode&0x07ffu)|0x7000u);}
+static void arm9t_imm_off_ldst_t78(arm7_t* cpu, uint32_t opcode){arm9t_imm_off_ldst(cpu,(opcode&0x07ffu)|0x7800u);}
+static void arm9t_mult_ldst_tc0(arm7_t* cpu, uint32_t opcode){arm9t_mult_ldst(cpu,(opcode&0x07ffu)|0xc000u);}
+static void arm9t_mult_ldst_tc8(arm7_t* cpu, uint32_t opcode){arm9t_mult_ldst(cpu,(opcode&0x07ffu)|0xc800u);}
+static void arm9t_pc_rel_ldst_t48(arm7_t* cpu, uint32_t opcode){arm9t_pc_rel_ldst(cpu,(opcode&0x07ffu)|0x4800u);}
+static void arm9t_push_pop_reg_tb4(arm7_t* cpu, uint32_t opcode){arm9t_push_pop_reg(cpu,(opcode&0x00ffu)|0xb400u);}
+static void arm9t_push_pop_reg_tb5(arm7_t* cpu, uint32_t opcode){arm9t_push_pop_reg(cpu,(opcode&0x00ffu)|0xb500u);}
+static void arm9t_push_pop_reg_tbc(arm7_t* cpu, uint32_t opcode){arm9t_push_pop_reg(cpu,(opcode&0x00ffu)|0xbc00u);}
+static void arm9t_push_pop_reg_tbd(arm7_t* cpu, uint32_t opcode){arm9t_push_pop_reg(cpu,(opcode&0x00ffu)|0xbd00u);}
+static void arm9t_reg_off_ldst_t50(arm7_t* cpu, uint32_t opcode){arm9t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5000u);}
+static void arm9t_reg_off_ldst_t51(arm7_t* cpu, uint32_t opcode){arm9t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5100u);}
+static void arm9t_reg_off_ldst_t54(arm7_t* cpu, uint32_t opcode){arm9t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5400u);}
+static void arm9t_reg_off_ldst_t55(arm7_t* cpu, uint32_t opcode){arm9t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5500u);}
+static void arm9t_reg_off_ldst_t58(arm7_t* cpu, uint32_t opcode){arm9t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5800u);}
+static void arm9t_reg_off_ldst_t59(arm7_t* cpu, uint32_t opcode){arm9t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5900u);}
+static void arm9t_reg_off_ldst_t5c(arm7_t* cpu, uint32_t opcode){arm9t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5c00u);}
+static void arm9t_reg_off_ldst_t5d(arm7_t* cpu, uint32_t opcode){arm9t_reg_off_ldst(cpu,(opcode&0x00ffu)|0x5d00u);}
+static void arm9t_stack_off_ldst_t90(arm7_t* cpu, uint32_t opcode){arm9t_stack_off_ldst(cpu,(opcode&0x07ffu)|0x9000u);}
+static void arm9t_stack_off_ldst_t98(arm7_t* cpu, uint32_t opcode){arm9t_stack_off_ldst(cpu,(opcode&0x07ffu)|0x9800u);}
+
+static const arm7_handler_t arm7_specialized_lookup_table[4096]={
+  arm7_data_processing_a000, arm7_data_processing_a001, arm7_data_processing_a002, arm7_data_processing_a003,
+  arm7_data_processing_a004, arm7_data_processing_a005, arm7_data_processing_a006, arm7_data_processing_a007,
+  arm7_data_processing_a008, arm7_multiply_a009, arm7_data_processing_a00a, arm7_half_word_transfer_a00b,
+  arm7_data_processing_a00c, arm7_undefined, arm7_data_processing_a00e, arm7_undefined,
+  arm7_data_processing_a010, arm7_data_processing_a011, arm7_data_processing_a012, arm7_data_processing_a013,
+  arm7_data_processing_a014, arm7_data_processing_a015, arm7_data_processing_a016, arm7_data_processing_a017,
+  arm7_data_processing_a018, arm7_multiply_a019, arm7_data_processing_a01a, arm7_half_word_transfer_a01b,
+  arm7_data_processing_a01c, arm7_half_word_transfer_a01d, arm7_data_processing_a01e, arm7_half_word_transfer_a01f,
+  arm7_data_processing_a020, arm7_data_processing_a021, arm7_data_processing_a022, arm7_data_processing_a023,
+  arm7_data_processing_a024, arm7_data_processing_a025, arm7_data_processing_a026, arm7_data_processing_a027,
+  arm7_data_processing_a028, arm7_multiply_a029, arm7_data_processing_a02a, arm7_half_word_transfer_a02b,
+  arm7_data_processing_a02c, arm7_undefined, arm7_data_processing_a02e, arm7_undefined,
+  arm7_data_processing_a030, arm7_data_processing_a031, arm7_data_processing_a032, arm7_data_processing_a033,
+  arm7_data_processing_a034, arm7_data_processing_a035, arm7_data_processing_a036, arm7_data_processing_a037,
+  arm7_data_processing_a038, arm7_multiply_a039, arm7_data_processing_a03a, arm7_half_word_transfer_a03b,
+  arm7_data_processing_a03c, arm7_half_word_transfer_a03d, arm7_data_processing_a03e, arm7_half_word_transfer_a03f,
+  arm7_data_processing_a040, arm7_data_processing_a041, arm7_data_processing_a042, arm7_data_processing_a043,
+  arm7_data_processing_a044, arm7_data_processing_a045, arm7_data_processing_a046, arm7_data_processing_a047,
+  arm7_data_processing_a048, arm7_undefined, arm7_data_processing_a04a, arm7_half_word_transfer_a04b,
+  arm7_data_processing_a04c, arm7_undefined, arm7_data_processing_a04e, arm7_undefined,
+  arm7_data_processing_a050, arm7_data_processing_a051, arm7_data_processing_a052, arm7_data_processing_a053,
+  arm7_data_processing_a054, arm7_data_processing_a055, arm7_data_processing_a056, arm7_data_processing_a057,
+  arm7_data_processing_a058, arm7_undefined, arm7_data_processing_a05a, arm7_half_word_transfer_a05b,
+  arm7_data_processing_a05c, arm7_half_word_transfer_a05d, arm7_data_processing_a05e, arm7_half_word_transfer_a05f,
+  arm7_data_processing_a060, arm7_data_processing_a061, arm7_data_processing_a062, arm7_data_processing_a063,
+  arm7_data_processing_a064, arm7_data_processing_a065, arm7_data_processing_a066, arm7_data_processing_a067,
+  arm7_data_processing_a068, arm7_undefined, arm7_data_processing_a06a, arm7_half_word_transfer_a06b,
+  arm7_data_processing_a06c, arm7_undefined, arm7_data_processing_a06e, arm7_undefined,
+  arm7_data_processing_a070, arm7_data_processing_a071, arm7_data_processing_a072, arm7_data_processing_a073,
+  arm7_data_processing_a074, arm7_data_processing_a075, arm7_data_processing_a076, arm7_data_processing_a077,
+  arm7_data_processing_a078, arm7_undefined, arm7_data_processing_a07a, arm7_half_word_transfer_a07b,
+  arm7_data_processing_a07c, arm7_half_word_transfer_a07d, arm7_data_processing_a07e, arm7_half_word_transfer_a07f,
+  arm7_data_processing_a080, arm7_data_processing_a081, arm7_data_processing_a082, arm7_data_processing_a083,
+  arm7_data_processing_a084, arm7_data_processing_a085, arm7_data_processing_a086, arm7_data_processing_a087,
+  arm7_data_processing_a088, arm7_multiply_long_a089, arm7_data_processing_a08a, arm7_half_word_transfer_a08b,
+  arm7_data_processing_a08c, arm7_undefined, arm7_data_processing_a08e, arm7_undefined,
+  arm7_data_processing_a090, arm7_data_processing_a091, arm7_data_processing_a092, arm7_data_processing_a093,
+  arm7_data_processing_a094, arm7_data_processing_a095, arm7_data_processing_a096, arm7_data_processing_a097,
+  arm7_data_processing_a098, arm7_multiply_long_a099, arm7_data_processing_a09a, arm7_half_word_transfer_a09b,
+  arm7_data_processing_a09c, arm7_half_word_transfer_a09d, arm7_data_processing_a09e, arm7_half_word_transfer_a09f,
+  arm7_data_processing_a0a0, arm7_data_processing_a0a1, arm7_data_processing_a0a2, arm7_data_processing_a0a3,
+  arm7_data_processing_a0a4, arm7_data_processing_a0a5, arm7_data_processing_a0a6, arm7_data_processing_a0a7,
+  arm7_data_processing_a0a8, arm7_multiply_long_a0a9, arm7_data_processing_a0aa, arm7_half_word_transfer_a0ab,
+  arm7_data_processing_a0ac, arm7_undefined, arm7_data_processing_a0ae, arm7_undefined,
+  arm7_data_processing_a0b0, arm7_data_processing_a0b1, arm7_data_processing_a0b2, arm7_data_processing_a0b3,
+  arm7_data_processing_a0b4, arm7_data_processing_a0b5, arm7_data_processing_a0b6, arm7_data_processing_a0b7,
+  arm7_data_processing_a0b8, arm7_multiply_long_a0b9, arm7_data_processing_a0ba, arm7_half_word_transfer_a0bb,
+  arm7_data_processing_a0bc, arm7_half_word_transfer_a0bd, arm7_data_processing_a0be, arm7_half_word_transfer_a0bf,
+  arm7_data_processing_a0c0, arm7_data_processing_a0c1, arm7_data_processing_a0c2, arm7_data_processing_a0c3,
+  arm7_data_processing_a0c4, arm7_data_processing_a0c5, arm7_data_processing_a0c6, arm7_data_processing_a0c7,
+  arm7_data_processing_a0c8, arm7_multiply_long_a0c9, arm7_data_processing_a0ca, arm7_half_word_transfer_a0cb,
+  arm7_data_processing_a0cc, arm7_undefined, arm7_data_processing_a0ce, arm7_undefined,
+  arm7_data_processing_a0d0, arm7_data_processing_a0d1, arm7_data_processing_a0d2, arm7_data_processing_a0d3,
+  arm7_data_processing_a0d4, arm7_data_processing_a0d5, arm7_data_processing_a0d6, arm7_data_processing_a0d7,
+  arm7_data_processing_a0d8, arm7_multiply_long_a0d9, arm7_data_processing_a0da, arm7_half_word_transfer_a0db,
+  arm7_data_processing_a0dc, arm7_half_word_transfer_a0dd, arm7_data_processing_a0de, arm7_half_word_transfer_a0df,
+  arm7_data_processing_a0e0, arm7_data_processing_a0e1, arm7_data_processing_a0e2, arm7_data_processing_a0e3,
+  arm7_data_processing_a0e4, arm7_data_processing_a0e5, arm7_data_processing_a0e6, arm7_data_processing_a0e7,
+  arm7_data_processing_a0e8, arm7_multiply_long_a0e9, arm7_data_processing_a0ea, arm7_half_word_transfer_a0eb,
+  arm7_data_processing_a0ec, arm7_undefined, arm7_data_processing_a0ee, arm7_undefined,
+  arm7_data_processing_a0f0, arm7_data_processing_a0f1, arm7_data_processing_a0f2, arm7_data_processing_a0f3,
+  arm7_data_processing_a0f4, arm7_data_processing_a0f5, arm7_data_processing_a0f6, arm7_data_processing_a0f7,
+  arm7_data_processing_a0f8, arm7_multiply_long_a0f9, arm7_data_processing_a0fa, arm7_half_word_transfer_a0fb,
+  arm7_data_processing_a0fc, arm7_half_word_transfer_a0fd, arm7_data_processing_a0fe, arm7_half_word_transfer_a0ff,
+  arm7_mrs_a100, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_single_data_swap_a109, arm7_undefined, arm7_half_word_transfer_a10b,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_data_processing_a110, arm7_data_processing_a111, arm7_data_processing_a112, arm7_data_processing_a113,
+  arm7_data_processing_a114, arm7_data_processing_a115, arm7_data_processing_a116, arm7_data_processing_a117,
+  arm7_data_processing_a118, arm7_undefined, arm7_data_processing_a11a, arm7_half_word_transfer_a11b,
+  arm7_data_processing_a11c, arm7_half_word_transfer_a11d, arm7_data_processing_a11e, arm7_half_word_transfer_a11f,
+  arm7_msr_a120, arm7_branch_exchange_a121, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_half_word_transfer_a12b,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_data_processing_a130, arm7_data_processing_a131, arm7_data_processing_a132, arm7_data_processing_a133,
+  arm7_data_processing_a134, arm7_data_processing_a135, arm7_data_processing_a136, arm7_data_processing_a137,
+  arm7_data_processing_a138, arm7_undefined, arm7_data_processing_a13a, arm7_half_word_transfer_a13b,
+  arm7_data_processing_a13c, arm7_half_word_transfer_a13d, arm7_data_processing_a13e, arm7_half_word_transfer_a13f,
+  arm7_mrs_a140, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_single_data_swap_a149, arm7_undefined, arm7_half_word_transfer_a14b,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_data_processing_a150, arm7_data_processing_a151, arm7_data_processing_a152, arm7_data_processing_a153,
+  arm7_data_processing_a154, arm7_data_processing_a155, arm7_data_processing_a156, arm7_data_processing_a157,
+  arm7_data_processing_a158, arm7_undefined, arm7_data_processing_a15a, arm7_half_word_transfer_a15b,
+  arm7_data_processing_a15c, arm7_half_word_transfer_a15d, arm7_data_processing_a15e, arm7_half_word_transfer_a15f,
+  arm7_msr_a160, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_half_word_transfer_a16b,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_data_processing_a170, arm7_data_processing_a171, arm7_data_processing_a172, arm7_data_processing_a173,
+  arm7_data_processing_a174, arm7_data_processing_a175, arm7_data_processing_a176, arm7_data_processing_a177,
+  arm7_data_processing_a178, arm7_undefined, arm7_data_processing_a17a, arm7_half_word_transfer_a17b,
+  arm7_data_processing_a17c, arm7_half_word_transfer_a17d, arm7_data_processing_a17e, arm7_half_word_transfer_a17f,
+  arm7_data_processing_a180, arm7_data_processing_a181, arm7_data_processing_a182, arm7_data_processing_a183,
+  arm7_data_processing_a184, arm7_data_processing_a185, arm7_data_processing_a186, arm7_data_processing_a187,
+  arm7_data_processing_a188, arm7_undefined, arm7_data_processing_a18a, arm7_half_word_transfer_a18b,
+  arm7_data_processing_a18c, arm7_undefined, arm7_data_processing_a18e, arm7_undefined,
+  arm7_data_processing_a190, arm7_data_processing_a191, arm7_data_processing_a192, arm7_data_processing_a193,
+  arm7_data_processing_a194, arm7_data_processing_a195, arm7_data_processing_a196, arm7_data_processing_a197,
+  arm7_data_processing_a198, arm7_undefined, arm7_data_processing_a19a, arm7_half_word_transfer_a19b,
+  arm7_data_processing_a19c, arm7_half_word_transfer_a19d, arm7_data_processing_a19e, arm7_half_word_transfer_a19f,
+  arm7_data_processing_a1a0, arm7_data_processing_a1a1, arm7_data_processing_a1a2, arm7_data_processing_a1a3,
+  arm7_data_processing_a1a4, arm7_data_processing_a1a5, arm7_data_processing_a1a6, arm7_data_processing_a1a7,
+  arm7_data_processing_a1a8, arm7_undefined, arm7_data_processing_a1aa, arm7_half_word_transfer_a1ab,
+  arm7_data_processing_a1ac, arm7_undefined, arm7_data_processing_a1ae, arm7_undefined,
+  arm7_data_processing_a1b0, arm7_data_processing_a1b1, arm7_data_processing_a1b2, arm7_data_processing_a1b3,
+  arm7_data_processing_a1b4, arm7_data_processing_a1b5, arm7_data_processing_a1b6, arm7_data_processing_a1b7,
+  arm7_data_processing_a1b8, arm7_undefined, arm7_data_processing_a1ba, arm7_half_word_transfer_a1bb,
+  arm7_data_processing_a1bc, arm7_half_word_transfer_a1bd, arm7_data_processing_a1be, arm7_half_word_transfer_a1bf,
+  arm7_data_processing_a1c0, arm7_data_processing_a1c1, arm7_data_processing_a1c2, arm7_data_processing_a1c3,
+  arm7_data_processing_a1c4, arm7_data_processing_a1c5, arm7_data_processing_a1c6, arm7_data_processing_a1c7,
+  arm7_data_processing_a1c8, arm7_undefined, arm7_data_processing_a1ca, arm7_half_word_transfer_a1cb,
+  arm7_data_processing_a1cc, arm7_undefined, arm7_data_processing_a1ce, arm7_undefined,
+  arm7_data_processing_a1d0, arm7_data_processing_a1d1, arm7_data_processing_a1d2, arm7_data_processing_a1d3,
+  arm7_data_processing_a1d4, arm7_data_processing_a1d5, arm7_data_processing_a1d6, arm7_data_processing_a1d7,
+  arm7_data_processing_a1d8, arm7_undefined, arm7_data_processing_a1da, arm7_half_word_transfer_a1db,
+  arm7_data_processing_a1dc, arm7_half_word_transfer_a1dd, arm7_data_processing_a1de, arm7_half_word_transfer_a1df,
+  arm7_data_processing_a1e0, arm7_data_processing_a1e1, arm7_data_processing_a1e2, arm7_data_processing_a1e3,
+  arm7_data_processing_a1e4, arm7_data_processing_a1e5, arm7_data_processing_a1e6, arm7_data_processing_a1e7,
+  arm7_data_processing_a1e8, arm7_undefined, arm7_data_processing_a1ea, arm7_half_word_transfer_a1eb,
+  arm7_data_processing_a1ec, arm7_undefined, arm7_data_processing_a1ee, arm7_undefined,
+  arm7_data_processing_a1f0, arm7_data_processing_a1f1, arm7_data_processing_a1f2, arm7_data_processing_a1f3,
+  arm7_data_processing_a1f4, arm7_data_processing_a1f5, arm7_data_processing_a1f6, arm7_data_processing_a1f7,
+  arm7_data_processing_a1f8, arm7_undefined, arm7_data_processing_a1fa, arm7_half_word_transfer_a1fb,
+  arm7_data_processing_a1fc, arm7_half_word_transfer_a1fd, arm7_data_processing_a1fe, arm7_half_word_transfer_a1ff,
+  arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200,
+  arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200,
+  arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200,
+  arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200,
+  arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210,
+  arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210,
+  arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210,
+  arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210,
+  arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220,
+  arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220,
+  arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220,
+  arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220,
+  arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230,
+  arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230,
+  arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230,
+  arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230,
+  arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240,
+  arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240,
+  arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240,
+  arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240,
+  arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250,
+  arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250,
+  arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250,
+  arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250,
+  arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260,
+  arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260,
+  arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260,
+  arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260,
+  arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270,
+  arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270,
+  arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270,
+  arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270,
+  arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280,
+  arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280,
+  arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280,
+  arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280,
+  arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290,
+  arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290,
+  arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290,
+  arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290,
+  arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0,
+  arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0,
+  arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0,
+  arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0,
+  arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0,
+  arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0,
+  arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0,
+  arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0,
+  arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0,
+  arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0,
+  arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0,
+  arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0,
+  arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0,
+  arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0,
+  arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0,
+  arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0,
+  arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0,
+  arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0,
+  arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0,
+  arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0,
+  arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0,
+  arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0,
+  arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0,
+  arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310,
+  arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310,
+  arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310,
+  arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310,
+  arm7_msr_a320, arm7_msr_a321, arm7_msr_a322, arm7_msr_a323,
+  arm7_msr_a324, arm7_msr_a325, arm7_msr_a326, arm7_msr_a327,
+  arm7_msr_a328, arm7_msr_a329, arm7_msr_a32a, arm7_msr_a32b,
+  arm7_msr_a32c, arm7_msr_a32d, arm7_msr_a32e, arm7_msr_a32f,
+  arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330,
+  arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330,
+  arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330,
+  arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350,
+  arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350,
+  arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350,
+  arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350,
+  arm7_msr_a360, arm7_msr_a361, arm7_msr_a362, arm7_msr_a363,
+  arm7_msr_a364, arm7_msr_a365, arm7_msr_a366, arm7_msr_a367,
+  arm7_msr_a368, arm7_msr_a369, arm7_msr_a36a, arm7_msr_a36b,
+  arm7_msr_a36c, arm7_msr_a36d, arm7_msr_a36e, arm7_msr_a36f,
+  arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370,
+  arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370,
+  arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370,
+  arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370,
+  arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380,
+  arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380,
+  arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380,
+  arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380,
+  arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390,
+  arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390,
+  arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390,
+  arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390,
+  arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0,
+  arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0,
+  arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0,
+  arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0,
+  arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0,
+  arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0,
+  arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0,
+  arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0,
+  arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0,
+  arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0,
+  arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0,
+  arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0,
+  arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0,
+  arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0,
+  arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0,
+  arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0,
+  arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0,
+  arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0,
+  arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0,
+  arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0,
+  arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0,
+  arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0,
+  arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0,
+  arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0,
+  arm7_single_word_transfer_a400, arm7_single_word_transfer_a400, arm7_single_word_transfer_a400, arm7_single_word_transfer_a400,
+  arm7_single_word_transfer_a400, arm7_single_word_transfer_a400, arm7_single_word_transfer_a400, arm7_single_word_transfer_a400,
+  arm7_single_word_transfer_a400, arm7_single_word_transfer_a400, arm7_single_word_transfer_a400, arm7_single_word_transfer_a400,
+  arm7_single_word_transfer_a400, arm7_single_word_transfer_a400, arm7_single_word_transfer_a400, arm7_single_word_transfer_a400,
+  arm7_single_word_transfer_a410, arm7_single_word_transfer_a410, arm7_single_word_transfer_a410, arm7_single_word_transfer_a410,
+  arm7_single_word_transfer_a410, arm7_single_word_transfer_a410, arm7_single_word_transfer_a410, arm7_single_word_transfer_a410,
+  arm7_single_word_transfer_a410, arm7_single_word_transfer_a410, arm7_single_word_transfer_a410, arm7_single_word_transfer_a410,
+  arm7_single_word_transfer_a410, arm7_single_word_transfer_a410, arm7_single_word_transfer_a410, arm7_single_word_transfer_a410,
+  arm7_single_word_transfer_a420, arm7_single_word_transfer_a420, arm7_single_word_transfer_a420, arm7_single_word_transfer_a420,
+  arm7_single_word_transfer_a420, arm7_single_word_transfer_a420, arm7_single_word_transfer_a420, arm7_single_word_transfer_a420,
+  arm7_single_word_transfer_a420, arm7_single_word_transfer_a420, arm7_single_word_transfer_a420, arm7_single_word_transfer_a420,
+  arm7_single_word_transfer_a420, arm7_single_word_transfer_a420, arm7_single_word_transfer_a420, arm7_single_word_transfer_a420,
+  arm7_single_word_transfer_a430, arm7_single_word_transfer_a430, arm7_single_word_transfer_a430, arm7_single_word_transfer_a430,
+  arm7_single_word_transfer_a430, arm7_single_word_transfer_a430, arm7_single_word_transfer_a430, arm7_single_word_transfer_a430,
+  arm7_single_word_transfer_a430, arm7_single_word_transfer_a430, arm7_single_word_transfer_a430, arm7_single_word_transfer_a430,
+  arm7_single_word_transfer_a430, arm7_single_word_transfer_a430, arm7_single_word_transfer_a430, arm7_single_word_transfer_a430,
+  arm7_single_word_transfer_a440, arm7_single_word_transfer_a440, arm7_single_word_transfer_a440, arm7_single_word_transfer_a440,
+  arm7_single_word_transfer_a440, arm7_single_word_transfer_a440, arm7_single_word_transfer_a440, arm7_single_word_transfer_a440,
+  arm7_single_word_transfer_a440, arm7_single_word_transfer_a440, arm7_single_word_transfer_a440, arm7_single_word_transfer_a440,
+  arm7_single_word_transfer_a440, arm7_single_word_transfer_a440, arm7_single_word_transfer_a440, arm7_single_word_transfer_a440,
+  arm7_single_word_transfer_a450, arm7_single_word_transfer_a450, arm7_single_word_transfer_a450, arm7_single_word_transfer_a450,
+  arm7_single_word_transfer_a450, arm7_single_word_transfer_a450, arm7_single_word_transfer_a450, arm7_single_word_transfer_a450,
+  arm7_single_word_transfer_a450, arm7_single_word_transfer_a450, arm7_single_word_transfer_a450, arm7_single_word_transfer_a450,
+  arm7_single_word_transfer_a450, arm7_single_word_transfer_a450, arm7_single_word_transfer_a450, arm7_single_word_transfer_a450,
+  arm7_single_word_transfer_a460, arm7_single_word_transfer_a460, arm7_single_word_transfer_a460, arm7_single_word_transfer_a460,
+  arm7_single_word_transfer_a460, arm7_single_word_transfer_a460, arm7_single_word_transfer_a460, arm7_single_word_transfer_a460,
+  arm7_single_word_transfer_a460, arm7_single_word_transfer_a460, arm7_single_word_transfer_a460, arm7_single_word_transfer_a460,
+  arm7_single_word_transfer_a460, arm7_single_word_transfer_a460, arm7_single_word_transfer_a460, arm7_single_word_transfer_a460,
+  arm7_single_word_transfer_a470, arm7_single_word_transfer_a470, arm7_single_word_transfer_a470, arm7_single_word_transfer_a470,
+  arm7_single_word_transfer_a470, arm7_single_word_transfer_a470, arm7_single_word_transfer_a470, arm7_single_word_transfer_a470,
+  arm7_single_word_transfer_a470, arm7_single_word_transfer_a470, arm7_single_word_transfer_a470, arm7_single_word_transfer_a470,
+  arm7_single_word_transfer_a470, arm7_single_word_transfer_a470, arm7_single_word_transfer_a470, arm7_single_word_transfer_a470,
+  arm7_single_word_transfer_a480, arm7_single_word_transfer_a480, arm7_single_word_transfer_a480, arm7_single_word_transfer_a480,
+  arm7_single_word_transfer_a480, arm7_single_word_transfer_a480, arm7_single_word_transfer_a480, arm7_single_word_transfer_a480,
+  arm7_single_word_transfer_a480, arm7_single_word_transfer_a480, arm7_single_word_transfer_a480, arm7_single_word_transfer_a480,
+  arm7_single_word_transfer_a480, arm7_single_word_transfer_a480, arm7_single_word_transfer_a480, arm7_single_word_transfer_a480,
+  arm7_single_word_transfer_a490, arm7_single_word_transfer_a490, arm7_single_word_transfer_a490, arm7_single_word_transfer_a490,
+  arm7_single_word_transfer_a490, arm7_single_word_transfer_a490, arm7_single_word_transfer_a490, arm7_single_word_transfer_a490,
+  arm7_single_word_transfer_a490, arm7_single_word_transfer_a490, arm7_single_word_transfer_a490, arm7_single_word_transfer_a490,
+  arm7_single_word_transfer_a490, arm7_single_word_transfer_a490, arm7_single_word_transfer_a490, arm7_single_word_transfer_a490,
+  arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0,
+  arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0,
+  arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0,
+  arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0, arm7_single_word_transfer_a4a0,
+  arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0,
+  arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0,
+  arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0,
+  arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0, arm7_single_word_transfer_a4b0,
+  arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0,
+  arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0,
+  arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0,
+  arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0, arm7_single_word_transfer_a4c0,
+  arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0,
+  arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0,
+  arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0,
+  arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0, arm7_single_word_transfer_a4d0,
+  arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0,
+  arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0,
+  arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0,
+  arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0, arm7_single_word_transfer_a4e0,
+  arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0,
+  arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0,
+  arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0,
+  arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0, arm7_single_word_transfer_a4f0,
+  arm7_single_word_transfer_a500, arm7_single_word_transfer_a500, arm7_single_word_transfer_a500, arm7_single_word_transfer_a500,
+  arm7_single_word_transfer_a500, arm7_single_word_transfer_a500, arm7_single_word_transfer_a500, arm7_single_word_transfer_a500,
+  arm7_single_word_transfer_a500, arm7_single_word_transfer_a500, arm7_single_word_transfer_a500, arm7_single_word_transfer_a500,
+  arm7_single_word_transfer_a500, arm7_single_word_transfer_a500, arm7_single_word_transfer_a500, arm7_single_word_transfer_a500,
+  arm7_single_word_transfer_a510, arm7_single_word_transfer_a510, arm7_single_word_transfer_a510, arm7_single_word_transfer_a510,
+  arm7_single_word_transfer_a510, arm7_single_word_transfer_a510, arm7_single_word_transfer_a510, arm7_single_word_transfer_a510,
+  arm7_single_word_transfer_a510, arm7_single_word_transfer_a510, arm7_single_word_transfer_a510, arm7_single_word_transfer_a510,
+  arm7_single_word_transfer_a510, arm7_single_word_transfer_a510, arm7_single_word_transfer_a510, arm7_single_word_transfer_a510,
+  arm7_single_word_transfer_a520, arm7_single_word_transfer_a520, arm7_single_word_transfer_a520, arm7_single_word_transfer_a520,
+  arm7_single_word_transfer_a520, arm7_single_word_transfer_a520, arm7_single_word_transfer_a520, arm7_single_word_transfer_a520,
+  arm7_single_word_transfer_a520, arm7_single_word_transfer_a520, arm7_single_word_transfer_a520, arm7_single_word_transfer_a520,
+  arm7_single_word_transfer_a520, arm7_single_word_transfer_a520, arm7_single_word_transfer_a520, arm7_single_word_transfer_a520,
+  arm7_single_word_transfer_a530, arm7_single_word_transfer_a530, arm7_single_word_transfer_a530, arm7_single_word_transfer_a530,
+  arm7_single_word_transfer_a530, arm7_single_word_transfer_a530, arm7_single_word_transfer_a530, arm7_single_word_transfer_a530,
+  arm7_single_word_transfer_a530, arm7_single_word_transfer_a530, arm7_single_word_transfer_a530, arm7_single_word_transfer_a530,
+  arm7_single_word_transfer_a530, arm7_single_word_transfer_a530, arm7_single_word_transfer_a530, arm7_single_word_transfer_a530,
+  arm7_single_word_transfer_a540, arm7_single_word_transfer_a540, arm7_single_word_transfer_a540, arm7_single_word_transfer_a540,
+  arm7_single_word_transfer_a540, arm7_single_word_transfer_a540, arm7_single_word_transfer_a540, arm7_single_word_transfer_a540,
+  arm7_single_word_transfer_a540, arm7_single_word_transfer_a540, arm7_single_word_transfer_a540, arm7_single_word_transfer_a540,
+  arm7_single_word_transfer_a540, arm7_single_word_transfer_a540, arm7_single_word_transfer_a540, arm7_single_word_transfer_a540,
+  arm7_single_word_transfer_a550, arm7_single_word_transfer_a550, arm7_single_word_transfer_a550, arm7_single_word_transfer_a550,
+  arm7_single_word_transfer_a550, arm7_single_word_transfer_a550, arm7_single_word_transfer_a550, arm7_single_word_transfer_a550,
+  arm7_single_word_transfer_a550, arm7_single_word_transfer_a550, arm7_single_word_transfer_a550, arm7_single_word_transfer_a550,
+  arm7_single_word_transfer_a550, arm7_single_word_transfer_a550, arm7_single_word_transfer_a550, arm7_single_word_transfer_a550,
+  arm7_single_word_transfer_a560, arm7_single_word_transfer_a560, arm7_single_word_transfer_a560, arm7_single_word_transfer_a560,
+  arm7_single_word_transfer_a560, arm7_single_word_transfer_a560, arm7_single_word_transfer_a560, arm7_single_word_transfer_a560,
+  arm7_single_word_transfer_a560, arm7_single_word_transfer_a560, arm7_single_word_transfer_a560, arm7_single_word_transfer_a560,
+  arm7_single_word_transfer_a560, arm7_single_word_transfer_a560, arm7_single_word_transfer_a560, arm7_single_word_transfer_a560,
+  arm7_single_word_transfer_a570, arm7_single_word_transfer_a570, arm7_single_word_transfer_a570, arm7_single_word_transfer_a570,
+  arm7_single_word_transfer_a570, arm7_single_word_transfer_a570, arm7_single_word_transfer_a570, arm7_single_word_transfer_a570,
+  arm7_single_word_transfer_a570, arm7_single_word_transfer_a570, arm7_single_word_transfer_a570, arm7_single_word_transfer_a570,
+  arm7_single_word_transfer_a570, arm7_single_word_transfer_a570, arm7_single_word_transfer_a570, arm7_single_word_transfer_a570,
+  arm7_single_word_transfer_a580, arm7_single_word_transfer_a580, arm7_single_word_transfer_a580, arm7_single_word_transfer_a580,
+  arm7_single_word_transfer_a580, arm7_single_word_transfer_a580, arm7_single_word_transfer_a580, arm7_single_word_transfer_a580,
+  arm7_single_word_transfer_a580, arm7_single_word_transfer_a580, arm7_single_word_transfer_a580, arm7_single_word_transfer_a580,
+  arm7_single_word_transfer_a580, arm7_single_word_transfer_a580, arm7_single_word_transfer_a580, arm7_single_word_transfer_a580,
+  arm7_single_word_transfer_a590, arm7_single_word_transfer_a590, arm7_single_word_transfer_a590, arm7_single_word_transfer_a590,
+  arm7_single_word_transfer_a590, arm7_single_word_transfer_a590, arm7_single_word_transfer_a590, arm7_single_word_transfer_a590,
+  arm7_single_word_transfer_a590, arm7_single_word_transfer_a590, arm7_single_word_transfer_a590, arm7_single_word_transfer_a590,
+  arm7_single_word_transfer_a590, arm7_single_word_transfer_a590, arm7_single_word_transfer_a590, arm7_single_word_transfer_a590,
+  arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0,
+  arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0,
+  arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0,
+  arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0, arm7_single_word_transfer_a5a0,
+  arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0,
+  arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0,
+  arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0,
+  arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0, arm7_single_word_transfer_a5b0,
+  arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0,
+  arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0,
+  arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0,
+  arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0, arm7_single_word_transfer_a5c0,
+  arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0,
+  arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0,
+  arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0,
+  arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0, arm7_single_word_transfer_a5d0,
+  arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0,
+  arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0,
+  arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0,
+  arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0, arm7_single_word_transfer_a5e0,
+  arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0,
+  arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0,
+  arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0,
+  arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0, arm7_single_word_transfer_a5f0,
+  arm7_single_word_transfer_a600, arm7_undefined, arm7_single_word_transfer_a600, arm7_undefined,
+  arm7_single_word_transfer_a600, arm7_undefined, arm7_single_word_transfer_a600, arm7_undefined,
+  arm7_single_word_transfer_a600, arm7_undefined, arm7_single_word_transfer_a600, arm7_undefined,
+  arm7_single_word_transfer_a600, arm7_undefined, arm7_single_word_transfer_a600, arm7_undefined,
+  arm7_single_word_transfer_a610, arm7_undefined, arm7_single_word_transfer_a610, arm7_undefined,
+  arm7_single_word_transfer_a610, arm7_undefined, arm7_single_word_transfer_a610, arm7_undefined,
+  arm7_single_word_transfer_a610, arm7_undefined, arm7_single_word_transfer_a610, arm7_undefined,
+  arm7_single_word_transfer_a610, arm7_undefined, arm7_single_word_transfer_a610, arm7_undefined,
+  arm7_single_word_transfer_a620, arm7_undefined, arm7_single_word_transfer_a620, arm7_undefined,
+  arm7_single_word_transfer_a620, arm7_undefined, arm7_single_word_transfer_a620, arm7_undefined,
+  arm7_single_word_transfer_a620, arm7_undefined, arm7_single_word_transfer_a620, arm7_undefined,
+  arm7_single_word_transfer_a620, arm7_undefined, arm7_single_word_transfer_a620, arm7_undefined,
+  arm7_single_word_transfer_a630, arm7_undefined, arm7_single_word_transfer_a630, arm7_undefined,
+  arm7_single_word_transfer_a630, arm7_undefined, arm7_single_word_transfer_a630, arm7_undefined,
+  arm7_single_word_transfer_a630, arm7_undefined, arm7_single_word_transfer_a630, arm7_undefined,
+  arm7_single_word_transfer_a630, arm7_undefined, arm7_single_word_transfer_a630, arm7_undefined,
+  arm7_single_word_transfer_a640, arm7_undefined, arm7_single_word_transfer_a640, arm7_undefined,
+  arm7_single_word_transfer_a640, arm7_undefined, arm7_single_word_transfer_a640, arm7_undefined,
+  arm7_single_word_transfer_a640, arm7_undefined, arm7_single_word_transfer_a640, arm7_undefined,
+  arm7_single_word_transfer_a640, arm7_undefined, arm7_single_word_transfer_a640, arm7_undefined,
+  arm7_single_word_transfer_a650, arm7_undefined, arm7_single_word_transfer_a650, arm7_undefined,
+  arm7_single_word_transfer_a650, arm7_undefined, arm7_single_word_transfer_a650, arm7_undefined,
+  arm7_single_word_transfer_a650, arm7_undefined, arm7_single_word_transfer_a650, arm7_undefined,
+  arm7_single_word_transfer_a650, arm7_undefined, arm7_single_word_transfer_a650, arm7_undefined,
+  arm7_single_word_transfer_a660, arm7_undefined, arm7_single_word_transfer_a660, arm7_undefined,
+  arm7_single_word_transfer_a660, arm7_undefined, arm7_single_word_transfer_a660, arm7_undefined,
+  arm7_single_word_transfer_a660, arm7_undefined, arm7_single_word_transfer_a660, arm7_undefined,
+  arm7_single_word_transfer_a660, arm7_undefined, arm7_single_word_transfer_a660, arm7_undefined,
+  arm7_single_word_transfer_a670, arm7_undefined, arm7_single_word_transfer_a670, arm7_undefined,
+  arm7_single_word_transfer_a670, arm7_undefined, arm7_single_word_transfer_a670, arm7_undefined,
+  arm7_single_word_transfer_a670, arm7_undefined, arm7_single_word_transfer_a670, arm7_undefined,
+  arm7_single_word_transfer_a670, arm7_undefined, arm7_single_word_transfer_a670, arm7_undefined,
+  arm7_single_word_transfer_a680, arm7_undefined, arm7_single_word_transfer_a680, arm7_undefined,
+  arm7_single_word_transfer_a680, arm7_undefined, arm7_single_word_transfer_a680, arm7_undefined,
+  arm7_single_word_transfer_a680, arm7_undefined, arm7_single_word_transfer_a680, arm7_undefined,
+  arm7_single_word_transfer_a680, arm7_undefined, arm7_single_word_transfer_a680, arm7_undefined,
+  arm7_single_word_transfer_a690, arm7_undefined, arm7_single_word_transfer_a690, arm7_undefined,
+  arm7_single_word_transfer_a690, arm7_undefined, arm7_single_word_transfer_a690, arm7_undefined,
+  arm7_single_word_transfer_a690, arm7_undefined, arm7_single_word_transfer_a690, arm7_undefined,
+  arm7_single_word_transfer_a690, arm7_undefined, arm7_single_word_transfer_a690, arm7_undefined,
+  arm7_single_word_transfer_a6a0, arm7_undefined, arm7_single_word_transfer_a6a0, arm7_undefined,
+  arm7_single_word_transfer_a6a0, arm7_undefined, arm7_single_word_transfer_a6a0, arm7_undefined,
+  arm7_single_word_transfer_a6a0, arm7_undefined, arm7_single_word_transfer_a6a0, arm7_undefined,
+  arm7_single_word_transfer_a6a0, arm7_undefined, arm7_single_word_transfer_a6a0, arm7_undefined,
+  arm7_single_word_transfer_a6b0, arm7_undefined, arm7_single_word_transfer_a6b0, arm7_undefined,
+  arm7_single_word_transfer_a6b0, arm7_undefined, arm7_single_word_transfer_a6b0, arm7_undefined,
+  arm7_single_word_transfer_a6b0, arm7_undefined, arm7_single_word_transfer_a6b0, arm7_undefined,
+  arm7_single_word_transfer_a6b0, arm7_undefined, arm7_single_word_transfer_a6b0, arm7_undefined,
+  arm7_single_word_transfer_a6c0, arm7_undefined, arm7_single_word_transfer_a6c0, arm7_undefined,
+  arm7_single_word_transfer_a6c0, arm7_undefined, arm7_single_word_transfer_a6c0, arm7_undefined,
+  arm7_single_word_transfer_a6c0, arm7_undefined, arm7_single_word_transfer_a6c0, arm7_undefined,
+  arm7_single_word_transfer_a6c0, arm7_undefined, arm7_single_word_transfer_a6c0, arm7_undefined,
+  arm7_single_word_transfer_a6d0, arm7_undefined, arm7_single_word_transfer_a6d0, arm7_undefined,
+  arm7_single_word_transfer_a6d0, arm7_undefined, arm7_single_word_transfer_a6d0, arm7_undefined,
+  arm7_single_word_transfer_a6d0, arm7_undefined, arm7_single_word_transfer_a6d0, arm7_undefined,
+  arm7_single_word_transfer_a6d0, arm7_undefined, arm7_single_word_transfer_a6d0, arm7_undefined,
+  arm7_single_word_transfer_a6e0, arm7_undefined, arm7_single_word_transfer_a6e0, arm7_undefined,
+  arm7_single_word_transfer_a6e0, arm7_undefined, arm7_single_word_transfer_a6e0, arm7_undefined,
+  arm7_single_word_transfer_a6e0, arm7_undefined, arm7_single_word_transfer_a6e0, arm7_undefined,
+  arm7_single_word_transfer_a6e0, arm7_undefined, arm7_single_word_transfer_a6e0, arm7_undefined,
+  arm7_single_word_transfer_a6f0, arm7_undefined, arm7_single_word_transfer_a6f0, arm7_undefined,
+  arm7_single_word_transfer_a6f0, arm7_undefined, arm7_single_word_transfer_a6f0, arm7_undefined,
+  arm7_single_word_transfer_a6f0, arm7_undefined, arm7_single_word_transfer_a6f0, arm7_undefined,
+  arm7_single_word_transfer_a6f0, arm7_undefined, arm7_single_word_transfer_a6f0, arm7_undefined,
+  arm7_single_word_transfer_a700, arm7_undefined, arm7_single_word_transfer_a700, arm7_undefined,
+  arm7_single_word_transfer_a700, arm7_undefined, arm7_single_word_transfer_a700, arm7_undefined,
+  arm7_single_word_transfer_a700, arm7_undefined, arm7_single_word_transfer_a700, arm7_undefined,
+  arm7_single_word_transfer_a700, arm7_undefined, arm7_single_word_transfer_a700, arm7_undefined,
+  arm7_single_word_transfer_a710, arm7_undefined, arm7_single_word_transfer_a710, arm7_undefined,
+  arm7_single_word_transfer_a710, arm7_undefined, arm7_single_word_transfer_a710, arm7_undefined,
+  arm7_single_word_transfer_a710, arm7_undefined, arm7_single_word_transfer_a710, arm7_undefined,
+  arm7_single_word_transfer_a710, arm7_undefined, arm7_single_word_transfer_a710, arm7_undefined,
+  arm7_single_word_transfer_a720, arm7_undefined, arm7_single_word_transfer_a720, arm7_undefined,
+  arm7_single_word_transfer_a720, arm7_undefined, arm7_single_word_transfer_a720, arm7_undefined,
+  arm7_single_word_transfer_a720, arm7_undefined, arm7_single_word_transfer_a720, arm7_undefined,
+  arm7_single_word_transfer_a720, arm7_undefined, arm7_single_word_transfer_a720, arm7_undefined,
+  arm7_single_word_transfer_a730, arm7_undefined, arm7_single_word_transfer_a730, arm7_undefined,
+  arm7_single_word_transfer_a730, arm7_undefined, arm7_single_word_transfer_a730, arm7_undefined,
+  arm7_single_word_transfer_a730, arm7_undefined, arm7_single_word_transfer_a730, arm7_undefined,
+  arm7_single_word_transfer_a730, arm7_undefined, arm7_single_word_transfer_a730, arm7_undefined,
+  arm7_single_word_transfer_a740, arm7_undefined, arm7_single_word_transfer_a740, arm7_undefined,
+  arm7_single_word_transfer_a740, arm7_undefined, arm7_single_word_transfer_a740, arm7_undefined,
+  arm7_single_word_transfer_a740, arm7_undefined, arm7_single_word_transfer_a740, arm7_undefined,
+  arm7_single_word_transfer_a740, arm7_undefined, arm7_single_word_transfer_a740, arm7_undefined,
+  arm7_single_word_transfer_a750, arm7_undefined, arm7_single_word_transfer_a750, arm7_undefined,
+  arm7_single_word_transfer_a750, arm7_undefined, arm7_single_word_transfer_a750, arm7_undefined,
+  arm7_single_word_transfer_a750, arm7_undefined, arm7_single_word_transfer_a750, arm7_undefined,
+  arm7_single_word_transfer_a750, arm7_undefined, arm7_single_word_transfer_a750, arm7_undefined,
+  arm7_single_word_transfer_a760, arm7_undefined, arm7_single_word_transfer_a760, arm7_undefined,
+  arm7_single_word_transfer_a760, arm7_undefined, arm7_single_word_transfer_a760, arm7_undefined,
+  arm7_single_word_transfer_a760, arm7_undefined, arm7_single_word_transfer_a760, arm7_undefined,
+  arm7_single_word_transfer_a760, arm7_undefined, arm7_single_word_transfer_a760, arm7_undefined,
+  arm7_single_word_transfer_a770, arm7_undefined, arm7_single_word_transfer_a770, arm7_undefined,
+  arm7_single_word_transfer_a770, arm7_undefined, arm7_single_word_transfer_a770, arm7_undefined,
+  arm7_single_word_transfer_a770, arm7_undefined, arm7_single_word_transfer_a770, arm7_undefined,
+  arm7_single_word_transfer_a770, arm7_undefined, arm7_single_word_transfer_a770, arm7_undefined,
+  arm7_single_word_transfer_a780, arm7_undefined, arm7_single_word_transfer_a780, arm7_undefined,
+  arm7_single_word_transfer_a780, arm7_undefined, arm7_single_word_transfer_a780, arm7_undefined,
+  arm7_single_word_transfer_a780, arm7_undefined, arm7_single_word_transfer_a780, arm7_undefined,
+  arm7_single_word_transfer_a780, arm7_undefined, arm7_single_word_transfer_a780, arm7_undefined,
+  arm7_single_word_transfer_a790, arm7_undefined, arm7_single_word_transfer_a790, arm7_undefined,
+  arm7_single_word_transfer_a790, arm7_undefined, arm7_single_word_transfer_a790, arm7_undefined,
+  arm7_single_word_transfer_a790, arm7_undefined, arm7_single_word_transfer_a790, arm7_undefined,
+  arm7_single_word_transfer_a790, arm7_undefined, arm7_single_word_transfer_a790, arm7_undefined,
+  arm7_single_word_transfer_a7a0, arm7_undefined, arm7_single_word_transfer_a7a0, arm7_undefined,
+  arm7_single_word_transfer_a7a0, arm7_undefined, arm7_single_word_transfer_a7a0, arm7_undefined,
+  arm7_single_word_transfer_a7a0, arm7_undefined, arm7_single_word_transfer_a7a0, arm7_undefined,
+  arm7_single_word_transfer_a7a0, arm7_undefined, arm7_single_word_transfer_a7a0, arm7_undefined,
+  arm7_single_word_transfer_a7b0, arm7_undefined, arm7_single_word_transfer_a7b0, arm7_undefined,
+  arm7_single_word_transfer_a7b0, arm7_undefined, arm7_single_word_transfer_a7b0, arm7_undefined,
+  arm7_single_word_transfer_a7b0, arm7_undefined, arm7_single_word_transfer_a7b0, arm7_undefined,
+  arm7_single_word_transfer_a7b0, arm7_undefined, arm7_single_word_transfer_a7b0, arm7_undefined,
+  arm7_single_word_transfer_a7c0, arm7_undefined, arm7_single_word_transfer_a7c0, arm7_undefined,
+  arm7_single_word_transfer_a7c0, arm7_undefined, arm7_single_word_transfer_a7c0, arm7_undefined,
+  arm7_single_word_transfer_a7c0, arm7_undefined, arm7_single_word_transfer_a7c0, arm7_undefined,
+  arm7_single_word_transfer_a7c0, arm7_undefined, arm7_single_word_transfer_a7c0, arm7_undefined,
+  arm7_single_word_transfer_a7d0, arm7_undefined, arm7_single_word_transfer_a7d0, arm7_undefined,
+  arm7_single_word_transfer_a7d0, arm7_undefined, arm7_single_word_transfer_a7d0, arm7_undefined,
+  arm7_single_word_transfer_a7d0, arm7_undefined, arm7_single_word_transfer_a7d0, arm7_undefined,
+  arm7_single_word_transfer_a7d0, arm7_undefined, arm7_single_word_transfer_a7d0, arm7_undefined,
+  arm7_single_word_transfer_a7e0, arm7_undefined, arm7_single_word_transfer_a7e0, arm7_undefined,
+  arm7_single_word_transfer_a7e0, arm7_undefined, arm7_single_word_transfer_a7e0, arm7_undefined,
+  arm7_single_word_transfer_a7e0, arm7_undefined, arm7_single_word_transfer_a7e0, arm7_undefined,
+  arm7_single_word_transfer_a7e0, arm7_undefined, arm7_single_word_transfer_a7e0, arm7_undefined,
+  arm7_single_word_transfer_a7f0, arm7_undefined, arm7_single_word_transfer_a7f0, arm7_undefined,
+  arm7_single_word_transfer_a7f0, arm7_undefined, arm7_single_word_transfer_a7f0, arm7_undefined,
+  arm7_single_word_transfer_a7f0, arm7_undefined, arm7_single_word_transfer_a7f0, arm7_undefined,
+  arm7_single_word_transfer_a7f0, arm7_undefined, arm7_single_word_transfer_a7f0, arm7_undefined,
+  arm7_block_transfer_a800, arm7_block_transfer_a800, arm7_block_transfer_a800, arm7_block_transfer_a800,
+  arm7_block_transfer_a800, arm7_block_transfer_a800, arm7_block_transfer_a800, arm7_block_transfer_a800,
+  arm7_block_transfer_a800, arm7_block_transfer_a800, arm7_block_transfer_a800, arm7_block_transfer_a800,
+  arm7_block_transfer_a800, arm7_block_transfer_a800, arm7_block_transfer_a800, arm7_block_transfer_a800,
+  arm7_block_transfer_a810, arm7_block_transfer_a810, arm7_block_transfer_a810, arm7_block_transfer_a810,
+  arm7_block_transfer_a810, arm7_block_transfer_a810, arm7_block_transfer_a810, arm7_block_transfer_a810,
+  arm7_block_transfer_a810, arm7_block_transfer_a810, arm7_block_transfer_a810, arm7_block_transfer_a810,
+  arm7_block_transfer_a810, arm7_block_transfer_a810, arm7_block_transfer_a810, arm7_block_transfer_a810,
+  arm7_block_transfer_a820, arm7_block_transfer_a820, arm7_block_transfer_a820, arm7_block_transfer_a820,
+  arm7_block_transfer_a820, arm7_block_transfer_a820, arm7_block_transfer_a820, arm7_block_transfer_a820,
+  arm7_block_transfer_a820, arm7_block_transfer_a820, arm7_block_transfer_a820, arm7_block_transfer_a820,
+  arm7_block_transfer_a820, arm7_block_transfer_a820, arm7_block_transfer_a820, arm7_block_transfer_a820,
+  arm7_block_transfer_a830, arm7_block_transfer_a830, arm7_block_transfer_a830, arm7_block_transfer_a830,
+  arm7_block_transfer_a830, arm7_block_transfer_a830, arm7_block_transfer_a830, arm7_block_transfer_a830,
+  arm7_block_transfer_a830, arm7_block_transfer_a830, arm7_block_transfer_a830, arm7_block_transfer_a830,
+  arm7_block_transfer_a830, arm7_block_transfer_a830, arm7_block_transfer_a830, arm7_block_transfer_a830,
+  arm7_block_transfer_a840, arm7_block_transfer_a840, arm7_block_transfer_a840, arm7_block_transfer_a840,
+  arm7_block_transfer_a840, arm7_block_transfer_a840, arm7_block_transfer_a840, arm7_block_transfer_a840,
+  arm7_block_transfer_a840, arm7_block_transfer_a840, arm7_block_transfer_a840, arm7_block_transfer_a840,
+  arm7_block_transfer_a840, arm7_block_transfer_a840, arm7_block_transfer_a840, arm7_block_transfer_a840,
+  arm7_block_transfer_a850, arm7_block_transfer_a850, arm7_block_transfer_a850, arm7_block_transfer_a850,
+  arm7_block_transfer_a850, arm7_block_transfer_a850, arm7_block_transfer_a850, arm7_block_transfer_a850,
+  arm7_block_transfer_a850, arm7_block_transfer_a850, arm7_block_transfer_a850, arm7_block_transfer_a850,
+  arm7_block_transfer_a850, arm7_block_transfer_a850, arm7_block_transfer_a850, arm7_block_transfer_a850,
+  arm7_block_transfer_a860, arm7_block_transfer_a860, arm7_block_transfer_a860, arm7_block_transfer_a860,
+  arm7_block_transfer_a860, arm7_block_transfer_a860, arm7_block_transfer_a860, arm7_block_transfer_a860,
+  arm7_block_transfer_a860, arm7_block_transfer_a860, arm7_block_transfer_a860, arm7_block_transfer_a860,
+  arm7_block_transfer_a860, arm7_block_transfer_a860, arm7_block_transfer_a860, arm7_block_transfer_a860,
+  arm7_block_transfer_a870, arm7_block_transfer_a870, arm7_block_transfer_a870, arm7_block_transfer_a870,
+  arm7_block_transfer_a870, arm7_block_transfer_a870, arm7_block_transfer_a870, arm7_block_transfer_a870,
+  arm7_block_transfer_a870, arm7_block_transfer_a870, arm7_block_transfer_a870, arm7_block_transfer_a870,
+  arm7_block_transfer_a870, arm7_block_transfer_a870, arm7_block_transfer_a870, arm7_block_transfer_a870,
+  arm7_block_transfer_a880, arm7_block_transfer_a880, arm7_block_transfer_a880, arm7_block_transfer_a880,
+  arm7_block_transfer_a880, arm7_block_transfer_a880, arm7_block_transfer_a880, arm7_block_transfer_a880,
+  arm7_block_transfer_a880, arm7_block_transfer_a880, arm7_block_transfer_a880, arm7_block_transfer_a880,
+  arm7_block_transfer_a880, arm7_block_transfer_a880, arm7_block_transfer_a880, arm7_block_transfer_a880,
+  arm7_block_transfer_a890, arm7_block_transfer_a890, arm7_block_transfer_a890, arm7_block_transfer_a890,
+  arm7_block_transfer_a890, arm7_block_transfer_a890, arm7_block_transfer_a890, arm7_block_transfer_a890,
+  arm7_block_transfer_a890, arm7_block_transfer_a890, arm7_block_transfer_a890, arm7_block_transfer_a890,
+  arm7_block_transfer_a890, arm7_block_transfer_a890, arm7_block_transfer_a890, arm7_block_transfer_a890,
+  arm7_block_transfer_a8a0, arm7_block_transfer_a8a0, arm7_block_transfer_a8a0, arm7_block_transfer_a8a0,
+  arm7_block_transfer_a8a0, arm7_block_transfer_a8a0, arm7_block_transfer_a8a0, arm7_block_transfer_a8a0,
+  arm7_block_transfer_a8a0, arm7_block_transfer_a8a0, arm7_block_transfer_a8a0, arm7_block_transfer_a8a0,
+  arm7_block_transfer_a8a0, arm7_block_transfer_a8a0, arm7_block_transfer_a8a0, arm7_block_transfer_a8a0,
+  arm7_block_transfer_a8b0, arm7_block_transfer_a8b0, arm7_block_transfer_a8b0, arm7_block_transfer_a8b0,
+  arm7_block_transfer_a8b0, arm7_block_transfer_a8b0, arm7_block_transfer_a8b0, arm7_block_transfer_a8b0,
+  arm7_block_transfer_a8b0, arm7_block_transfer_a8b0, arm7_block_transfer_a8b0, arm7_block_transfer_a8b0,
+  arm7_block_transfer_a8b0, arm7_block_transfer_a8b0, arm7_block_transfer_a8b0, arm7_block_transfer_a8b0,
+  arm7_block_transfer_a8c0, arm7_block_transfer_a8c0, arm7_block_transfer_a8c0, arm7_block_transfer_a8c0,
+  arm7_block_transfer_a8c0, arm7_block_transfer_a8c0, arm7_block_transfer_a8c0, arm7_block_transfer_a8c0,
+  arm7_block_transfer_a8c0, arm7_block_transfer_a8c0, arm7_block_transfer_a8c0, arm7_block_transfer_a8c0,
+  arm7_block_transfer_a8c0, arm7_block_transfer_a8c0, arm7_block_transfer_a8c0, arm7_block_transfer_a8c0,
+  arm7_block_transfer_a8d0, arm7_block_transfer_a8d0, arm7_block_transfer_a8d0, arm7_block_transfer_a8d0,
+  arm7_block_transfer_a8d0, arm7_block_transfer_a8d0, arm7_block_transfer_a8d0, arm7_block_transfer_a8d0,
+  arm7_block_transfer_a8d0, arm7_block_transfer_a8d0, arm7_block_transfer_a8d0, arm7_block_transfer_a8d0,
+  arm7_block_transfer_a8d0, arm7_block_transfer_a8d0, arm7_block_transfer_a8d0, arm7_block_transfer_a8d0,
+  arm7_block_transfer_a8e0, arm7_block_transfer_a8e0, arm7_block_transfer_a8e0, arm7_block_transfer_a8e0,
+  arm7_block_transfer_a8e0, arm7_block_transfer_a8e0, arm7_block_transfer_a8e0, arm7_block_transfer_a8e0,
+  arm7_block_transfer_a8e0, arm7_block_transfer_a8e0, arm7_block_transfer_a8e0, arm7_block_transfer_a8e0,
+  arm7_block_transfer_a8e0, arm7_block_transfer_a8e0, arm7_block_transfer_a8e0, arm7_block_transfer_a8e0,
+  arm7_block_transfer_a8f0, arm7_block_transfer_a8f0, arm7_block_transfer_a8f0, arm7_block_transfer_a8f0,
+  arm7_block_transfer_a8f0, arm7_block_transfer_a8f0, arm7_block_transfer_a8f0, arm7_block_transfer_a8f0,
+  arm7_block_transfer_a8f0, arm7_block_transfer_a8f0, arm7_block_transfer_a8f0, arm7_block_transfer_a8f0,
+  arm7_block_transfer_a8f0, arm7_block_transfer_a8f0, arm7_block_transfer_a8f0, arm7_block_transfer_a8f0,
+  arm7_block_transfer_a900, arm7_block_transfer_a900, arm7_block_transfer_a900, arm7_block_transfer_a900,
+  arm7_block_transfer_a900, arm7_block_transfer_a900, arm7_block_transfer_a900, arm7_block_transfer_a900,
+  arm7_block_transfer_a900, arm7_block_transfer_a900, arm7_block_transfer_a900, arm7_block_transfer_a900,
+  arm7_block_transfer_a900, arm7_block_transfer_a900, arm7_block_transfer_a900, arm7_block_transfer_a900,
+  arm7_block_transfer_a910, arm7_block_transfer_a910, arm7_block_transfer_a910, arm7_block_transfer_a910,
+  arm7_block_transfer_a910, arm7_block_transfer_a910, arm7_block_transfer_a910, arm7_block_transfer_a910,
+  arm7_block_transfer_a910, arm7_block_transfer_a910, arm7_block_transfer_a910, arm7_block_transfer_a910,
+  arm7_block_transfer_a910, arm7_block_transfer_a910, arm7_block_transfer_a910, arm7_block_transfer_a910,
+  arm7_block_transfer_a920, arm7_block_transfer_a920, arm7_block_transfer_a920, arm7_block_transfer_a920,
+  arm7_block_transfer_a920, arm7_block_transfer_a920, arm7_block_transfer_a920, arm7_block_transfer_a920,
+  arm7_block_transfer_a920, arm7_block_transfer_a920, arm7_block_transfer_a920, arm7_block_transfer_a920,
+  arm7_block_transfer_a920, arm7_block_transfer_a920, arm7_block_transfer_a920, arm7_block_transfer_a920,
+  arm7_block_transfer_a930, arm7_block_transfer_a930, arm7_block_transfer_a930, arm7_block_transfer_a930,
+  arm7_block_transfer_a930, arm7_block_transfer_a930, arm7_block_transfer_a930, arm7_block_transfer_a930,
+  arm7_block_transfer_a930, arm7_block_transfer_a930, arm7_block_transfer_a930, arm7_block_transfer_a930,
+  arm7_block_transfer_a930, arm7_block_transfer_a930, arm7_block_transfer_a930, arm7_block_transfer_a930,
+  arm7_block_transfer_a940, arm7_block_transfer_a940, arm7_block_transfer_a940, arm7_block_transfer_a940,
+  arm7_block_transfer_a940, arm7_block_transfer_a940, arm7_block_transfer_a940, arm7_block_transfer_a940,
+  arm7_block_transfer_a940, arm7_block_transfer_a940, arm7_block_transfer_a940, arm7_block_transfer_a940,
+  arm7_block_transfer_a940, arm7_block_transfer_a940, arm7_block_transfer_a940, arm7_block_transfer_a940,
+  arm7_block_transfer_a950, arm7_block_transfer_a950, arm7_block_transfer_a950, arm7_block_transfer_a950,
+  arm7_block_transfer_a950, arm7_block_transfer_a950, arm7_block_transfer_a950, arm7_block_transfer_a950,
+  arm7_block_transfer_a950, arm7_block_transfer_a950, arm7_block_transfer_a950, arm7_block_transfer_a950,
+  arm7_block_transfer_a950, arm7_block_transfer_a950, arm7_block_transfer_a950, arm7_block_transfer_a950,
+  arm7_block_transfer_a960, arm7_block_transfer_a960, arm7_block_transfer_a960, arm7_block_transfer_a960,
+  arm7_block_transfer_a960, arm7_block_transfer_a960, arm7_block_transfer_a960, arm7_block_transfer_a960,
+  arm7_block_transfer_a960, arm7_block_transfer_a960, arm7_block_transfer_a960, arm7_block_transfer_a960,
+  arm7_block_transfer_a960, arm7_block_transfer_a960, arm7_block_transfer_a960, arm7_block_transfer_a960,
+  arm7_block_transfer_a970, arm7_block_transfer_a970, arm7_block_transfer_a970, arm7_block_transfer_a970,
+  arm7_block_transfer_a970, arm7_block_transfer_a970, arm7_block_transfer_a970, arm7_block_transfer_a970,
+  arm7_block_transfer_a970, arm7_block_transfer_a970, arm7_block_transfer_a970, arm7_block_transfer_a970,
+  arm7_block_transfer_a970, arm7_block_transfer_a970, arm7_block_transfer_a970, arm7_block_transfer_a970,
+  arm7_block_transfer_a980, arm7_block_transfer_a980, arm7_block_transfer_a980, arm7_block_transfer_a980,
+  arm7_block_transfer_a980, arm7_block_transfer_a980, arm7_block_transfer_a980, arm7_block_transfer_a980,
+  arm7_block_transfer_a980, arm7_block_transfer_a980, arm7_block_transfer_a980, arm7_block_transfer_a980,
+  arm7_block_transfer_a980, arm7_block_transfer_a980, arm7_block_transfer_a980, arm7_block_transfer_a980,
+  arm7_block_transfer_a990, arm7_block_transfer_a990, arm7_block_transfer_a990, arm7_block_transfer_a990,
+  arm7_block_transfer_a990, arm7_block_transfer_a990, arm7_block_transfer_a990, arm7_block_transfer_a990,
+  arm7_block_transfer_a990, arm7_block_transfer_a990, arm7_block_transfer_a990, arm7_block_transfer_a990,
+  arm7_block_transfer_a990, arm7_block_transfer_a990, arm7_block_transfer_a990, arm7_block_transfer_a990,
+  arm7_block_transfer_a9a0, arm7_block_transfer_a9a0, arm7_block_transfer_a9a0, arm7_block_transfer_a9a0,
+  arm7_block_transfer_a9a0, arm7_block_transfer_a9a0, arm7_block_transfer_a9a0, arm7_block_transfer_a9a0,
+  arm7_block_transfer_a9a0, arm7_block_transfer_a9a0, arm7_block_transfer_a9a0, arm7_block_transfer_a9a0,
+  arm7_block_transfer_a9a0, arm7_block_transfer_a9a0, arm7_block_transfer_a9a0, arm7_block_transfer_a9a0,
+  arm7_block_transfer_a9b0, arm7_block_transfer_a9b0, arm7_block_transfer_a9b0, arm7_block_transfer_a9b0,
+  arm7_block_transfer_a9b0, arm7_block_transfer_a9b0, arm7_block_transfer_a9b0, arm7_block_transfer_a9b0,
+  arm7_block_transfer_a9b0, arm7_block_transfer_a9b0, arm7_block_transfer_a9b0, arm7_block_transfer_a9b0,
+  arm7_block_transfer_a9b0, arm7_block_transfer_a9b0, arm7_block_transfer_a9b0, arm7_block_transfer_a9b0,
+  arm7_block_transfer_a9c0, arm7_block_transfer_a9c0, arm7_block_transfer_a9c0, arm7_block_transfer_a9c0,
+  arm7_block_transfer_a9c0, arm7_block_transfer_a9c0, arm7_block_transfer_a9c0, arm7_block_transfer_a9c0,
+  arm7_block_transfer_a9c0, arm7_block_transfer_a9c0, arm7_block_transfer_a9c0, arm7_block_transfer_a9c0,
+  arm7_block_transfer_a9c0, arm7_block_transfer_a9c0, arm7_block_transfer_a9c0, arm7_block_transfer_a9c0,
+  arm7_block_transfer_a9d0, arm7_block_transfer_a9d0, arm7_block_transfer_a9d0, arm7_block_transfer_a9d0,
+  arm7_block_transfer_a9d0, arm7_block_transfer_a9d0, arm7_block_transfer_a9d0, arm7_block_transfer_a9d0,
+  arm7_block_transfer_a9d0, arm7_block_transfer_a9d0, arm7_block_transfer_a9d0, arm7_block_transfer_a9d0,
+  arm7_block_transfer_a9d0, arm7_block_transfer_a9d0, arm7_block_transfer_a9d0, arm7_block_transfer_a9d0,
+  arm7_block_transfer_a9e0, arm7_block_transfer_a9e0, arm7_block_transfer_a9e0, arm7_block_transfer_a9e0,
+  arm7_block_transfer_a9e0, arm7_block_transfer_a9e0, arm7_block_transfer_a9e0, arm7_block_transfer_a9e0,
+  arm7_block_transfer_a9e0, arm7_block_transfer_a9e0, arm7_block_transfer_a9e0, arm7_block_transfer_a9e0,
+  arm7_block_transfer_a9e0, arm7_block_transfer_a9e0, arm7_block_transfer_a9e0, arm7_block_transfer_a9e0,
+  arm7_block_transfer_a9f0, arm7_block_transfer_a9f0, arm7_block_transfer_a9f0, arm7_block_transfer_a9f0,
+  arm7_block_transfer_a9f0, arm7_block_transfer_a9f0, arm7_block_transfer_a9f0, arm7_block_transfer_a9f0,
+  arm7_block_transfer_a9f0, arm7_block_transfer_a9f0, arm7_block_transfer_a9f0, arm7_block_transfer_a9f0,
+  arm7_block_transfer_a9f0, arm7_block_transfer_a9f0, arm7_block_transfer_a9f0, arm7_block_transfer_a9f0,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00, arm7_branch_aa00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00, arm7_branch_ab00,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+};
+
+static const arm7_handler_t arm9_specialized_lookup_table[4096]={
+  arm7_data_processing_a000, arm7_data_processing_a001, arm7_data_processing_a002, arm7_data_processing_a003,
+  arm7_data_processing_a004, arm7_data_processing_a005, arm7_data_processing_a006, arm7_data_processing_a007,
+  arm7_data_processing_a008, arm7_multiply_a009, arm7_data_processing_a00a, arm7_half_word_transfer_a00b,
+  arm7_data_processing_a00c, arm9_double_word_transfer_a00d, arm7_data_processing_a00e, arm9_double_word_transfer_a00f,
+  arm7_data_processing_a010, arm7_data_processing_a011, arm7_data_processing_a012, arm7_data_processing_a013,
+  arm7_data_processing_a014, arm7_data_processing_a015, arm7_data_processing_a016, arm7_data_processing_a017,
+  arm7_data_processing_a018, arm7_multiply_a019, arm7_data_processing_a01a, arm7_half_word_transfer_a01b,
+  arm7_data_processing_a01c, arm7_half_word_transfer_a01d, arm7_data_processing_a01e, arm7_half_word_transfer_a01f,
+  arm7_data_processing_a020, arm7_data_processing_a021, arm7_data_processing_a022, arm7_data_processing_a023,
+  arm7_data_processing_a024, arm7_data_processing_a025, arm7_data_processing_a026, arm7_data_processing_a027,
+  arm7_data_processing_a028, arm7_multiply_a029, arm7_data_processing_a02a, arm7_half_word_transfer_a02b,
+  arm7_data_processing_a02c, arm9_double_word_transfer_a02d, arm7_data_processing_a02e, arm9_double_word_transfer_a02f,
+  arm7_data_processing_a030, arm7_data_processing_a031, arm7_data_processing_a032, arm7_data_processing_a033,
+  arm7_data_processing_a034, arm7_data_processing_a035, arm7_data_processing_a036, arm7_data_processing_a037,
+  arm7_data_processing_a038, arm7_multiply_a039, arm7_data_processing_a03a, arm7_half_word_transfer_a03b,
+  arm7_data_processing_a03c, arm7_half_word_transfer_a03d, arm7_data_processing_a03e, arm7_half_word_transfer_a03f,
+  arm7_data_processing_a040, arm7_data_processing_a041, arm7_data_processing_a042, arm7_data_processing_a043,
+  arm7_data_processing_a044, arm7_data_processing_a045, arm7_data_processing_a046, arm7_data_processing_a047,
+  arm7_data_processing_a048, arm7_undefined, arm7_data_processing_a04a, arm7_half_word_transfer_a04b,
+  arm7_data_processing_a04c, arm9_double_word_transfer_a04d, arm7_data_processing_a04e, arm9_double_word_transfer_a04f,
+  arm7_data_processing_a050, arm7_data_processing_a051, arm7_data_processing_a052, arm7_data_processing_a053,
+  arm7_data_processing_a054, arm7_data_processing_a055, arm7_data_processing_a056, arm7_data_processing_a057,
+  arm7_data_processing_a058, arm7_undefined, arm7_data_processing_a05a, arm7_half_word_transfer_a05b,
+  arm7_data_processing_a05c, arm7_half_word_transfer_a05d, arm7_data_processing_a05e, arm7_half_word_transfer_a05f,
+  arm7_data_processing_a060, arm7_data_processing_a061, arm7_data_processing_a062, arm7_data_processing_a063,
+  arm7_data_processing_a064, arm7_data_processing_a065, arm7_data_processing_a066, arm7_data_processing_a067,
+  arm7_data_processing_a068, arm7_undefined, arm7_data_processing_a06a, arm7_half_word_transfer_a06b,
+  arm7_data_processing_a06c, arm9_double_word_transfer_a06d, arm7_data_processing_a06e, arm9_double_word_transfer_a06f,
+  arm7_data_processing_a070, arm7_data_processing_a071, arm7_data_processing_a072, arm7_data_processing_a073,
+  arm7_data_processing_a074, arm7_data_processing_a075, arm7_data_processing_a076, arm7_data_processing_a077,
+  arm7_data_processing_a078, arm7_undefined, arm7_data_processing_a07a, arm7_half_word_transfer_a07b,
+  arm7_data_processing_a07c, arm7_half_word_transfer_a07d, arm7_data_processing_a07e, arm7_half_word_transfer_a07f,
+  arm7_data_processing_a080, arm7_data_processing_a081, arm7_data_processing_a082, arm7_data_processing_a083,
+  arm7_data_processing_a084, arm7_data_processing_a085, arm7_data_processing_a086, arm7_data_processing_a087,
+  arm7_data_processing_a088, arm7_multiply_long_a089, arm7_data_processing_a08a, arm7_half_word_transfer_a08b,
+  arm7_data_processing_a08c, arm9_double_word_transfer_a08d, arm7_data_processing_a08e, arm9_double_word_transfer_a08f,
+  arm7_data_processing_a090, arm7_data_processing_a091, arm7_data_processing_a092, arm7_data_processing_a093,
+  arm7_data_processing_a094, arm7_data_processing_a095, arm7_data_processing_a096, arm7_data_processing_a097,
+  arm7_data_processing_a098, arm7_multiply_long_a099, arm7_data_processing_a09a, arm7_half_word_transfer_a09b,
+  arm7_data_processing_a09c, arm7_half_word_transfer_a09d, arm7_data_processing_a09e, arm7_half_word_transfer_a09f,
+  arm7_data_processing_a0a0, arm7_data_processing_a0a1, arm7_data_processing_a0a2, arm7_data_processing_a0a3,
+  arm7_data_processing_a0a4, arm7_data_processing_a0a5, arm7_data_processing_a0a6, arm7_data_processing_a0a7,
+  arm7_data_processing_a0a8, arm7_multiply_long_a0a9, arm7_data_processing_a0aa, arm7_half_word_transfer_a0ab,
+  arm7_data_processing_a0ac, arm9_double_word_transfer_a0ad, arm7_data_processing_a0ae, arm9_double_word_transfer_a0af,
+  arm7_data_processing_a0b0, arm7_data_processing_a0b1, arm7_data_processing_a0b2, arm7_data_processing_a0b3,
+  arm7_data_processing_a0b4, arm7_data_processing_a0b5, arm7_data_processing_a0b6, arm7_data_processing_a0b7,
+  arm7_data_processing_a0b8, arm7_multiply_long_a0b9, arm7_data_processing_a0ba, arm7_half_word_transfer_a0bb,
+  arm7_data_processing_a0bc, arm7_half_word_transfer_a0bd, arm7_data_processing_a0be, arm7_half_word_transfer_a0bf,
+  arm7_data_processing_a0c0, arm7_data_processing_a0c1, arm7_data_processing_a0c2, arm7_data_processing_a0c3,
+  arm7_data_processing_a0c4, arm7_data_processing_a0c5, arm7_data_processing_a0c6, arm7_data_processing_a0c7,
+  arm7_data_processing_a0c8, arm7_multiply_long_a0c9, arm7_data_processing_a0ca, arm7_half_word_transfer_a0cb,
+  arm7_data_processing_a0cc, arm9_double_word_transfer_a0cd, arm7_data_processing_a0ce, arm9_double_word_transfer_a0cf,
+  arm7_data_processing_a0d0, arm7_data_processing_a0d1, arm7_data_processing_a0d2, arm7_data_processing_a0d3,
+  arm7_data_processing_a0d4, arm7_data_processing_a0d5, arm7_data_processing_a0d6, arm7_data_processing_a0d7,
+  arm7_data_processing_a0d8, arm7_multiply_long_a0d9, arm7_data_processing_a0da, arm7_half_word_transfer_a0db,
+  arm7_data_processing_a0dc, arm7_half_word_transfer_a0dd, arm7_data_processing_a0de, arm7_half_word_transfer_a0df,
+  arm7_data_processing_a0e0, arm7_data_processing_a0e1, arm7_data_processing_a0e2, arm7_data_processing_a0e3,
+  arm7_data_processing_a0e4, arm7_data_processing_a0e5, arm7_data_processing_a0e6, arm7_data_processing_a0e7,
+  arm7_data_processing_a0e8, arm7_multiply_long_a0e9, arm7_data_processing_a0ea, arm7_half_word_transfer_a0eb,
+  arm7_data_processing_a0ec, arm9_double_word_transfer_a0ed, arm7_data_processing_a0ee, arm9_double_word_transfer_a0ef,
+  arm7_data_processing_a0f0, arm7_data_processing_a0f1, arm7_data_processing_a0f2, arm7_data_processing_a0f3,
+  arm7_data_processing_a0f4, arm7_data_processing_a0f5, arm7_data_processing_a0f6, arm7_data_processing_a0f7,
+  arm7_data_processing_a0f8, arm7_multiply_long_a0f9, arm7_data_processing_a0fa, arm7_half_word_transfer_a0fb,
+  arm7_data_processing_a0fc, arm7_half_word_transfer_a0fd, arm7_data_processing_a0fe, arm7_half_word_transfer_a0ff,
+  arm7_mrs_a100, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm9_qadd_qsub_a105, arm7_undefined, arm7_undefined,
+  arm9_signed_halfword_multiply_a108, arm7_single_data_swap_a109, arm9_signed_halfword_multiply_a10a, arm7_half_word_transfer_a10b,
+  arm9_signed_halfword_multiply_a10c, arm9_double_word_transfer_a10d, arm9_signed_halfword_multiply_a10e, arm9_double_word_transfer_a10f,
+  arm7_data_processing_a110, arm7_data_processing_a111, arm7_data_processing_a112, arm7_data_processing_a113,
+  arm7_data_processing_a114, arm7_data_processing_a115, arm7_data_processing_a116, arm7_data_processing_a117,
+  arm7_data_processing_a118, arm7_undefined, arm7_data_processing_a11a, arm7_half_word_transfer_a11b,
+  arm7_data_processing_a11c, arm7_half_word_transfer_a11d, arm7_data_processing_a11e, arm7_half_word_transfer_a11f,
+  arm7_msr_a120, arm7_branch_exchange_a121, arm7_undefined, arm9_branch_link_exchange_a123,
+  arm7_undefined, arm9_qadd_qsub_a125, arm7_undefined, arm7_undefined,
+  arm9_signed_halfword_multiply_a128, arm7_undefined, arm9_signed_halfword_multiply_a12a, arm7_half_word_transfer_a12b,
+  arm9_signed_halfword_multiply_a12c, arm9_double_word_transfer_a12d, arm9_signed_halfword_multiply_a12e, arm9_double_word_transfer_a12f,
+  arm7_data_processing_a130, arm7_data_processing_a131, arm7_data_processing_a132, arm7_data_processing_a133,
+  arm7_data_processing_a134, arm7_data_processing_a135, arm7_data_processing_a136, arm7_data_processing_a137,
+  arm7_data_processing_a138, arm7_undefined, arm7_data_processing_a13a, arm7_half_word_transfer_a13b,
+  arm7_data_processing_a13c, arm7_half_word_transfer_a13d, arm7_data_processing_a13e, arm7_half_word_transfer_a13f,
+  arm7_mrs_a140, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm9_qadd_qsub_a145, arm7_undefined, arm7_undefined,
+  arm9_signed_halfword_multiply_a148, arm7_single_data_swap_a149, arm9_signed_halfword_multiply_a14a, arm7_half_word_transfer_a14b,
+  arm9_signed_halfword_multiply_a14c, arm9_double_word_transfer_a14d, arm9_signed_halfword_multiply_a14e, arm9_double_word_transfer_a14f,
+  arm7_data_processing_a150, arm7_data_processing_a151, arm7_data_processing_a152, arm7_data_processing_a153,
+  arm7_data_processing_a154, arm7_data_processing_a155, arm7_data_processing_a156, arm7_data_processing_a157,
+  arm7_data_processing_a158, arm7_undefined, arm7_data_processing_a15a, arm7_half_word_transfer_a15b,
+  arm7_data_processing_a15c, arm7_half_word_transfer_a15d, arm7_data_processing_a15e, arm7_half_word_transfer_a15f,
+  arm7_msr_a160, arm9_clz_a161, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm9_qadd_qsub_a165, arm7_undefined, arm7_undefined,
+  arm9_signed_halfword_multiply_a168, arm7_undefined, arm9_signed_halfword_multiply_a16a, arm7_half_word_transfer_a16b,
+  arm9_signed_halfword_multiply_a16c, arm9_double_word_transfer_a16d, arm9_signed_halfword_multiply_a16e, arm9_double_word_transfer_a16f,
+  arm7_data_processing_a170, arm7_data_processing_a171, arm7_data_processing_a172, arm7_data_processing_a173,
+  arm7_data_processing_a174, arm7_data_processing_a175, arm7_data_processing_a176, arm7_data_processing_a177,
+  arm7_data_processing_a178, arm7_undefined, arm7_data_processing_a17a, arm7_half_word_transfer_a17b,
+  arm7_data_processing_a17c, arm7_half_word_transfer_a17d, arm7_data_processing_a17e, arm7_half_word_transfer_a17f,
+  arm7_data_processing_a180, arm7_data_processing_a181, arm7_data_processing_a182, arm7_data_processing_a183,
+  arm7_data_processing_a184, arm7_data_processing_a185, arm7_data_processing_a186, arm7_data_processing_a187,
+  arm7_data_processing_a188, arm7_undefined, arm7_data_processing_a18a, arm7_half_word_transfer_a18b,
+  arm7_data_processing_a18c, arm9_double_word_transfer_a18d, arm7_data_processing_a18e, arm9_double_word_transfer_a18f,
+  arm7_data_processing_a190, arm7_data_processing_a191, arm7_data_processing_a192, arm7_data_processing_a193,
+  arm7_data_processing_a194, arm7_data_processing_a195, arm7_data_processing_a196, arm7_data_processing_a197,
+  arm7_data_processing_a198, arm7_undefined, arm7_data_processing_a19a, arm7_half_word_transfer_a19b,
+  arm7_data_processing_a19c, arm7_half_word_transfer_a19d, arm7_data_processing_a19e, arm7_half_word_transfer_a19f,
+  arm7_data_processing_a1a0, arm7_data_processing_a1a1, arm7_data_processing_a1a2, arm7_data_processing_a1a3,
+  arm7_data_processing_a1a4, arm7_data_processing_a1a5, arm7_data_processing_a1a6, arm7_data_processing_a1a7,
+  arm7_data_processing_a1a8, arm7_undefined, arm7_data_processing_a1aa, arm7_half_word_transfer_a1ab,
+  arm7_data_processing_a1ac, arm9_double_word_transfer_a1ad, arm7_data_processing_a1ae, arm9_double_word_transfer_a1af,
+  arm7_data_processing_a1b0, arm7_data_processing_a1b1, arm7_data_processing_a1b2, arm7_data_processing_a1b3,
+  arm7_data_processing_a1b4, arm7_data_processing_a1b5, arm7_data_processing_a1b6, arm7_data_processing_a1b7,
+  arm7_data_processing_a1b8, arm7_undefined, arm7_data_processing_a1ba, arm7_half_word_transfer_a1bb,
+  arm7_data_processing_a1bc, arm7_half_word_transfer_a1bd, arm7_data_processing_a1be, arm7_half_word_transfer_a1bf,
+  arm7_data_processing_a1c0, arm7_data_processing_a1c1, arm7_data_processing_a1c2, arm7_data_processing_a1c3,
+  arm7_data_processing_a1c4, arm7_data_processing_a1c5, arm7_data_processing_a1c6, arm7_data_processing_a1c7,
+  arm7_data_processing_a1c8, arm7_undefined, arm7_data_processing_a1ca, arm7_half_word_transfer_a1cb,
+  arm7_data_processing_a1cc, arm9_double_word_transfer_a1cd, arm7_data_processing_a1ce, arm9_double_word_transfer_a1cf,
+  arm7_data_processing_a1d0, arm7_data_processing_a1d1, arm7_data_processing_a1d2, arm7_data_processing_a1d3,
+  arm7_data_processing_a1d4, arm7_data_processing_a1d5, arm7_data_processing_a1d6, arm7_data_processing_a1d7,
+  arm7_data_processing_a1d8, arm7_undefined, arm7_data_processing_a1da, arm7_half_word_transfer_a1db,
+  arm7_data_processing_a1dc, arm7_half_word_transfer_a1dd, arm7_data_processing_a1de, arm7_half_word_transfer_a1df,
+  arm7_data_processing_a1e0, arm7_data_processing_a1e1, arm7_data_processing_a1e2, arm7_data_processing_a1e3,
+  arm7_data_processing_a1e4, arm7_data_processing_a1e5, arm7_data_processing_a1e6, arm7_data_processing_a1e7,
+  arm7_data_processing_a1e8, arm7_undefined, arm7_data_processing_a1ea, arm7_half_word_transfer_a1eb,
+  arm7_data_processing_a1ec, arm9_double_word_transfer_a1ed, arm7_data_processing_a1ee, arm9_double_word_transfer_a1ef,
+  arm7_data_processing_a1f0, arm7_data_processing_a1f1, arm7_data_processing_a1f2, arm7_data_processing_a1f3,
+  arm7_data_processing_a1f4, arm7_data_processing_a1f5, arm7_data_processing_a1f6, arm7_data_processing_a1f7,
+  arm7_data_processing_a1f8, arm7_undefined, arm7_data_processing_a1fa, arm7_half_word_transfer_a1fb,
+  arm7_data_processing_a1fc, arm7_half_word_transfer_a1fd, arm7_data_processing_a1fe, arm7_half_word_transfer_a1ff,
+  arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200,
+  arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200,
+  arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200,
+  arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200, arm7_data_processing_a200,
+  arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210,
+  arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210,
+  arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210,
+  arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210, arm7_data_processing_a210,
+  arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220,
+  arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220,
+  arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220,
+  arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220, arm7_data_processing_a220,
+  arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230,
+  arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230,
+  arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230,
+  arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230, arm7_data_processing_a230,
+  arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240,
+  arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240,
+  arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240,
+  arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240, arm7_data_processing_a240,
+  arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250,
+  arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250,
+  arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250,
+  arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250, arm7_data_processing_a250,
+  arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260,
+  arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260,
+  arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260,
+  arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260, arm7_data_processing_a260,
+  arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270,
+  arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270,
+  arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270,
+  arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270, arm7_data_processing_a270,
+  arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280,
+  arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280,
+  arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280,
+  arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280, arm7_data_processing_a280,
+  arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290,
+  arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290,
+  arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290,
+  arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290, arm7_data_processing_a290,
+  arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0,
+  arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0,
+  arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0,
+  arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0, arm7_data_processing_a2a0,
+  arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0,
+  arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0,
+  arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0,
+  arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0, arm7_data_processing_a2b0,
+  arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0,
+  arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0,
+  arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0,
+  arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0, arm7_data_processing_a2c0,
+  arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0,
+  arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0,
+  arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0,
+  arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0, arm7_data_processing_a2d0,
+  arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0,
+  arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0,
+  arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0,
+  arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0, arm7_data_processing_a2e0,
+  arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0,
+  arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0,
+  arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0,
+  arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0, arm7_data_processing_a2f0,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310,
+  arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310,
+  arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310,
+  arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310, arm7_data_processing_a310,
+  arm7_msr_a320, arm7_msr_a321, arm7_msr_a322, arm7_msr_a323,
+  arm7_msr_a324, arm7_msr_a325, arm7_msr_a326, arm7_msr_a327,
+  arm7_msr_a328, arm7_msr_a329, arm7_msr_a32a, arm7_msr_a32b,
+  arm7_msr_a32c, arm7_msr_a32d, arm7_msr_a32e, arm7_msr_a32f,
+  arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330,
+  arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330,
+  arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330,
+  arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330, arm7_data_processing_a330,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_undefined, arm7_undefined, arm7_undefined, arm7_undefined,
+  arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350,
+  arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350,
+  arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350,
+  arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350, arm7_data_processing_a350,
+  arm7_msr_a360, arm7_msr_a361, arm7_msr_a362, arm7_msr_a363,
+  arm7_msr_a364, arm7_msr_a365, arm7_msr_a366, arm7_msr_a367,
+  arm7_msr_a368, arm7_msr_a369, arm7_msr_a36a, arm7_msr_a36b,
+  arm7_msr_a36c, arm7_msr_a36d, arm7_msr_a36e, arm7_msr_a36f,
+  arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370,
+  arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370,
+  arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370,
+  arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370, arm7_data_processing_a370,
+  arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380,
+  arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380,
+  arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380,
+  arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380, arm7_data_processing_a380,
+  arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390,
+  arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390,
+  arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390,
+  arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390, arm7_data_processing_a390,
+  arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0,
+  arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0,
+  arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0,
+  arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0, arm7_data_processing_a3a0,
+  arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0,
+  arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0,
+  arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0,
+  arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0, arm7_data_processing_a3b0,
+  arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0,
+  arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0,
+  arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0,
+  arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0, arm7_data_processing_a3c0,
+  arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0,
+  arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0,
+  arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0,
+  arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0, arm7_data_processing_a3d0,
+  arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0,
+  arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0,
+  arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0,
+  arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0, arm7_data_processing_a3e0,
+  arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0,
+  arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0,
+  arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0,
+  arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0, arm7_data_processing_a3f0,
+  arm9_single_word_transfer_a400, arm9_single_word_transfer_a400, arm9_single_word_transfer_a400, arm9_single_word_transfer_a400,
+  arm9_single_word_transfer_a400, arm9_single_word_transfer_a400, arm9_single_word_transfer_a400, arm9_single_word_transfer_a400,
+  arm9_single_word_transfer_a400, arm9_single_word_transfer_a400, arm9_single_word_transfer_a400, arm9_single_word_transfer_a400,
+  arm9_single_word_transfer_a400, arm9_single_word_transfer_a400, arm9_single_word_transfer_a400, arm9_single_word_transfer_a400,
+  arm9_single_word_transfer_a410, arm9_single_word_transfer_a410, arm9_single_word_transfer_a410, arm9_single_word_transfer_a410,
+  arm9_single_word_transfer_a410, arm9_single_word_transfer_a410, arm9_single_word_transfer_a410, arm9_single_word_transfer_a410,
+  arm9_single_word_transfer_a410, arm9_single_word_transfer_a410, arm9_single_word_transfer_a410, arm9_single_word_transfer_a410,
+  arm9_single_word_transfer_a410, arm9_single_word_transfer_a410, arm9_single_word_transfer_a410, arm9_single_word_transfer_a410,
+  arm9_single_word_transfer_a420, arm9_single_word_transfer_a420, arm9_single_word_transfer_a420, arm9_single_word_transfer_a420,
+  arm9_single_word_transfer_a420, arm9_single_word_transfer_a420, arm9_single_word_transfer_a420, arm9_single_word_transfer_a420,
+  arm9_single_word_transfer_a420, arm9_single_word_transfer_a420, arm9_single_word_transfer_a420, arm9_single_word_transfer_a420,
+  arm9_single_word_transfer_a420, arm9_single_word_transfer_a420, arm9_single_word_transfer_a420, arm9_single_word_transfer_a420,
+  arm9_single_word_transfer_a430, arm9_single_word_transfer_a430, arm9_single_word_transfer_a430, arm9_single_word_transfer_a430,
+  arm9_single_word_transfer_a430, arm9_single_word_transfer_a430, arm9_single_word_transfer_a430, arm9_single_word_transfer_a430,
+  arm9_single_word_transfer_a430, arm9_single_word_transfer_a430, arm9_single_word_transfer_a430, arm9_single_word_transfer_a430,
+  arm9_single_word_transfer_a430, arm9_single_word_transfer_a430, arm9_single_word_transfer_a430, arm9_single_word_transfer_a430,
+  arm9_single_word_transfer_a440, arm9_single_word_transfer_a440, arm9_single_word_transfer_a440, arm9_single_word_transfer_a440,
+  arm9_single_word_transfer_a440, arm9_single_word_transfer_a440, arm9_single_word_transfer_a440, arm9_single_word_transfer_a440,
+  arm9_single_word_transfer_a440, arm9_single_word_transfer_a440, arm9_single_word_transfer_a440, arm9_single_word_transfer_a440,
+  arm9_single_word_transfer_a440, arm9_single_word_transfer_a440, arm9_single_word_transfer_a440, arm9_single_word_transfer_a440,
+  arm9_single_word_transfer_a450, arm9_single_word_transfer_a450, arm9_single_word_transfer_a450, arm9_single_word_transfer_a450,
+  arm9_single_word_transfer_a450, arm9_single_word_transfer_a450, arm9_single_word_transfer_a450, arm9_single_word_transfer_a450,
+  arm9_single_word_transfer_a450, arm9_single_word_transfer_a450, arm9_single_word_transfer_a450, arm9_single_word_transfer_a450,
+  arm9_single_word_transfer_a450, arm9_single_word_transfer_a450, arm9_single_word_transfer_a450, arm9_single_word_transfer_a450,
+  arm9_single_word_transfer_a460, arm9_single_word_transfer_a460, arm9_single_word_transfer_a460, arm9_single_word_transfer_a460,
+  arm9_single_word_transfer_a460, arm9_single_word_transfer_a460, arm9_single_word_transfer_a460, arm9_single_word_transfer_a460,
+  arm9_single_word_transfer_a460, arm9_single_word_transfer_a460, arm9_single_word_transfer_a460, arm9_single_word_transfer_a460,
+  arm9_single_word_transfer_a460, arm9_single_word_transfer_a460, arm9_single_word_transfer_a460, arm9_single_word_transfer_a460,
+  arm9_single_word_transfer_a470, arm9_single_word_transfer_a470, arm9_single_word_transfer_a470, arm9_single_word_transfer_a470,
+  arm9_single_word_transfer_a470, arm9_single_word_transfer_a470, arm9_single_word_transfer_a470, arm9_single_word_transfer_a470,
+  arm9_single_word_transfer_a470, arm9_single_word_transfer_a470, arm9_single_word_transfer_a470, arm9_single_word_transfer_a470,
+  arm9_single_word_transfer_a470, arm9_single_word_transfer_a470, arm9_single_word_transfer_a470, arm9_single_word_transfer_a470,
+  arm9_single_word_transfer_a480, arm9_single_word_transfer_a480, arm9_single_word_transfer_a480, arm9_single_word_transfer_a480,
+  arm9_single_word_transfer_a480, arm9_single_word_transfer_a480, arm9_single_word_transfer_a480, arm9_single_word_transfer_a480,
+  arm9_single_word_transfer_a480, arm9_single_word_transfer_a480, arm9_single_word_transfer_a480, arm9_single_word_transfer_a480,
+  arm9_single_word_transfer_a480, arm9_single_word_transfer_a480, arm9_single_word_transfer_a480, arm9_single_word_transfer_a480,
+  arm9_single_word_transfer_a490, arm9_single_word_transfer_a490, arm9_single_word_transfer_a490, arm9_single_word_transfer_a490,
+  arm9_single_word_transfer_a490, arm9_single_word_transfer_a490, arm9_single_word_transfer_a490, arm9_single_word_transfer_a490,
+  arm9_single_word_transfer_a490, arm9_single_word_transfer_a490, arm9_single_word_transfer_a490, arm9_single_word_transfer_a490,
+  arm9_single_word_transfer_a490, arm9_single_word_transfer_a490, arm9_single_word_transfer_a490, arm9_single_word_transfer_a490,
+  arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0,
+  arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0,
+  arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0,
+  arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0, arm9_single_word_transfer_a4a0,
+  arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0,
+  arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0,
+  arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0,
+  arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0, arm9_single_word_transfer_a4b0,
+  arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0,
+  arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0,
+  arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0,
+  arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0, arm9_single_word_transfer_a4c0,
+  arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0,
+  arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0,
+  arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0,
+  arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0, arm9_single_word_transfer_a4d0,
+  arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0,
+  arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0,
+  arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0,
+  arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0, arm9_single_word_transfer_a4e0,
+  arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0,
+  arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0,
+  arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0,
+  arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0, arm9_single_word_transfer_a4f0,
+  arm9_single_word_transfer_a500, arm9_single_word_transfer_a500, arm9_single_word_transfer_a500, arm9_single_word_transfer_a500,
+  arm9_single_word_transfer_a500, arm9_single_word_transfer_a500, arm9_single_word_transfer_a500, arm9_single_word_transfer_a500,
+  arm9_single_word_transfer_a500, arm9_single_word_transfer_a500, arm9_single_word_transfer_a500, arm9_single_word_transfer_a500,
+  arm9_single_word_transfer_a500, arm9_single_word_transfer_a500, arm9_single_word_transfer_a500, arm9_single_word_transfer_a500,
+  arm9_single_word_transfer_a510, arm9_single_word_transfer_a510, arm9_single_word_transfer_a510, arm9_single_word_transfer_a510,
+  arm9_single_word_transfer_a510, arm9_single_word_transfer_a510, arm9_single_word_transfer_a510, arm9_single_word_transfer_a510,
+  arm9_single_word_transfer_a510, arm9_single_word_transfer_a510, arm9_single_word_transfer_a510, arm9_single_word_transfer_a510,
+  arm9_single_word_transfer_a510, arm9_single_word_transfer_a510, arm9_single_word_transfer_a510, arm9_single_word_transfer_a510,
+  arm9_single_word_transfer_a520, arm9_single_word_transfer_a520, arm9_single_word_transfer_a520, arm9_single_word_transfer_a520,
+  arm9_single_word_transfer_a520, arm9_single_word_transfer_a520, arm9_single_word_transfer_a520, arm9_single_word_transfer_a520,
+  arm9_single_word_transfer_a520, arm9_single_word_transfer_a520, arm9_single_word_transfer_a520, arm9_single_word_transfer_a520,
+  arm9_single_word_transfer_a520, arm9_single_word_transfer_a520, arm9_single_word_transfer_a520, arm9_single_word_transfer_a520,
+  arm9_single_word_transfer_a530, arm9_single_word_transfer_a530, arm9_single_word_transfer_a530, arm9_single_word_transfer_a530,
+  arm9_single_word_transfer_a530, arm9_single_word_transfer_a530, arm9_single_word_transfer_a530, arm9_single_word_transfer_a530,
+  arm9_single_word_transfer_a530, arm9_single_word_transfer_a530, arm9_single_word_transfer_a530, arm9_single_word_transfer_a530,
+  arm9_single_word_transfer_a530, arm9_single_word_transfer_a530, arm9_single_word_transfer_a530, arm9_single_word_transfer_a530,
+  arm9_single_word_transfer_a540, arm9_single_word_transfer_a540, arm9_single_word_transfer_a540, arm9_single_word_transfer_a540,
+  arm9_single_word_transfer_a540, arm9_single_word_transfer_a540, arm9_single_word_transfer_a540, arm9_single_word_transfer_a540,
+  arm9_single_word_transfer_a540, arm9_single_word_transfer_a540, arm9_single_word_transfer_a540, arm9_single_word_transfer_a540,
+  arm9_single_word_transfer_a540, arm9_single_word_transfer_a540, arm9_single_word_transfer_a540, arm9_single_word_transfer_a540,
+  arm9_single_word_transfer_a550, arm9_single_word_transfer_a550, arm9_single_word_transfer_a550, arm9_single_word_transfer_a550,
+  arm9_single_word_transfer_a550, arm9_single_word_transfer_a550, arm9_single_word_transfer_a550, arm9_single_word_transfer_a550,
+  arm9_single_word_transfer_a550, arm9_single_word_transfer_a550, arm9_single_word_transfer_a550, arm9_single_word_transfer_a550,
+  arm9_single_word_transfer_a550, arm9_single_word_transfer_a550, arm9_single_word_transfer_a550, arm9_single_word_transfer_a550,
+  arm9_single_word_transfer_a560, arm9_single_word_transfer_a560, arm9_single_word_transfer_a560, arm9_single_word_transfer_a560,
+  arm9_single_word_transfer_a560, arm9_single_word_transfer_a560, arm9_single_word_transfer_a560, arm9_single_word_transfer_a560,
+  arm9_single_word_transfer_a560, arm9_single_word_transfer_a560, arm9_single_word_transfer_a560, arm9_single_word_transfer_a560,
+  arm9_single_word_transfer_a560, arm9_single_word_transfer_a560, arm9_single_word_transfer_a560, arm9_single_word_transfer_a560,
+  arm9_single_word_transfer_a570, arm9_single_word_transfer_a570, arm9_single_word_transfer_a570, arm9_single_word_transfer_a570,
+  arm9_single_word_transfer_a570, arm9_single_word_transfer_a570, arm9_single_word_transfer_a570, arm9_single_word_transfer_a570,
+  arm9_single_word_transfer_a570, arm9_single_word_transfer_a570, arm9_single_word_transfer_a570, arm9_single_word_transfer_a570,
+  arm9_single_word_transfer_a570, arm9_single_word_transfer_a570, arm9_single_word_transfer_a570, arm9_single_word_transfer_a570,
+  arm9_single_word_transfer_a580, arm9_single_word_transfer_a580, arm9_single_word_transfer_a580, arm9_single_word_transfer_a580,
+  arm9_single_word_transfer_a580, arm9_single_word_transfer_a580, arm9_single_word_transfer_a580, arm9_single_word_transfer_a580,
+  arm9_single_word_transfer_a580, arm9_single_word_transfer_a580, arm9_single_word_transfer_a580, arm9_single_word_transfer_a580,
+  arm9_single_word_transfer_a580, arm9_single_word_transfer_a580, arm9_single_word_transfer_a580, arm9_single_word_transfer_a580,
+  arm9_single_word_transfer_a590, arm9_single_word_transfer_a590, arm9_single_word_transfer_a590, arm9_single_word_transfer_a590,
+  arm9_single_word_transfer_a590, arm9_single_word_transfer_a590, arm9_single_word_transfer_a590, arm9_single_word_transfer_a590,
+  arm9_single_word_transfer_a590, arm9_single_word_transfer_a590, arm9_single_word_transfer_a590, arm9_single_word_transfer_a590,
+  arm9_single_word_transfer_a590, arm9_single_word_transfer_a590, arm9_single_word_transfer_a590, arm9_single_word_transfer_a590,
+  arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0,
+  arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0,
+  arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0,
+  arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0, arm9_single_word_transfer_a5a0,
+  arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0,
+  arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0,
+  arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0,
+  arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0, arm9_single_word_transfer_a5b0,
+  arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0,
+  arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0,
+  arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0,
+  arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0, arm9_single_word_transfer_a5c0,
+  arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0,
+  arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0,
+  arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0,
+  arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0, arm9_single_word_transfer_a5d0,
+  arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0,
+  arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0,
+  arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0,
+  arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0, arm9_single_word_transfer_a5e0,
+  arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0,
+  arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0,
+  arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0,
+  arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0, arm9_single_word_transfer_a5f0,
+  arm9_single_word_transfer_a600, arm7_undefined, arm9_single_word_transfer_a600, arm7_undefined,
+  arm9_single_word_transfer_a600, arm7_undefined, arm9_single_word_transfer_a600, arm7_undefined,
+  arm9_single_word_transfer_a600, arm7_undefined, arm9_single_word_transfer_a600, arm7_undefined,
+  arm9_single_word_transfer_a600, arm7_undefined, arm9_single_word_transfer_a600, arm7_undefined,
+  arm9_single_word_transfer_a610, arm7_undefined, arm9_single_word_transfer_a610, arm7_undefined,
+  arm9_single_word_transfer_a610, arm7_undefined, arm9_single_word_transfer_a610, arm7_undefined,
+  arm9_single_word_transfer_a610, arm7_undefined, arm9_single_word_transfer_a610, arm7_undefined,
+  arm9_single_word_transfer_a610, arm7_undefined, arm9_single_word_transfer_a610, arm7_undefined,
+  arm9_single_word_transfer_a620, arm7_undefined, arm9_single_word_transfer_a620, arm7_undefined,
+  arm9_single_word_transfer_a620, arm7_undefined, arm9_single_word_transfer_a620, arm7_undefined,
+  arm9_single_word_transfer_a620, arm7_undefined, arm9_single_word_transfer_a620, arm7_undefined,
+  arm9_single_word_transfer_a620, arm7_undefined, arm9_single_word_transfer_a620, arm7_undefined,
+  arm9_single_word_transfer_a630, arm7_undefined, arm9_single_word_transfer_a630, arm7_undefined,
+  arm9_single_word_transfer_a630, arm7_undefined, arm9_single_word_transfer_a630, arm7_undefined,
+  arm9_single_word_transfer_a630, arm7_undefined, arm9_single_word_transfer_a630, arm7_undefined,
+  arm9_single_word_transfer_a630, arm7_undefined, arm9_single_word_transfer_a630, arm7_undefined,
+  arm9_single_word_transfer_a640, arm7_undefined, arm9_single_word_transfer_a640, arm7_undefined,
+  arm9_single_word_transfer_a640, arm7_undefined, arm9_single_word_transfer_a640, arm7_undefined,
+  arm9_single_word_transfer_a640, arm7_undefined, arm9_single_word_transfer_a640, arm7_undefined,
+  arm9_single_word_transfer_a640, arm7_undefined, arm9_single_word_transfer_a640, arm7_undefined,
+  arm9_single_word_transfer_a650, arm7_undefined, arm9_single_word_transfer_a650, arm7_undefined,
+  arm9_single_word_transfer_a650, arm7_undefined, arm9_single_word_transfer_a650, arm7_undefined,
+  arm9_single_word_transfer_a650, arm7_undefined, arm9_single_word_transfer_a650, arm7_undefined,
+  arm9_single_word_transfer_a650, arm7_undefined, arm9_single_word_transfer_a650, arm7_undefined,
+  arm9_single_word_transfer_a660, arm7_undefined, arm9_single_word_transfer_a660, arm7_undefined,
+  arm9_single_word_transfer_a660, arm7_undefined, arm9_single_word_transfer_a660, arm7_undefined,
+  arm9_single_word_transfer_a660, arm7_undefined, arm9_single_word_transfer_a660, arm7_undefined,
+  arm9_single_word_transfer_a660, arm7_undefined, arm9_single_word_transfer_a660, arm7_undefined,
+  arm9_single_word_transfer_a670, arm7_undefined, arm9_single_word_transfer_a670, arm7_undefined,
+  arm9_single_word_transfer_a670, arm7_undefined, arm9_single_word_transfer_a670, arm7_undefined,
+  arm9_single_word_transfer_a670, arm7_undefined, arm9_single_word_transfer_a670, arm7_undefined,
+  arm9_single_word_transfer_a670, arm7_undefined, arm9_single_word_transfer_a670, arm7_undefined,
+  arm9_single_word_transfer_a680, arm7_undefined, arm9_single_word_transfer_a680, arm7_undefined,
+  arm9_single_word_transfer_a680, arm7_undefined, arm9_single_word_transfer_a680, arm7_undefined,
+  arm9_single_word_transfer_a680, arm7_undefined, arm9_single_word_transfer_a680, arm7_undefined,
+  arm9_single_word_transfer_a680, arm7_undefined, arm9_single_word_transfer_a680, arm7_undefined,
+  arm9_single_word_transfer_a690, arm7_undefined, arm9_single_word_transfer_a690, arm7_undefined,
+  arm9_single_word_transfer_a690, arm7_undefined, arm9_single_word_transfer_a690, arm7_undefined,
+  arm9_single_word_transfer_a690, arm7_undefined, arm9_single_word_transfer_a690, arm7_undefined,
+  arm9_single_word_transfer_a690, arm7_undefined, arm9_single_word_transfer_a690, arm7_undefined,
+  arm9_single_word_transfer_a6a0, arm7_undefined, arm9_single_word_transfer_a6a0, arm7_undefined,
+  arm9_single_word_transfer_a6a0, arm7_undefined, arm9_single_word_transfer_a6a0, arm7_undefined,
+  arm9_single_word_transfer_a6a0, arm7_undefined, arm9_single_word_transfer_a6a0, arm7_undefined,
+  arm9_single_word_transfer_a6a0, arm7_undefined, arm9_single_word_transfer_a6a0, arm7_undefined,
+  arm9_single_word_transfer_a6b0, arm7_undefined, arm9_single_word_transfer_a6b0, arm7_undefined,
+  arm9_single_word_transfer_a6b0, arm7_undefined, arm9_single_word_transfer_a6b0, arm7_undefined,
+  arm9_single_word_transfer_a6b0, arm7_undefined, arm9_single_word_transfer_a6b0, arm7_undefined,
+  arm9_single_word_transfer_a6b0, arm7_undefined, arm9_single_word_transfer_a6b0, arm7_undefined,
+  arm9_single_word_transfer_a6c0, arm7_undefined, arm9_single_word_transfer_a6c0, arm7_undefined,
+  arm9_single_word_transfer_a6c0, arm7_undefined, arm9_single_word_transfer_a6c0, arm7_undefined,
+  arm9_single_word_transfer_a6c0, arm7_undefined, arm9_single_word_transfer_a6c0, arm7_undefined,
+  arm9_single_word_transfer_a6c0, arm7_undefined, arm9_single_word_transfer_a6c0, arm7_undefined,
+  arm9_single_word_transfer_a6d0, arm7_undefined, arm9_single_word_transfer_a6d0, arm7_undefined,
+  arm9_single_word_transfer_a6d0, arm7_undefined, arm9_single_word_transfer_a6d0, arm7_undefined,
+  arm9_single_word_transfer_a6d0, arm7_undefined, arm9_single_word_transfer_a6d0, arm7_undefined,
+  arm9_single_word_transfer_a6d0, arm7_undefined, arm9_single_word_transfer_a6d0, arm7_undefined,
+  arm9_single_word_transfer_a6e0, arm7_undefined, arm9_single_word_transfer_a6e0, arm7_undefined,
+  arm9_single_word_transfer_a6e0, arm7_undefined, arm9_single_word_transfer_a6e0, arm7_undefined,
+  arm9_single_word_transfer_a6e0, arm7_undefined, arm9_single_word_transfer_a6e0, arm7_undefined,
+  arm9_single_word_transfer_a6e0, arm7_undefined, arm9_single_word_transfer_a6e0, arm7_undefined,
+  arm9_single_word_transfer_a6f0, arm7_undefined, arm9_single_word_transfer_a6f0, arm7_undefined,
+  arm9_single_word_transfer_a6f0, arm7_undefined, arm9_single_word_transfer_a6f0, arm7_undefined,
+  arm9_single_word_transfer_a6f0, arm7_undefined, arm9_single_word_transfer_a6f0, arm7_undefined,
+  arm9_single_word_transfer_a6f0, arm7_undefined, arm9_single_word_transfer_a6f0, arm7_undefined,
+  arm9_single_word_transfer_a700, arm7_undefined, arm9_single_word_transfer_a700, arm7_undefined,
+  arm9_single_word_transfer_a700, arm7_undefined, arm9_single_word_transfer_a700, arm7_undefined,
+  arm9_single_word_transfer_a700, arm7_undefined, arm9_single_word_transfer_a700, arm7_undefined,
+  arm9_single_word_transfer_a700, arm7_undefined, arm9_single_word_transfer_a700, arm7_undefined,
+  arm9_single_word_transfer_a710, arm7_undefined, arm9_single_word_transfer_a710, arm7_undefined,
+  arm9_single_word_transfer_a710, arm7_undefined, arm9_single_word_transfer_a710, arm7_undefined,
+  arm9_single_word_transfer_a710, arm7_undefined, arm9_single_word_transfer_a710, arm7_undefined,
+  arm9_single_word_transfer_a710, arm7_undefined, arm9_single_word_transfer_a710, arm7_undefined,
+  arm9_single_word_transfer_a720, arm7_undefined, arm9_single_word_transfer_a720, arm7_undefined,
+  arm9_single_word_transfer_a720, arm7_undefined, arm9_single_word_transfer_a720, arm7_undefined,
+  arm9_single_word_transfer_a720, arm7_undefined, arm9_single_word_transfer_a720, arm7_undefined,
+  arm9_single_word_transfer_a720, arm7_undefined, arm9_single_word_transfer_a720, arm7_undefined,
+  arm9_single_word_transfer_a730, arm7_undefined, arm9_single_word_transfer_a730, arm7_undefined,
+  arm9_single_word_transfer_a730, arm7_undefined, arm9_single_word_transfer_a730, arm7_undefined,
+  arm9_single_word_transfer_a730, arm7_undefined, arm9_single_word_transfer_a730, arm7_undefined,
+  arm9_single_word_transfer_a730, arm7_undefined, arm9_single_word_transfer_a730, arm7_undefined,
+  arm9_single_word_transfer_a740, arm7_undefined, arm9_single_word_transfer_a740, arm7_undefined,
+  arm9_single_word_transfer_a740, arm7_undefined, arm9_single_word_transfer_a740, arm7_undefined,
+  arm9_single_word_transfer_a740, arm7_undefined, arm9_single_word_transfer_a740, arm7_undefined,
+  arm9_single_word_transfer_a740, arm7_undefined, arm9_single_word_transfer_a740, arm7_undefined,
+  arm9_single_word_transfer_a750, arm7_undefined, arm9_single_word_transfer_a750, arm7_undefined,
+  arm9_single_word_transfer_a750, arm7_undefined, arm9_single_word_transfer_a750, arm7_undefined,
+  arm9_single_word_transfer_a750, arm7_undefined, arm9_single_word_transfer_a750, arm7_undefined,
+  arm9_single_word_transfer_a750, arm7_undefined, arm9_single_word_transfer_a750, arm7_undefined,
+  arm9_single_word_transfer_a760, arm7_undefined, arm9_single_word_transfer_a760, arm7_undefined,
+  arm9_single_word_transfer_a760, arm7_undefined, arm9_single_word_transfer_a760, arm7_undefined,
+  arm9_single_word_transfer_a760, arm7_undefined, arm9_single_word_transfer_a760, arm7_undefined,
+  arm9_single_word_transfer_a760, arm7_undefined, arm9_single_word_transfer_a760, arm7_undefined,
+  arm9_single_word_transfer_a770, arm7_undefined, arm9_single_word_transfer_a770, arm7_undefined,
+  arm9_single_word_transfer_a770, arm7_undefined, arm9_single_word_transfer_a770, arm7_undefined,
+  arm9_single_word_transfer_a770, arm7_undefined, arm9_single_word_transfer_a770, arm7_undefined,
+  arm9_single_word_transfer_a770, arm7_undefined, arm9_single_word_transfer_a770, arm7_undefined,
+  arm9_single_word_transfer_a780, arm7_undefined, arm9_single_word_transfer_a780, arm7_undefined,
+  arm9_single_word_transfer_a780, arm7_undefined, arm9_single_word_transfer_a780, arm7_undefined,
+  arm9_single_word_transfer_a780, arm7_undefined, arm9_single_word_transfer_a780, arm7_undefined,
+  arm9_single_word_transfer_a780, arm7_undefined, arm9_single_word_transfer_a780, arm7_undefined,
+  arm9_single_word_transfer_a790, arm7_undefined, arm9_single_word_transfer_a790, arm7_undefined,
+  arm9_single_word_transfer_a790, arm7_undefined, arm9_single_word_transfer_a790, arm7_undefined,
+  arm9_single_word_transfer_a790, arm7_undefined, arm9_single_word_transfer_a790, arm7_undefined,
+  arm9_single_word_transfer_a790, arm7_undefined, arm9_single_word_transfer_a790, arm7_undefined,
+  arm9_single_word_transfer_a7a0, arm7_undefined, arm9_single_word_transfer_a7a0, arm7_undefined,
+  arm9_single_word_transfer_a7a0, arm7_undefined, arm9_single_word_transfer_a7a0, arm7_undefined,
+  arm9_single_word_transfer_a7a0, arm7_undefined, arm9_single_word_transfer_a7a0, arm7_undefined,
+  arm9_single_word_transfer_a7a0, arm7_undefined, arm9_single_word_transfer_a7a0, arm7_undefined,
+  arm9_single_word_transfer_a7b0, arm7_undefined, arm9_single_word_transfer_a7b0, arm7_undefined,
+  arm9_single_word_transfer_a7b0, arm7_undefined, arm9_single_word_transfer_a7b0, arm7_undefined,
+  arm9_single_word_transfer_a7b0, arm7_undefined, arm9_single_word_transfer_a7b0, arm7_undefined,
+  arm9_single_word_transfer_a7b0, arm7_undefined, arm9_single_word_transfer_a7b0, arm7_undefined,
+  arm9_single_word_transfer_a7c0, arm7_undefined, arm9_single_word_transfer_a7c0, arm7_undefined,
+  arm9_single_word_transfer_a7c0, arm7_undefined, arm9_single_word_transfer_a7c0, arm7_undefined,
+  arm9_single_word_transfer_a7c0, arm7_undefined, arm9_single_word_transfer_a7c0, arm7_undefined,
+  arm9_single_word_transfer_a7c0, arm7_undefined, arm9_single_word_transfer_a7c0, arm7_undefined,
+  arm9_single_word_transfer_a7d0, arm7_undefined, arm9_single_word_transfer_a7d0, arm7_undefined,
+  arm9_single_word_transfer_a7d0, arm7_undefined, arm9_single_word_transfer_a7d0, arm7_undefined,
+  arm9_single_word_transfer_a7d0, arm7_undefined, arm9_single_word_transfer_a7d0, arm7_undefined,
+  arm9_single_word_transfer_a7d0, arm7_undefined, arm9_single_word_transfer_a7d0, arm7_undefined,
+  arm9_single_word_transfer_a7e0, arm7_undefined, arm9_single_word_transfer_a7e0, arm7_undefined,
+  arm9_single_word_transfer_a7e0, arm7_undefined, arm9_single_word_transfer_a7e0, arm7_undefined,
+  arm9_single_word_transfer_a7e0, arm7_undefined, arm9_single_word_transfer_a7e0, arm7_undefined,
+  arm9_single_word_transfer_a7e0, arm7_undefined, arm9_single_word_transfer_a7e0, arm7_undefined,
+  arm9_single_word_transfer_a7f0, arm7_undefined, arm9_single_word_transfer_a7f0, arm7_undefined,
+  arm9_single_word_transfer_a7f0, arm7_undefined, arm9_single_word_transfer_a7f0, arm7_undefined,
+  arm9_single_word_transfer_a7f0, arm7_undefined, arm9_single_word_transfer_a7f0, arm7_undefined,
+  arm9_single_word_transfer_a7f0, arm7_undefined, arm9_single_word_transfer_a7f0, arm7_undefined,
+  arm9_block_transfer_a800, arm9_block_transfer_a800, arm9_block_transfer_a800, arm9_block_transfer_a800,
+  arm9_block_transfer_a800, arm9_block_transfer_a800, arm9_block_transfer_a800, arm9_block_transfer_a800,
+  arm9_block_transfer_a800, arm9_block_transfer_a800, arm9_block_transfer_a800, arm9_block_transfer_a800,
+  arm9_block_transfer_a800, arm9_block_transfer_a800, arm9_block_transfer_a800, arm9_block_transfer_a800,
+  arm9_block_transfer_a810, arm9_block_transfer_a810, arm9_block_transfer_a810, arm9_block_transfer_a810,
+  arm9_block_transfer_a810, arm9_block_transfer_a810, arm9_block_transfer_a810, arm9_block_transfer_a810,
+  arm9_block_transfer_a810, arm9_block_transfer_a810, arm9_block_transfer_a810, arm9_block_transfer_a810,
+  arm9_block_transfer_a810, arm9_block_transfer_a810, arm9_block_transfer_a810, arm9_block_transfer_a810,
+  arm9_block_transfer_a820, arm9_block_transfer_a820, arm9_block_transfer_a820, arm9_block_transfer_a820,
+  arm9_block_transfer_a820, arm9_block_transfer_a820, arm9_block_transfer_a820, arm9_block_transfer_a820,
+  arm9_block_transfer_a820, arm9_block_transfer_a820, arm9_block_transfer_a820, arm9_block_transfer_a820,
+  arm9_block_transfer_a820, arm9_block_transfer_a820, arm9_block_transfer_a820, arm9_block_transfer_a820,
+  arm9_block_transfer_a830, arm9_block_transfer_a830, arm9_block_transfer_a830, arm9_block_transfer_a830,
+  arm9_block_transfer_a830, arm9_block_transfer_a830, arm9_block_transfer_a830, arm9_block_transfer_a830,
+  arm9_block_transfer_a830, arm9_block_transfer_a830, arm9_block_transfer_a830, arm9_block_transfer_a830,
+  arm9_block_transfer_a830, arm9_block_transfer_a830, arm9_block_transfer_a830, arm9_block_transfer_a830,
+  arm9_block_transfer_a840, arm9_block_transfer_a840, arm9_block_transfer_a840, arm9_block_transfer_a840,
+  arm9_block_transfer_a840, arm9_block_transfer_a840, arm9_block_transfer_a840, arm9_block_transfer_a840,
+  arm9_block_transfer_a840, arm9_block_transfer_a840, arm9_block_transfer_a840, arm9_block_transfer_a840,
+  arm9_block_transfer_a840, arm9_block_transfer_a840, arm9_block_transfer_a840, arm9_block_transfer_a840,
+  arm9_block_transfer_a850, arm9_block_transfer_a850, arm9_block_transfer_a850, arm9_block_transfer_a850,
+  arm9_block_transfer_a850, arm9_block_transfer_a850, arm9_block_transfer_a850, arm9_block_transfer_a850,
+  arm9_block_transfer_a850, arm9_block_transfer_a850, arm9_block_transfer_a850, arm9_block_transfer_a850,
+  arm9_block_transfer_a850, arm9_block_transfer_a850, arm9_block_transfer_a850, arm9_block_transfer_a850,
+  arm9_block_transfer_a860, arm9_block_transfer_a860, arm9_block_transfer_a860, arm9_block_transfer_a860,
+  arm9_block_transfer_a860, arm9_block_transfer_a860, arm9_block_transfer_a860, arm9_block_transfer_a860,
+  arm9_block_transfer_a860, arm9_block_transfer_a860, arm9_block_transfer_a860, arm9_block_transfer_a860,
+  arm9_block_transfer_a860, arm9_block_transfer_a860, arm9_block_transfer_a860, arm9_block_transfer_a860,
+  arm9_block_transfer_a870, arm9_block_transfer_a870, arm9_block_transfer_a870, arm9_block_transfer_a870,
+  arm9_block_transfer_a870, arm9_block_transfer_a870, arm9_block_transfer_a870, arm9_block_transfer_a870,
+  arm9_block_transfer_a870, arm9_block_transfer_a870, arm9_block_transfer_a870, arm9_block_transfer_a870,
+  arm9_block_transfer_a870, arm9_block_transfer_a870, arm9_block_transfer_a870, arm9_block_transfer_a870,
+  arm9_block_transfer_a880, arm9_block_transfer_a880, arm9_block_transfer_a880, arm9_block_transfer_a880,
+  arm9_block_transfer_a880, arm9_block_transfer_a880, arm9_block_transfer_a880, arm9_block_transfer_a880,
+  arm9_block_transfer_a880, arm9_block_transfer_a880, arm9_block_transfer_a880, arm9_block_transfer_a880,
+  arm9_block_transfer_a880, arm9_block_transfer_a880, arm9_block_transfer_a880, arm9_block_transfer_a880,
+  arm9_block_transfer_a890, arm9_block_transfer_a890, arm9_block_transfer_a890, arm9_block_transfer_a890,
+  arm9_block_transfer_a890, arm9_block_transfer_a890, arm9_block_transfer_a890, arm9_block_transfer_a890,
+  arm9_block_transfer_a890, arm9_block_transfer_a890, arm9_block_transfer_a890, arm9_block_transfer_a890,
+  arm9_block_transfer_a890, arm9_block_transfer_a890, arm9_block_transfer_a890, arm9_block_transfer_a890,
+  arm9_block_transfer_a8a0, arm9_block_transfer_a8a0, arm9_block_transfer_a8a0, arm9_block_transfer_a8a0,
+  arm9_block_transfer_a8a0, arm9_block_transfer_a8a0, arm9_block_transfer_a8a0, arm9_block_transfer_a8a0,
+  arm9_block_transfer_a8a0, arm9_block_transfer_a8a0, arm9_block_transfer_a8a0, arm9_block_transfer_a8a0,
+  arm9_block_transfer_a8a0, arm9_block_transfer_a8a0, arm9_block_transfer_a8a0, arm9_block_transfer_a8a0,
+  arm9_block_transfer_a8b0, arm9_block_transfer_a8b0, arm9_block_transfer_a8b0, arm9_block_transfer_a8b0,
+  arm9_block_transfer_a8b0, arm9_block_transfer_a8b0, arm9_block_transfer_a8b0, arm9_block_transfer_a8b0,
+  arm9_block_transfer_a8b0, arm9_block_transfer_a8b0, arm9_block_transfer_a8b0, arm9_block_transfer_a8b0,
+  arm9_block_transfer_a8b0, arm9_block_transfer_a8b0, arm9_block_transfer_a8b0, arm9_block_transfer_a8b0,
+  arm9_block_transfer_a8c0, arm9_block_transfer_a8c0, arm9_block_transfer_a8c0, arm9_block_transfer_a8c0,
+  arm9_block_transfer_a8c0, arm9_block_transfer_a8c0, arm9_block_transfer_a8c0, arm9_block_transfer_a8c0,
+  arm9_block_transfer_a8c0, arm9_block_transfer_a8c0, arm9_block_transfer_a8c0, arm9_block_transfer_a8c0,
+  arm9_block_transfer_a8c0, arm9_block_transfer_a8c0, arm9_block_transfer_a8c0, arm9_block_transfer_a8c0,
+  arm9_block_transfer_a8d0, arm9_block_transfer_a8d0, arm9_block_transfer_a8d0, arm9_block_transfer_a8d0,
+  arm9_block_transfer_a8d0, arm9_block_transfer_a8d0, arm9_block_transfer_a8d0, arm9_block_transfer_a8d0,
+  arm9_block_transfer_a8d0, arm9_block_transfer_a8d0, arm9_block_transfer_a8d0, arm9_block_transfer_a8d0,
+  arm9_block_transfer_a8d0, arm9_block_transfer_a8d0, arm9_block_transfer_a8d0, arm9_block_transfer_a8d0,
+  arm9_block_transfer_a8e0, arm9_block_transfer_a8e0, arm9_block_transfer_a8e0, arm9_block_transfer_a8e0,
+  arm9_block_transfer_a8e0, arm9_block_transfer_a8e0, arm9_block_transfer_a8e0, arm9_block_transfer_a8e0,
+  arm9_block_transfer_a8e0, arm9_block_transfer_a8e0, arm9_block_transfer_a8e0, arm9_block_transfer_a8e0,
+  arm9_block_transfer_a8e0, arm9_block_transfer_a8e0, arm9_block_transfer_a8e0, arm9_block_transfer_a8e0,
+  arm9_block_transfer_a8f0, arm9_block_transfer_a8f0, arm9_block_transfer_a8f0, arm9_block_transfer_a8f0,
+  arm9_block_transfer_a8f0, arm9_block_transfer_a8f0, arm9_block_transfer_a8f0, arm9_block_transfer_a8f0,
+  arm9_block_transfer_a8f0, arm9_block_transfer_a8f0, arm9_block_transfer_a8f0, arm9_block_transfer_a8f0,
+  arm9_block_transfer_a8f0, arm9_block_transfer_a8f0, arm9_block_transfer_a8f0, arm9_block_transfer_a8f0,
+  arm9_block_transfer_a900, arm9_block_transfer_a900, arm9_block_transfer_a900, arm9_block_transfer_a900,
+  arm9_block_transfer_a900, arm9_block_transfer_a900, arm9_block_transfer_a900, arm9_block_transfer_a900,
+  arm9_block_transfer_a900, arm9_block_transfer_a900, arm9_block_transfer_a900, arm9_block_transfer_a900,
+  arm9_block_transfer_a900, arm9_block_transfer_a900, arm9_block_transfer_a900, arm9_block_transfer_a900,
+  arm9_block_transfer_a910, arm9_block_transfer_a910, arm9_block_transfer_a910, arm9_block_transfer_a910,
+  arm9_block_transfer_a910, arm9_block_transfer_a910, arm9_block_transfer_a910, arm9_block_transfer_a910,
+  arm9_block_transfer_a910, arm9_block_transfer_a910, arm9_block_transfer_a910, arm9_block_transfer_a910,
+  arm9_block_transfer_a910, arm9_block_transfer_a910, arm9_block_transfer_a910, arm9_block_transfer_a910,
+  arm9_block_transfer_a920, arm9_block_transfer_a920, arm9_block_transfer_a920, arm9_block_transfer_a920,
+  arm9_block_transfer_a920, arm9_block_transfer_a920, arm9_block_transfer_a920, arm9_block_transfer_a920,
+  arm9_block_transfer_a920, arm9_block_transfer_a920, arm9_block_transfer_a920, arm9_block_transfer_a920,
+  arm9_block_transfer_a920, arm9_block_transfer_a920, arm9_block_transfer_a920, arm9_block_transfer_a920,
+  arm9_block_transfer_a930, arm9_block_transfer_a930, arm9_block_transfer_a930, arm9_block_transfer_a930,
+  arm9_block_transfer_a930, arm9_block_transfer_a930, arm9_block_transfer_a930, arm9_block_transfer_a930,
+  arm9_block_transfer_a930, arm9_block_transfer_a930, arm9_block_transfer_a930, arm9_block_transfer_a930,
+  arm9_block_transfer_a930, arm9_block_transfer_a930, arm9_block_transfer_a930, arm9_block_transfer_a930,
+  arm9_block_transfer_a940, arm9_block_transfer_a940, arm9_block_transfer_a940, arm9_block_transfer_a940,
+  arm9_block_transfer_a940, arm9_block_transfer_a940, arm9_block_transfer_a940, arm9_block_transfer_a940,
+  arm9_block_transfer_a940, arm9_block_transfer_a940, arm9_block_transfer_a940, arm9_block_transfer_a940,
+  arm9_block_transfer_a940, arm9_block_transfer_a940, arm9_block_transfer_a940, arm9_block_transfer_a940,
+  arm9_block_transfer_a950, arm9_block_transfer_a950, arm9_block_transfer_a950, arm9_block_transfer_a950,
+  arm9_block_transfer_a950, arm9_block_transfer_a950, arm9_block_transfer_a950, arm9_block_transfer_a950,
+  arm9_block_transfer_a950, arm9_block_transfer_a950, arm9_block_transfer_a950, arm9_block_transfer_a950,
+  arm9_block_transfer_a950, arm9_block_transfer_a950, arm9_block_transfer_a950, arm9_block_transfer_a950,
+  arm9_block_transfer_a960, arm9_block_transfer_a960, arm9_block_transfer_a960, arm9_block_transfer_a960,
+  arm9_block_transfer_a960, arm9_block_transfer_a960, arm9_block_transfer_a960, arm9_block_transfer_a960,
+  arm9_block_transfer_a960, arm9_block_transfer_a960, arm9_block_transfer_a960, arm9_block_transfer_a960,
+  arm9_block_transfer_a960, arm9_block_transfer_a960, arm9_block_transfer_a960, arm9_block_transfer_a960,
+  arm9_block_transfer_a970, arm9_block_transfer_a970, arm9_block_transfer_a970, arm9_block_transfer_a970,
+  arm9_block_transfer_a970, arm9_block_transfer_a970, arm9_block_transfer_a970, arm9_block_transfer_a970,
+  arm9_block_transfer_a970, arm9_block_transfer_a970, arm9_block_transfer_a970, arm9_block_transfer_a970,
+  arm9_block_transfer_a970, arm9_block_transfer_a970, arm9_block_transfer_a970, arm9_block_transfer_a970,
+  arm9_block_transfer_a980, arm9_block_transfer_a980, arm9_block_transfer_a980, arm9_block_transfer_a980,
+  arm9_block_transfer_a980, arm9_block_transfer_a980, arm9_block_transfer_a980, arm9_block_transfer_a980,
+  arm9_block_transfer_a980, arm9_block_transfer_a980, arm9_block_transfer_a980, arm9_block_transfer_a980,
+  arm9_block_transfer_a980, arm9_block_transfer_a980, arm9_block_transfer_a980, arm9_block_transfer_a980,
+  arm9_block_transfer_a990, arm9_block_transfer_a990, arm9_block_transfer_a990, arm9_block_transfer_a990,
+  arm9_block_transfer_a990, arm9_block_transfer_a990, arm9_block_transfer_a990, arm9_block_transfer_a990,
+  arm9_block_transfer_a990, arm9_block_transfer_a990, arm9_block_transfer_a990, arm9_block_transfer_a990,
+  arm9_block_transfer_a990, arm9_block_transfer_a990, arm9_block_transfer_a990, arm9_block_transfer_a990,
+  arm9_block_transfer_a9a0, arm9_block_transfer_a9a0, arm9_block_transfer_a9a0, arm9_block_transfer_a9a0,
+  arm9_block_transfer_a9a0, arm9_block_transfer_a9a0, arm9_block_transfer_a9a0, arm9_block_transfer_a9a0,
+  arm9_block_transfer_a9a0, arm9_block_transfer_a9a0, arm9_block_transfer_a9a0, arm9_block_transfer_a9a0,
+  arm9_block_transfer_a9a0, arm9_block_transfer_a9a0, arm9_block_transfer_a9a0, arm9_block_transfer_a9a0,
+  arm9_block_transfer_a9b0, arm9_block_transfer_a9b0, arm9_block_transfer_a9b0, arm9_block_transfer_a9b0,
+  arm9_block_transfer_a9b0, arm9_block_transfer_a9b0, arm9_block_transfer_a9b0, arm9_block_transfer_a9b0,
+  arm9_block_transfer_a9b0, arm9_block_transfer_a9b0, arm9_block_transfer_a9b0, arm9_block_transfer_a9b0,
+  arm9_block_transfer_a9b0, arm9_block_transfer_a9b0, arm9_block_transfer_a9b0, arm9_block_transfer_a9b0,
+  arm9_block_transfer_a9c0, arm9_block_transfer_a9c0, arm9_block_transfer_a9c0, arm9_block_transfer_a9c0,
+  arm9_block_transfer_a9c0, arm9_block_transfer_a9c0, arm9_block_transfer_a9c0, arm9_block_transfer_a9c0,
+  arm9_block_transfer_a9c0, arm9_block_transfer_a9c0, arm9_block_transfer_a9c0, arm9_block_transfer_a9c0,
+  arm9_block_transfer_a9c0, arm9_block_transfer_a9c0, arm9_block_transfer_a9c0, arm9_block_transfer_a9c0,
+  arm9_block_transfer_a9d0, arm9_block_transfer_a9d0, arm9_block_transfer_a9d0, arm9_block_transfer_a9d0,
+  arm9_block_transfer_a9d0, arm9_block_transfer_a9d0, arm9_block_transfer_a9d0, arm9_block_transfer_a9d0,
+  arm9_block_transfer_a9d0, arm9_block_transfer_a9d0, arm9_block_transfer_a9d0, arm9_block_transfer_a9d0,
+  arm9_block_transfer_a9d0, arm9_block_transfer_a9d0, arm9_block_transfer_a9d0, arm9_block_transfer_a9d0,
+  arm9_block_transfer_a9e0, arm9_block_transfer_a9e0, arm9_block_transfer_a9e0, arm9_block_transfer_a9e0,
+  arm9_block_transfer_a9e0, arm9_block_transfer_a9e0, arm9_block_transfer_a9e0, arm9_block_transfer_a9e0,
+  arm9_block_transfer_a9e0, arm9_block_transfer_a9e0, arm9_block_transfer_a9e0, arm9_block_transfer_a9e0,
+  arm9_block_transfer_a9e0, arm9_block_transfer_a9e0, arm9_block_transfer_a9e0, arm9_block_transfer_a9e0,
+  arm9_block_transfer_a9f0, arm9_block_transfer_a9f0, arm9_block_transfer_a9f0, arm9_block_transfer_a9f0,
+  arm9_block_transfer_a9f0, arm9_block_transfer_a9f0, arm9_block_transfer_a9f0, arm9_block_transfer_a9f0,
+  arm9_block_transfer_a9f0, arm9_block_transfer_a9f0, arm9_block_transfer_a9f0, arm9_block_transfer_a9f0,
+  arm9_block_transfer_a9f0, arm9_block_transfer_a9f0, arm9_block_transfer_a9f0, arm9_block_transfer_a9f0,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00, arm9_branch_aa00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00, arm9_branch_ab00,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer, arm7_coproc_data_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_coproc_data_op, arm7_coproc_reg_transfer, arm7_coproc_data_op, arm7_coproc_reg_transfer,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+  arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt, arm7_software_interrupt,
+};
+
+static const arm7_handler_t arm7t_specialized_lookup_table[256]={
+  arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00,
+  arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00,
+  arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08,
+  arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08,
+  arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10,
+  arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10,
+  arm7t_add_sub_t18, arm7t_add_sub_t18, arm7t_add_sub_t1a, arm7t_add_sub_t1a,
+  arm7t_add_sub_t1c, arm7t_add_sub_t1c, arm7t_add_sub_t1e, arm7t_add_sub_t1e,
+  arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20,
+  arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20,
+  arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28,
+  arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28,
+  arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30,
+  arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30,
+  arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38,
+  arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38,
+  arm7t_alu_op_t40, arm7t_alu_op_t41, arm7t_alu_op_t42, arm7t_alu_op_t43,
+  arm7t_hi_reg_op_t44, arm7t_hi_reg_op_t45, arm7t_hi_reg_op_t46, arm7t_hi_reg_op_t47,
+  arm7t_pc_rel_ldst_t48, arm7t_pc_rel_ldst_t48, arm7t_pc_rel_ldst_t48, arm7t_pc_rel_ldst_t48,
+  arm7t_pc_rel_ldst_t48, arm7t_pc_rel_ldst_t48, arm7t_pc_rel_ldst_t48, arm7t_pc_rel_ldst_t48,
+  arm7t_reg_off_ldst_t50, arm7t_reg_off_ldst_t51, arm7t_ldst_bh_t52, arm7t_ldst_bh_t53,
+  arm7t_reg_off_ldst_t54, arm7t_reg_off_ldst_t55, arm7t_ldst_bh_t56, arm7t_ldst_bh_t57,
+  arm7t_reg_off_ldst_t58, arm7t_reg_off_ldst_t59, arm7t_ldst_bh_t5a, arm7t_ldst_bh_t5b,
+  arm7t_reg_off_ldst_t5c, arm7t_reg_off_ldst_t5d, arm7t_ldst_bh_t5e, arm7t_ldst_bh_t5f,
+  arm7t_imm_off_ldst_t60, arm7t_imm_off_ldst_t60, arm7t_imm_off_ldst_t60, arm7t_imm_off_ldst_t60,
+  arm7t_imm_off_ldst_t60, arm7t_imm_off_ldst_t60, arm7t_imm_off_ldst_t60, arm7t_imm_off_ldst_t60,
+  arm7t_imm_off_ldst_t68, arm7t_imm_off_ldst_t68, arm7t_imm_off_ldst_t68, arm7t_imm_off_ldst_t68,
+  arm7t_imm_off_ldst_t68, arm7t_imm_off_ldst_t68, arm7t_imm_off_ldst_t68, arm7t_imm_off_ldst_t68,
+  arm7t_imm_off_ldst_t70, arm7t_imm_off_ldst_t70, arm7t_imm_off_ldst_t70, arm7t_imm_off_ldst_t70,
+  arm7t_imm_off_ldst_t70, arm7t_imm_off_ldst_t70, arm7t_imm_off_ldst_t70, arm7t_imm_off_ldst_t70,
+  arm7t_imm_off_ldst_t78, arm7t_imm_off_ldst_t78, arm7t_imm_off_ldst_t78, arm7t_imm_off_ldst_t78,
+  arm7t_imm_off_ldst_t78, arm7t_imm_off_ldst_t78, arm7t_imm_off_ldst_t78, arm7t_imm_off_ldst_t78,
+  arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80,
+  arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80,
+  arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88,
+  arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88,
+  arm7t_stack_off_ldst_t90, arm7t_stack_off_ldst_t90, arm7t_stack_off_ldst_t90, arm7t_stack_off_ldst_t90,
+  arm7t_stack_off_ldst_t90, arm7t_stack_off_ldst_t90, arm7t_stack_off_ldst_t90, arm7t_stack_off_ldst_t90,
+  arm7t_stack_off_ldst_t98, arm7t_stack_off_ldst_t98, arm7t_stack_off_ldst_t98, arm7t_stack_off_ldst_t98,
+  arm7t_stack_off_ldst_t98, arm7t_stack_off_ldst_t98, arm7t_stack_off_ldst_t98, arm7t_stack_off_ldst_t98,
+  arm7t_load_addr_ta0, arm7t_load_addr_ta0, arm7t_load_addr_ta0, arm7t_load_addr_ta0,
+  arm7t_load_addr_ta0, arm7t_load_addr_ta0, arm7t_load_addr_ta0, arm7t_load_addr_ta0,
+  arm7t_load_addr_ta8, arm7t_load_addr_ta8, arm7t_load_addr_ta8, arm7t_load_addr_ta8,
+  arm7t_load_addr_ta8, arm7t_load_addr_ta8, arm7t_load_addr_ta8, arm7t_load_addr_ta8,
+  arm7t_add_off_sp_tb0, arm7t_unknown, arm7t_unknown, arm7t_unknown,
+  arm7t_push_pop_reg_tb4, arm7t_push_pop_reg_tb5, arm7t_unknown, arm7t_unknown,
+  arm7t_unknown, arm7t_unknown, arm7t_unknown, arm7t_unknown,
+  arm7t_push_pop_reg_tbc, arm7t_push_pop_reg_tbd, arm7t_unknown, arm7t_unknown,
+  arm7t_mult_ldst_tc0, arm7t_mult_ldst_tc0, arm7t_mult_ldst_tc0, arm7t_mult_ldst_tc0,
+  arm7t_mult_ldst_tc0, arm7t_mult_ldst_tc0, arm7t_mult_ldst_tc0, arm7t_mult_ldst_tc0,
+  arm7t_mult_ldst_tc8, arm7t_mult_ldst_tc8, arm7t_mult_ldst_tc8, arm7t_mult_ldst_tc8,
+  arm7t_mult_ldst_tc8, arm7t_mult_ldst_tc8, arm7t_mult_ldst_tc8, arm7t_mult_ldst_tc8,
+  arm7t_cond_branch_td0, arm7t_cond_branch_td1, arm7t_cond_branch_td2, arm7t_cond_branch_td3,
+  arm7t_cond_branch_td4, arm7t_cond_branch_td5, arm7t_cond_branch_td6, arm7t_cond_branch_td7,
+  arm7t_cond_branch_td8, arm7t_cond_branch_td9, arm7t_cond_branch_tda, arm7t_cond_branch_tdb,
+  arm7t_cond_branch_tdc, arm7t_cond_branch_tdd, arm7t_cond_branch_tde, arm7t_soft_interrupt,
+  arm7t_branch_te0, arm7t_branch_te0, arm7t_branch_te0, arm7t_branch_te0,
+  arm7t_branch_te0, arm7t_branch_te0, arm7t_branch_te0, arm7t_branch_te0,
+  arm7t_long_branch_link_te8, arm7t_long_branch_link_te8, arm7t_long_branch_link_te8, arm7t_long_branch_link_te8,
+  arm7t_long_branch_link_te8, arm7t_long_branch_link_te8, arm7t_long_branch_link_te8, arm7t_long_branch_link_te8,
+  arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0,
+  arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0,
+  arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8,
+  arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8,
+};
+
+static const arm7_handler_t arm9t_specialized_lookup_table[256]={
+  arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00,
+  arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00, arm7t_mov_shift_reg_t00,
+  arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08,
+  arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08, arm7t_mov_shift_reg_t08,
+  arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10,
+  arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10, arm7t_mov_shift_reg_t10,
+  arm7t_add_sub_t18, arm7t_add_sub_t18, arm7t_add_sub_t1a, arm7t_add_sub_t1a,
+  arm7t_add_sub_t1c, arm7t_add_sub_t1c, arm7t_add_sub_t1e, arm7t_add_sub_t1e,
+  arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20,
+  arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20, arm7t_mov_cmp_add_sub_imm_t20,
+  arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28,
+  arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28, arm7t_mov_cmp_add_sub_imm_t28,
+  arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30,
+  arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30, arm7t_mov_cmp_add_sub_imm_t30,
+  arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38,
+  arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38, arm7t_mov_cmp_add_sub_imm_t38,
+  arm7t_alu_op_t40, arm7t_alu_op_t41, arm7t_alu_op_t42, arm7t_alu_op_t43,
+  arm9t_hi_reg_op_t44, arm9t_hi_reg_op_t45, arm9t_hi_reg_op_t46, arm9t_hi_reg_op_t47,
+  arm9t_pc_rel_ldst_t48, arm9t_pc_rel_ldst_t48, arm9t_pc_rel_ldst_t48, arm9t_pc_rel_ldst_t48,
+  arm9t_pc_rel_ldst_t48, arm9t_pc_rel_ldst_t48, arm9t_pc_rel_ldst_t48, arm9t_pc_rel_ldst_t48,
+  arm9t_reg_off_ldst_t50, arm9t_reg_off_ldst_t51, arm7t_ldst_bh_t52, arm7t_ldst_bh_t53,
+  arm9t_reg_off_ldst_t54, arm9t_reg_off_ldst_t55, arm7t_ldst_bh_t56, arm7t_ldst_bh_t57,
+  arm9t_reg_off_ldst_t58, arm9t_reg_off_ldst_t59, arm7t_ldst_bh_t5a, arm7t_ldst_bh_t5b,
+  arm9t_reg_off_ldst_t5c, arm9t_reg_off_ldst_t5d, arm7t_ldst_bh_t5e, arm7t_ldst_bh_t5f,
+  arm9t_imm_off_ldst_t60, arm9t_imm_off_ldst_t60, arm9t_imm_off_ldst_t60, arm9t_imm_off_ldst_t60,
+  arm9t_imm_off_ldst_t60, arm9t_imm_off_ldst_t60, arm9t_imm_off_ldst_t60, arm9t_imm_off_ldst_t60,
+  arm9t_imm_off_ldst_t68, arm9t_imm_off_ldst_t68, arm9t_imm_off_ldst_t68, arm9t_imm_off_ldst_t68,
+  arm9t_imm_off_ldst_t68, arm9t_imm_off_ldst_t68, arm9t_imm_off_ldst_t68, arm9t_imm_off_ldst_t68,
+  arm9t_imm_off_ldst_t70, arm9t_imm_off_ldst_t70, arm9t_imm_off_ldst_t70, arm9t_imm_off_ldst_t70,
+  arm9t_imm_off_ldst_t70, arm9t_imm_off_ldst_t70, arm9t_imm_off_ldst_t70, arm9t_imm_off_ldst_t70,
+  arm9t_imm_off_ldst_t78, arm9t_imm_off_ldst_t78, arm9t_imm_off_ldst_t78, arm9t_imm_off_ldst_t78,
+  arm9t_imm_off_ldst_t78, arm9t_imm_off_ldst_t78, arm9t_imm_off_ldst_t78, arm9t_imm_off_ldst_t78,
+  arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80,
+  arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80, arm7t_imm_off_ldst_bh_t80,
+  arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88,
+  arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88, arm7t_imm_off_ldst_bh_t88,
+  arm9t_stack_off_ldst_t90, arm9t_stack_off_ldst_t90, arm9t_stack_off_ldst_t90, arm9t_stack_off_ldst_t90,
+  arm9t_stack_off_ldst_t90, arm9t_stack_off_ldst_t90, arm9t_stack_off_ldst_t90, arm9t_stack_off_ldst_t90,
+  arm9t_stack_off_ldst_t98, arm9t_stack_off_ldst_t98, arm9t_stack_off_ldst_t98, arm9t_stack_off_ldst_t98,
+  arm9t_stack_off_ldst_t98, arm9t_stack_off_ldst_t98, arm9t_stack_off_ldst_t98, arm9t_stack_off_ldst_t98,
+  arm7t_load_addr_ta0, arm7t_load_addr_ta0, arm7t_load_addr_ta0, arm7t_load_addr_ta0,
+  arm7t_load_addr_ta0, arm7t_load_addr_ta0, arm7t_load_addr_ta0, arm7t_load_addr_ta0,
+  arm7t_load_addr_ta8, arm7t_load_addr_ta8, arm7t_load_addr_ta8, arm7t_load_addr_ta8,
+  arm7t_load_addr_ta8, arm7t_load_addr_ta8, arm7t_load_addr_ta8, arm7t_load_addr_ta8,
+  arm7t_add_off_sp_tb0, arm7t_unknown, arm7t_unknown, arm7t_unknown,
+  arm9t_push_pop_reg_tb4, arm9t_push_pop_reg_tb5, arm7t_unknown, arm7t_unknown,
+  arm7t_unknown, arm7t_unknown, arm7t_unknown, arm7t_unknown,
+  arm9t_push_pop_reg_tbc, arm9t_push_pop_reg_tbd, arm7t_unknown, arm7t_unknown,
+  arm9t_mult_ldst_tc0, arm9t_mult_ldst_tc0, arm9t_mult_ldst_tc0, arm9t_mult_ldst_tc0,
+  arm9t_mult_ldst_tc0, arm9t_mult_ldst_tc0, arm9t_mult_ldst_tc0, arm9t_mult_ldst_tc0,
+  arm9t_mult_ldst_tc8, arm9t_mult_ldst_tc8, arm9t_mult_ldst_tc8, arm9t_mult_ldst_tc8,
+  arm9t_mult_ldst_tc8, arm9t_mult_ldst_tc8, arm9t_mult_ldst_tc8, arm9t_mult_ldst_tc8,
+  arm7t_cond_branch_td0, arm7t_cond_branch_td1, arm7t_cond_branch_td2, arm7t_cond_branch_td3,
+  arm7t_cond_branch_td4, arm7t_cond_branch_td5, arm7t_cond_branch_td6, arm7t_cond_branch_td7,
+  arm7t_cond_branch_td8, arm7t_cond_branch_td9, arm7t_cond_branch_tda, arm7t_cond_branch_tdb,
+  arm7t_cond_branch_tdc, arm7t_cond_branch_tdd, arm7t_cond_branch_tde, arm7t_soft_interrupt,
+  arm7t_branch_te0, arm7t_branch_te0, arm7t_branch_te0, arm7t_branch_te0,
+  arm7t_branch_te0, arm7t_branch_te0, arm7t_branch_te0, arm7t_branch_te0,
+  arm7t_long_branch_link_te8, arm7t_long_branch_link_te8, arm7t_long_branch_link_te8, arm7t_long_branch_link_te8,
+  arm7t_long_branch_link_te8, arm7t_long_branch_link_te8, arm7t_long_branch_link_te8, arm7t_long_branch_link_te8,
+  arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0,
+  arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0, arm7t_long_branch_link_tf0,
+  arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8,
+  arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8, arm7t_long_branch_link_tf8,
+};
+
+#endif
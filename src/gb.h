@@ -295,9 +295,21 @@ typedef struct {
   bool halt_bug; 
 } sb_gb_cpu_t;
 
+#define SB_MEM_PAGE_READ  (1<<0)
+#define SB_MEM_PAGE_WRITE (1<<1)
+#define SB_MEM_PAGE_ROM   (1<<2) // offset is into the cart ROM instead of the sb_gb_t
+#define SB_MEM_PAGE_SHIFT 8
+#define SB_MEM_PAGES      (0x10000>>SB_MEM_PAGE_SHIFT)
+typedef struct{
+  uint32_t offset; // Start of the page's memory from the sb_gb_t (or cart ROM), so copies of the core can share it
+  uint32_t flags;  // Accesses to pages without the SB_MEM_PAGE_READ/WRITE flag go through sb_read8_slow/sb_store8_slow
+}sb_gb_mem_page_t;
+
 typedef struct {
   uint8_t data[65536];
   uint8_t wram[SB_WRAM_NUM_BANKS*SB_WRAM_BANK_SIZE];
+  // Rebuilt by sb_update_mem_pages whenever a MBC or bank register write moves the memory behind a page
+  sb_gb_mem_page_t pages[SB_MEM_PAGES];
 } sb_gb_mem_t;
 
 typedef struct {
@@ -318,6 +330,12 @@ typedef struct {
   bool bank_mode; //MBC1
 } sb_gb_cartridge_t;
 
+#define SB_PPU_NUM_TILES 384
+typedef struct{
+  // 2bpp tile data expanded to one color id per pixel, indexed by the bit position in the tile row
+  uint8_t pixels[SB_VRAM_NUM_BANKS][SB_PPU_NUM_TILES][8][8];
+} sb_tile_cache_t;
+
 typedef struct{
   unsigned int scanline_cycles;
   unsigned int curr_scanline;
@@ -335,6 +353,12 @@ typedef struct{
   bool finished_frame;
   int sprite_index;
   bool render_frame;
+  float ghosting_strength;
+  // Last cycle of the current scanline the renderer has caught up to
+  int render_cycle;
+  sb_tile_cache_t *tile_cache;
+  // Tiles written since they were last expanded into the tile cache
+  uint32_t tile_dirty[SB_VRAM_NUM_BANKS][SB_PPU_NUM_TILES/32];
 } sb_lcd_ppu_t;
 typedef struct{
   bool in_hblank; 
@@ -431,9 +455,20 @@ typedef struct {
   uint8_t* bios; 
 } sb_gb_t;  
 
+typedef struct{
+  uint64_t runs_skipped;
+  uint64_t iterations_skipped;
+  uint64_t verified, mismatches;
+  // Copies of the state a skipped run is replayed on one iteration at a time when verifying
+  sb_gb_t gb;
+  sb_emu_state_t emu;
+} sb_halt_skip_t;
+
 typedef struct{
   uint8_t framebuffer[SB_LCD_H*SB_LCD_W*4];
   uint8_t bios[2304];
+  sb_tile_cache_t tile_cache;
+  sb_halt_skip_t halt_skip;
  } gb_scratch_t; 
 
 // Return offset to bess structure
@@ -492,14 +527,14 @@ typedef void (*sb_opcode_impl_t)(sb_gb_t*,int op1,int op2, int op1_enum, int op2
 
 //Include down here because of dependence on sb_gb_t /*TODO: refactor this*/
 #include "sb_instr_tables.h"
+#include "sb_instr_specialized.h"
 
-uint32_t sb_lookup_tile(sb_gb_t* gb, int px, int py, int tile_base, int data_mode);
 void sb_lookup_palette_color(sb_gb_t*gb,int color_id, int*r, int *g, int *b);
 static FORCE_INLINE void sb_process_audio(sb_gb_t *gb, sb_emu_state_t*emu, double delta_time,int cycles);
 static void sb_tick_frame_seq(sb_gb_t*gb,sb_frame_sequencer_t* seq);
 static void sb_process_audio_writes(sb_gb_t* gb); 
 static bool sb_run_ar_cheat(sb_gb_t* gb, const uint32_t* buffer, uint32_t size);
-void sb_draw_pixel(sb_emu_state_t*emu,sb_gb_t* gb, int x, int y);
+static void sb_lcd_catch_up(sb_gb_t* gb);
 
 static FORCE_INLINE uint8_t sb_read8_io(sb_gb_t*gb, int addr){return gb->mem.data[addr];}
 static FORCE_INLINE void sb_store8_io(sb_gb_t*gb, int addr, int value){gb->mem.data[addr]=value;}
@@ -592,7 +627,7 @@ uint8_t sb_io_or_mask(sb_gb_t* gb, int addr){
   }
   return 0; 
 }
-uint8_t sb_read8(sb_gb_t *gb, int addr) {
+static uint8_t sb_read8_slow(sb_gb_t *gb, int addr) {
   //if(addr == 0xff44)return 0x90;
   //if(addr == 0xff80)gb->cpu.trigger_breakpoint=true;
   //Only high ram is accessible during oam_dma
@@ -621,9 +656,22 @@ uint8_t sb_read8(sb_gb_t *gb, int addr) {
   }
   return sb_read8_direct(gb,addr);
 }
+static FORCE_INLINE uint8_t sb_read8(sb_gb_t *gb, int addr) {
+  if(SB_LIKELY((unsigned)addr<=0xffff)){
+    sb_gb_mem_page_t page = gb->mem.pages[addr>>SB_MEM_PAGE_SHIFT];
+    if(SB_LIKELY(page.flags&SB_MEM_PAGE_READ)){
+      const uint8_t* base = page.flags&SB_MEM_PAGE_ROM? gb->cart.data: (const uint8_t*)gb;
+      return base[page.offset+(addr&((1<<SB_MEM_PAGE_SHIFT)-1))];
+    }
+  }
+  return sb_read8_slow(gb,addr);
+}
 static FORCE_INLINE void sb_store8_direct(sb_gb_t *gb, int addr, int value) {
   if(addr>=0x8000&&addr<=0x9fff){
     uint8_t vbank =sb_read8_io(gb, SB_IO_GBC_VBK)%SB_VRAM_NUM_BANKS;;
+    sb_lcd_catch_up(gb);
+    int tile = (addr-0x8000)/16;
+    if(tile<SB_PPU_NUM_TILES)gb->lcd.tile_dirty[vbank][tile/32]|=1u<<(tile%32);
     gb->lcd.vram[vbank*SB_VRAM_BANK_SIZE+addr-0x8000]=value;
     return;
   }else if(addr>=0xA000&&addr<=0xBfff){
@@ -653,11 +701,16 @@ static FORCE_INLINE void sb_store8_direct(sb_gb_t *gb, int addr, int value) {
     //gb->cpu.trigger_breakpoint=true;
     return;
   }
+  if(addr>=0xfe00&&addr<=0xfe9f)sb_lcd_catch_up(gb);
   gb->mem.data[addr]=value;
 }
-void sb_store8(sb_gb_t *gb, int addr, int value) {
+static void sb_store8_slow(sb_gb_t *gb, int addr, int value) {
   if(addr>=0xff00){
     if(!sb_gbc_enable(gb) &&addr>=0xff4C&&addr<=0xff7f&&addr!=SB_IO_BIOS_BANK)return;
+    // Registers the renderer reads, draw the pixels the PPU already passed with the old values
+    if((addr>=SB_IO_LCD_CTRL&&addr<=SB_IO_GBC_KEY0)||addr==SB_IO_BIOS_BANK||(addr>=SB_IO_GBC_BCPS&&addr<=SB_IO_GBC_OCPD)){
+      sb_lcd_catch_up(gb);
+    }
     if(addr == SB_IO_DMA_SRC_LO ||addr == SB_IO_DMA_DST_LO){
       value&=~0xf;
     } else if(addr == SB_IO_DMA_MODE_LEN){
@@ -800,6 +853,80 @@ void sb_store8(sb_gb_t *gb, int addr, int value) {
   }
   sb_store8_direct(gb,addr,value);
 }
+// Fills the page table for [start_addr, end_addr] from the current banking state. Only plain memory
+// gets a fast page. The BIOS, VRAM writes, SRAM writes, the MBC3 RTC registers, disabled SRAM, OAM and
+// IO keep the slow path.
+static void sb_update_mem_pages(sb_gb_t* gb, int start_addr, int end_addr){
+  for(int p=start_addr>>SB_MEM_PAGE_SHIFT;p<=end_addr>>SB_MEM_PAGE_SHIFT;++p){
+    int addr = p<<SB_MEM_PAGE_SHIFT;
+    sb_gb_mem_page_t page = {0};
+    if(addr<=0x7fff){
+      bool bios = !sb_read8_io(gb,SB_IO_BIOS_BANK)&&(addr<256||(addr>=512&&addr<2304));
+      if(!bios&&gb->cart.rom_size>0&&gb->cart.rom_size%(1<<SB_MEM_PAGE_SHIFT)==0){
+        int cart_addr = SB_BFE(addr,0,14);
+        if(addr>=0x4000)cart_addr|=(gb->cart.mapped_rom_bank)<<14;
+        if(gb->cart.mbc_type==SB_MBC_MBC1&&(addr>=0x4000||gb->cart.bank_mode)){
+          cart_addr|=SB_BFE(gb->cart.mapped_ram_bank,0,2)<<19;
+        }
+        cart_addr%= (gb->cart.rom_size);
+        page = (sb_gb_mem_page_t){cart_addr,SB_MEM_PAGE_READ|SB_MEM_PAGE_ROM};
+      }
+    }else if(addr<=0x9fff){
+      uint8_t vbank =sb_read8_io(gb,SB_IO_GBC_VBK)%SB_VRAM_NUM_BANKS;
+      page = (sb_gb_mem_page_t){offsetof(sb_gb_t,lcd.vram)+vbank*SB_VRAM_BANK_SIZE+addr-0x8000,SB_MEM_PAGE_READ};
+    }else if(addr<=0xbfff){
+      bool rtc = gb->rtc.has_rtc&&gb->cart.mbc_type==SB_MBC_MBC3&&gb->cart.mapped_ram_bank>=0x08&&gb->cart.mapped_ram_bank<=0x0C;
+      if(gb->cart.ram_write_enable&&!rtc&&gb->cart.ram_size>0&&gb->cart.ram_size%(1<<SB_MEM_PAGE_SHIFT)==0){
+        int ram_addr_off = 0x2000*gb->cart.mapped_ram_bank+(addr-0xA000);
+        if(gb->cart.mbc_type==SB_MBC_MBC1){
+          ram_addr_off = SB_BFE(addr,0,13);
+          if(gb->cart.bank_mode)ram_addr_off|= SB_BFE(gb->cart.mapped_ram_bank,0,2)<<13;
+        }
+        ram_addr_off%=gb->cart.ram_size;
+        page = (sb_gb_mem_page_t){offsetof(sb_gb_t,cart.ram_data)+ram_addr_off,SB_MEM_PAGE_READ};
+      }
+    }else if(addr>=0xD000&&addr<=0xDfff){
+      int bank =gb->mem.data[SB_IO_GBC_SVBK]%SB_WRAM_NUM_BANKS;
+      if(bank==0)bank = 1;
+      int ram_addr_off = 0x1000*bank+(addr-0xd000);
+      page = (sb_gb_mem_page_t){offsetof(sb_gb_t,mem.wram)+ram_addr_off,SB_MEM_PAGE_READ|SB_MEM_PAGE_WRITE};
+    }else if(addr<=0xfdff){
+      //Echo Ram
+      int data_addr = addr>=0xe000? addr-0xe000+0xc000: addr;
+      page = (sb_gb_mem_page_t){offsetof(sb_gb_t,mem.data)+data_addr,SB_MEM_PAGE_READ|SB_MEM_PAGE_WRITE};
+    }
+    gb->mem.pages[p]=page;
+  }
+}
+static FORCE_INLINE void sb_store8(sb_gb_t *gb, int addr, int value) {
+  if(SB_LIKELY((unsigned)addr<=0xffff)){
+    sb_gb_mem_page_t page = gb->mem.pages[addr>>SB_MEM_PAGE_SHIFT];
+    if(SB_LIKELY(page.flags&SB_MEM_PAGE_WRITE)){
+      ((uint8_t*)gb)[page.offset+(addr&((1<<SB_MEM_PAGE_SHIFT)-1))]=value;
+      return;
+    }
+  }
+  if(addr<=0x7fff){
+    // MBC writes move the memory behind the ROM and SRAM pages, but many games keep writing the
+    // bank they already have mapped
+    sb_gb_cartridge_t* cart = &gb->cart;
+    unsigned rom_bank = cart->mapped_rom_bank;
+    uint8_t ram_bank = cart->mapped_ram_bank;
+    bool ram_enable = cart->ram_write_enable, bank_mode = cart->bank_mode;
+    sb_store8_slow(gb,addr,value);
+    if(ram_bank!=cart->mapped_ram_bank||bank_mode!=cart->bank_mode){
+      // MBC1 also uses the RAM bank bits for the upper ROM bank bits
+      if(cart->mbc_type==SB_MBC_MBC1)sb_update_mem_pages(gb,0x0000,0x7fff);
+      sb_update_mem_pages(gb,0xa000,0xbfff);
+    }else if(ram_enable!=cart->ram_write_enable)sb_update_mem_pages(gb,0xa000,0xbfff);
+    if(rom_bank!=cart->mapped_rom_bank)sb_update_mem_pages(gb,0x4000,0x7fff);
+    return;
+  }
+  sb_store8_slow(gb,addr,value);
+  if(addr==SB_IO_BIOS_BANK)sb_update_mem_pages(gb,0x0000,0x7fff);
+  else if(addr==SB_IO_GBC_VBK)sb_update_mem_pages(gb,0x8000,0x9fff);
+  else if(addr==SB_IO_GBC_SVBK)sb_update_mem_pages(gb,0xd000,0xdfff);
+}
 void sb_store16(sb_gb_t *gb, int addr, unsigned int value) {
   sb_store8(gb,addr,value&0xff);
   sb_store8(gb,addr+1,((value>>8u)&0xff));
@@ -862,8 +989,10 @@ static FORCE_INLINE void sb_update_lcd(sb_emu_state_t*emu,sb_gb_t* gb){
   int mode = stat&0x7;
   bool new_scanline = false;
   if(!enable){
+    sb_lcd_catch_up(gb);
     //TODO: Starting at 4 here, may indicate a CPU timing bug. But is needed to pass 1-lcd_sync.gb
     gb->lcd.scanline_cycles = 4;
+    gb->lcd.render_cycle = 4;
     gb->lcd.curr_scanline = 0;
     gb->lcd.curr_window_scanline = 0;
     gb->lcd.wy_eq_ly = false;
@@ -878,6 +1007,11 @@ static FORCE_INLINE void sb_update_lcd(sb_emu_state_t*emu,sb_gb_t* gb){
     const int scanline_dots = 456;
     const int mode0_clks = scanline_dots-mode2_clks-mode3_clks;
 
+    if(gb->lcd.scanline_cycles+1>=scanline_dots){
+      // Finish the line before the scanline state below moves on
+      sb_lcd_catch_up(gb);
+      gb->lcd.render_cycle=-1;
+    }
     gb->lcd.scanline_cycles +=1;
     if(gb->lcd.scanline_cycles>=scanline_dots){
       gb->lcd.scanline_cycles=0;
@@ -889,7 +1023,6 @@ static FORCE_INLINE void sb_update_lcd(sb_emu_state_t*emu,sb_gb_t* gb){
     else mode =0;
     int old_mode = stat&0x7;
    
-    int wy = sb_read8_io(gb, SB_IO_LCD_WY);
     if(new_scanline){
 
       if(gb->lcd.window_active)gb->lcd.curr_window_scanline+=1;
@@ -908,45 +1041,6 @@ static FORCE_INLINE void sb_update_lcd(sb_emu_state_t*emu,sb_gb_t* gb){
       if(ly==SB_LCD_H)gb->lcd.finished_frame=true;
     }
     if(ly >= SB_LCD_H) {mode = 1;}    
-    if(gb->lcd.render_frame){
-      if(mode==2){
-        int clock_num = gb->lcd.scanline_cycles;
-        if(clock_num==0){
-          for(int i=0;i<SB_SPRITES_PER_SCANLINE;++i)gb->lcd.render_sprites[i]=-1;
-          gb->lcd.sprite_index = 0; 
-        }
-        if(clock_num%2){
-          uint8_t y = gb->lcd.curr_scanline;
-          const int num_sprites= 40;
-          int oam_table_offset = 0xfe00;
-          uint8_t ctrl = sb_read8_io(gb, SB_IO_LCD_CTRL);
-          bool draw_sprite = SB_BFE(ctrl,1,1)==1;
-          bool sprite8x16  = SB_BFE(ctrl,2,1)==1;
-          int sprite_h = sprite8x16 ? 16: 8;
-          int sprite_id = clock_num/2;
-          int sprite_base = oam_table_offset+sprite_id*4;
-          int yc = (int)sb_read8_io(gb, sprite_base+0)-16;
-          int xc = (int)sb_read8_io(gb, sprite_base+1)-16;
-          if(yc<=y && yc+sprite_h>y&& gb->lcd.sprite_index<SB_SPRITES_PER_SCANLINE&&sprite_id<num_sprites&&draw_sprite){
-            gb->lcd.render_sprites[gb->lcd.sprite_index]=sprite_id;
-            for(int i=0;i<4;++i){
-              gb->lcd.render_sprites_data[gb->lcd.sprite_index][i]=sb_read8_io(gb, sprite_base+i);
-            }
-            gb->lcd.sprite_index++;
-          }
-        }
-      }
-      if(gb->lcd.curr_scanline<SB_LCD_H){
-        int x = gb->lcd.scanline_cycles-mode2_clks-8;
-        //This is intenentionally not latched for: 007 - The World is Not Enough's hud. 
-        //Zen Intergalactic Ninja, Speedy Gonzales, and the Warriors of Might and Magic are also very sensitive
-        //to the behavior of this window. 
-        if(ly==wy&&window_enable) gb->lcd.wy_eq_ly = true;
-        if(x<SB_LCD_W&&x>=0){
-          sb_draw_pixel(emu,gb,x,gb->lcd.curr_scanline);
-        }
-      }
-    }
     if(ly==153&& gb->lcd.scanline_cycles>=4){ly = 0;}
 
     bool lyc_eq_ly_interrupt = SB_BFE(stat, 6,1);
@@ -978,9 +1072,32 @@ static FORCE_INLINE void sb_update_lcd(sb_emu_state_t*emu,sb_gb_t* gb){
   gb->lcd.in_hblank = (mode&0x3)==0;
   sb_store8_io(gb, SB_IO_LCD_LY, ly);;
 }
+// Number of sb_update_lcd calls until the one that changes the mode or scanline (or LY reading 0 on
+// line 153). The calls before it only advance scanline_cycles as long as no register is written. Returns
+// 0 while the LCD is off, where every call does the same thing.
+static FORCE_INLINE int sb_lcd_cycles_to_next_event(sb_gb_t* gb){
+  if(!SB_BFE(sb_read8_io(gb, SB_IO_LCD_CTRL),7,1))return 0;
+  int cycle = gb->lcd.scanline_cycles;
+  int next = cycle<80? 80: cycle<80+SB_LCD_W? 80+SB_LCD_W: 456;
+  if(gb->lcd.curr_scanline==153&&cycle<4)next = 4;
+  return next-cycle;
+}
 uint8_t sb_read_vram(sb_gb_t*gb, int cpu_address, int bank){
   return gb->lcd.vram[bank*SB_VRAM_BANK_SIZE+cpu_address-0x8000];
 }
+// Returns the color ids of one row of a tile, expanding the tile from VRAM if it was written
+static FORCE_INLINE const uint8_t* sb_lookup_tile_row(sb_gb_t* gb, int tile, int row, int bank){
+  uint8_t (*pixels)[8] = gb->lcd.tile_cache->pixels[bank][tile];
+  uint32_t *dirty = &gb->lcd.tile_dirty[bank][tile/32];
+  if(SB_UNLIKELY(SB_BFE(*dirty,tile%32,1))){
+    const uint8_t *data = gb->lcd.vram+bank*SB_VRAM_BANK_SIZE+tile*16;
+    for(int y=0;y<8;++y){
+      for(int x=0;x<8;++x)pixels[y][x]=SB_BFE(data[y*2],x,1)+SB_BFE(data[y*2+1],x,1)*2;
+    }
+    *dirty&=~(1u<<(tile%32));
+  }
+  return pixels[row];
+}
 // Returns info about the pixel in the tile map packed into a 32bit integer
 // ret[1:0] = color_id
 // ret[7:2] = palette_id
@@ -988,7 +1105,7 @@ uint8_t sb_read_vram(sb_gb_t*gb, int cpu_address, int bank){
 #define SB_BACKG_PALETTE 0
 #define SB_OBJ0_PALETTE 1
 #define SB_OBJ1_PALETTE 2
-uint32_t sb_lookup_tile(sb_gb_t* gb, int px, int py, int tile_base, int data_mode){
+static FORCE_INLINE uint32_t sb_lookup_tile(sb_gb_t* gb, int px, int py, int tile_base, int data_mode, bool gbc_mode){
   const int tile_size = 8;
   const int tiles_per_row = 32;
   int tile_offset = (((px&0xff)/tile_size)+((py&0xff)/tile_size)*tiles_per_row)&0x3ff;
@@ -998,15 +1115,13 @@ uint32_t sb_lookup_tile(sb_gb_t* gb, int px, int py, int tile_base, int data_mod
   int pixel_in_tile_x = 7-(px%8);
   int pixel_in_tile_y = (py%8);
 
-  int byte_tile_data_off = 0;
-
   int tile_d_vram_bank = 0;
   int tile_bg_palette = 0;
 
   bool bg_to_oam_priority=false;
   tile_bg_palette = SB_BACKG_PALETTE;
   //Only enable GB functionality if in GBC mode
-  if(sb_gbc_enable(gb)){
+  if(gbc_mode){
     uint8_t attr = sb_read_vram(gb, tile_base+tile_offset,1);
 
     bg_to_oam_priority = SB_BFE(attr,7,1);
@@ -1018,17 +1133,9 @@ uint32_t sb_lookup_tile(sb_gb_t* gb, int px, int py, int tile_base, int data_mod
     if(v_flip)pixel_in_tile_y = 7-pixel_in_tile_y;
     if(h_flip)pixel_in_tile_x = 7-pixel_in_tile_x;
   }
-
-  const int bytes_per_tile = 2*8;
-  if(data_mode==0){
-    byte_tile_data_off = 0x8000 + 0x1000 + ((int)((int8_t)(tile_id)))*bytes_per_tile;
-  }else{
-    byte_tile_data_off = 0x8000 + ((int)((uint8_t)(tile_id)))*bytes_per_tile;
-  }
-  byte_tile_data_off+=pixel_in_tile_y*2;
-  uint8_t data1 = sb_read_vram(gb, byte_tile_data_off,tile_d_vram_bank);
-  uint8_t data2 = sb_read_vram(gb, byte_tile_data_off+1,tile_d_vram_bank);
-  int color_id = (SB_BFE(data1,pixel_in_tile_x,1)+SB_BFE(data2,pixel_in_tile_x,1)*2);
+  // Mode 0 addresses tiles signed relative to 0x9000 (tile 256)
+  int tile = data_mode==0 ? 256+(int)((int8_t)(tile_id)) : (int)((uint8_t)(tile_id));
+  int color_id = sb_lookup_tile_row(gb,tile,pixel_in_tile_y,tile_d_vram_bank)[pixel_in_tile_x];
   color_id |= (tile_bg_palette&0x3f)<<2;
   if(bg_to_oam_priority)color_id|= 1<<8;
   return color_id;
@@ -1071,7 +1178,8 @@ void sb_lookup_palette_color(sb_gb_t*gb,int color_id, int*r, int *g, int *b){
     *b = tb*8;
   }
 }
-void sb_draw_pixel(sb_emu_state_t*emu,sb_gb_t* gb, int x, int y){
+// Draws pixels [x_start, x_end) of scanline y with the current register state
+static void sb_draw_scanline(sb_gb_t* gb, int y, int x_start, int x_end){
   uint8_t ctrl = sb_read8_io(gb, SB_IO_LCD_CTRL);
   bool draw_bg_win     = SB_BFE(ctrl,0,1)==1;
   bool master_priority = true;
@@ -1085,44 +1193,43 @@ void sb_draw_pixel(sb_emu_state_t*emu,sb_gb_t* gb, int x, int y){
   bool sprite8x16  = SB_BFE(ctrl,2,1)==1;
   int bg_tile_map_base      = SB_BFE(ctrl,3,1)==1 ? 0x9c00 : 0x9800;
   int bg_win_tile_data_mode = SB_BFE(ctrl,4,1)==1;
-  bool window_enable        = SB_BFE(ctrl,5,1)==1;
   int win_tile_map_base     = SB_BFE(ctrl,6,1)==1 ? 0x9c00 : 0x9800;
 
-  int oam_table_offset = 0xfe00;
   int wx = sb_read8_io(gb, SB_IO_LCD_WX)-7;
-  int wy = sb_read8_io(gb, SB_IO_LCD_WY);
   int sx = sb_read8_io(gb, SB_IO_LCD_SX);
   int sy = sb_read8_io(gb, SB_IO_LCD_SY);
 
-  // HW only draws first 10 sprites that touch a scanline
   const int bytes_per_tile = 2*8;
-  int color_id=0;
-
-  bool background_priority= false;
-  gb->lcd.window_active|= gb->lcd.latched_window_enable&&gb->lcd.wy_eq_ly&&x>=wx;
-  if(draw_bg_win){
-    if(gb->lcd.window_active){
-      int px = x-wx;
-      if(px>=0){
-        int py = gb->lcd.curr_window_scanline;
-        color_id = sb_lookup_tile(gb,px,py,win_tile_map_base,bg_win_tile_data_mode);
+  uint16_t color_ids[SB_LCD_W];
+  for(int x=x_start;x<x_end;++x){
+    int color_id=0;
+    gb->lcd.window_active|= gb->lcd.latched_window_enable&&gb->lcd.wy_eq_ly&&x>=wx;
+    if(draw_bg_win){
+      if(gb->lcd.window_active){
+        int px = x-wx;
+        if(px>=0){
+          int py = gb->lcd.curr_window_scanline;
+          color_id = sb_lookup_tile(gb,px,py,win_tile_map_base,bg_win_tile_data_mode,gbc_mode);
+        }
+      }else{
+        int px = x+ sx;
+        int py = y+ sy;
+        color_id = sb_lookup_tile(gb,px,py,bg_tile_map_base,bg_win_tile_data_mode,gbc_mode);
       }
-    }else{
-      int px = x+ sx;
-      int py = y+ sy;
-      color_id = sb_lookup_tile(gb,px,py,bg_tile_map_base,bg_win_tile_data_mode);
     }
+    color_ids[x]=color_id;
   }
   if(draw_sprite){
-    int prior_sprite = 256;
+    // HW only draws first 10 sprites that touch a scanline. Every pixel resolves the
+    // sprites in OAM order, so walking sprite by sprite gives the same result.
+    int prior_sprite[SB_LCD_W];
+    for(int x=x_start;x<x_end;++x)prior_sprite[x]=256;
     for(int i=0;i<gb->lcd.sprite_index;++i){
-      int sprite = gb->lcd.render_sprites[i];
       int xc = gb->lcd.render_sprites_data[i][1]-8;
-
-      int x_sprite = 7-(x-xc);
-      int prior = sb_gbc_enable(gb)?0 : xc;
-      //Check if the sprite is hit
-      if(prior_sprite<=prior||x_sprite>=8 || x_sprite<0) continue;
+      int prior = gbc_mode?0 : xc;
+      int sprite_start = xc>x_start?xc:x_start;
+      int sprite_end = xc+8<x_end?xc+8:x_end;
+      if(sprite_start>=sprite_end)continue;
 
       int yc = gb->lcd.render_sprites_data[i][0]-16;
       int y_sprite = y-yc;
@@ -1130,7 +1237,6 @@ void sb_draw_pixel(sb_emu_state_t*emu,sb_gb_t* gb, int x, int y){
       int tile = gb->lcd.render_sprites_data[i][2];
       int attr = gb->lcd.render_sprites_data[i][3];
       int tile_d_vram_bank = 0;
-      int tile_sprite_palette =0;
 
       int palette = SB_BFE(attr,4,1)!=0?SB_OBJ1_PALETTE:SB_OBJ0_PALETTE;
       if(gbc_mode){
@@ -1143,32 +1249,106 @@ void sb_draw_pixel(sb_emu_state_t*emu,sb_gb_t* gb, int x, int y){
       bool y_flip = SB_BFE(attr,6,1);
       bool bg_win_on_top = SB_BFE(attr,7,1);
 
-      if(x_flip)x_sprite = 7-x_sprite;
       if(y_flip)y_sprite = (sprite8x16? 15 : 7)-y_sprite;
 
-      int byte_tile_data_off = 0x8000 + (((uint8_t)(tile))*bytes_per_tile);
-      byte_tile_data_off+=y_sprite*2;
-
-      uint8_t data1 = sb_read_vram(gb, byte_tile_data_off,tile_d_vram_bank);
-      uint8_t data2 = sb_read_vram(gb, byte_tile_data_off+1,tile_d_vram_bank);
-
-      int cid = (SB_BFE(data1,x_sprite,1)+SB_BFE(data2,x_sprite,1)*2);
-      if((bg_win_on_top||(SB_BFE(color_id,8,1)))&&master_priority){
-        if((color_id&0x3)==0&&cid!=0){color_id = cid | (palette<<2); prior_sprite =prior;}
-      }else if(cid!=0){color_id = cid | (palette<<2); prior_sprite=prior;}
+      int byte_tile_data_off = (((uint8_t)(tile))*bytes_per_tile)+y_sprite*2;
+      const uint8_t *row;
+      uint8_t row_data[8];
+      if(SB_LIKELY(byte_tile_data_off>=0)){
+        row = sb_lookup_tile_row(gb,byte_tile_data_off/bytes_per_tile,(byte_tile_data_off/2)%8,tile_d_vram_bank);
+      }else{
+        // A flipped 8x8 sprite left over from 8x16 selection reaches before the tile data
+        uint8_t data1 = sb_read_vram(gb, 0x8000+byte_tile_data_off,tile_d_vram_bank);
+        uint8_t data2 = sb_read_vram(gb, 0x8000+byte_tile_data_off+1,tile_d_vram_bank);
+        for(int b=0;b<8;++b)row_data[b]=SB_BFE(data1,b,1)+SB_BFE(data2,b,1)*2;
+        row = row_data;
+      }
+      for(int x=sprite_start;x<sprite_end;++x){
+        if(prior_sprite[x]<=prior)continue;
+        int x_sprite = 7-(x-xc);
+        if(x_flip)x_sprite = 7-x_sprite;
+        int cid = row[x_sprite];
+        int color_id = color_ids[x];
+        if((bg_win_on_top||(SB_BFE(color_id,8,1)))&&master_priority){
+          if((color_id&0x3)==0&&cid!=0){color_ids[x] = cid | (palette<<2); prior_sprite[x] =prior;}
+        }else if(cid!=0){color_ids[x] = cid | (palette<<2); prior_sprite[x]=prior;}
+      }
     }
   }
-  int r=0,g=0,b=0;
-  sb_lookup_palette_color(gb,color_id,&r,&g,&b);
+  // Palettes only depend on the low byte of the color id
+  uint8_t palette_rgb[256][3];
+  bool palette_valid[256];
+  memset(palette_valid,0,sizeof(palette_valid));
 
   float ghost_coef = 0.5;
   if(gb->model != SB_GB)ghost_coef= 0.2;
-  ghost_coef*=emu->screen_ghosting_strength;
-  int p =(x+(y)*SB_LCD_W)*4;
-  gb->lcd.framebuffer[p+0] = r*(1.0-ghost_coef)+gb->lcd.framebuffer[p+0]*ghost_coef+0.5;
-  gb->lcd.framebuffer[p+1] = g*(1.0-ghost_coef)+gb->lcd.framebuffer[p+1]*ghost_coef+0.5;
-  gb->lcd.framebuffer[p+2] = b*(1.0-ghost_coef)+gb->lcd.framebuffer[p+2]*ghost_coef+0.5;
-
+  ghost_coef*=gb->lcd.ghosting_strength;
+  uint8_t *fb = gb->lcd.framebuffer+y*SB_LCD_W*4;
+  for(int x=x_start;x<x_end;++x){
+    int color_id = color_ids[x]&0xff;
+    if(!palette_valid[color_id]){
+      int r=0,g=0,b=0;
+      sb_lookup_palette_color(gb,color_ids[x],&r,&g,&b);
+      palette_rgb[color_id][0]=r;
+      palette_rgb[color_id][1]=g;
+      palette_rgb[color_id][2]=b;
+      palette_valid[color_id]=true;
+    }
+    uint8_t *p = fb+x*4;
+    const uint8_t *rgb = palette_rgb[color_id];
+    if(ghost_coef==0){
+      p[0]=rgb[0]; p[1]=rgb[1]; p[2]=rgb[2];
+    }else{
+      p[0] = rgb[0]*(1.0-ghost_coef)+p[0]*ghost_coef+0.5;
+      p[1] = rgb[1]*(1.0-ghost_coef)+p[1]*ghost_coef+0.5;
+      p[2] = rgb[2]*(1.0-ghost_coef)+p[2]*ghost_coef+0.5;
+    }
+  }
+}
+// Runs the PPU's drawing work for the cycles of the current scanline that have passed
+// since the last call. Called before anything the renderer reads changes, so mid-scanline
+// raster effects still land on the same pixel as when every cycle was drawn on its own.
+static void sb_lcd_catch_up(sb_gb_t* gb){
+  int start = gb->lcd.render_cycle+1;
+  int end = gb->lcd.scanline_cycles;
+  gb->lcd.render_cycle = end;
+  if(start>end||!gb->lcd.render_frame||gb->lcd.curr_scanline>=SB_LCD_H)return;
+  const int mode2_clks= 80;
+  uint8_t ctrl = sb_read8_io(gb, SB_IO_LCD_CTRL);
+  for(int clock_num=start;clock_num<=end&&clock_num<mode2_clks;++clock_num){
+    if(clock_num==0){
+      for(int i=0;i<SB_SPRITES_PER_SCANLINE;++i)gb->lcd.render_sprites[i]=-1;
+      gb->lcd.sprite_index = 0; 
+    }
+    if(clock_num%2){
+      uint8_t y = gb->lcd.curr_scanline;
+      const int num_sprites= 40;
+      int oam_table_offset = 0xfe00;
+      bool draw_sprite = SB_BFE(ctrl,1,1)==1;
+      bool sprite8x16  = SB_BFE(ctrl,2,1)==1;
+      int sprite_h = sprite8x16 ? 16: 8;
+      int sprite_id = clock_num/2;
+      int sprite_base = oam_table_offset+sprite_id*4;
+      int yc = (int)sb_read8_io(gb, sprite_base+0)-16;
+      if(yc<=y && yc+sprite_h>y&& gb->lcd.sprite_index<SB_SPRITES_PER_SCANLINE&&sprite_id<num_sprites&&draw_sprite){
+        gb->lcd.render_sprites[gb->lcd.sprite_index]=sprite_id;
+        for(int i=0;i<4;++i){
+          gb->lcd.render_sprites_data[gb->lcd.sprite_index][i]=sb_read8_io(gb, sprite_base+i);
+        }
+        gb->lcd.sprite_index++;
+      }
+    }
+  }
+  //This is intenentionally not latched for: 007 - The World is Not Enough's hud. 
+  //Zen Intergalactic Ninja, Speedy Gonzales, and the Warriors of Might and Magic are also very sensitive
+  //to the behavior of this window. 
+  bool window_enable = SB_BFE(ctrl,5,1)==1;
+  if(gb->lcd.curr_scanline==sb_read8_io(gb, SB_IO_LCD_WY)&&window_enable) gb->lcd.wy_eq_ly = true;
+  int x_start = start-mode2_clks-8;
+  int x_end = end-mode2_clks-8+1;
+  if(x_start<0)x_start=0;
+  if(x_end>SB_LCD_W)x_end=SB_LCD_W;
+  if(x_start<x_end)sb_draw_scanline(gb,gb->lcd.curr_scanline,x_start,x_end);
 }
 
 void sb_update_timers(sb_gb_t* gb, int delta_clocks, bool double_speed){
@@ -1184,7 +1364,7 @@ void sb_update_timers(sb_gb_t* gb, int delta_clocks, bool double_speed){
     case 3: tma_bit = 7;break; //16Khz
   }
   int seq_bit = double_speed?13:12;
-  for(int i=0;i<delta_clocks;++i){
+  for(int i=0;i<delta_clocks;){
     uint16_t curr = gb->timers.total_clock_ticks;
     uint16_t next = curr+1;
     gb->timers.total_clock_ticks=next;
@@ -1206,6 +1386,21 @@ void sb_update_timers(sb_gb_t* gb, int delta_clocks, bool double_speed){
     }
     gb->timers.last_tick_seq = tick_seq;
     gb->timers.last_tick_tima = tick_tima;
+    ++i;
+    // TIMA only ticks when the counter carries out of tma_bit and the frame sequencer when seq_bit
+    // gets set, skip the clocks in between.
+    uint16_t ticks = gb->timers.total_clock_ticks;
+    int to_tima = -ticks&((2<<tma_bit)-1);
+    int to_seq = ((1<<seq_bit)-ticks)&((2<<seq_bit)-1);
+    int skip = to_tima<to_seq? to_tima: to_seq;
+    if(skip>delta_clocks-i)skip = delta_clocks-i;
+    if(skip>0){
+      uint16_t last = ticks+skip-1;
+      gb->timers.total_clock_ticks=(uint16_t)(last+1);
+      gb->timers.last_tick_tima = SB_BFE(last,tma_bit,1)&tima_enable;
+      gb->timers.last_tick_seq = SB_BFE(last,seq_bit,1);
+      i+=skip;
+    }
   }
   sb_store8_io(gb, SB_IO_DIV, SB_BFE(gb->timers.total_clock_ticks,8,8));
 }
@@ -1262,6 +1457,7 @@ int sb_update_dma(sb_gb_t *gb){
   return delta_cycles;
 }
 void sb_update_oam_dma(sb_gb_t* gb, int delta_cycles){
+  if(!gb->dma.oam_dma_activate_fifo&&!gb->dma.oam_dma_active)return;
   delta_cycles/=4;
   uint16_t dma_src = ((int)sb_read8_io(gb,SB_IO_OAM_DMA))<<8u;
   uint16_t dma_dst = 0xfe00;
@@ -1319,14 +1515,117 @@ void sb_tick_components(sb_emu_state_t* emu, sb_gb_t* gb, int cycles){
   unsigned speed = sb_read8_io(gb,SB_IO_GBC_SPEED_SWITCH);
   bool double_speed = SB_BFE(speed, 7, 1)&&sb_gbc_enable(gb);
   sb_update_oam_dma(gb,(double_speed?2:1)*cycles);
-  for(int i=0;i<cycles;++i){
+  // The first update sees the registers the CPU just wrote, after that only the mode and scanline
+  // changes need a full update
+  for(int i=0;i<cycles;){
     sb_update_lcd(emu,gb);
+    ++i;
+    int next = sb_lcd_cycles_to_next_event(gb);
+    if(next==0)break;
+    int skip = next-1;
+    if(skip>cycles-i)skip = cycles-i;
+    gb->lcd.scanline_cycles+=skip;
+    i+=skip;
   }
   sb_update_timers(gb,(double_speed?2:1)*cycles, double_speed);
   sb_tick_sio(gb,cycles);
   double delta_t = ((double)cycles)/(4*1024*1024);
   sb_process_audio(gb,emu,delta_t,cycles);
 }
+// Number of halted sb_tick iterations (of cycles each) that can run as one sb_tick_components call.
+// Only the last of them may raise an interrupt flag, so the CPU stays halted and every register
+// reads the same as it would have between them. Returns 0 or 1 when the next iteration has to be
+// stepped on its own.
+static int sb_halt_skip_iterations(sb_gb_t* gb, int cycles, int max_iterations){
+  int n = max_iterations;
+  // sb_process_audio clamps longer steps
+  if(n>65536/cycles)n = 65536/cycles;
+  // The LCD only raises interrupts on mode and scanline changes
+  int lcd = sb_lcd_cycles_to_next_event(gb);
+  if(lcd&&(lcd-1)/cycles<n)n = (lcd-1)/cycles;
+
+  uint8_t tac = sb_read8_io(gb, SB_IO_TAC);
+  if(SB_BFE(tac,2,1)){
+    static const int tma_bits[4]={9,3,5,7};
+    unsigned speed = sb_read8_io(gb,SB_IO_GBC_SPEED_SWITCH);
+    int clocks = (SB_BFE(speed,7,1)&&sb_gbc_enable(gb)?2:1)*cycles;
+    int period = 2<<tma_bits[SB_BFE(tac,0,2)];
+    int to_overflow = ((-gb->timers.total_clock_ticks)&(period-1))+1+(255-sb_read8_io(gb,SB_IO_TIMA))*period;
+    if((to_overflow-1)/clocks<n)n = (to_overflow-1)/clocks;
+  }
+
+  uint8_t siocnt = sb_read8_io(gb,SB_IO_SERIAL_CTRL);
+  if(SB_BFE(siocnt,7,1)){
+    if(!gb->serial.last_active)return 0;
+    if(SB_BFE(siocnt,0,1)&&(gb->serial.ticks_to_complete-1)/cycles<n)n = (gb->serial.ticks_to_complete-1)/cycles;
+  }
+
+  // Samples generated by one call only differ from ones generated step by step if the channels changed
+  // in between, so a run can cover several samples as long as the wave channel and the frame sequencer
+  // don't step and the sample clock doesn't wrap around
+  if(SB_BFE(sb_read8_io(gb,SB_IO_SOUND_ON_OFF),7,1)){
+    sb_audio_t* audio = &gb->audio;
+    double ahead = audio->current_sample_generated_time-audio->current_sim_time;
+    double step = cycles/(4.*1024*1024);
+    if(ahead<n*step){
+      int no_sample = ahead>0? (int)(ahead/step): 0;
+      unsigned speed = sb_read8_io(gb,SB_IO_GBC_SPEED_SWITCH);
+      bool double_speed = SB_BFE(speed,7,1)&&sb_gbc_enable(gb);
+      int seq_bit = double_speed?13:12;
+      int to_seq = ((1<<seq_bit)-gb->timers.total_clock_ticks)&((2<<seq_bit)-1);
+      int batch = to_seq/((double_speed?2:1)*cycles);
+      // The wave channel plays silence while it is off or muted
+      uint8_t power3 = sb_read8_io(gb,SB_IO_AUD3_POWER);
+      if(SB_BFE(power3,7,1)&&SB_BFE(sb_read8_io(gb,SB_IO_AUD3_VOL),5,2)){
+        int wave = audio->wave_freq_timer>0? audio->wave_freq_timer/cycles: 0;
+        if(wave<batch)batch = wave;
+      }
+      int wrap = (int)((1.0-audio->current_sim_time)/step)-1;
+      if(wrap<batch)batch = wrap;
+      if(batch<no_sample)batch = no_sample;
+      if(batch<n)n = batch;
+    }
+  }
+  return n;
+}
+static void sb_halt_skip(sb_emu_state_t* emu, sb_gb_t* gb, sb_halt_skip_t* skip, int cycles, int iterations){
+  if(SB_UNLIKELY(emu->gb_halt_skip_verify)){
+    memcpy(&skip->gb,gb,sizeof(sb_gb_t));
+    skip->emu = *emu;
+  }
+  sb_tick_components(emu,gb,cycles*iterations);
+  gb->cpu.last_inter_f = sb_read8_io(gb,SB_IO_INTER_F);
+  skip->runs_skipped++;
+  skip->iterations_skipped+=iterations-1;
+  if(SB_LIKELY(!emu->gb_halt_skip_verify))return;
+
+  // Replay the run the way sb_tick steps a halted CPU and check it ends in the same state. The CPU
+  // must not have been able to wake up before the last iteration either.
+  int woke = -1;
+  for(int i=0;i<iterations;++i){
+    skip->gb.cpu.last_inter_f = sb_read8_io(&skip->gb,SB_IO_INTER_F);
+    sb_tick_components(&skip->emu,&skip->gb,cycles);
+    if(i+1==iterations||woke>=0)continue;
+    uint8_t ie = sb_read8_io(&skip->gb,SB_IO_INTER_EN);
+    if((ie&skip->gb.cpu.last_inter_f&0x1f)||(ie&sb_read8_io(&skip->gb,SB_IO_INTER_F)&0x1f))woke = i+1;
+  }
+  skip->verified++;
+  const uint8_t* a = (const uint8_t*)&skip->gb;
+  const uint8_t* b = (const uint8_t*)gb;
+  size_t off = 0;
+  while(off<sizeof(sb_gb_t)&&a[off]==b[off])off++;
+  bool match = woke<0&&off==sizeof(sb_gb_t)&&skip->emu.audio_ring_buff.write_ptr==emu->audio_ring_buff.write_ptr&&
+               !memcmp(skip->emu.audio_ring_buff.data,emu->audio_ring_buff.data,sizeof(emu->audio_ring_buff.data));
+  if(match)return;
+  if(woke>=0){
+    printf("GB HALT skip mismatch after %d iterations at pc 0x%04x: the CPU could have woken up after %d\n",
+      iterations,gb->cpu.pc,woke);
+  }else if(off<sizeof(sb_gb_t)){
+    printf("GB HALT skip mismatch after %d iterations at pc 0x%04x: state byte 0x%zx is 0x%02x stepped, 0x%02x skipped\n",
+      iterations,gb->cpu.pc,off,a[off],b[off]);
+  }else printf("GB HALT skip mismatch after %d iterations at pc 0x%04x: audio samples differ\n",iterations,gb->cpu.pc);
+  skip->mismatches++;
+}
 void gb_tick_rtc(sb_gb_t*gb){
   time_t time_secs= time(NULL);
   struct tm * tm = localtime(&time_secs);
@@ -1337,6 +1636,12 @@ void gb_tick_rtc(sb_gb_t*gb){
 }
 void sb_tick(sb_emu_state_t* emu, sb_gb_t* gb,gb_scratch_t* scratch){
   gb->lcd.framebuffer = scratch->framebuffer; 
+  gb->lcd.tile_cache = &scratch->tile_cache;
+  // The cache lives outside the savestate, so reexpand tiles that may have changed under it
+  memset(gb->lcd.tile_dirty,0xff,sizeof(gb->lcd.tile_dirty));
+  gb->lcd.ghosting_strength = emu->screen_ghosting_strength;
+  // Savestates and the BESS loader change the banking state behind the page table's back
+  sb_update_mem_pages(gb,0x0000,0xffff);
   gb->cart.data = emu->rom_data; 
   gb->bios = scratch->bios;
   int instructions_to_execute = emu->step_instructions;
@@ -1348,9 +1653,36 @@ void sb_tick(sb_emu_state_t* emu, sb_gb_t* gb,gb_scratch_t* scratch){
   gb->lcd.finished_frame =false;
   gb->lcd.render_frame = emu->render_frame;
   gb_tick_rtc(gb);
+  sb_update_joypad_io_reg(emu, gb);
+  uint8_t joypad_reg = gb->mem.data[SB_IO_JOYPAD];
   for(int i=0;i<instructions_to_execute;++i){
     bool double_speed = false;
-    sb_update_joypad_io_reg(emu, gb);
+    // The inputs don't change during a frame, only a write to the register needs an update
+    if(SB_UNLIKELY(gb->mem.data[SB_IO_JOYPAD]!=joypad_reg)){
+      sb_update_joypad_io_reg(emu, gb);
+      joypad_reg = gb->mem.data[SB_IO_JOYPAD];
+    }
+    // A halted CPU only waits on IF, run the components up to the next event that could wake it in one step
+    if(gb->cpu.wait_for_interrupt&&!gb->cpu.prefix_op&&!gb->cpu.deferred_interrupt_enable&&
+       !gb->dma.active&&!gb->dma.oam_dma_activate_fifo&&!gb->dma.oam_dma_active&&gb->cpu.pc!=emu->pc_breakpoint){
+      uint8_t ie = sb_read8_io(gb,SB_IO_INTER_EN);
+      unsigned speed = sb_read8_io(gb,SB_IO_GBC_SPEED_SWITCH);
+      bool gbc = sb_gbc_enable(gb);
+      if(!(ie&(gb->cpu.last_inter_f|sb_read8_io(gb,SB_IO_INTER_F))&0x1f)&&!(gbc&&SB_BFE(speed,0,1))){
+        int cycles = gbc&&SB_BFE(speed,7,1)? 2: 4;
+        int max_iterations = instructions_to_execute-i;
+        if(emu->step_instructions==0&&(70224-total_cylces)/cycles<max_iterations)max_iterations = (70224-total_cylces)/cycles;
+        int iterations = sb_halt_skip_iterations(gb,cycles,max_iterations);
+        if(iterations>1){
+          sb_halt_skip(emu,gb,&scratch->halt_skip,cycles,iterations);
+          rumble_cycles+=cycles*iterations*gb->cart.rumble;
+          total_cylces+=cycles*iterations;
+          i+=iterations-1;
+          if(total_cylces>=70224&&emu->step_instructions==0)break;
+          continue;
+        }
+      }
+    }
     int dma_delta_cycles = sb_update_dma(gb);
     int cpu_delta_cycles = 0;
     if(dma_delta_cycles==0){
@@ -1400,16 +1732,10 @@ void sb_tick(sb_emu_state_t* emu, sb_gb_t* gb,gb_scratch_t* scratch){
       }
  
       if(call_interrupt==false&&gb->cpu.wait_for_interrupt==false){
-        sb_instr_t inst = sb_decode_table[op];
-        gb->cpu.pc+=inst.length;
         if(gb->cpu.halt_bug)gb->cpu.pc--;
         gb->cpu.halt_bug = false;
-        int operand1 = sb_load_operand(gb,inst.op_src1);
-        int operand2 = sb_load_operand(gb,inst.op_src2);
-
-        unsigned pc_before_inst = gb->cpu.pc;
         gb->cpu.prefix_op = false;
-        inst.impl(gb, operand1, operand2,inst.op_src1,inst.op_src2, inst.flag_mask);
+        cpu_delta_cycles = sb_exec_specialized(gb,op);
         if(gb->cpu.prefix_op==true)i--;
 
         if(gb->cpu.wait_for_interrupt){
@@ -1421,8 +1747,6 @@ void sb_tick(sb_emu_state_t* emu, sb_gb_t* gb,gb_scratch_t* scratch){
             gb->cpu.halt_bug =true;
           }
         }
-        cpu_delta_cycles = 4*((gb->cpu.branch_taken? (inst.mcycles_branch_taken-(inst.mcycles-1)) : 1));
-        gb->cpu.branch_taken=false;
       }else if(call_interrupt==false&&gb->cpu.wait_for_interrupt==true && request_speed_switch){
         gb->cpu.wait_for_interrupt = false;
         sb_store8_io(gb,SB_IO_GBC_SPEED_SWITCH,double_speed? 0x00: 0x80);
@@ -1432,8 +1756,7 @@ void sb_tick(sb_emu_state_t* emu, sb_gb_t* gb,gb_scratch_t* scratch){
       if(!gb->cpu.wait_for_interrupt){
         unsigned next_op = sb_read8(gb,gb->cpu.pc);
         if(gb->cpu.prefix_op)next_op+=256;
-        sb_instr_t next_inst = sb_decode_table[next_op];
-        cpu_delta_cycles+= (next_inst.mcycles-1)*4;
+        cpu_delta_cycles+= (sb_decode_table[next_op].mcycles-1)*4;
         if(gb->cpu.prefix_op){
           cpu_delta_cycles -=4;
         }
@@ -1454,6 +1777,7 @@ void sb_tick(sb_emu_state_t* emu, sb_gb_t* gb,gb_scratch_t* scratch){
     if(gb->lcd.finished_frame){break;}
     if(total_cylces>=70224&&emu->step_instructions==0)break;
   }
+  sb_lcd_catch_up(gb);
   emu->joy.rumble = (double)rumble_cycles/(double)total_cylces;
 }
 float compute_vol_env_slope(uint8_t d){
@@ -1652,7 +1976,7 @@ static bool sb_load_rom(sb_emu_state_t* emu,sb_gb_t* gb, gb_scratch_t* scratch){
     gb->mem.data[0xFF4B] = 0x00; // WX
     gb->mem.data[0xFFFF] = 0x00; // IE
   }
-  
+  sb_update_mem_pages(gb,0x0000,0xffff);
   return true; 
 }
 static uint8_t sb_read_wave_ram(sb_gb_t*gb, int index){
@@ -5,6 +5,8 @@
 #include <string.h>
 #include <math.h>
 #include "arm7.h"
+#include "arm7_jit.h"
+#include "arm7_bios_hle.h"
 #include "gba_bios.h"
 #include <time.h>
 //Should be power of 2 for perf, 8192 samples gives ~85ms maximal latency for 48kHz
@@ -620,6 +622,21 @@ mmio_reg_t gba_io_reg_desc[]={
 #define GBA_REQ_READ  0x40
 #define GBA_REQ_WRITE 0x80
 
+// Page table over the bus below 0x10000000 so the common accesses skip the decode in gba_dword_lookup.
+// Pages without a flag (BIOS, IO, backup, the VRAM mirror that depends on the video mode and the end
+// of the ROM) take the full decode. 
+#define GBA_MEM_PAGE_SHIFT 14
+#define GBA_MEM_PAGES      (0x10000000>>GBA_MEM_PAGE_SHIFT)
+#define GBA_MEM_PAGE_READ  0x1
+#define GBA_MEM_PAGE_WRITE 0x2
+#define GBA_MEM_PAGE_ROM   0x4 // Offset is into the cart_rom and reads are returned through the open bus
+#define GBA_MEM_PAGE_WRITE8 0x8 // 8 bit writes store the byte (only on the work RAM, see gba_store8)
+typedef struct{
+  uint32_t offset; // Start of the page's memory from the gba_t (or cart_rom), so copies of the core can share it
+  uint16_t mask;   // Address bits inside the page's memory, mirrors smaller than a page keep fewer of them
+  uint8_t flags;
+}gba_mem_page_t;
+
 typedef struct {     
   uint8_t *bios;
   uint8_t wram0[256*1024];
@@ -824,6 +841,11 @@ typedef struct gba_t{
   int residual_dma_ticks; 
   bool stop_mode; 
   gba_solar_sensor_t solar_sensor;
+  arm7_idle_loop_t idle_loop;
+  // The last instruction arrived at the head of a confirmed idle loop
+  bool idle_loop_active;
+  arm7_hle_verify_t* hle_verify; // NULL unless the BIOS HLE is being verified
+  const gba_mem_page_t* mem_pages; // Page table in the scratch, NULL until a ROM is loaded
 } gba_t; 
 
 typedef struct{
@@ -832,6 +854,16 @@ typedef struct{
   FILE * log_cmp_file; 
   bool skip_bios_intro;
   char save_file_path[SB_FILE_PATH_SIZE];  
+  arm7_block_cache_t block_cache;
+  uint64_t block_cache_resume_clock;
+  arm7_jit_t arm_jit;
+  arm7_jit_budget_t jit_budget;
+  arm7_hle_verify_t hle_verify;
+  gba_mem_page_t mem_pages[GBA_MEM_PAGES];
+  // State before a verified run of compiled code, replayed by the interpreter
+  arm7_jit_verify_t jit_verify;
+  gba_t jit_verify_gba;
+  sb_emu_state_t jit_verify_emu;
 }gba_scratch_t;
 static void gba_process_audio_writes(gba_t* gba);
 static uint8_t gba_audio_process_byte_write(gba_t *gba, uint32_t addr, uint8_t value);
@@ -843,7 +875,10 @@ static FORCE_INLINE void gba_store32(gba_t*gba, unsigned baddr, uint32_t data);
 //Returns offset into savestate where bess info can be found
 static uint32_t gba_save_best_effort_state(gba_t* gba){
   gba->bess.bess_version = 1; 
+  arm7_flush_flags(&gba->cpu);
+  arm7_unbank_registers(&gba->cpu);
   for(int i=0;i<37;++i)gba->bess.cpu_registers[i]=gba->cpu.registers[i];
+  arm7_update_bank(&gba->cpu);
   
   gba->bess.wram0_seg = ((uint8_t*)gba->mem.wram0)-(uint8_t*)gba;
   gba->bess.wram1_seg = ((uint8_t*)gba->mem.wram1)-(uint8_t*)gba;
@@ -866,7 +901,10 @@ static bool gba_load_best_effort_state(gba_t* gba,uint8_t *save_state_data, uint
   if(bess->vram_seg+sizeof(gba->mem.vram) > size) return false;  
   if(bess->oam_seg+sizeof(gba->mem.oam) > size) return false;  
   if(bess->cart_backup_seg+sizeof(gba->mem.cart_backup) > size) return false; 
+  arm7_unbank_registers(&gba->cpu);
   for(int i=0;i<37;++i)gba->cpu.registers[i]=bess->cpu_registers[i];
+  gba->cpu.lazy_flags=0;
+  arm7_update_bank(&gba->cpu);
   memcpy(gba->mem.wram0,save_state_data+bess->wram0_seg,sizeof(gba->mem.wram0));
   memcpy(gba->mem.wram1,save_state_data+bess->wram1_seg,sizeof(gba->mem.wram1));
   memcpy(gba->mem.io,save_state_data+bess->io_seg,sizeof(gba->mem.io));
@@ -1161,6 +1199,7 @@ static FORCE_INLINE void gba_store32(gba_t*gba, unsigned baddr, uint32_t data){
   }
   uint32_t *val=gba_dword_lookup(gba,baddr,GBA_REQ_WRITE|GBA_REQ_4B);
   *val= data;
+  arm7_block_cache_invalidate(gba->cpu.block_cache,val);
 }
 static FORCE_INLINE void gba_store16(gba_t*gba, unsigned baddr, uint32_t data){
   if(baddr>=0x08000000){
@@ -1182,6 +1221,7 @@ static FORCE_INLINE void gba_store16(gba_t*gba, unsigned baddr, uint32_t data){
   uint32_t* val = gba_dword_lookup(gba,baddr,GBA_REQ_WRITE|GBA_REQ_2B);
   int offset = SB_BFE(baddr,1,1);
   ((uint16_t*)val)[offset]=data; 
+  arm7_block_cache_invalidate(gba->cpu.block_cache,val);
 }
 static FORCE_INLINE void gba_store8(gba_t*gba, unsigned baddr, uint32_t data){
   if(baddr>=0x05000000){
@@ -1196,6 +1236,7 @@ static FORCE_INLINE void gba_store8(gba_t*gba, unsigned baddr, uint32_t data){
   uint32_t *val = gba_dword_lookup(gba,baddr,GBA_REQ_WRITE|GBA_REQ_1B);
   int offset = SB_BFE(baddr,0,2);
   ((uint8_t*)val)[offset]=data; 
+  arm7_block_cache_invalidate(gba->cpu.block_cache,val);
 } 
 static FORCE_INLINE void gba_io_store8(gba_t*gba, unsigned baddr, uint8_t data){gba->mem.io[baddr&0xffff]=data;}
 static FORCE_INLINE void gba_io_store16(gba_t*gba, unsigned baddr, uint16_t data){*(uint16_t*)(gba->mem.io+(baddr&0xffff))=data;}
@@ -1339,6 +1380,115 @@ static FORCE_INLINE uint32_t arm7_read16_seq(void* user_data, uint32_t address,
   gba_compute_access_cycles((gba_t*)user_data,address,seq?0:1);
   return gba_read16((gba_t*)user_data,address);
 }
+// Code memory for the decoded block cache (BIOS is excluded since fetches from it update the BIOS latch)
+static const uint8_t* arm7_code_ptr(void* user_data, uint32_t address, uint32_t* bytes_mapped){
+  gba_t* gba = (gba_t*)user_data;
+  switch(address>>24){
+    case 0x2: *bytes_mapped = 256*1024-(address&0x3ffff); return gba->mem.wram0+(address&0x3ffff);
+    case 0x3: *bytes_mapped = 32*1024-(address&0x7fff); return gba->mem.wram1+(address&0x7fff);
+    case 0x8: case 0x9: case 0xA: case 0xB: case 0xC: case 0xD:{
+      uint32_t maddr = address&0x1ffffff;
+      if(maddr<gba->cart.rom_size){
+        *bytes_mapped = gba->cart.rom_size-maddr;
+        return gba->mem.cart_rom+maddr;
+      }
+    }
+  }
+  *bytes_mapped = 0x1000000-(address&0xffffff);
+  return NULL;
+}
+// Memory an idle loop may poll: it is only written by the CPU, by DMAs (which start on PPU/timer
+// events) or by the PPU and IRQ logic on their events. Timers, the BIOS latch, the cartridge GPIO and
+// backup are excluded since their reads change between events.
+static bool gba_idle_loop_read_ok(void* user_data, uint32_t address, int size){
+  gba_t* gba = (gba_t*)user_data;
+  switch(address>>24){
+    case 0x2: case 0x3: case 0x5: case 0x6: case 0x7: return true;
+    case 0x4:
+      return (address>=GBA_DISPSTAT&&address+size<=GBA_DISPSTAT+4)||
+             (address>=GBA_KEYINPUT&&address+size<=GBA_KEYCNT+2)||
+             (address>=GBA_IE&&address+size<=GBA_IF+2)||
+             (address>=GBA_IME&&address+size<=GBA_IME+4);
+    case 0x8: case 0x9: case 0xA: case 0xB: case 0xC:{
+      uint32_t maddr = address&0x1ffffff;
+      if(maddr+size>0xC4&&maddr<0xCA)return false;
+      return maddr+size<=gba->cart.rom_size;
+    }
+  }
+  return false;
+}
+static void arm7_cached_fetch(void* user_data, uint32_t address, const uint8_t* host, bool thumb, bool seq){
+  gba_t* gba = (gba_t*)user_data;
+  gba_compute_access_cycles(gba,address,thumb?(seq?0:1):(seq?2:3));
+  // Match the open bus value gba_dword_lookup leaves behind
+  if(thumb&&address>=0x08000000)gba->mem.openbus_word = (*(uint16_t*)host)*0x10001;
+  else gba->mem.openbus_word = *(uint32_t*)(host-(address&3));
+}
+// Plain memory for the BIOS HLE (arm7_hle_mem_t). VRAM is only mapped up to the end of its 96KB
+// since the 32KB mirror above it depends on the video mode.
+static uint8_t* gba_hle_host_ptr(gba_t* gba, uint32_t address, uint32_t* bytes_mapped){
+  switch(address>>24){
+    case 0x2: *bytes_mapped = 256*1024-(address&0x3ffff); return gba->mem.wram0+(address&0x3ffff);
+    case 0x3: *bytes_mapped = 32*1024-(address&0x7fff); return gba->mem.wram1+(address&0x7fff);
+    case 0x5: *bytes_mapped = 1024-(address&0x3ff); return gba->mem.palette+(address&0x3ff);
+    case 0x6:{
+      uint32_t offset = address&0x1ffff;
+      if(offset>=0x18000)break;
+      *bytes_mapped = 0x18000-offset;
+      return gba->mem.vram+offset;
+    }
+    case 0x7: *bytes_mapped = 1024-(address&0x3ff); return gba->mem.oam+(address&0x3ff);
+  }
+  *bytes_mapped = 0;
+  return NULL;
+}
+static const uint8_t* gba_hle_read_ptr(void* user_data, uint32_t address, uint32_t* bytes_mapped){
+  gba_t* gba = (gba_t*)user_data;
+  if(address>=0x08000000&&address<0x0E000000){
+    uint32_t maddr = address&0x1ffffff;
+    // Keep the cartridge GPIO registers out of the range
+    if(maddr<0xCA)return NULL;
+    if(maddr>=gba->cart.rom_size)return NULL;
+    *bytes_mapped = gba->cart.rom_size-maddr;
+    return gba->mem.cart_rom+maddr;
+  }
+  return gba_hle_host_ptr(gba,address,bytes_mapped);
+}
+static uint8_t* gba_hle_write_ptr(void* user_data, uint32_t address, uint32_t bytes, int width){
+  gba_t* gba = (gba_t*)user_data;
+  // Byte writes to palette, VRAM and OAM don't store the byte
+  if(width==1&&address>=0x05000000)return NULL;
+  uint32_t mapped = 0;
+  uint8_t* host = gba_hle_host_ptr(gba,address,&mapped);
+  if(!host||mapped<bytes)return NULL;
+  arm7_block_cache_invalidate_range(gba->cpu.block_cache,host,bytes);
+  return host;
+}
+// Runs the SWIs arm7_bios_hle.h implements natively (arm7_hle_run_fn_t), the others go to the BIOS
+static bool gba_bios_hle_run(arm7_t* cpu, const arm7_hle_mem_t* mem, uint32_t function, uint32_t* outputs){
+  switch(function){
+    case 0x06: *outputs = ARM7_HLE_DIV_OUTPUTS; return arm7_hle_div(cpu,false);
+    case 0x07: *outputs = ARM7_HLE_DIV_OUTPUTS; return arm7_hle_div(cpu,true);
+    case 0x08: *outputs = ARM7_HLE_R0_OUTPUT; return arm7_hle_sqrt(cpu);
+    case 0x09: *outputs = ARM7_HLE_R0_OUTPUT; return arm7_hle_arctan(cpu);
+    case 0x0A: *outputs = ARM7_HLE_R0_OUTPUT; return arm7_hle_arctan2(cpu);
+    case 0x0B: return arm7_hle_cpu_set(cpu,mem);
+    case 0x0C: return arm7_hle_cpu_fast_set(cpu,mem);
+    case 0x11: return arm7_hle_lz77(cpu,mem,false);
+    case 0x12: return arm7_hle_lz77(cpu,mem,true);
+    case 0x13: return arm7_hle_huffman(cpu,mem);
+    case 0x14: return arm7_hle_rl(cpu,mem,false);
+    case 0x15: return arm7_hle_rl(cpu,mem,true);
+  }
+  return false;
+}
+static bool gba_bios_hle(void* user_data, uint32_t function){
+  gba_t* gba = (gba_t*)user_data;
+  arm7_hle_mem_t mem = {gba,gba_hle_read_ptr,gba_hle_write_ptr};
+  if(gba->hle_verify)return arm7_hle_verify_begin(gba->hle_verify,&gba->cpu,&mem,function,gba_bios_hle_run);
+  uint32_t outputs = 0;
+  return gba_bios_hle_run(&gba->cpu,&mem,function,&outputs);
+}
 //Used to process special behavior triggered by MMIO write
 static bool gba_process_mmio_write(gba_t *gba, uint32_t address, uint32_t data, int req_size_bytes);
 
@@ -1373,11 +1523,94 @@ static FORCE_INLINE void arm7_write8(void* user_data, uint32_t address, uint8_t
   }
   gba_store8((gba_t*)user_data,address,data);
 }
+// Host memory behind [address,address+bytes) if the page table maps all of it for the access
+static FORCE_INLINE uint8_t* gba_mem_page_span(gba_t* gba, uint32_t address, uint32_t bytes, bool write){
+  if(!gba->mem_pages||address>=0x10000000)return NULL;
+  gba_mem_page_t page = gba->mem_pages[address>>GBA_MEM_PAGE_SHIFT];
+  if(!(page.flags&(write? GBA_MEM_PAGE_WRITE: GBA_MEM_PAGE_READ)))return NULL;
+  uint32_t span = page.mask|3;
+  if((address&span)+bytes>span+1)return NULL;
+  uint8_t* base = page.flags&GBA_MEM_PAGE_ROM? gba->mem.cart_rom: (uint8_t*)gba;
+  return base+page.offset+(address&span);
+}
+// LDM/STM on the memory of the page table in one go (arm_block_transfer_fn_t), every word is still
+// charged like arm7_read32_seq/arm7_write32 would and the open bus matches what gba_dword_lookup
+// leaves behind
+static FORCE_INLINE bool gba_arm7_block_transfer(void* user_data, uint32_t address, uint32_t* data, int words, bool write){
+  gba_t* gba = (gba_t*)user_data;
+  uint32_t bytes = words*4;
+  uint8_t* host = gba_mem_page_span(gba,address,bytes,write);
+  if(!host)return false;
+  for(int i=0;i<words;++i)gba_compute_access_cycles(gba,address,write||!i? 3: 2);
+  if(write){
+    memcpy(&gba->mem.openbus_word,host+bytes-4,4);
+    memcpy(host,data,bytes);
+    arm7_block_cache_invalidate_range(gba->cpu.block_cache,host,bytes);
+  }else{
+    memcpy(data,host,bytes);
+    gba->mem.openbus_word = data[words-1];
+  }
+  return true;
+}
+// Wait states of a load or store compiled code runs on the page table (arm7_jit_access_fn_t)
+static void gba_jit_access(void* user_data, uint32_t address, int request_size){
+  gba_compute_access_cycles((gba_t*)user_data,address,request_size);
+}
+#if ARM7_STATIC_BUS
+// Handler tables with the bus above bound at compile time
+static const arm7_bus_t gba_arm7_bus={
+  .read32 = arm7_read32, .read16 = arm7_read16, .read32_seq = arm7_read32_seq, .read16_seq = arm7_read16_seq,
+  .read8 = arm7_read8, .write32 = arm7_write32, .write16 = arm7_write16, .write8 = arm7_write8,
+  .block_transfer = gba_arm7_block_transfer,
+};
+#define ARM7_BUS gba_arm7_bus
+#define ARM7_BUS_PREFIX(NAME) gba_##NAME
+#define ARM7_BUS_ARM9 0
+#include "arm7_bus_handlers.h"
+#endif
 // Try to load a GBA rom, return false on invalid rom
 bool gba_load_rom(sb_emu_state_t*emu,gba_t* gba, gba_scratch_t *scratch);
  
+// Fills the page table, it only depends on the size of the ROM
+static void gba_build_mem_pages(gba_t* gba, gba_mem_page_t* pages){
+  for(uint32_t p=0;p<GBA_MEM_PAGES;++p){
+    uint32_t addr = p<<GBA_MEM_PAGE_SHIFT;
+    uint8_t* host = NULL;
+    uint16_t mask = (1<<GBA_MEM_PAGE_SHIFT)-4;
+    uint8_t flags = GBA_MEM_PAGE_READ|GBA_MEM_PAGE_WRITE;
+    switch(addr>>24){
+      case 0x2: host = gba->mem.wram0+(addr&0x3ffff); flags|=GBA_MEM_PAGE_WRITE8; break;
+      case 0x3: host = gba->mem.wram1+(addr&0x7fff); flags|=GBA_MEM_PAGE_WRITE8; break;
+      case 0x5: host = gba->mem.palette; mask = 0x3fc; break;
+      case 0x6: if((addr&0x1ffff)<0x18000)host = gba->mem.vram+(addr&0x1ffff); break;
+      case 0x7: host = gba->mem.oam; mask = 0x3fc; break;
+      case 0x8: case 0x9: case 0xA: case 0xB: case 0xC: case 0xD:{
+        uint32_t maddr = addr&0x1ffffff;
+        if(maddr+(1<<GBA_MEM_PAGE_SHIFT)>gba->cart.rom_size)break;
+        pages[p] = (gba_mem_page_t){maddr,mask,GBA_MEM_PAGE_READ|GBA_MEM_PAGE_ROM};
+        continue;
+      }
+    }
+    if(host)pages[p] = (gba_mem_page_t){host-(uint8_t*)gba,mask,flags};
+    else pages[p] = (gba_mem_page_t){0};
+  }
+}
 static FORCE_INLINE uint32_t * gba_dword_lookup(gba_t* gba,unsigned addr, int req_type){
   uint32_t *ret = &gba->mem.openbus_word;
+  const gba_mem_page_t* pages = gba->mem_pages;
+  if(SB_LIKELY(pages&&addr<0x10000000)){
+    gba_mem_page_t page = pages[addr>>GBA_MEM_PAGE_SHIFT];
+    if(SB_LIKELY(page.flags&(req_type&GBA_REQ_WRITE? GBA_MEM_PAGE_WRITE: GBA_MEM_PAGE_READ))){
+      if(page.flags&GBA_MEM_PAGE_ROM){
+        gba->mem.openbus_word = *(uint32_t*)(gba->mem.cart_rom+page.offset+(addr&page.mask));
+        if(req_type&0x3)gba->mem.openbus_word = ((uint16_t)(gba->mem.openbus_word>>(addr&2)*8))*0x10001;
+        return ret;
+      }
+      ret = (uint32_t*)((uint8_t*)gba+page.offset+(addr&page.mask));
+      gba->mem.openbus_word=*ret;
+      return ret;
+    }
+  }
   switch(addr>>24){
     case 0x0: if(addr<0x4000){
       if(gba->cpu.registers[15]<0x4000)gba->mem.bios_word = *(uint32_t*)(gba->mem.bios+(addr&~3));
@@ -1630,6 +1863,13 @@ static bool gba_process_mmio_write(gba_t *gba, uint32_t address, uint32_t data,
   }
   return false;
 }
+// Idle loops that need a hint, keyed by the game code in the ROM header. head marks a loop as idle
+// even if its body has ops the detection doesn't allow (its registers still have to repeat), and
+// disabled turns skipping off for games that poll something the detection can't see.
+// Entries look like {"ABCE", 0x08000400, false}.
+static const arm7_idle_loop_override_t gba_idle_loop_overrides[]={
+  {"",0,false},
+};
 int gba_search_rom_for_backup_string(gba_t* gba){
   int btype = GBA_BACKUP_NONE; 
   for(int b = 0; b< gba->cart.rom_size;++b){
@@ -1659,6 +1899,7 @@ void gba_unload(gba_t*gba,gba_scratch_t *scratch){
   printf("Unloading GBA\n");
   if(scratch->log_cmp_file)fclose(scratch->log_cmp_file);
   scratch->log_cmp_file=NULL;
+  arm7_jit_free(&scratch->arm_jit);
 }
 bool gba_load_rom(sb_emu_state_t*emu,gba_t* gba, gba_scratch_t *scratch){
   memset(gba,0,sizeof(gba_t));
@@ -1678,6 +1919,8 @@ bool gba_load_rom(sb_emu_state_t*emu,gba_t* gba, gba_scratch_t *scratch){
   }
   gba->cart.rom_size = emu->rom_size; 
   gba->mem.cart_rom = emu->rom_data;
+  gba_build_mem_pages(gba,scratch->mem_pages);
+  gba->mem_pages = scratch->mem_pages;
 
   gba->cart.backup_type = gba_search_rom_for_backup_string(gba);
 
@@ -1703,6 +1946,7 @@ bool gba_load_rom(sb_emu_state_t*emu,gba_t* gba, gba_scratch_t *scratch){
   }
 
   gba->cpu = arm7_init(gba);
+  if(gba->cart.rom_size>=0xB0)arm7_idle_loop_apply_override(&gba->idle_loop,gba_idle_loop_overrides,sizeof(gba_idle_loop_overrides)/sizeof(gba_idle_loop_overrides[0]),gba->mem.cart_rom+0xAC);
   
   for(int bg = 2;bg<4;++bg){
     gba_io_store16(gba,GBA_BG2PA+(bg-2)*0x10,1<<8);
@@ -1726,6 +1970,7 @@ bool gba_load_rom(sb_emu_state_t*emu,gba_t* gba, gba_scratch_t *scratch){
       0x0,0x0,0x0,0x0,0x0,
     };
     for(int i=0;i<37;++i)gba->cpu.registers[i]=initial_regs[i];
+    arm7_update_bank(&gba->cpu);
     const uint32_t initial_mmio_writes[]={
       0x4000000,0x80,
       0x4000004,0x7e0000,
@@ -1751,6 +1996,7 @@ bool gba_load_rom(sb_emu_state_t*emu,gba_t* gba, gba_scratch_t *scratch){
   }else{
     gba->cpu.registers[PC]  = 0x0000000; 
     gba->cpu.registers[CPSR]= 0x000000d3; 
+    arm7_update_bank(&gba->cpu);
   }
   if(gba->cpu.log_cmp_file){fclose(gba->cpu.log_cmp_file);gba->cpu.log_cmp_file=NULL;};
   gba->cpu.log_cmp_file =se_load_log_file(scratch->save_file_path, "log.bin");
@@ -3692,10 +3938,182 @@ static FORCE_INLINE void sb_process_audio(sb_gb_t *gb, sb_emu_state_t*emu, doubl
 // END GB REUSE CODE SHIM//
 
 
+// Cycles until one of the components has work to do: the IF pipeline shifts on every cycle while it
+// holds interrupts, the timers update once the deferred ticks reach timer_ticks_before_event and the
+// PPU runs on every dot.
+static FORCE_INLINE int gba_cycles_to_next_event(gba_t* gba){
+  if(gba->active_if_pipe_stages)return 1;
+  int cycles = 4-gba->ppu.scan_clock%4;
+  if(gba->deferred_timer_ticks+cycles>gba->timer_ticks_before_event){
+    cycles = gba->deferred_timer_ticks<gba->timer_ticks_before_event? gba->timer_ticks_before_event-gba->deferred_timer_ticks: 1;
+  }
+  return cycles;
+}
+// Same as cycles calls of gba_tick_interrupts, gba_tick_timers and gba_tick_ppu when only the last one
+// can have an event (see gba_cycles_to_next_event)
+static FORCE_INLINE void gba_tick_to_event(gba_t* gba, int cycles, bool render){
+  gba_tick_interrupts(gba);
+  gba->deferred_timer_ticks+=cycles-1;
+  gba->ppu.scan_clock+=cycles-1;
+  gba->ppu.fast_forward_ticks-=cycles-1;
+  gba_tick_timers(gba);
+  gba_tick_ppu(gba,render);
+}
+// Ticks the hardware for the cycles the last CPU instruction or DMA took, stepping from one component
+// event to the next. Returns true at the end of the frame.
+static FORCE_INLINE bool gba_tick_components(sb_emu_state_t* emu, gba_t* gba, int ticks){
+  gba_tick_sio(gba);
+  double delta_t = ((double)ticks)/(16*1024*1024);
+  if(SB_LIKELY(gba->active_if_pipe_stages==0)){
+    int ppu_fast_forward = gba->ppu.fast_forward_ticks;
+    int timer_fast_forward = gba->timer_ticks_before_event-gba->deferred_timer_ticks;
+    int fast_forward_ticks=ppu_fast_forward<timer_fast_forward?ppu_fast_forward:timer_fast_forward; 
+    if(fast_forward_ticks>ticks){
+      if(gba->cpu.wait_for_interrupt)ticks=fast_forward_ticks;
+      else if(gba->idle_loop_active){
+        // Skip whole iterations so the CPU is back at the loop head with the same timing it would have had
+        int skip = (fast_forward_ticks-ticks)/gba->idle_loop.iteration_clocks*gba->idle_loop.iteration_clocks;
+        arm7_idle_loop_skip(&gba->idle_loop,skip);
+        ticks=fast_forward_ticks=ticks+skip;
+      }else fast_forward_ticks=ticks;
+    }
+    gba->idle_loop_active=false;
+    gba->rtc.total_clocks_ticked+=fast_forward_ticks;
+    gba->deferred_timer_ticks+=fast_forward_ticks;
+    gba->ppu.scan_clock+=fast_forward_ticks;
+    gba->ppu.fast_forward_ticks-=fast_forward_ticks;
+    ticks -=fast_forward_ticks>ticks?ticks:fast_forward_ticks;
+    delta_t = ((double)ticks+fast_forward_ticks)/(16*1024*1024);
+    gba_tick_audio(gba, emu,delta_t,ticks+fast_forward_ticks);
+  }else gba_tick_audio(gba, emu,delta_t,ticks);
+  bool last_activate_dmas =gba->activate_dmas;
+  gba->rtc.total_clocks_ticked+=ticks;
+  for(int t = 0;t<ticks;){
+    int cycles = gba_cycles_to_next_event(gba);
+    if(cycles>ticks-t)cycles=ticks-t;
+    t+=cycles;
+    if(gba->activate_dmas&&!last_activate_dmas){gba->residual_dma_ticks=ticks-t;gba->last_cpu_tick=t;}
+    gba_tick_to_event(gba,cycles,emu->render_frame);
+  }
+  return gba->ppu.has_hit_vblank||gba->stop_mode;
+}
+// Cycles the CPU can run before gba_tick_components has more to do than advance clocks: the PPU and
+// timer fast forward, the next frame sequencer and wave channel steps and the next audio sample (or
+// the wrap of the simulated time). The IF pipeline and serial transfers tick on every call.
+static int gba_cpu_budget(gba_t* gba){
+  if(gba->active_if_pipe_stages||SB_BFE(gba_io_read16(gba,GBA_SIOCNT),7,1))return 0;
+  gba_audio_t* audio = &gba->audio;
+  int budget = gba->ppu.fast_forward_ticks;
+  int timer = gba->timer_ticks_before_event-gba->deferred_timer_ticks;
+  int frame_seq = 32768-(audio->audio_clock&32767);
+  int wave = (audio->wave_freq_timer+1)*4-(audio->audio_clock&3);
+  double limit = 1.0;
+  if(SB_BFE(gba_io_read8(gba,GBA_SOUNDCNT_X),7,1)&&audio->current_sample_generated_time<limit)limit = audio->current_sample_generated_time;
+  double sample_ticks = (limit-audio->current_sim_time)*(16*1024*1024);
+  int sample = sample_ticks>2? (int)sample_ticks-1: 0;
+  if(timer<budget)budget = timer;
+  if(frame_seq<budget)budget = frame_seq;
+  if(wave<budget)budget = wave;
+  if(sample<budget)budget = sample;
+  return budget>0? budget: 0;
+}
+typedef struct{
+  sb_emu_state_t* emu;
+  gba_t* gba;
+  bool frame_done;
+  bool breakpoint;
+  arm7_jit_budget_t* budget; // Cycle budget of the JIT, NULL when the boundary isn't called from compiled code
+}gba_cpu_run_ctx_t;
+// Ticks the cycles of the instructions compiled code ran within the budget (arm7_jit_budget_t::flush)
+static void gba_cpu_flush_budget(void* user_data){
+  gba_cpu_run_ctx_t* ctx = (gba_cpu_run_ctx_t*)user_data;
+  arm7_jit_budget_t* budget = ctx->budget;
+  int pending = budget->pending;
+  budget->pending = budget->cycles = 0;
+  if(pending)gba_tick_components(ctx->emu,ctx->gba,pending);
+}
+// Same as the end of a gba_tick iteration followed by the start of the next one, for code run by the
+// JIT or the threaded interpreter. The cycles of the instructions the JIT skipped the call for are
+// ticked together with the ones of the last instruction.
+static bool gba_cpu_boundary(void* user_data){
+  gba_cpu_run_ctx_t* ctx = (gba_cpu_run_ctx_t*)user_data;
+  gba_t* gba = ctx->gba;
+  arm7_jit_budget_t* budget = ctx->budget;
+  int pending = 0;
+  if(budget){
+    pending = budget->pending;
+    budget->pending = budget->cycles = 0;
+  }
+  int ticks = gba->last_cpu_tick = gba->mem.requests+gba->cpu.i_cycles;
+  if(SB_UNLIKELY(gba->cpu.trigger_breakpoint)){
+    if(pending)gba_tick_components(ctx->emu,gba,pending);
+    ctx->breakpoint=true;
+    return false;
+  }
+  if(gba_tick_components(ctx->emu,gba,ticks+pending)){ctx->frame_done=true;return false;}
+  if(gba->activate_dmas||gba->residual_dma_ticks)return false;
+  uint16_t int_if = gba_io_read16(gba,GBA_IF);
+  if(int_if&&(int_if&gba_io_read16(gba,GBA_IE))&&SB_BFE(gba_io_read32(gba,GBA_IME),0,1))return false;
+  gba->cpu.i_cycles=0;
+  gba->mem.requests=0;
+  if(budget)budget->cycles = gba_cpu_budget(gba);
+  return true;
+}
+// Runs compiled code like arm7_jit_run. One in every GBA_JIT_VERIFY_INTERVAL runs is replayed on a
+// copy of the state with arm7_exec_instruction and the results compared.
+#ifndef GBA_JIT_VERIFY_INTERVAL
+#define GBA_JIT_VERIFY_INTERVAL 16
+#endif
+static bool gba_jit_verify_run(sb_emu_state_t* emu, gba_t* gba, gba_scratch_t* scratch, gba_cpu_run_ctx_t* ctx){
+  arm7_jit_verify_t* v = &scratch->jit_verify;
+  const uint8_t* entry = arm7_jit_entry(&scratch->arm_jit,&gba->cpu,arm7_jit_verify_boundary);
+  if(!entry)return false;
+  v->boundary = gba_cpu_boundary;
+  v->ctx = ctx;
+  bool verify = arm7_jit_verify_due(v,GBA_JIT_VERIFY_INTERVAL);
+  gba_t* replay = &scratch->jit_verify_gba;
+  if(verify){
+    memcpy(replay,gba,sizeof(gba_t));
+    memcpy(&scratch->jit_verify_emu,emu,sizeof(sb_emu_state_t));
+  }
+  uint32_t start_pc = gba->cpu.registers[PC];
+  uint64_t skipped = scratch->jit_budget.skipped;
+  arm7_jit_enter(&scratch->arm_jit,&gba->cpu,v,entry);
+  v->instructions+=scratch->jit_budget.skipped-skipped;
+  if(!verify)return true;
+
+  gba_cpu_run_ctx_t replay_ctx = {&scratch->jit_verify_emu,replay,.budget=NULL};
+  replay->cpu.user_data = replay;
+  replay->cpu.block_cache = NULL;
+  arm7_code_window_flush(&replay->cpu);
+  for(uint32_t i=0;i<v->instructions;++i){
+    arm7_exec_instruction(&replay->cpu);
+    if(!gba_cpu_boundary(&replay_ctx))break;
+  }
+  v->verified++;
+  bool match = arm7_jit_verify_cpu(v,&gba->cpu,&replay->cpu,start_pc,"GBA");
+  if(match&&(replay_ctx.frame_done!=ctx->frame_done||replay_ctx.breakpoint!=ctx->breakpoint)){
+    printf("GBA JIT mismatch after %u instructions from 0x%08x: the run ended differently\n",v->instructions,start_pc);
+    match = false;
+  }
+  if(match&&memcmp(replay,gba,sizeof(gba_t))){
+    size_t offset = 0;
+    while(((uint8_t*)replay)[offset]==((uint8_t*)gba)[offset])++offset;
+    printf("GBA JIT mismatch after %u instructions from 0x%08x: gba_t differs at offset %zu\n",v->instructions,start_pc,offset);
+    match = false;
+  }
+  if(match&&memcmp(&scratch->jit_verify_emu.audio_ring_buff,&emu->audio_ring_buff,sizeof(emu->audio_ring_buff))){
+    printf("GBA JIT mismatch after %u instructions from 0x%08x: the audio output differs\n",v->instructions,start_pc);
+    match = false;
+  }
+  if(!match)v->mismatches++;
+  return true;
+}
 void gba_tick(sb_emu_state_t* emu, gba_t* gba,gba_scratch_t *scratch){
   gba->framebuffer = scratch->framebuffer;
   gba->mem.bios    = scratch->bios;
   gba->mem.cart_rom= emu->rom_data;
+  gba->mem_pages   = scratch->mem_pages;
   gba->cpu.log_cmp_file = scratch->log_cmp_file;
   gba->cpu.read8 = arm7_read8;
   gba->cpu.read16 = arm7_read16;
@@ -3705,7 +4123,20 @@ void gba_tick(sb_emu_state_t* emu, gba_t* gba,gba_scratch_t *scratch){
   gba->cpu.write8 = arm7_write8;
   gba->cpu.write16 = arm7_write16;
   gba->cpu.write32 = arm7_write32;
+  gba->cpu.code_ptr = arm7_code_ptr;
+  gba->cpu.cached_fetch = arm7_cached_fetch;
+  gba->cpu.swi_hle = emu->bios_hle? gba_bios_hle: NULL;
+  gba->cpu.block_transfer = gba_arm7_block_transfer;
+  gba->hle_verify = emu->bios_hle&&emu->bios_hle_verify? &scratch->hle_verify: NULL;
+#if ARM7_STATIC_BUS
+  arm7_bind_bus_handlers(&gba->cpu,gba_arm_handlers,gba_thumb_handlers);
+#endif
   gba->cpu.user_data=gba;
+  gba->cpu.block_cache = emu->arm_block_cache||emu->arm_jit? &scratch->block_cache: NULL;
+  // State loads, rewinds and resets replace the emulated memory without going through the bus, so
+  // blocks are only kept when the core resumes exactly where the last tick stopped. 
+  if(scratch->block_cache_resume_clock!=gba->rtc.total_clocks_ticked||!scratch->block_cache.epoch)arm7_block_cache_flush(gba->cpu.block_cache);
+  arm7_code_window_flush(&gba->cpu);
 
   gba_tick_keypad(&emu->joy,gba);
   gba->ppu.has_hit_vblank=false;
@@ -3714,6 +4145,34 @@ void gba_tick(sb_emu_state_t* emu, gba_t* gba,gba_scratch_t *scratch){
   if(!(solar_value >0.00))solar_value=0.00;
   gba->solar_sensor.value = 0xE7-solar_value*(0xE7-0x32);
   gba->ppu.ghosting_strength = emu->screen_ghosting_strength;
+  gba_cpu_run_ctx_t run_ctx = {emu,gba};
+  // Verifying the BIOS HLE checks for the return of the SWIs after every instruction
+  bool use_jit = emu->arm_jit&&gba->cpu.block_cache&&!gba->hle_verify;
+  if(use_jit){
+    arm7_jit_budget_t* budget = &scratch->jit_budget;
+    budget->counter = offsetof(gba_t,mem.requests);
+    budget->flush = gba_cpu_flush_budget;
+    budget->ctx = &run_ctx;
+    run_ctx.budget = budget;
+    arm7_jit_system_t system;
+    memset(&system,0,sizeof(system));
+    system.pages = scratch->mem_pages;
+    system.page_shift = GBA_MEM_PAGE_SHIFT;
+    system.page_limit = 0x10000000;
+    system.read_flag = GBA_MEM_PAGE_READ;
+    system.write_flag = GBA_MEM_PAGE_WRITE;
+    system.write8_flag = GBA_MEM_PAGE_WRITE8;
+    system.rom_flag = GBA_MEM_PAGE_ROM;
+    system.rom_base = offsetof(gba_t,mem.cart_rom);
+    system.access = gba_jit_access;
+    system.openbus = offsetof(gba_t,mem.openbus_word);
+    system.openbus_word = true;
+    system.budget = budget;
+    arm7_jit_set_system(&scratch->arm_jit,&system);
+  }
+  bool jit_verify = use_jit&&emu->arm_jit_verify;
+  bool use_threaded = ARM7_THREADED_INTERPRETER&&!gba->cpu.block_cache&&!gba->hle_verify;
+  bool use_fusion = emu->thumb_fusion&&gba->cpu.block_cache&&!gba->hle_verify;
   while(true){
     int ticks = gba->activate_dmas? gba_tick_dma(gba,gba->last_cpu_tick) :0;
     if(!ticks&&gba->residual_dma_ticks){ticks=gba->residual_dma_ticks;gba->residual_dma_ticks=0;}
@@ -3727,38 +4186,31 @@ void gba_tick(sb_emu_state_t* emu, gba_t* gba,gba_scratch_t *scratch){
         int_if *= SB_BFE(ime,0,1);
         arm7_process_interrupts(&gba->cpu, int_if);
       }
-      arm7_exec_instruction(&gba->cpu);
+      if((use_jit&&(SB_UNLIKELY(jit_verify)? gba_jit_verify_run(emu,gba,scratch,&run_ctx): arm7_jit_run(&scratch->arm_jit,&gba->cpu,gba_cpu_boundary,&run_ctx)))||
+         (use_threaded&&arm7_exec_threaded(&gba->cpu,gba_cpu_boundary,&run_ctx))){
+        if(SB_UNLIKELY(run_ctx.breakpoint)){emu->run_mode = SB_MODE_PAUSE; gba->cpu.trigger_breakpoint=false; break;}
+        if(run_ctx.frame_done)break;
+        continue;
+      }
+      uint32_t pc = gba->cpu.registers[PC];
+      if(use_fusion){
+        int executed = arm7_exec_cached_fused(&gba->cpu,gba_cpu_boundary,&run_ctx);
+        if(!executed){
+          if(SB_UNLIKELY(run_ctx.breakpoint)){emu->run_mode = SB_MODE_PAUSE; gba->cpu.trigger_breakpoint=false; break;}
+          if(run_ctx.frame_done)break;
+          continue;
+        }
+        pc+= (executed-1)*2;
+      }else if(gba->cpu.block_cache)arm7_exec_cached_instruction(&gba->cpu);
+      else arm7_exec_instruction(&gba->cpu);
+      gba->idle_loop_active = emu->idle_loop_skip&&arm7_idle_loop_arrival(&gba->cpu,&gba->idle_loop,pc,gba->rtc.total_clocks_ticked,gba_idle_loop_read_ok);
+      if(SB_UNLIKELY(gba->hle_verify))arm7_hle_verify_check(gba->hle_verify,&gba->cpu,"GBA");
       gba->last_cpu_tick=ticks = gba->mem.requests+gba->cpu.i_cycles; 
       if(SB_UNLIKELY(gba->cpu.trigger_breakpoint)){emu->run_mode = SB_MODE_PAUSE; gba->cpu.trigger_breakpoint=false; break;}
     }
-    gba_tick_sio(gba);
-    double delta_t = ((double)ticks)/(16*1024*1024);
-    if(SB_LIKELY(gba->active_if_pipe_stages==0)){
-      int ppu_fast_forward = gba->ppu.fast_forward_ticks;
-      int timer_fast_forward = gba->timer_ticks_before_event-gba->deferred_timer_ticks;
-      int fast_forward_ticks=ppu_fast_forward<timer_fast_forward?ppu_fast_forward:timer_fast_forward; 
-      if(fast_forward_ticks>ticks){
-        if(gba->cpu.wait_for_interrupt)ticks=fast_forward_ticks;
-        else fast_forward_ticks=ticks;
-      }
-      gba->rtc.total_clocks_ticked+=fast_forward_ticks;
-      gba->deferred_timer_ticks+=fast_forward_ticks;
-      gba->ppu.scan_clock+=fast_forward_ticks;
-      gba->ppu.fast_forward_ticks-=fast_forward_ticks;
-      ticks -=fast_forward_ticks>ticks?ticks:fast_forward_ticks;
-      delta_t = ((double)ticks+fast_forward_ticks)/(16*1024*1024);
-      gba_tick_audio(gba, emu,delta_t,ticks+fast_forward_ticks);
-    }else gba_tick_audio(gba, emu,delta_t,ticks);
-    bool last_activate_dmas =gba->activate_dmas;
-    gba->rtc.total_clocks_ticked+=ticks;
-    for(int t = 0;t<ticks;++t){
-      if(gba->activate_dmas&&!last_activate_dmas){gba->residual_dma_ticks=ticks-t-1;gba->last_cpu_tick=t+1;}
-      gba_tick_interrupts(gba);
-      gba_tick_timers(gba);
-      gba_tick_ppu(gba,emu->render_frame);
-    }
-    if(SB_UNLIKELY(gba->ppu.has_hit_vblank||gba->stop_mode))break;
+    if(gba_tick_components(emu,gba,ticks))break;
   } 
+  scratch->block_cache_resume_clock = gba->cpu.block_cache? gba->rtc.total_clocks_ticked: UINT64_MAX;
   emu->joy.rumble = SB_BFE(gba->cart.gpio_data,3,1);        
 }
 
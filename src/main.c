@@ -185,7 +185,15 @@ typedef struct{
   uint32_t http_control_server_port; 
   uint32_t http_control_server_enable;
   uint32_t avoid_overlaping_touchscreen;
-  uint32_t padding[230];
+  uint32_t arm_block_cache;
+  uint32_t arm_jit;
+  uint32_t idle_loop_skip;
+  uint32_t bios_hle;
+  uint32_t bios_hle_verify;
+  uint32_t thumb_fusion;
+  uint32_t gb_halt_skip_verify;
+  uint32_t arm_jit_verify;
+  uint32_t padding[222];
 }persistent_settings_t; 
 _Static_assert(sizeof(persistent_settings_t)==1024, "persistent_settings_t must be exactly 1024 bytes");
 #define SE_STATS_GRAPH_DATA 256
@@ -1366,6 +1374,49 @@ void se_draw_arm_state(const char* label, arm7_t *arm, emu_byte_read_t read){
   if(clear_step_data)arm->debug_swi_ring_offset=0;
 
 }
+void se_draw_idle_loop_stats(arm7_idle_loop_t* idle){
+  se_text(ICON_FK_HOURGLASS " Idle Loops");
+  igSeparator();
+  if(!emu_state.idle_loop_skip)se_text("Idle loop skipping is disabled");
+  if(idle->disabled)se_text("Disabled for this game");
+  else if(idle->override_head)se_text("Override head: 0x%08x",idle->override_head);
+  se_text("Loops detected: %llu",(unsigned long long)idle->loops_detected);
+  se_text("Clocks skipped: %llu",(unsigned long long)idle->clocks_skipped);
+  if(idle->loops_detected)se_text("Last loop: 0x%08x (%u clocks per iteration)",idle->last_head,idle->iteration_clocks);
+}
+void se_draw_bios_hle_stats(arm7_hle_verify_t* verify){
+  if(!emu_state.bios_hle_verify)return;
+  se_text(ICON_FK_CHECK " BIOS HLE Verification");
+  igSeparator();
+  se_text("SWIs verified: %llu",(unsigned long long)verify->verified);
+  se_text("Mismatches: %llu",(unsigned long long)verify->mismatches);
+}
+void se_draw_arm_jit_verify_stats(arm7_jit_verify_t* verify){
+  if(!emu_state.arm_jit||!emu_state.arm_jit_verify)return;
+  se_text(ICON_FK_CHECK " JIT Verification");
+  igSeparator();
+  se_text("Runs verified: %llu",(unsigned long long)verify->verified);
+  se_text("Mismatches: %llu",(unsigned long long)verify->mismatches);
+}
+void se_draw_gb_halt_skip_stats(sb_halt_skip_t* skip){
+  se_text(ICON_FK_HOURGLASS " HALT Skipping");
+  igSeparator();
+  se_text("Runs skipped: %llu",(unsigned long long)skip->runs_skipped);
+  se_text("Iterations skipped: %llu",(unsigned long long)skip->iterations_skipped);
+  if(!emu_state.gb_halt_skip_verify)return;
+  se_text("Runs verified: %llu",(unsigned long long)skip->verified);
+  se_text("Mismatches: %llu",(unsigned long long)skip->mismatches);
+}
+void se_draw_thumb_fusion_stats(arm7_block_cache_t* cache){
+  static const char* names[ARM7_FUSE_COUNT]={"","CMP+Bcc","Shift+ADD","LDR+LDR","BL"};
+  se_text(ICON_FK_LINK " Thumb Fusion");
+  igSeparator();
+  if(!emu_state.arm_block_cache||!emu_state.thumb_fusion){se_text("Thumb fusion is disabled");return;}
+  uint64_t total = 0;
+  for(int i=1;i<ARM7_FUSE_COUNT;++i)total+=cache->fused[i];
+  for(int i=1;i<ARM7_FUSE_COUNT;++i)se_text("%s: %llu (%.1f%%)",names[i],(unsigned long long)cache->fused[i],total?cache->fused[i]*100./total:0.);
+  se_text("Split by an event: %llu",(unsigned long long)cache->fusion_fallbacks);
+}
 void se_draw_mem_debug_state(const char* label, gui_state_t* gui, emu_byte_read_t read,emu_byte_write_t write){
   se_text(ICON_FK_EXCHANGE " Read/Write Memory Address");
   igSeparator();
@@ -2011,10 +2062,10 @@ typedef struct{
 }se_debug_tool_desc_t; 
 
 void gba_memory_debugger(){se_draw_mem_debug_state("GBA MEM", &gui_state, &gba_byte_read, &gba_byte_write); }
-void gba_cpu_debugger(){se_draw_arm_state("CPU",&core.gba.cpu,&gba_byte_read);}
+void gba_cpu_debugger(){se_draw_arm_state("CPU",&core.gba.cpu,&gba_byte_read);se_draw_idle_loop_stats(&core.gba.idle_loop);se_draw_thumb_fusion_stats(&scratch.gba.block_cache);se_draw_bios_hle_stats(&scratch.gba.hle_verify);se_draw_arm_jit_verify_stats(&scratch.gba.jit_verify);}
 void gba_mmio_debugger(){se_draw_io_state("GBA MMIO", gba_io_reg_desc,sizeof(gba_io_reg_desc)/sizeof(mmio_reg_t), &gba_byte_read, &gba_byte_write,NULL);}
 
-void gb_mmio_debugger(){se_draw_io_state("GB MMIO", gb_io_reg_desc,sizeof(gb_io_reg_desc)/sizeof(mmio_reg_t), &gb_byte_read, &gb_byte_write,NULL);}
+void gb_mmio_debugger(){se_draw_io_state("GB MMIO", gb_io_reg_desc,sizeof(gb_io_reg_desc)/sizeof(mmio_reg_t), &gb_byte_read, &gb_byte_write,NULL);se_draw_gb_halt_skip_stats(&scratch.gb.halt_skip);}
 void gb_memory_debugger(){se_draw_mem_debug_state("GB MEM", &gui_state, &gb_byte_read, &gb_byte_write);}
 
 sb_debug_mmio_access_t nds7_mmio_access_type(uint64_t address,int trigger_breakpoint){return nds_debug_mmio_access(&core.nds,NDS_ARM7,address,trigger_breakpoint);}
@@ -2023,8 +2074,8 @@ void nds7_mmio_debugger(){se_draw_io_state("NDS7 MMIO", nds7_io_reg_desc,sizeof(
 void nds9_mmio_debugger(){se_draw_io_state("NDS9 MMIO", nds9_io_reg_desc,sizeof(nds9_io_reg_desc)/sizeof(mmio_reg_t), &nds9_byte_read, &nds9_byte_write,&nds9_mmio_access_type); }
 void nds7_mem_debugger(){se_draw_mem_debug_state("NDS9 MEM",&gui_state, &nds9_byte_read, &nds9_byte_write); }
 void nds9_mem_debugger(){se_draw_mem_debug_state("NDS7_MEM",&gui_state, &nds7_byte_read, &nds7_byte_write);}
-void nds7_cpu_debugger(){se_draw_arm_state("ARM7",&core.nds.arm7,&nds7_byte_read); }
-void nds9_cpu_debugger(){se_draw_arm_state("ARM9",&core.nds.arm9,&nds9_byte_read);}
+void nds7_cpu_debugger(){se_draw_arm_state("ARM7",&core.nds.arm7,&nds7_byte_read);se_draw_idle_loop_stats(&core.nds.idle_loop[0]);se_draw_bios_hle_stats(&scratch.nds.hle_verify[0]);}
+void nds9_cpu_debugger(){se_draw_arm_state("ARM9",&core.nds.arm9,&nds9_byte_read);se_draw_idle_loop_stats(&core.nds.idle_loop[1]);se_draw_thumb_fusion_stats(&scratch.nds.arm9_block_cache);se_draw_bios_hle_stats(&scratch.nds.hle_verify[1]);se_draw_arm_jit_verify_stats(&scratch.nds.arm9_jit_verify);}
 void nds_io_debugger(){
   nds_t * nds = &core.nds;
   for(int cpu=0;cpu<2;++cpu){
@@ -3732,6 +3783,14 @@ void se_update_frame() {
   }
 
   emu_state.screen_ghosting_strength = gui_state.settings.ghosting;
+  emu_state.arm_block_cache = gui_state.settings.arm_block_cache;
+  emu_state.arm_jit = gui_state.settings.arm_jit;
+  emu_state.thumb_fusion = gui_state.settings.thumb_fusion;
+  emu_state.arm_jit_verify = gui_state.settings.arm_jit_verify;
+  emu_state.idle_loop_skip = gui_state.settings.idle_loop_skip;
+  emu_state.bios_hle = gui_state.settings.bios_hle;
+  emu_state.bios_hle_verify = gui_state.settings.bios_hle_verify;
+  emu_state.gb_halt_skip_verify = gui_state.settings.gb_halt_skip_verify;
   const int frames_per_rewind_state = 8; 
   static double simulation_time = -1;
   double curr_time = se_time();
@@ -4462,6 +4521,38 @@ void se_draw_menu_panel(){
   bool force_dmg_mode = gui_state.settings.force_dmg_mode;
   se_checkbox("Force GB games to run in DMG mode",&force_dmg_mode);
   gui_state.settings.force_dmg_mode=force_dmg_mode;
+  bool arm_block_cache = gui_state.settings.arm_block_cache;
+  se_checkbox("Cache decoded ARM code blocks",&arm_block_cache);
+  gui_state.settings.arm_block_cache=arm_block_cache;
+  if(arm_block_cache){
+    bool thumb_fusion = gui_state.settings.thumb_fusion;
+    se_checkbox("Fuse common Thumb instruction pairs",&thumb_fusion);
+    gui_state.settings.thumb_fusion=thumb_fusion;
+  }
+#if ARM7_JIT_SUPPORTED
+  bool arm_jit = gui_state.settings.arm_jit;
+  se_checkbox("JIT compile hot GBA and NDS ARM9 code (x86-64)",&arm_jit);
+  gui_state.settings.arm_jit=arm_jit;
+  if(arm_jit){
+    bool arm_jit_verify = gui_state.settings.arm_jit_verify;
+    se_checkbox("Verify compiled code against the interpreter",&arm_jit_verify);
+    gui_state.settings.arm_jit_verify=arm_jit_verify;
+  }
+#endif
+  bool idle_loop_skip = gui_state.settings.idle_loop_skip;
+  se_checkbox("Skip idle loops (GBA/NDS)",&idle_loop_skip);
+  gui_state.settings.idle_loop_skip=idle_loop_skip;
+  bool bios_hle = gui_state.settings.bios_hle;
+  se_checkbox("Run BIOS calls natively (GBA/NDS)",&bios_hle);
+  gui_state.settings.bios_hle=bios_hle;
+  if(bios_hle){
+    bool bios_hle_verify = gui_state.settings.bios_hle_verify;
+    se_checkbox("Verify native BIOS calls against the BIOS",&bios_hle_verify);
+    gui_state.settings.bios_hle_verify=bios_hle_verify;
+  }
+  bool gb_halt_skip_verify = gui_state.settings.gb_halt_skip_verify;
+  se_checkbox("Verify skipped GB HALTs against cycle stepping",&gb_halt_skip_verify);
+  gui_state.settings.gb_halt_skip_verify=gb_halt_skip_verify;
   bool draw_debug_menu = gui_state.settings.draw_debug_menu;
   se_checkbox("Show Debug Tools",&draw_debug_menu);
   gui_state.settings.draw_debug_menu = draw_debug_menu;
@@ -5,8 +5,21 @@
 #include "nds_rom_database.h"
 #include "freebios/drastic_bios_arm7.h"
 #include "freebios/drastic_bios_arm9.h"
+#include "arm7_bios_hle.h"
+#include "arm7_jit.h"
 
 #define NDS_SCANLINE_PPU 1
+// Draws the scanlines of engine B on a worker thread next to engine A (needs POSIX threads)
+#ifndef NDS_THREADED_PPU
+#define NDS_THREADED_PPU 0
+#endif
+#if NDS_THREADED_PPU
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+// Polls before the worker sleeps and before the emulation thread yields to it
+#define NDS_PPU_WORKER_SPIN (1<<17)
+#endif
 
 typedef enum{
   kARM7,
@@ -1862,6 +1875,30 @@ mmio_reg_t nds7_io_reg_desc[]={
 #define NDS_GPU_MAX_PARAM 64
 #define NDS_GX_DMA_THRESHOLD 128
 
+// Per CPU page tables over the bus below NDS_MEM_PAGE_LIMIT so the common CPU accesses skip the TCM
+// checks and the region decode. Pages without a flag take the full decode.
+#define NDS_MEM_PAGE_SHIFT  14
+#define NDS_MEM_PAGE_LIMIT  0x08000000
+#define NDS_MEM_PAGES       (NDS_MEM_PAGE_LIMIT>>NDS_MEM_PAGE_SHIFT)
+#define NDS_MEM_PAGE_READ   0x1
+#define NDS_MEM_PAGE_WRITE  0x2 // 16 and 32 bit writes
+#define NDS_MEM_PAGE_WRITE8 0x4
+#define NDS_MEM_PAGE_CODE   0x8 // Writes invalidate the block caches
+// A native IntrWait is keyed by the SP and the address of its SWI, so the waits of different threads
+// and interrupt handlers don't resume each other. The most recent ones are kept.
+#define NDS_HLE_INTR_WAITS 4
+typedef struct{
+  uint32_t sp, pc;
+  bool active;
+}nds_hle_intr_wait_t;
+
+typedef struct{
+  uint32_t offset; // Start of the page's memory from the nds_t
+  uint16_t mask;   // Address bits inside the page's memory, mirrors smaller than a page keep fewer of them
+  uint8_t flags;
+  uint8_t cycles;  // Non sequential slow bus cycles of reads (low nibble) and writes (high nibble)
+}nds_mem_page_t;
+
 typedef struct {     
   uint8_t ram[4*1024*1024]; /*4096KB Main RAM (8192KB in debug version)*/
   uint8_t wram[96*1024];    /*96KB   WRAM (64K mapped to NDS7, plus 32K mappable to NDS7 or NDS9)*/
@@ -1872,6 +1909,8 @@ typedef struct {
   uint8_t data_cache[4*1024];
   uint8_t vram[1024*1024];    /* VRAM (allocateable as BG/OBJ/2D/3D/Palette/Texture/WRAM memory) */
   uint64_t vram_translation_cache[1024*16];
+  // Indexed by NDS_ARM7/NDS_ARM9, kept here so state loads bring back the mapping they were built for
+  nds_mem_page_t pages[2][NDS_MEM_PAGES];
   uint8_t palette[2*1024];   
   uint8_t *save_data;
 
@@ -2220,6 +2259,14 @@ typedef struct{
   uint64_t current_clock;
   float ghosting_strength;
   int ppu_fast_forward_ticks;
+  // Idle loops of the ARM7 (0) and ARM9 (1), clocked in cycles of that CPU
+  arm7_idle_loop_t idle_loop[2];
+  // Times each CPU confirmed its idle loop since the other one last ran outside of an idle loop
+  int idle_loop_passes[2];
+  // Native IntrWaits the ARM7 (0) or ARM9 (1) is halted in, they check their flags when rerun
+  nds_hle_intr_wait_t hle_intr_wait[2][NDS_HLE_INTR_WAITS];
+  arm7_hle_verify_t* hle_verify; // Per CPU, NULL unless the BIOS HLE is being verified
+  struct nds_ppu_worker* ppu_worker; // NULL unless NDS_THREADED_PPU is set
   FILE * gx_log;
   FILE * io9_log;
   FILE * io7_log;
@@ -2227,6 +2274,23 @@ typedef struct{
   FILE * dma_log;
   FILE * vert_log;
 } nds_t; 
+#if NDS_THREADED_PPU
+typedef struct nds_ppu_worker{
+  pthread_t thread;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  bool started;
+  bool sleeping;
+  bool quit;
+  // Scanlines handed over and finished, accessed atomically
+  uint32_t posted;
+  uint32_t done;
+  nds_t* nds;
+  int lcd_x, lcd_y;
+  uint32_t dispcapcnt;
+}nds_ppu_worker_t;
+static void nds_ppu_worker_stop(nds_ppu_worker_t* worker);
+#endif
 typedef struct{
   uint8_t nds7_bios[16*1024];
   uint8_t nds9_bios[4*1024];
@@ -2239,6 +2303,18 @@ typedef struct{
   uint8_t framebuffer_3d[NDS_LCD_W*NDS_LCD_H*4];
   uint8_t framebuffer_3d_disp[NDS_LCD_W*NDS_LCD_H*4];
   nds_vert_t vert_buffer[NDS_MAX_VERTS];
+  arm7_block_cache_t arm7_block_cache;
+  arm7_block_cache_t arm9_block_cache;
+  arm7_jit_t arm9_jit;
+  uint64_t block_cache_resume_clock;
+  arm7_hle_verify_t hle_verify[2];
+  // State before a verified run of compiled ARM9 code, replayed by the interpreter
+  arm7_jit_verify_t arm9_jit_verify;
+  nds_t jit_verify_nds;
+  sb_emu_state_t jit_verify_emu;
+#if NDS_THREADED_PPU
+  nds_ppu_worker_t ppu_worker;
+#endif
 }nds_scratch_t; 
 static void nds_tick_keypad(sb_joy_t*joy, nds_t* nds); 
 static void nds_tick_touch(sb_joy_t*joy, nds_t* nds); 
@@ -2248,11 +2324,18 @@ static void nds_compute_timers(nds_t* nds);
 static uint32_t nds_get_save_size(nds_t*nds);
 static uint8_t nds_process_flash_write(nds_t *nds, uint8_t write_data, nds_flash_t* flash, uint8_t *flash_data, uint32_t flash_size);
 static bool nds_run_ar_cheat(nds_t* nds, const uint32_t* buffer, uint32_t size);
+static void nds_update_vram_mapping(nds_t*nds);
+static void nds_update_mem_pages(nds_t* nds, int cpu, uint64_t start, uint64_t end);
 
 
 //Returns offset into savestate where bess info can be found
 static uint32_t nds_save_best_effort_state(nds_t* nds){
   nds->bess.bess_version = 1;   
+  arm7_flush_flags(&nds->arm9);
+  arm7_flush_flags(&nds->arm7);
+  // The registers are saved in place so they stay unbanked until the next nds_tick
+  arm7_unbank_registers(&nds->arm9);
+  arm7_unbank_registers(&nds->arm7);
 
   nds->bess.cpu9_reg_seg= (uint8_t*)nds->arm9.registers-(uint8_t*)nds;
   nds->bess.cpu7_reg_seg= (uint8_t*)nds->arm7.registers-(uint8_t*)nds;
@@ -2303,8 +2386,13 @@ static bool nds_load_best_effort_state(nds_t* nds,uint8_t *save_state_data, uint
   if(bess->card_transfer_data_seg + sizeof(nds->mem.card_transfer_data)>size)return false;
   if(bess->coproc_reg_seg + sizeof(nds->cp15.reg)>size)return false;
 
+  arm7_unbank_registers(&nds->arm9);
+  arm7_unbank_registers(&nds->arm7);
   memcpy((uint8_t*)nds->arm9.registers, save_state_data+bess->cpu9_reg_seg, sizeof(nds->arm9.registers));
   memcpy((uint8_t*)nds->arm7.registers, save_state_data+bess->cpu7_reg_seg, sizeof(nds->arm7.registers));
+  nds->arm9.lazy_flags=nds->arm7.lazy_flags=0;
+  arm7_update_bank(&nds->arm9);
+  arm7_update_bank(&nds->arm7);
   memcpy((uint8_t*)nds->mem.ram,        save_state_data+bess->ram_seg, sizeof(nds->mem.ram));
   memcpy((uint8_t*)nds->mem.wram,       save_state_data+bess->wram_seg, sizeof(nds->mem.wram));
   memcpy((uint8_t*)nds->mem.code_tcm,   save_state_data+bess->code_tcm_seg, sizeof(nds->mem.code_tcm));
@@ -2317,6 +2405,9 @@ static bool nds_load_best_effort_state(nds_t* nds,uint8_t *save_state_data, uint
   memcpy((uint8_t*)nds->mem.io,         save_state_data+bess->io_seg, sizeof(nds->mem.io));
   memcpy((uint8_t*)nds->mem.card_transfer_data, save_state_data+bess->card_transfer_data_seg, sizeof(nds->mem.card_transfer_data));
   memcpy((uint8_t*)nds->cp15.reg,       save_state_data+bess->coproc_reg_seg, sizeof(nds->cp15.reg));
+  // The clock isn't part of BESS, so nds_tick wouldn't notice that the memory under the blocks changed
+  arm7_block_cache_flush(nds->arm7.block_cache);
+  arm7_block_cache_flush(nds->arm9.block_cache);
 
   printf("ARM7 PC: %08x ARM9 PC: %08x\n",nds->arm7.registers[15],nds->arm9.registers[15]);
 
@@ -2328,6 +2419,9 @@ static bool nds_load_best_effort_state(nds_t* nds,uint8_t *save_state_data, uint
   nds->mem.itcm_load_mode=bess->itcm_load_mode;
   nds->mem.dtcm_enable=bess->dtcm_enable;
   nds->mem.itcm_enable=bess->itcm_enable;
+  nds_update_vram_mapping(nds);
+  nds_update_mem_pages(nds,NDS_ARM7,0,NDS_MEM_PAGE_LIMIT);
+  nds_update_mem_pages(nds,NDS_ARM9,0,NDS_MEM_PAGE_LIMIT);
 
   nds->mem.card_read_offset=bess->card_read_offset;
   nds->mem.card_transfer_bytes=bess->card_transfer_bytes;
@@ -2639,6 +2733,90 @@ static FORCE_INLINE uint32_t nds_apply_vram_mem_op(nds_t *nds,uint32_t address,
 
 static bool nds_preprocess_mmio(nds_t * nds, uint32_t addr, uint32_t data, int transaction_type);
 static void nds_postprocess_mmio_write(nds_t * nds, uint32_t addr, uint32_t data, int transaction_type);
+// Either CPU can run code written by the other CPU or DMA, so writes invalidate both block caches
+static FORCE_INLINE void nds_invalidate_code(nds_t* nds, uint8_t* memory, uint32_t address, int transaction_type){
+  if(transaction_type&NDS_MEM_WRITE){
+    arm7_block_cache_invalidate(nds->arm7.block_cache,memory+address);
+    arm7_block_cache_invalidate(nds->arm9.block_cache,memory+address);
+  }
+}
+// Resolves the page at addr the way the TCM checks and the region decode would. VRAM pages are only
+// filled from valid entries of the VRAM translation cache (single bank mappings), so they stay on the
+// full decode until it has been accessed there.
+static nds_mem_page_t nds_compute_mem_page(nds_t* nds, int cpu, uint32_t addr){
+  const uint32_t page_size = 1<<NDS_MEM_PAGE_SHIFT;
+  nds_mem_page_t page = {0};
+  uint8_t* host = NULL;
+  uint16_t mask = page_size-1;
+  uint8_t flags = NDS_MEM_PAGE_READ|NDS_MEM_PAGE_WRITE|NDS_MEM_PAGE_WRITE8|NDS_MEM_PAGE_CODE;
+  uint8_t cycles = 0;
+  if(cpu==NDS_ARM9){
+    // DTCM has priority over ITCM, pages only partly covered by one keep the full decode
+    const struct{uint64_t start,end; bool enable,load_mode; uint8_t* mem; uint32_t size;}tcm[2]={
+      {nds->mem.dtcm_start_address,nds->mem.dtcm_end_address,nds->mem.dtcm_enable,nds->mem.dtcm_load_mode,nds->mem.data_tcm,16*1024},
+      {nds->mem.itcm_start_address,nds->mem.itcm_end_address,nds->mem.itcm_enable,nds->mem.itcm_load_mode,nds->mem.code_tcm,32*1024},
+    };
+    for(int t=0;t<2;++t){
+      if(!tcm[t].enable||addr+page_size<=tcm[t].start||addr>=tcm[t].end)continue;
+      if(tcm[t].load_mode||addr<tcm[t].start||addr+page_size>tcm[t].end||((addr-tcm[t].start)&(page_size-1)))return page;
+      host = tcm[t].mem+((addr-tcm[t].start)&(tcm[t].size-1));
+      return (nds_mem_page_t){host-(uint8_t*)nds,mask,flags,0};
+    }
+    switch(addr>>24){
+      case 0x2: host = nds->mem.ram+(addr&(4*1024*1024-1)); cycles = 9<<4; break; // Reads hit the cache
+      case 0x3:{
+        uint8_t cnt = nds9_io_read8(nds,NDS9_WRAMCNT)&0x3;
+        const int offset[4]={0,16*1024,0,0};
+        const int wram_mask[4]={32*1024-1,16*1024-1,16*1024-1,0};
+        if(cnt!=3)host = nds->mem.wram+(addr&wram_mask[cnt])+offset[cnt];
+        cycles = 0x44;
+      }break;
+      case 0x5: host = nds->mem.palette; mask = 2*1024-1; flags&=~NDS_MEM_PAGE_CODE; cycles = 0x44; break;
+      case 0x7: host = nds->mem.oam; mask = 2*1024-1; flags&=~NDS_MEM_PAGE_CODE; cycles = 0x44; break;
+      case 0x6: flags = NDS_MEM_PAGE_READ|NDS_MEM_PAGE_WRITE; cycles = 0x44; break; // Byte writes are ignored
+    }
+  }else{
+    switch(addr>>24){
+      case 0x2: host = nds->mem.ram+(addr&(4*1024*1024-1)); break;
+      case 0x3:{
+        uint8_t cnt = nds9_io_read8(nds,NDS9_WRAMCNT)&0x3;
+        const int offset[4]={0,0,16*1024,0};
+        const int wram_mask[4]={0,16*1024-1,16*1024-1,32*1024-1};
+        if(addr<=0x037FFFFF&&wram_mask[cnt])host = nds->mem.wram+(addr&wram_mask[cnt])+offset[cnt];
+        else host = nds->mem.wram+32*1024+(addr&(64*1024-1));
+      }break;
+      case 0x6: flags = NDS_MEM_PAGE_READ|NDS_MEM_PAGE_WRITE|NDS_MEM_PAGE_WRITE8; break;
+    }
+  }
+  if((addr>>24)==0x6){
+    uint64_t key = nds->mem.vram_translation_cache[SB_BFE(addr,14,10)*16+(cpu==NDS_ARM9?NDS_MEM_ARM9:NDS_MEM_ARM7)];
+    if((key&~(1023))==nds->mem.curr_vram_translation_key)host = nds->mem.vram+(key&1023)*16*1024;
+  }
+  if(host)page = (nds_mem_page_t){host-(uint8_t*)nds,mask,flags,cycles};
+  return page;
+}
+// Rebuilds the pages of the CPU that overlap [start,end)
+static void nds_update_mem_pages(nds_t* nds, int cpu, uint64_t start, uint64_t end){
+  if(end>NDS_MEM_PAGE_LIMIT)end = NDS_MEM_PAGE_LIMIT;
+  for(uint64_t addr=start&~((1<<NDS_MEM_PAGE_SHIFT)-1);addr<end;addr+=1<<NDS_MEM_PAGE_SHIFT){
+    nds->mem.pages[cpu][addr>>NDS_MEM_PAGE_SHIFT] = nds_compute_mem_page(nds,cpu,addr);
+  }
+}
+// Runs a CPU access from the page table, returns false when it needs the full decode
+static FORCE_INLINE bool nds_mem_page_transaction(nds_t * nds, int cpu, uint32_t addr, uint32_t data, int transaction_type){
+  if(SB_UNLIKELY(addr>=NDS_MEM_PAGE_LIMIT))return false;
+  nds_mem_page_t page = nds->mem.pages[cpu][addr>>NDS_MEM_PAGE_SHIFT];
+  bool write = transaction_type&NDS_MEM_WRITE;
+  int required = write? (transaction_type&NDS_MEM_1B? NDS_MEM_PAGE_WRITE8: NDS_MEM_PAGE_WRITE): NDS_MEM_PAGE_READ;
+  if(SB_UNLIKELY(!(page.flags&required)))return false;
+  int cycles = write? page.cycles>>4: page.cycles&0xf;
+  if(cycles)nds->mem.slow_bus_cycles+=(transaction_type&NDS_MEM_SEQ)?1:cycles;
+  uint8_t* memory = (uint8_t*)nds+page.offset;
+  addr&=page.mask;
+  nds->mem.openbus_word = nds_apply_mem_op(memory,addr,data,transaction_type);
+  if(page.flags&NDS_MEM_PAGE_CODE)nds_invalidate_code(nds,memory,addr,transaction_type);
+  return true;
+}
 static FORCE_INLINE uint32_t nds9_process_memory_transaction(nds_t * nds, uint32_t addr, uint32_t data, int transaction_type){
   uint32_t *ret = &nds->mem.openbus_word;
   switch(addr>>24){
@@ -2668,6 +2846,7 @@ static FORCE_INLINE uint32_t nds9_process_memory_transaction(nds_t * nds, uint32
       }*/
       addr&=4*1024*1024-1;
       *ret = nds_apply_mem_op(nds->mem.ram, addr, data, transaction_type); 
+      nds_invalidate_code(nds,nds->mem.ram,addr,transaction_type);
       break;
     case 0x3: //Shared WRAM 
       {
@@ -2679,6 +2858,7 @@ static FORCE_INLINE uint32_t nds9_process_memory_transaction(nds_t * nds, uint32
         if(cnt==3)break;
         addr=(addr&mask[cnt])+offset[cnt];
         *ret = nds_apply_mem_op(nds->mem.wram, addr, data, transaction_type); 
+        nds_invalidate_code(nds,nds->mem.wram,addr,transaction_type);
       }
       break;
     case 0x4: 
@@ -2704,6 +2884,7 @@ static FORCE_INLINE uint32_t nds9_process_memory_transaction(nds_t * nds, uint32
     case 0x6: //VRAM(NDS9) WRAM(NDS7)
       nds->mem.slow_bus_cycles+=(transaction_type&NDS_MEM_SEQ)?1:4;
       *ret = nds_apply_vram_mem_op(nds, addr, data, transaction_type); 
+      nds_update_mem_pages(nds,NDS_ARM9,addr,addr+1);
       break;
     case 0x7: 
       nds->mem.slow_bus_cycles+=(transaction_type&NDS_MEM_SEQ)?1:4;
@@ -2721,15 +2902,18 @@ static FORCE_INLINE uint32_t nds9_process_memory_transaction(nds_t * nds, uint32
 }
 static FORCE_INLINE uint32_t nds9_process_memory_transaction_cpu(nds_t * nds, uint32_t addr, uint32_t data, int transaction_type){
   uint32_t *ret = &nds->mem.openbus_word;
+  if(SB_LIKELY(nds_mem_page_transaction(nds,NDS_ARM9,addr,data,transaction_type)))return *ret;
   if(addr>=nds->mem.dtcm_start_address&&addr<nds->mem.dtcm_end_address){
     if(nds->mem.dtcm_enable&&(!nds->mem.dtcm_load_mode||(transaction_type&NDS_MEM_WRITE))){
       nds->mem.openbus_word = nds_apply_mem_op(nds->mem.data_tcm,(addr-nds->mem.dtcm_start_address)&(16*1024-1),data,transaction_type);
+      nds_invalidate_code(nds,nds->mem.data_tcm,(addr-nds->mem.dtcm_start_address)&(16*1024-1),transaction_type);
       return *ret; 
     }
   }
   if(addr>=nds->mem.itcm_start_address&&addr<nds->mem.itcm_end_address){
     if(nds->mem.itcm_enable&&(!nds->mem.itcm_load_mode||(transaction_type&NDS_MEM_WRITE))){
       nds->mem.openbus_word = nds_apply_mem_op(nds->mem.code_tcm,(addr-nds->mem.itcm_start_address)&(32*1024-1),data,transaction_type);
+      nds_invalidate_code(nds,nds->mem.code_tcm,(addr-nds->mem.itcm_start_address)&(32*1024-1),transaction_type);
       return *ret; 
     }
   }
@@ -2738,6 +2922,7 @@ static FORCE_INLINE uint32_t nds9_process_memory_transaction_cpu(nds_t * nds, ui
 
 static FORCE_INLINE uint32_t nds7_process_memory_transaction(nds_t * nds, uint32_t addr, uint32_t data, int transaction_type){
   uint32_t *ret = &nds->mem.openbus_word;
+  if(SB_LIKELY(nds_mem_page_transaction(nds,NDS_ARM7,addr,data,transaction_type)))return *ret;
   switch(addr>>24){
       case 0x0: //BIOS(NDS7), TCM(NDS9)
       if(addr<0x4000){
@@ -2750,6 +2935,7 @@ static FORCE_INLINE uint32_t nds7_process_memory_transaction(nds_t * nds, uint32
     case 0x2: //Main RAM
       addr&=4*1024*1024-1;
       *ret = nds_apply_mem_op(nds->mem.ram, addr, data, transaction_type); 
+      nds_invalidate_code(nds,nds->mem.ram,addr,transaction_type);
       break;
     case 0x3: //Shared WRAM 
       {
@@ -2762,6 +2948,7 @@ static FORCE_INLINE uint32_t nds7_process_memory_transaction(nds_t * nds, uint32
           else            addr=(addr&mask[cnt])+offset[cnt];
         }else addr= 32*1024+((addr-0x03800000)&(64*1024-1));
         *ret = nds_apply_mem_op(nds->mem.wram, addr, data, transaction_type); 
+        nds_invalidate_code(nds,nds->mem.wram,addr,transaction_type);
       }
       break;
     case 0x4: 
@@ -2808,6 +2995,7 @@ static FORCE_INLINE uint32_t nds7_process_memory_transaction(nds_t * nds, uint32
       break;
     case 0x6: //VRAM(NDS9) WRAM(NDS7)
       *ret = nds_apply_vram_mem_op(nds, addr, data, transaction_type); 
+      nds_update_mem_pages(nds,NDS_ARM7,addr,addr+1);
       break;
   }
   return *ret; 
@@ -2936,6 +3124,271 @@ void nds7_arm_write8(void* user_data, uint32_t address, uint8_t data){nds7_write
 uint32_t nds_coprocessor_read(void* user_data, int coproc,int opcode,int Cn, int Cm,int Cp);
 void nds_coprocessor_write(void* user_data, int coproc,int opcode,int Cn, int Cm,int Cp,uint32_t data);
 
+static bool nds7_arm_block_transfer(void* user_data, uint32_t address, uint32_t* data, int words, bool write);
+static bool nds9_arm_block_transfer(void* user_data, uint32_t address, uint32_t* data, int words, bool write);
+
+#if ARM7_STATIC_BUS
+// Handler tables with the buses above bound at compile time
+static const arm7_bus_t nds7_arm_bus={
+  .read32 = nds7_arm_read32, .read16 = nds7_arm_read16, .read32_seq = nds7_arm_read32_seq, .read16_seq = nds7_arm_read16_seq,
+  .read8 = nds7_arm_read8, .write32 = nds7_arm_write32, .write16 = nds7_arm_write16, .write8 = nds7_arm_write8,
+  .coprocessor_read = nds_coprocessor_read, .coprocessor_write = nds_coprocessor_write,
+  .block_transfer = nds7_arm_block_transfer,
+};
+static const arm7_bus_t nds9_arm_bus={
+  .read32 = nds9_arm_read32, .read16 = nds9_arm_read16, .read32_seq = nds9_arm_read32_seq, .read16_seq = nds9_arm_read16_seq,
+  .read8 = nds9_arm_read8, .write32 = nds9_arm_write32, .write16 = nds9_arm_write16, .write8 = nds9_arm_write8,
+  .coprocessor_read = nds_coprocessor_read, .coprocessor_write = nds_coprocessor_write,
+  .block_transfer = nds9_arm_block_transfer,
+};
+#define ARM7_BUS nds7_arm_bus
+#define ARM7_BUS_PREFIX(NAME) nds7_##NAME
+#define ARM7_BUS_ARM9 0
+#include "arm7_bus_handlers.h"
+#define ARM7_BUS nds9_arm_bus
+#define ARM7_BUS_PREFIX(NAME) nds9_##NAME
+#define ARM7_BUS_ARM9 1
+#include "arm7_bus_handlers.h"
+#endif
+
+// Code memory for the decoded block caches. Only RAM like regions are cached, BIOS fetches update
+// the BIOS latch and VRAM writes are not tracked.
+static FORCE_INLINE uint32_t nds_code_range_limit(uint32_t address, uint32_t bytes, uint32_t boundary){
+  if(address<boundary&&boundary-address<bytes)return boundary-address;
+  return bytes;
+}
+static const uint8_t* nds9_arm_code_ptr(void* user_data, uint32_t address, uint32_t* bytes_mapped){
+  nds_t* nds = (nds_t*)user_data;
+  if(address>=nds->mem.dtcm_start_address&&address<nds->mem.dtcm_end_address){
+    if(nds->mem.dtcm_enable&&!nds->mem.dtcm_load_mode){
+      uint32_t offset = (address-nds->mem.dtcm_start_address)&(16*1024-1);
+      *bytes_mapped = nds_code_range_limit(address,16*1024-offset,nds->mem.dtcm_end_address);
+      return nds->mem.data_tcm+offset;
+    }
+  }
+  if(address>=nds->mem.itcm_start_address&&address<nds->mem.itcm_end_address){
+    if(nds->mem.itcm_enable&&!nds->mem.itcm_load_mode){
+      uint32_t offset = (address-nds->mem.itcm_start_address)&(32*1024-1);
+      *bytes_mapped = nds_code_range_limit(address,32*1024-offset,nds->mem.itcm_end_address);
+      return nds->mem.code_tcm+offset;
+    }
+  }
+  // Don't let the range run into a TCM
+  uint32_t limit = 0x1000000-(address&0xffffff);
+  limit = nds_code_range_limit(address,limit,nds->mem.dtcm_start_address);
+  limit = nds_code_range_limit(address,limit,nds->mem.itcm_start_address);
+  *bytes_mapped = limit;
+  switch(address>>24){
+    case 0x2:{
+      uint32_t offset = address&(4*1024*1024-1);
+      uint32_t avail = 4*1024*1024-offset;
+      *bytes_mapped = avail<limit? avail: limit;
+      return nds->mem.ram+offset;
+    }
+    case 0x3:{
+      uint8_t cnt = nds9_io_read8(nds,NDS9_WRAMCNT)&0x3;
+      const int offset[4]={0,16*1024,0,0};
+      const int mask[4]={32*1024-1,16*1024-1,16*1024-1,0};
+      if(cnt==3)return NULL;
+      uint32_t avail = mask[cnt]+1-(address&mask[cnt]);
+      *bytes_mapped = avail<limit? avail: limit;
+      return nds->mem.wram+(address&mask[cnt])+offset[cnt];
+    }
+  }
+  return NULL;
+}
+static const uint8_t* nds7_arm_code_ptr(void* user_data, uint32_t address, uint32_t* bytes_mapped){
+  nds_t* nds = (nds_t*)user_data;
+  switch(address>>24){
+    case 0x2:{
+      uint32_t offset = address&(4*1024*1024-1);
+      *bytes_mapped = 4*1024*1024-offset;
+      return nds->mem.ram+offset;
+    }
+    case 0x3:{
+      uint8_t cnt = nds9_io_read8(nds,NDS9_WRAMCNT)&0x3;
+      if(address<=0x037FFFFF){
+        const int offset[4]={0,0,16*1024,0};
+        const int mask[4]={0,16*1024-1,16*1024-1,32*1024-1};
+        if(mask[cnt]){
+          *bytes_mapped = mask[cnt]+1-(address&mask[cnt]);
+          return nds->mem.wram+(address&mask[cnt])+offset[cnt];
+        }
+      }
+      uint32_t offset = address&(64*1024-1);
+      *bytes_mapped = 64*1024-offset;
+      return nds->mem.wram+32*1024+offset;
+    }
+  }
+  *bytes_mapped = 0x1000000-(address&0xffffff);
+  return NULL;
+}
+// Idle loops that need a hint for each CPU, keyed by the cartridge game code. head marks a loop as
+// idle even if its body has ops the detection doesn't allow (its registers still have to repeat), and
+// disabled turns skipping off for games that poll something the detection can't see.
+// Entries look like {"ABCE", 0x02000800, false}.
+static const arm7_idle_loop_override_t nds7_idle_loop_overrides[]={
+  {"",0,false},
+};
+static const arm7_idle_loop_override_t nds9_idle_loop_overrides[]={
+  {"",0,false},
+};
+// Memory an idle loop may poll. Main RAM, WRAM, VRAM and the IPC registers are also written by the
+// other CPU, so a loop is only treated as idle while the other CPU is halted or idle too.
+static bool nds_idle_loop_io_read_ok(uint32_t address, int size){
+  return (address>=GBA_DISPSTAT&&address+size<=GBA_DISPSTAT+4)||
+         (address>=GBA_KEYINPUT&&address+size<=GBA_KEYCNT+2)||
+         (address>=NDS_IPCSYNC&&address+size<=NDS_IPCFIFOCNT+4)||
+         (address>=NDS9_IME&&address+size<=NDS9_IME+4)||
+         (address>=NDS9_IE&&address+size<=NDS9_IF+4);
+}
+static bool nds9_idle_loop_read_ok(void* user_data, uint32_t address, int size){
+  nds_t* nds = (nds_t*)user_data;
+  if(address>=nds->mem.dtcm_start_address&&address<nds->mem.dtcm_end_address&&nds->mem.dtcm_enable)return true;
+  if(address>=nds->mem.itcm_start_address&&address<nds->mem.itcm_end_address&&nds->mem.itcm_enable)return true;
+  switch(address>>24){
+    case 0x2: case 0x3: case 0x5: case 0x6: case 0x7: return true;
+    case 0x4: return nds_idle_loop_io_read_ok(address,size);
+  }
+  return false;
+}
+static bool nds7_idle_loop_read_ok(void* user_data, uint32_t address, int size){
+  switch(address>>24){
+    case 0x2: case 0x3: case 0x6: return true;
+    case 0x4: return nds_idle_loop_io_read_ok(address,size)||(address>=NDS7_EXTKEYIN&&address+size<=NDS7_EXTKEYIN+2);
+  }
+  return false;
+}
+// Mirrors the side effects of a code fetch through nds9_process_memory_transaction_cpu
+static void nds9_arm_cached_fetch(void* user_data, uint32_t address, const uint8_t* host, bool thumb, bool seq){
+  nds_t* nds = (nds_t*)user_data;
+  if(host>=nds->mem.wram&&host<nds->mem.wram+sizeof(nds->mem.wram))nds->mem.slow_bus_cycles+=seq?1:4;
+  nds->mem.openbus_word = thumb? *(uint16_t*)host: *(uint32_t*)host;
+}
+static void nds7_arm_cached_fetch(void* user_data, uint32_t address, const uint8_t* host, bool thumb, bool seq){
+  nds_t* nds = (nds_t*)user_data;
+  nds->mem.openbus_word = thumb? *(uint16_t*)host: *(uint32_t*)host;
+}
+// Plain memory for the BIOS HLE (arm7_hle_mem_t), the main RAM, WRAM and TCMs the code fetches map.
+// VRAM goes through the bank mapping and is left to the BIOS.
+static uint8_t* nds_hle_write_ptr(nds_t* nds, const uint8_t* host, uint32_t bytes_mapped, uint32_t bytes){
+  if(!host||bytes_mapped<bytes)return NULL;
+  arm7_block_cache_invalidate_range(nds->arm7.block_cache,host,bytes);
+  arm7_block_cache_invalidate_range(nds->arm9.block_cache,host,bytes);
+  return (uint8_t*)host;
+}
+static uint8_t* nds9_hle_write_ptr(void* user_data, uint32_t address, uint32_t bytes, int width){
+  nds_t* nds = (nds_t*)user_data;
+  // Writes to a TCM in load mode go to the TCM while reads see the memory behind it
+  if(address>=nds->mem.dtcm_start_address&&address<nds->mem.dtcm_end_address&&nds->mem.dtcm_enable&&nds->mem.dtcm_load_mode)return NULL;
+  if(address>=nds->mem.itcm_start_address&&address<nds->mem.itcm_end_address&&nds->mem.itcm_enable&&nds->mem.itcm_load_mode)return NULL;
+  uint32_t mapped = 0;
+  const uint8_t* host = nds9_arm_code_ptr(nds,address,&mapped);
+  return nds_hle_write_ptr(nds,host,mapped,bytes);
+}
+static uint8_t* nds7_hle_write_ptr(void* user_data, uint32_t address, uint32_t bytes, int width){
+  uint32_t mapped = 0;
+  const uint8_t* host = nds7_arm_code_ptr(user_data,address,&mapped);
+  return nds_hle_write_ptr((nds_t*)user_data,host,mapped,bytes);
+}
+// LDM/STM in one go (arm_block_transfer_fn_t) when the page table of the CPU maps every word. The
+// first word is charged like a nonsequential access and the rest like nds_mem_page_transaction
+// charges sequential reads, writes are never sequential.
+static FORCE_INLINE bool nds_arm_block_transfer(nds_t* nds, int cpu, uint32_t address, uint32_t* data, int words, bool write){
+  if(address>=NDS_MEM_PAGE_LIMIT)return false;
+  nds_mem_page_t page = nds->mem.pages[cpu][address>>NDS_MEM_PAGE_SHIFT];
+  uint32_t bytes = words*4;
+  if(!(page.flags&(write? NDS_MEM_PAGE_WRITE: NDS_MEM_PAGE_READ)))return false;
+  if((address&page.mask)+bytes>(uint32_t)page.mask+1)return false;
+  uint8_t* host = (uint8_t*)nds+page.offset+(address&page.mask);
+  int cycles = write? page.cycles>>4: page.cycles&0xf;
+  if(cycles)nds->mem.slow_bus_cycles+=write? cycles*words: cycles+words-1;
+  if(write){
+    memcpy(host,data,bytes);
+    if(page.flags&NDS_MEM_PAGE_CODE){
+      arm7_block_cache_invalidate_range(nds->arm7.block_cache,host,bytes);
+      arm7_block_cache_invalidate_range(nds->arm9.block_cache,host,bytes);
+    }
+  }else memcpy(data,host,bytes);
+  nds->mem.openbus_word = data[words-1];
+  return true;
+}
+static bool nds9_arm_block_transfer(void* user_data, uint32_t address, uint32_t* data, int words, bool write){
+  return nds_arm_block_transfer((nds_t*)user_data,NDS_ARM9,address,data,words,write);
+}
+static bool nds7_arm_block_transfer(void* user_data, uint32_t address, uint32_t* data, int words, bool write){
+  return nds_arm_block_transfer((nds_t*)user_data,NDS_ARM7,address,data,words,write);
+}
+// Stores of compiled ARM9 code to NDS_MEM_PAGE_CODE pages (arm7_jit_code_write_fn_t), same as nds_invalidate_code
+static void nds_jit_code_write(void* user_data, const uint8_t* host){
+  nds_t* nds = (nds_t*)user_data;
+  arm7_block_cache_invalidate(nds->arm7.block_cache,host);
+  arm7_block_cache_invalidate(nds->arm9.block_cache,host);
+}
+// Runs the SWIs arm7_bios_hle.h implements natively (arm7_hle_run_fn_t). The Vram and Huffman
+// decompressors of the NDS read their input through callbacks into the game and always run in the BIOS.
+static bool nds_bios_hle_run(arm7_t* cpu, const arm7_hle_mem_t* mem, uint32_t function, uint32_t* outputs){
+  switch(function){
+    case 0x09: *outputs = ARM7_HLE_DIV_OUTPUTS; return arm7_hle_div(cpu,false);
+    case 0x0B: return arm7_hle_cpu_set(cpu,mem);
+    // The NDS BIOS only copies whole blocks of 8 words
+    case 0x0C: return !(cpu->registers[2]&7)&&arm7_hle_cpu_fast_set(cpu,mem);
+    case 0x0D: *outputs = ARM7_HLE_R0_OUTPUT; return arm7_hle_sqrt(cpu);
+    case 0x0E: *outputs = ARM7_HLE_R0_OUTPUT; return arm7_hle_crc16(cpu,mem);
+    case 0x11: return arm7_hle_lz77(cpu,mem,false);
+    case 0x14: return arm7_hle_rl(cpu,mem,false);
+  }
+  return false;
+}
+// IntrWait/VBlankIntrWait like the BIOS: discard the flags to wait for from the check word the
+// interrupt handler sets (at the end of the DTCM/ARM7 WRAM) if asked to, then halt and check for them
+// after every interrupt. The PC is left on the SWI so it reruns when the interrupt returns, the rerun
+// is told apart from a new call by its SP and address.
+static bool nds_hle_intr_wait(nds_t* nds, int cpu_id, bool discard, uint32_t flags){
+  arm7_t* cpu = cpu_id? &nds->arm9: &nds->arm7;
+  uint32_t check_address = cpu_id? nds->mem.dtcm_start_address+0x3FF8: 0x0380FFF8;
+  uint32_t sp = cpu->registers[13];
+  uint32_t pc = cpu->registers[PC]-(arm7_get_thumb_bit(cpu)? 2: 4);
+  nds_hle_intr_wait_t* waits = nds->hle_intr_wait[cpu_id];
+  nds_hle_intr_wait_t* wait = NULL;
+  for(int i=0;i<NDS_HLE_INTR_WAITS&&!wait;++i){
+    if(waits[i].active&&waits[i].sp==sp&&waits[i].pc==pc)wait = &waits[i];
+  }
+  bool resumed = wait!=NULL;
+  uint32_t check = 0;
+  if(resumed||discard){
+    check = cpu->read32(cpu->user_data,check_address);
+    cpu->write32(cpu->user_data,check_address,check&~flags);
+  }
+  cpu->write32(cpu->user_data,cpu_id? NDS9_IME: NDS7_IME,1);
+  if(resumed&&(check&flags)){
+    wait->active=false;
+    return true;
+  }
+  if(!resumed){
+    memmove(waits+1,waits,sizeof(*waits)*(NDS_HLE_INTR_WAITS-1));
+    waits[0] = (nds_hle_intr_wait_t){sp,pc,true};
+  }
+  cpu->wait_for_interrupt=true;
+  cpu->registers[PC]=pc;
+  return true;
+}
+static bool nds_bios_hle(nds_t* nds, int cpu_id, uint32_t function){
+  arm7_t* cpu = cpu_id? &nds->arm9: &nds->arm7;
+  arm7_hle_mem_t mem = {nds, cpu_id? nds9_arm_code_ptr: nds7_arm_code_ptr, cpu_id? nds9_hle_write_ptr: nds7_hle_write_ptr};
+  // Verification leaves everything to the BIOS, including the waits
+  if(nds->hle_verify)return arm7_hle_verify_begin(&nds->hle_verify[cpu_id],cpu,&mem,function,nds_bios_hle_run);
+  switch(function){
+    case 0x04: return nds_hle_intr_wait(nds,cpu_id,cpu->registers[0]!=0,cpu->registers[1]);
+    case 0x05: return nds_hle_intr_wait(nds,cpu_id,true,1);
+    case 0x06: cpu->wait_for_interrupt=true; return true;
+  }
+  uint32_t outputs = 0;
+  return nds_bios_hle_run(cpu,&mem,function,&outputs);
+}
+static bool nds7_bios_hle(void* user_data, uint32_t function){return nds_bios_hle((nds_t*)user_data,0,function);}
+static bool nds9_bios_hle(void* user_data, uint32_t function){return nds_bios_hle((nds_t*)user_data,1,function);}
+
 
 static FORCE_INLINE uint32_t nds_compute_access_cycles_dma(nds_t *nds, uint32_t address,int request_size/*0: 1B,1: 2B,3: 4B*/){
   return 1;
@@ -2982,6 +3435,8 @@ static void nds_update_vram_mapping(nds_t*nds){
     nds->mem.curr_vram_translation_key|= bank_key<<(b*6+10);
   }
   nds->mem.curr_vram_translation_key|=(1ull)<<63;
+  nds_update_mem_pages(nds,NDS_ARM7,0x06000000,0x07000000);
+  nds_update_mem_pages(nds,NDS_ARM9,0x06000000,0x07000000);
 }
 bool nds_load_rom(sb_emu_state_t*emu,nds_t* nds,nds_scratch_t*scratch){
   if(!sb_path_has_file_ext(emu->rom_path, ".nds"))return false; 
@@ -3003,6 +3458,8 @@ bool nds_load_rom(sb_emu_state_t*emu,nds_t* nds,nds_scratch_t*scratch){
   nds->mem.card_data=emu->rom_data;
   nds->mem.card_size=emu->rom_size;
   nds->mem.save_data = scratch->save_data;
+  memset(&scratch->arm7_block_cache,0,sizeof(scratch->arm7_block_cache));
+  memset(&scratch->arm9_block_cache,0,sizeof(scratch->arm9_block_cache));
 
   memcpy(&nds->card,emu->rom_data,sizeof(nds_card_t));
   nds->card.title[11]=0;
@@ -3048,6 +3505,8 @@ bool nds_load_rom(sb_emu_state_t*emu,nds_t* nds,nds_scratch_t*scratch){
     };
     for(int i=0;i<37;++i)nds->arm7.registers[i]=initial_regs[i];
     for(int i=0;i<37;++i)nds->arm9.registers[i]=initial_regs_arm9[i];
+    arm7_update_bank(&nds->arm7);
+    arm7_update_bank(&nds->arm9);
     const uint32_t initial_mmio_writes[]={
       0x4000000,0x80,
       0x4000004,0x7e0000,
@@ -3296,6 +3755,8 @@ bool nds_load_rom(sb_emu_state_t*emu,nds_t* nds,nds_scratch_t*scratch){
     nds->backup.backup_type = NDS_BACKUP_EEPROM_128KB;
   } 
   printf("NDS Save Type: %d\n",nds->backup.backup_type);
+  arm7_idle_loop_apply_override(&nds->idle_loop[0],nds7_idle_loop_overrides,sizeof(nds7_idle_loop_overrides)/sizeof(nds7_idle_loop_overrides[0]),nds->card.gamecode);
+  arm7_idle_loop_apply_override(&nds->idle_loop[1],nds9_idle_loop_overrides,sizeof(nds9_idle_loop_overrides)/sizeof(nds9_idle_loop_overrides[0]),nds->card.gamecode);
 
   size_t bytes=0;
   uint8_t*data = sb_load_file_data(emu->save_file_path,&bytes);
@@ -3309,6 +3770,8 @@ bool nds_load_rom(sb_emu_state_t*emu,nds_t* nds,nds_scratch_t*scratch){
     for(int i=0;i<sizeof(nds->mem.save_data);++i) nds->mem.save_data[i]=0;
   }
   nds_update_vram_mapping(nds);
+  nds_update_mem_pages(nds,NDS_ARM7,0,NDS_MEM_PAGE_LIMIT);
+  nds_update_mem_pages(nds,NDS_ARM9,0,NDS_MEM_PAGE_LIMIT);
 
   //nds->gx_log = fopen("gxlog.txt","wb");
   //nds->io7_log = fopen("io7log.txt","wb");
@@ -3322,6 +3785,10 @@ bool nds_load_rom(sb_emu_state_t*emu,nds_t* nds,nds_scratch_t*scratch){
 static void nds_unload(nds_t* nds, nds_scratch_t* scratch){
   if(nds->arm7.log_cmp_file){fclose(nds->arm7.log_cmp_file);nds->arm7.log_cmp_file=NULL;};
   if(nds->arm9.log_cmp_file){fclose(nds->arm9.log_cmp_file);nds->arm9.log_cmp_file=NULL;};
+  arm7_jit_free(&scratch->arm9_jit);
+#if NDS_THREADED_PPU
+  nds_ppu_worker_stop(&scratch->ppu_worker);
+#endif
   printf("Unloading DS data\n");
 }
 uint32_t nds_sqrt_u64(uint64_t value){
@@ -5152,7 +5619,22 @@ static void nds_postprocess_mmio_write(nds_t * nds, uint32_t baddr, uint32_t dat
   if(addr>=0x4000400&& addr<0x4000440 &&cpu==NDS_ARM9){
       nds_gpu_write_packed_cmd(nds,mmio);
   } 
-  if(addr>=NDS9_VRAMCNT_A&&addr<=NDS9_VRAMCNT_I)nds_update_vram_mapping(nds);
+  if(addr>=NDS9_VRAMCNT_A&&addr<=NDS9_VRAMCNT_I){
+    nds_update_vram_mapping(nds);
+    // WRAMCNT shares these words and remaps the shared WRAM. The ARM7's first two pages of it differ
+    // for every WRAMCNT setting, so they tell if the mapping changed.
+    const uint32_t wram_page = 0x03000000>>NDS_MEM_PAGE_SHIFT;
+    nds_mem_page_t old_pages[2] = {nds->mem.pages[NDS_ARM7][wram_page],nds->mem.pages[NDS_ARM7][wram_page+1]};
+    nds_update_mem_pages(nds,NDS_ARM7,0x03000000,0x04000000);
+    nds_update_mem_pages(nds,NDS_ARM9,0x03000000,0x04000000);
+    // VRAM is never cached as code, only blocks decoded from the remapped WRAM have to go
+    if(memcmp(old_pages,&nds->mem.pages[NDS_ARM7][wram_page],sizeof(old_pages))){
+      arm7_block_cache_invalidate_range(nds->arm7.block_cache,nds->mem.wram,sizeof(nds->mem.wram));
+      arm7_block_cache_invalidate_range(nds->arm9.block_cache,nds->mem.wram,32*1024);
+      arm7_code_window_flush(&nds->arm7);
+      arm7_code_window_flush(&nds->arm9);
+    }
+  }
   switch(addr){
 
     case NDS7_HALTCNT&~3:
@@ -5335,6 +5817,680 @@ static FORCE_INLINE int nds_ppu_compute_max_fast_forward(nds_t *nds){
   if(not_visible&& (scanline_clock>=1 && scanline_clock<=NDS_LCD_W*NDS_CLOCKS_PER_DOT))return NDS_LCD_W*NDS_CLOCKS_PER_DOT-scanline_clock-1; 
   return (NDS_CLOCKS_PER_DOT-1)-((nds->ppu[0].scan_clock)%NDS_CLOCKS_PER_DOT);
 }
+// Draws what engine ppu_id shows at lcd_x (the whole line with NDS_SCANLINE_PPU) and captures it. Only
+// the state of the engine, its framebuffer and the capture bank are written, so the two engines can be
+// drawn at the same time.
+static void nds_ppu_render_engine(nds_t* nds, int ppu_id, int lcd_x, int lcd_y, uint32_t dispcapcnt){
+  nds_ppu_t * ppu = nds->ppu+ppu_id;
+  int reg_offset = ppu_id==0? 0: 0x00001000;
+  uint32_t dispcnt = nds9_io_read32(nds, GBA_DISPCNT+reg_offset);
+  int display_mode = SB_BFE(dispcnt,16,2);
+  bool enable_capture = SB_BFE(dispcapcnt,31,1)&&ppu_id==0;
+  bool enable_3d = ppu_id==0&&SB_BFE(dispcnt,3,1);
+  int bg_mode = SB_BFE(dispcnt,0,3);
+  bool visible = lcd_x<NDS_LCD_W && lcd_y<NDS_LCD_H;
+  //Render sprites over scanline when it completes
+  if(lcd_y<NDS_LCD_H && lcd_x == 0){
+    int obj_vram_map_2d = !SB_BFE(dispcnt,6,1);
+    //Render sprites over scanline when it completes
+    uint8_t default_window_control =0x3f;//bitfield [0-3:bg0-bg3 enable 4:obj enable, 5: special effect enable]
+    bool winout_enable = SB_BFE(dispcnt,13,3)!=0;
+    uint16_t WINOUT = nds9_io_read16(nds, GBA_WINOUT+reg_offset);
+    if(winout_enable)default_window_control = SB_BFE(WINOUT,0,8);
+
+    memset(ppu->window,default_window_control,NDS_LCD_W);
+
+    bool display_obj = SB_BFE(dispcnt,12,1);
+    if(display_obj){
+      uint8_t obj_window_control = default_window_control;
+      bool obj_window_enable = SB_BFE(dispcnt,15,1);
+      if(obj_window_enable)obj_window_control = SB_BFE(WINOUT,8,6);
+      int oam_offset = ppu_id*1024;
+      int obj_vram_base = ppu_id ==0? 0x06400000: 0x06600000;
+      for(int o=0;o<128;++o){
+        uint16_t attr0 = *(uint16_t*)(nds->mem.oam+o*8+0+oam_offset);
+        //Attr0
+        uint8_t y_coord = SB_BFE(attr0,0,8);
+        bool rot_scale =  SB_BFE(attr0,8,1);
+        bool double_size = SB_BFE(attr0,9,1)&&rot_scale;
+        bool obj_disable = SB_BFE(attr0,9,1)&&!rot_scale;
+        if(obj_disable) continue; 
+
+        int obj_mode = SB_BFE(attr0,10,2); //(0=Normal, 1=Semi-Transparent, 2=OBJ Window, 3=bitmap)
+        bool mosaic  = SB_BFE(attr0,12,1);
+        bool colors_or_palettes = SB_BFE(attr0,13,1);
+        int obj_shape = SB_BFE(attr0,14,2);//(0=Square,1=Horizontal,2=Vertical,3=Prohibited)
+        uint16_t attr1 = *(uint16_t*)(nds->mem.oam+o*8+2+oam_offset);
+
+        int rotscale_param = SB_BFE(attr1,9,5);
+        bool h_flip = SB_BFE(attr1,12,1)&&!rot_scale;
+        bool v_flip = SB_BFE(attr1,13,1)&&!rot_scale;
+        int obj_size = SB_BFE(attr1,14,2);
+        // Size  Square   Horizontal  Vertical
+        // 0     8x8      16x8        8x16
+        // 1     16x16    32x8        8x32
+        // 2     32x32    32x16       16x32
+        // 3     64x64    64x32       32x64
+        const int xsize_lookup[16]={
+          8,16,8,0,
+          16,32,8,0,
+          32,32,16,0,
+          64,64,32,0
+        };
+        const int ysize_lookup[16]={
+          8,8,16,0,
+          16,8,32,0,
+          32,16,32,0,
+          64,32,64,0
+        }; 
+
+        int y_size = ysize_lookup[obj_size*4+obj_shape];
+
+        if(((lcd_y-y_coord)&0xff) <y_size*(double_size?2:1)){
+
+          int16_t x_coord = SB_BFE(attr1,0,9);
+          if (SB_BFE(x_coord,8,1))x_coord|=0xfe00;
+
+          int x_size = xsize_lookup[obj_size*4+obj_shape];
+          int x_start = x_coord>=0?x_coord:0;
+          int x_end   = x_coord+x_size*(double_size?2:1);
+          if(x_end>=NDS_LCD_W)x_end=NDS_LCD_W;
+          //Attr2
+          //Skip objects disabled by window
+          uint16_t attr2 = *(uint16_t*)(nds->mem.oam+o*8+4 +oam_offset);
+          int tile_base = SB_BFE(attr2,0,10);
+          // Always place sprites as the highest priority
+          int priority = SB_BFE(attr2,10,2);
+          int palette = SB_BFE(attr2,12,4);
+          for(int x = x_start; x< x_end;++x){
+            int sx = (x-x_coord);
+            int sy = (lcd_y-y_coord)&0xff;
+            if(mosaic){
+              uint16_t mos_reg = nds9_io_read16(nds,GBA_MOSAIC+reg_offset);
+              int mos_x = SB_BFE(mos_reg,8,4)+1;
+              int mos_y = SB_BFE(mos_reg,12,4)+1;
+              sx = ((x/mos_x)*mos_x-x_coord);
+              sy = (((lcd_y/mos_y)*mos_y-y_coord)&0xff);
+            }
+            if(rot_scale){
+              uint32_t param_base = rotscale_param*0x20+oam_offset; 
+              int32_t a = *(int16_t*)(nds->mem.oam+param_base+0x6);
+              int32_t b = *(int16_t*)(nds->mem.oam+param_base+0xe);
+              int32_t c = *(int16_t*)(nds->mem.oam+param_base+0x16);
+              int32_t d = *(int16_t*)(nds->mem.oam+param_base+0x1e);
+
+              int64_t x1 = sx<<8;
+              int64_t y1 = sy<<8;
+              int64_t objref_x = (x_size<<(double_size?8:7));
+              int64_t objref_y = (y_size<<(double_size?8:7));
+            
+              int64_t x2 = a*(x1-objref_x) + b*(y1-objref_y)+(x_size<<15);
+              int64_t y2 = c*(x1-objref_x) + d*(y1-objref_y)+(y_size<<15);
+
+              sx = (x2>>16);
+              sy = (y2>>16);
+              if(sx>=x_size||sy>=y_size||sx<0||sy<0)continue;
+            }else{
+              if(h_flip)sx=x_size-sx-1;
+              if(v_flip)sy=y_size-sy-1;
+            }
+            uint32_t col =0;
+            if(obj_mode==3){
+
+              bool linear = SB_BFE(dispcnt,6,1);
+              //TODO: Bitmap sprites
+              if(linear){
+                int boundry = SB_BFE(dispcnt,22,1);
+                tile_base *= boundry? 256: 128;
+                int p = sx+sy*x_size;
+                col = nds_ppu_read16(nds,obj_vram_base+tile_base+p*2);
+              }else{
+                bool size = SB_BFE(dispcnt,5,1);
+                int p = 0;             
+                if(size){
+                  int tile_x=SB_BFE(tile_base,0,5);
+                  int tile_y=SB_BFE(tile_base,5,5);
+                  p = (tile_x*8+sx)+(tile_y*8+sy)*32*8;
+                }else{
+                  int tile_x=SB_BFE(tile_base,0,4);
+                  int tile_y=SB_BFE(tile_base,4,6);
+                  p = (tile_x*8+sx)+(tile_y*8+sy)*16*8;
+                }
+                col = nds_ppu_read16(nds,obj_vram_base+p*2);
+                if(!SB_BFE(col,15,1))continue;
+              }
+            }else{
+              int tx = sx%8;
+              int ty = sy%8;
+              bool tile_obj_mapping = SB_BFE(dispcnt,4,1);
+                      
+              int y_tile_stride = obj_vram_map_2d? 32 : x_size/8*(colors_or_palettes? 2:1);
+
+              int tile_boundry = 32;
+              if(tile_obj_mapping ==true){
+                int tile_obj_1d_boundry = SB_BFE(dispcnt,20,2);
+                tile_boundry = 32<<tile_obj_1d_boundry;
+                y_tile_stride=x_size/8*(colors_or_palettes? 2:1);
+              }
+              int tile = tile_base*tile_boundry/32 + (((sx/8))*(colors_or_palettes? 2:1)+(sy/8)*y_tile_stride);
+              //tile*=tile_boundry/32;
+              uint16_t palette_id;
+              bool use_obj_ext_palettes = SB_BFE(dispcnt,31,1);
+              if(colors_or_palettes==false){
+                palette_id= nds_ppu_read8(nds,obj_vram_base+tile*32+tx/2+ty*4);
+                palette_id= (palette_id>>((tx&1)*4))&0xf;
+                if(palette_id==0)continue;
+                palette_id+=palette*16;
+                use_obj_ext_palettes=false; //Not supported in 16 color mode
+              }else{
+                palette_id=nds_ppu_read8(nds,obj_vram_base+tile*32+tx+ty*8);
+                if(palette_id==0)continue;
+              }
+              if(use_obj_ext_palettes){
+                palette_id=(palette)*256+palette_id;
+                uint32_t read_addr = (ppu_id?NDS_VRAM_OBJB_SLOT0:NDS_VRAM_OBJA_SLOT0)+palette_id*2;
+                col = nds_ppu_read16(nds, read_addr);
+              }else{
+                uint32_t pallete_offset = ppu_id?0x600:0x200; 
+                col = *(uint16_t*)(nds->mem.palette+pallete_offset+palette_id*2);
+              }
+            }
+
+            //Handle window objects(not displayed but control the windowing of other things)
+            if(obj_mode==2){ppu->window[x]=obj_window_control; 
+            }else{
+              int type =4;
+              col=col|(type<<17)|((5-priority)<<28)|((0x7)<<25);
+              if(obj_mode==1)col|=1<<16;
+              if((col>>17)>(ppu->first_target_buffer[x]>>17))ppu->first_target_buffer[x]=col;
+            }  
+          }
+        }
+      }
+    }
+    int enabled_windows = SB_BFE(dispcnt,13,3); // [0: win0, 1:win1, 2: objwin]
+    if(enabled_windows){
+      for(int win=1;win>=0;--win){
+        bool win_enable = SB_BFE(dispcnt,13+win,1);
+        if(!win_enable)continue;
+        uint16_t WINH = nds9_io_read16(nds, GBA_WIN0H+2*win+reg_offset);
+        uint16_t WINV = nds9_io_read16(nds, GBA_WIN0V+2*win+reg_offset);
+        int win_xmin = SB_BFE(WINH,8,8);
+        int win_xmax = SB_BFE(WINH,0,8);
+        int win_ymin = SB_BFE(WINV,8,8);
+        int win_ymax = SB_BFE(WINV,0,8);
+        // Garbage values of X2>240 or X1>X2 are interpreted as X2=240.
+        // Garbage values of Y2>160 or Y1>Y2 are interpreted as Y2=160. 
+        if(win_xmin>win_xmax)win_xmax=NDS_LCD_W;
+        if(win_ymin>win_ymax)win_ymax=NDS_LCD_H+1;
+        if(win_xmax>NDS_LCD_W)win_xmax=NDS_LCD_W;
+        if(lcd_y<win_ymin||lcd_y>=win_ymax)continue;
+        uint16_t winin = nds9_io_read16(nds,GBA_WININ+reg_offset);
+        uint8_t win_value = SB_BFE(winin,win*8,6);
+        memset(ppu->window+win_xmin,win_value,win_xmax-win_xmin);
+      }
+      int backdrop_type = 5;
+      uint32_t backdrop_col = (*(uint16_t*)(nds->mem.palette + GBA_BG_PALETTE+0*2+ppu_id*1024))|(backdrop_type<<17);
+      for(int x=0;x<NDS_LCD_W;++x){
+        uint8_t window_control = ppu->window[x];
+        if(SB_BFE(window_control,4,1)==0)ppu->first_target_buffer[x]=backdrop_col;
+      }
+    }
+  }
+  if(visible){
+    #if NDS_SCANLINE_PPU == 1
+    if(lcd_x==0){while(lcd_x<NDS_LCD_W){
+    #endif
+    uint8_t window_control =ppu->window[lcd_x];
+    bool render_backgrounds = true; //TODO hook up power management
+    if(render_backgrounds){
+      for(int bg = 3; bg>=0;--bg){
+        #define NDS_BG_TEXT 0
+        #define NDS_BG_AFFINE 1
+        #define NDS_BG_BITMAP 2
+        #define NDS_BG_LARGE_BITMAP 3
+        #define NDS_BG_INVALID 4
+
+        const int bg_mode_table[8*4]={
+          /* mode 0: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_TEXT,
+          /* mode 1: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_AFFINE,
+          /* mode 2: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_AFFINE,NDS_BG_AFFINE,
+          /* mode 3: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_BITMAP,
+          /* mode 4: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_AFFINE,NDS_BG_BITMAP,
+          /* mode 5: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_BITMAP,NDS_BG_BITMAP,
+          /* mode 6: */NDS_BG_TEXT,NDS_BG_INVALID,NDS_BG_LARGE_BITMAP,NDS_BG_INVALID,
+          /* mode 7: */NDS_BG_INVALID,NDS_BG_INVALID,NDS_BG_INVALID,NDS_BG_INVALID,
+        };
+        const int bg_size_table[4*4*2]={
+          /* TEXT: */        
+          256,256,
+          512,256,
+          256,512,
+          512,512,
+          /* AFFINE: */ 
+          128,128,
+          256,256,
+          512,512,
+          1024,1024,
+          /* BITMAP: */ 
+          128,128,
+          256,256,
+          512,256,
+          512,512,
+          /* LARGE BITMAP: */
+          512,1024,
+          1024,512,
+          0,0, //INVALID
+          0,0, //INVALID
+        };
+        int bg_type = bg_mode_table[bg_mode*4+bg];
+        uint32_t col =0;         
+        bool bg_en = SB_BFE(dispcnt,8+bg,1)&&SB_BFE(ppu->dispcnt_pipeline[0],8+bg,1)&&bg_type!=NDS_BG_INVALID;
+        if(!bg_en || SB_BFE(window_control,bg,1)==0)continue;
+
+        bool rot_scale = bg_type!=NDS_BG_TEXT;
+        uint16_t bgcnt = nds9_io_read16(nds, GBA_BG0CNT+bg*2+reg_offset);
+        int priority = SB_BFE(bgcnt,0,2);
+        int character_base = SB_BFE(bgcnt,2,4);
+        bool mosaic = SB_BFE(bgcnt,6,1);
+        bool colors = SB_BFE(bgcnt,7,1);
+        int screen_base = SB_BFE(bgcnt,8,5);
+        bool display_overflow =SB_BFE(bgcnt,13,1);
+        int screen_size = SB_BFE(bgcnt,14,2); 
+
+        if(SB_UNLIKELY(enable_3d&&bg==0)){
+          int p = lcd_x+lcd_y*NDS_LCD_W;
+          col  = SB_BFE(nds->framebuffer_3d_disp[p*4+0],3,5);
+          col |= SB_BFE(nds->framebuffer_3d_disp[p*4+1],3,5)<<5;
+          col |= SB_BFE(nds->framebuffer_3d_disp[p*4+2],3,5)<<10;
+          if(SB_BFE(nds->framebuffer_3d_disp[p*4+3],3,5)==0)continue;
+        }else{
+          bool bitmap_mode = SB_BFE(bgcnt,7,1)&&(bg_type==NDS_BG_BITMAP||bg_type==NDS_BG_LARGE_BITMAP);
+          bool extended_bgmap=!SB_BFE(bgcnt,7,1)&&(bg_type==NDS_BG_BITMAP||bg_type==NDS_BG_LARGE_BITMAP);
+          //NDS can have an affine "bitmap" that is really a large affine tile map
+          uint32_t bg_type_for_size = (bg_type==2&&!bitmap_mode)? 1: bg_type; 
+          int screen_size_x = bg_size_table[(bg_type_for_size*4+screen_size)*2+0];
+          int screen_size_y = bg_size_table[(bg_type_for_size*4+screen_size)*2+1];
+        
+          int bg_x = 0;
+          int bg_y = 0;
+          uint32_t pallete_offset = ppu_id?0x400:0; 
+
+          bool use_ext_palettes = SB_BFE(dispcnt,30,1);
+
+          if(rot_scale){
+            colors = true;
+
+            int32_t bgx = ppu->aff[bg-2].internal_bgx;
+            int32_t bgy = ppu->aff[bg-2].internal_bgy;
+
+            int32_t a = (int16_t)nds9_io_read16(nds,GBA_BG2PA+(bg-2)*0x10+reg_offset);
+            int32_t c = (int16_t)nds9_io_read16(nds,GBA_BG2PC+(bg-2)*0x10+reg_offset);
+
+            // Shift lcd_coords into fixed point
+            int64_t x2 = a*lcd_x + (((int64_t)bgx));
+            int64_t y2 = c*lcd_x + (((int64_t)bgy));
+            if(mosaic){
+              int16_t mos_reg = nds9_io_read16(nds,GBA_MOSAIC+reg_offset);
+              int mos_x = SB_BFE(mos_reg,0,4)+1;
+              x2 = a*((lcd_x/mos_x)*mos_x) + (((int64_t)bgx));
+              y2 = c*((lcd_x/mos_x)*mos_x) + (((int64_t)bgy));
+            }
+            bg_x = (x2>>8);
+            bg_y = (y2>>8);
+
+            if(display_overflow==0){
+              if(bg_x<0||bg_x>=screen_size_x||bg_y<0||bg_y>=screen_size_y)continue; 
+            }else{
+              bg_x%=screen_size_x;
+              bg_y%=screen_size_y;
+            }
+          }else{
+            int16_t hoff = SB_BFE(nds9_io_read16(nds,GBA_BG0HOFS+bg*4+reg_offset),0,9);
+            int16_t voff = SB_BFE(nds9_io_read16(nds,GBA_BG0VOFS+bg*4+reg_offset),0,9);
+            hoff=(hoff<<7)>>7;
+            voff=(voff<<7)>>7;
+            bg_x = (hoff+lcd_x);
+            bg_y = (voff+lcd_y);
+            if(mosaic){
+              uint16_t mos_reg = nds9_io_read16(nds,GBA_MOSAIC+reg_offset);
+              int mos_x = SB_BFE(mos_reg,0,4)+1;
+              int mos_y = SB_BFE(mos_reg,4,4)+1;
+              bg_x = hoff+(lcd_x/mos_x)*mos_x;
+              bg_y = voff+(lcd_y/mos_y)*mos_y;
+            }
+          }
+          int screen_base_addr    = screen_base*2*1024;
+          int character_base_addr = character_base*16*1024;
+        
+          int32_t bg_base = ppu_id? 0x06200000:0x06000000;
+          if(bitmap_mode){
+            screen_base_addr=screen_base*16*1024;
+            int p = bg_x+(bg_y)*screen_size_x;
+            if(bitmap_mode){
+              bool direct_color = SB_BFE(bgcnt,2,1);
+              if(direct_color){
+                col = nds_ppu_read16(nds,bg_base+screen_base_addr+p*2);
+                if(!SB_BFE(col,15,1))continue;
+              }
+              else{
+                int pallete_id  = nds_ppu_read8(nds,bg_base+screen_base_addr+p);
+                if(pallete_id==0)continue;
+                col = *(uint16_t*)(nds->mem.palette+pallete_offset+pallete_id*2);
+              }
+            }else{
+              col = nds_ppu_read16(nds,bg_base+screen_base_addr+p*2);
+            }
+          }else{
+            bg_x = bg_x&(screen_size_x-1);
+            bg_y = bg_y&(screen_size_y-1);
+            int bg_tile_x = bg_x/8;
+            int bg_tile_y = bg_y/8;
+
+            int tile_off = bg_tile_y*(screen_size_x/8)+bg_tile_x;
+
+            //engine A screen base: BGxCNT.bits*2K + DISPCNT.bits*64K
+            //engine A char base: BGxCNT.bits*16K + DISPCNT.bits*64K
+            if(ppu_id==0){
+              character_base_addr+=SB_BFE(dispcnt,24,3)*64*1024;
+              screen_base_addr+=SB_BFE(dispcnt,27,3)*64*1024;
+            }
+            uint16_t tile_data =0;
+
+            int px = bg_x%8;
+            int py = bg_y%8;
+
+            if(extended_bgmap){
+              tile_data=nds_ppu_read16(nds,bg_base+screen_base_addr+tile_off*2);
+              int h_flip = SB_BFE(tile_data,10,1);
+              int v_flip = SB_BFE(tile_data,11,1);
+              if(h_flip)px=7-px;
+              if(v_flip)py=7-py;
+            }else if(rot_scale){
+              tile_data=nds_ppu_read8(nds,bg_base+screen_base_addr+tile_off);
+              use_ext_palettes=false; //Not supported for 8bit bg map
+            }else{
+              int tile_off = (bg_tile_y%32)*32+(bg_tile_x%32);
+              if(bg_tile_x>=32)tile_off+=32*32;
+              if(bg_tile_y>=32)tile_off+=32*32*(screen_size==3?2:1);
+              tile_data=nds_ppu_read16(nds,bg_base+screen_base_addr+tile_off*2);
+              //printf("tx:%d ty:%d tile_off:%08x data:%08x\n",bg_tile_x,bg_tile_y,bg_base+screen_base_addr+tile_off,tile_data);
+              int h_flip = SB_BFE(tile_data,10,1);
+              int v_flip = SB_BFE(tile_data,11,1);
+              if(h_flip)px=7-px;
+              if(v_flip)py=7-py;
+            }
+            int tile_id = SB_BFE(tile_data,0,10);
+            int palette = SB_BFE(tile_data,12,4);
+
+            uint8_t tile_d=tile_id;
+            if(colors==false){
+              tile_d=nds_ppu_read8(nds,bg_base+character_base_addr+tile_id*8*4+px/2+py*4);
+              tile_d= (tile_d>>((px&1)*4))&0xf;
+              if(tile_d==0)continue;
+              tile_d+=palette*16;
+              use_ext_palettes=false;
+            }else{
+              tile_d=nds_ppu_read8(nds,bg_base+character_base_addr+tile_id*8*8+px+py*8);
+              if(tile_d==0)continue;
+            }
+            uint32_t palette_id = tile_d;
+            if(use_ext_palettes){
+              palette_id=(palette)*256+tile_d;
+              int ext_palette_slot = bg;
+              if(bg<2)ext_palette_slot+=SB_BFE(bgcnt,13,1)*2;
+              uint32_t read_addr = (ppu_id?NDS_VRAM_BGB_SLOT0:NDS_VRAM_BGA_SLOT0)+palette_id*2+0x2000*(ext_palette_slot);
+              col = nds_ppu_read16(nds, read_addr);
+            }else col = *(uint16_t*)(nds->mem.palette+pallete_offset+palette_id*2);
+          }
+        }
+        col |= (bg<<17) | ((5-priority)<<28)|((4-bg)<<25);
+        if(col>ppu->first_target_buffer[lcd_x]){
+          uint32_t t = ppu->first_target_buffer[lcd_x];
+          ppu->first_target_buffer[lcd_x]=col;
+          col = t;
+        }
+        if(col>ppu->second_target_buffer[lcd_x])ppu->second_target_buffer[lcd_x]=col;          
+      }
+    }
+    uint32_t col = ppu->first_target_buffer[lcd_x];
+    int r = SB_BFE(col,0,5);
+    int g = SB_BFE(col,5,5);
+    int b = SB_BFE(col,10,5);
+    uint32_t type = SB_BFE(col,17,3);
+
+    bool effect_enable = SB_BFE(window_control,5,1);
+    uint16_t bldcnt = nds9_io_read16(nds,GBA_BLDCNT+reg_offset);
+    int mode = SB_BFE(bldcnt,6,2);
+
+    //Semitransparent objects are always selected for blending
+    if(SB_BFE(col,16,1)){
+      uint32_t col2 = ppu->second_target_buffer[lcd_x];
+      uint32_t type2 = SB_BFE(col2,17,3);
+      bool blend = SB_BFE(bldcnt,8+type2,1);
+      if(blend){mode=1;effect_enable=true;}
+      else effect_enable &= SB_BFE(bldcnt,type,1);
+    }else effect_enable &= SB_BFE(bldcnt,type,1);
+    if(effect_enable){
+      uint16_t bldy = nds9_io_read16(nds,GBA_BLDY+reg_offset);
+      float evy = SB_BFE(bldy,0,5)/16.;
+      if(evy>1.0)evy=1;
+      switch(mode){
+        case 0: break; //None
+        case 1: {
+          uint32_t col2 = ppu->second_target_buffer[lcd_x];
+          uint32_t type2 = SB_BFE(col2,17,3);
+          bool blend = SB_BFE(bldcnt,8+type2,1);
+          if(blend){
+            uint16_t bldalpha= nds9_io_read16(nds,GBA_BLDALPHA+reg_offset);
+            //3d engines alpha blend based on the 3d alpha
+            
+            int r2 = SB_BFE(col2,0,5);
+            int g2 = SB_BFE(col2,5,5);
+            int b2 = SB_BFE(col2,10,5);
+            int eva = SB_BFE(bldalpha,0,5);
+            int evb = SB_BFE(bldalpha,8,5);
+            if(enable_3d&&type==0){
+              eva = nds->framebuffer_3d_disp[(lcd_x+lcd_y*NDS_LCD_W)*4+3]/16;
+              if(eva==15)eva=16;
+              evb = 16-eva;
+            }
+            if(eva>16)eva=16;
+            if(evb>16)evb=16;
+            r = (r*eva+r2*evb)/16;
+            g = (g*eva+g2*evb)/16;
+            b = (b*eva+b2*evb)/16;
+            if(r>31)r = 31;
+            if(g>31)g = 31;
+            if(b>31)b = 31;
+          }
+        }break; //Alpha Blend
+        case 2: //Lighten
+          r = r+(31-r)*evy;
+          g = g+(31-g)*evy;
+          b = b+(31-b)*evy;  
+          break; 
+        case 3: //Darken
+          r = r-(r)*evy;
+          g = g-(g)*evy;
+          b = b-(b)*evy;         
+          break; 
+      }
+    }
+
+    if(display_mode==2&&ppu_id==0){
+      int vram_block = SB_BFE(dispcnt,18,2);
+      uint16_t value = ((uint16_t*)nds->mem.vram)[lcd_x+lcd_y*NDS_LCD_W+vram_block*64*1024];
+      r = SB_BFE(value,0,5);
+      g = SB_BFE(value,5,5);
+      b = SB_BFE(value,10,5);
+    }else if(display_mode==0){
+      r=31;
+      g=31;
+      b=31;
+    }
+
+    if(enable_capture){
+      int size = SB_BFE(dispcapcnt, 20,2);
+      int szx = 128; int szy = 128;
+      if(size!=0){szx=256; szy= size*64;}
+      if(lcd_x<szx&&lcd_y<szy){
+        uint16_t color = (((uint16_t)r&0x1f))|(((uint16_t)g&0x1f)<<5)|(((uint16_t)b&0x1f)<<10);
+        //TODO: EVA/EVB, sources other than 0
+        int write_block = SB_BFE(dispcapcnt, 16,2);
+        int write_offset = SB_BFE(dispcapcnt, 18,2);
+        bool source_a = SB_BFE(dispcapcnt,24,1);
+        if(source_a&&lcd_x<NDS_LCD_W&&lcd_y<NDS_LCD_H){
+          int p = lcd_x+lcd_y*NDS_LCD_W;
+          color  = SB_BFE(nds->framebuffer_3d_disp[p*4+0],3,5);
+          color |= SB_BFE(nds->framebuffer_3d_disp[p*4+1],3,5)<<5;
+          color |= SB_BFE(nds->framebuffer_3d_disp[p*4+2],3,5)<<10;
+        }
+        int capture_mode = SB_BFE(dispcapcnt,29,2);
+        
+        if(capture_mode>=2){        
+          int r = SB_BFE(color,0,5);
+          int g = SB_BFE(color,5,5);
+          int b = SB_BFE(color,10,5);
+          int read_offset = SB_BFE(dispcapcnt, 26,2);
+          uint32_t read_address = 0x06800000;
+          read_address+=read_offset*0x08000;
+          read_address+=lcd_y*szx*2+lcd_x*2;
+          uint16_t color2=nds_ppu_read16(nds,read_address);
+          if(display_mode==2)color2=ppu->first_target_buffer[lcd_x];
+
+          int r2 = SB_BFE(color2,0,5);
+          int g2 = SB_BFE(color2,5,5);
+          int b2 = SB_BFE(color2,10,5);
+          int eva = SB_BFE(dispcapcnt,0,5);
+          int evb = SB_BFE(dispcapcnt,8,5);
+      
+          if(eva>16)eva=16;
+          if(evb>16)evb=16;
+          r = (r*eva+r2*evb)/16;
+          g = (g*eva+g2*evb)/16;
+          b = (b*eva+b2*evb)/16;
+          if(r>31)r = 31;
+          if(g>31)g = 31;
+          if(b>31)b = 31;
+          color  = SB_BFE(r,0,5);
+          color |= SB_BFE(g,0,5)<<5;
+          color |= SB_BFE(b,0,5)<<10;
+        }      
+        uint32_t write_address = 0x06800000;
+        write_address+=write_block*128*1024;
+        write_address+=write_offset*0x08000;
+        write_address+=lcd_y*szx*2+lcd_x*2;
+        color|=0x8000;//TODO: Confirm that captured alpha is always 1
+        nds9_write16(nds,write_address,color);
+      }
+    }
+
+    int disp_r = r; 
+    int disp_g = g; 
+    int disp_b = b; 
+    {
+      uint16_t master_brightness= nds9_io_read16(nds,ppu_id==0?NDS_A_MASTER_BRIGHT:NDS9_B_MASTER_BRIGHT);
+      int factor = SB_BFE(master_brightness,0,5);
+      int mode = SB_BFE(master_brightness,14,2);
+      if(factor>16)factor=16;
+      if(mode==1){
+        disp_r += (63-disp_r)*factor/16;
+        disp_g += (63-disp_g)*factor/16;
+        disp_b += (63-disp_b)*factor/16;
+      }else if(mode==2){
+        disp_r -= disp_r*factor/16;
+        disp_g -= disp_g*factor/16;
+        disp_b -= disp_b*factor/16;
+      }
+      if(disp_r<0)r=0;
+      if(disp_g<0)g=0;
+      if(disp_b<0)b=0;
+
+      if(disp_r>31)disp_r=31;
+      if(disp_g>31)disp_g=31;
+      if(disp_b>31)disp_b=31;
+    }
+    int p = (lcd_x+lcd_y*NDS_LCD_W)*4;
+    float screen_blend_factor = 1.0-(0.3*nds->ghosting_strength);
+    if(screen_blend_factor>1.0)screen_blend_factor=1;
+    if(screen_blend_factor<0.0)screen_blend_factor=0;
+    
+    uint8_t *framebuffer = (ppu_id==0)^nds->display_flip?nds->framebuffer_bottom: nds->framebuffer_top;
+    framebuffer[p+0] = disp_r*7*screen_blend_factor+framebuffer[p+0]*(1.0-screen_blend_factor);
+    framebuffer[p+1] = disp_g*7*screen_blend_factor+framebuffer[p+1]*(1.0-screen_blend_factor);
+    framebuffer[p+2] = disp_b*7*screen_blend_factor+framebuffer[p+2]*(1.0-screen_blend_factor); 
+    int backdrop_type = 5;
+    uint32_t backdrop_col = (*(uint16_t*)(nds->mem.palette + GBA_BG_PALETTE+0*2+ppu_id*1024))|(backdrop_type<<17);
+    
+    ppu->first_target_buffer[lcd_x] = backdrop_col;
+    ppu->second_target_buffer[lcd_x] = backdrop_col;
+  #if NDS_SCANLINE_PPU == 1
+  lcd_x++;
+  }
+  lcd_x = 0; 
+  }
+  #endif
+  }
+}
+#if NDS_THREADED_PPU
+// Runs the jobs nds_ppu_worker_post hands over, spinning for a while before it sleeps so the next
+// scanline doesn't wait for a wakeup
+static void* nds_ppu_worker_main(void* arg){
+  nds_ppu_worker_t* worker = (nds_ppu_worker_t*)arg;
+  uint32_t done = 0;
+  while(true){
+    uint32_t posted = done;
+    for(int spin=0;spin<NDS_PPU_WORKER_SPIN&&posted==done;++spin)posted = __atomic_load_n(&worker->posted,__ATOMIC_ACQUIRE);
+    if(posted==done){
+      pthread_mutex_lock(&worker->mutex);
+      worker->sleeping = true;
+      while((posted=__atomic_load_n(&worker->posted,__ATOMIC_ACQUIRE))==done&&!worker->quit)pthread_cond_wait(&worker->cond,&worker->mutex);
+      worker->sleeping = false;
+      pthread_mutex_unlock(&worker->mutex);
+      if(posted==done)return NULL;
+    }
+    nds_ppu_render_engine(worker->nds,1,worker->lcd_x,worker->lcd_y,worker->dispcapcnt);
+    done = posted;
+    __atomic_store_n(&worker->done,done,__ATOMIC_RELEASE);
+  }
+}
+static void nds_ppu_worker_start(nds_ppu_worker_t* worker){
+  // With a single core the two engines would only take turns
+  if(worker->started||sysconf(_SC_NPROCESSORS_ONLN)<2)return;
+  memset(worker,0,sizeof(*worker));
+  pthread_mutex_init(&worker->mutex,NULL);
+  pthread_cond_init(&worker->cond,NULL);
+  worker->started = pthread_create(&worker->thread,NULL,nds_ppu_worker_main,worker)==0;
+  if(!worker->started)printf("Failed to start the NDS PPU worker, drawing both engines in order\n");
+}
+static void nds_ppu_worker_stop(nds_ppu_worker_t* worker){
+  if(!worker->started)return;
+  pthread_mutex_lock(&worker->mutex);
+  worker->quit = true;
+  pthread_cond_signal(&worker->cond);
+  pthread_mutex_unlock(&worker->mutex);
+  pthread_join(worker->thread,NULL);
+  pthread_cond_destroy(&worker->cond);
+  pthread_mutex_destroy(&worker->mutex);
+  worker->started = false;
+}
+static void nds_ppu_worker_post(nds_ppu_worker_t* worker, nds_t* nds, int lcd_x, int lcd_y, uint32_t dispcapcnt){
+  worker->nds = nds;
+  worker->lcd_x = lcd_x;
+  worker->lcd_y = lcd_y;
+  worker->dispcapcnt = dispcapcnt;
+  pthread_mutex_lock(&worker->mutex);
+  __atomic_store_n(&worker->posted,worker->posted+1,__ATOMIC_RELEASE);
+  if(worker->sleeping)pthread_cond_signal(&worker->cond);
+  pthread_mutex_unlock(&worker->mutex);
+}
+static void nds_ppu_worker_wait(nds_ppu_worker_t* worker){
+  for(int spin=0;__atomic_load_n(&worker->done,__ATOMIC_ACQUIRE)!=worker->posted;++spin){
+    if(spin>=NDS_PPU_WORKER_SPIN)sched_yield();
+  }
+}
+#endif
 static FORCE_INLINE void nds_tick_ppu(nds_t* nds,bool render){
   nds->ppu[0].scan_clock+=1;
   if(SB_LIKELY(nds->ppu_fast_forward_ticks-->0))return;
@@ -5346,6 +6502,8 @@ static FORCE_INLINE void nds_tick_ppu(nds_t* nds,bool render){
   int lcd_y = (nds->ppu[0].scan_clock)/clocks_per_line;
   int lcd_x = ((nds->ppu[0].scan_clock)%clocks_per_line)/NDS_CLOCKS_PER_DOT;
   nds->ppu[1].scan_clock=nds->ppu[0].scan_clock;
+  bool render_engine[2];
+  uint32_t engine_dispcapcnt[2];
   for(int ppu_id=0;ppu_id<2;++ppu_id){
     nds_ppu_t * ppu = nds->ppu+ppu_id;
     uint32_t dispcapcnt = nds9_io_read32(nds,NDS_DISPCAPCNT);
@@ -5461,619 +6619,23 @@ static FORCE_INLINE void nds_tick_ppu(nds_t* nds,bool render){
       ppu->last_lcd_y  = lcd_y;
     }
     uint32_t dispcnt = nds9_io_read32(nds, GBA_DISPCNT+reg_offset);
-    int display_mode = SB_BFE(dispcnt,16,2);
-    bool enable_capture = SB_BFE(dispcapcnt,31,1)&&ppu_id==0;
-    render|=enable_capture;
-    int forced_blank = SB_BFE(dispcnt,7,1);
-    render&= !forced_blank;
-    if(!render)continue;
-    
-    bool enable_3d = ppu_id==0&&SB_BFE(dispcnt,3,1);
-    int bg_mode = SB_BFE(dispcnt,0,3);
-    bool visible = lcd_x<NDS_LCD_W && lcd_y<NDS_LCD_H;
-    //Render sprites over scanline when it completes
-    if(lcd_y<NDS_LCD_H && lcd_x == 0){
-      int obj_vram_map_2d = !SB_BFE(dispcnt,6,1);
-      //Render sprites over scanline when it completes
-      uint8_t default_window_control =0x3f;//bitfield [0-3:bg0-bg3 enable 4:obj enable, 5: special effect enable]
-      bool winout_enable = SB_BFE(dispcnt,13,3)!=0;
-      uint16_t WINOUT = nds9_io_read16(nds, GBA_WINOUT+reg_offset);
-      if(winout_enable)default_window_control = SB_BFE(WINOUT,0,8);
-
-      memset(ppu->window,default_window_control,NDS_LCD_W);
-
-      bool display_obj = SB_BFE(dispcnt,12,1);
-      if(display_obj){
-        uint8_t obj_window_control = default_window_control;
-        bool obj_window_enable = SB_BFE(dispcnt,15,1);
-        if(obj_window_enable)obj_window_control = SB_BFE(WINOUT,8,6);
-        int oam_offset = ppu_id*1024;
-        int obj_vram_base = ppu_id ==0? 0x06400000: 0x06600000;
-        for(int o=0;o<128;++o){
-          uint16_t attr0 = *(uint16_t*)(nds->mem.oam+o*8+0+oam_offset);
-          //Attr0
-          uint8_t y_coord = SB_BFE(attr0,0,8);
-          bool rot_scale =  SB_BFE(attr0,8,1);
-          bool double_size = SB_BFE(attr0,9,1)&&rot_scale;
-          bool obj_disable = SB_BFE(attr0,9,1)&&!rot_scale;
-          if(obj_disable) continue; 
-
-          int obj_mode = SB_BFE(attr0,10,2); //(0=Normal, 1=Semi-Transparent, 2=OBJ Window, 3=bitmap)
-          bool mosaic  = SB_BFE(attr0,12,1);
-          bool colors_or_palettes = SB_BFE(attr0,13,1);
-          int obj_shape = SB_BFE(attr0,14,2);//(0=Square,1=Horizontal,2=Vertical,3=Prohibited)
-          uint16_t attr1 = *(uint16_t*)(nds->mem.oam+o*8+2+oam_offset);
-
-          int rotscale_param = SB_BFE(attr1,9,5);
-          bool h_flip = SB_BFE(attr1,12,1)&&!rot_scale;
-          bool v_flip = SB_BFE(attr1,13,1)&&!rot_scale;
-          int obj_size = SB_BFE(attr1,14,2);
-          // Size  Square   Horizontal  Vertical
-          // 0     8x8      16x8        8x16
-          // 1     16x16    32x8        8x32
-          // 2     32x32    32x16       16x32
-          // 3     64x64    64x32       32x64
-          const int xsize_lookup[16]={
-            8,16,8,0,
-            16,32,8,0,
-            32,32,16,0,
-            64,64,32,0
-          };
-          const int ysize_lookup[16]={
-            8,8,16,0,
-            16,8,32,0,
-            32,16,32,0,
-            64,32,64,0
-          }; 
-
-          int y_size = ysize_lookup[obj_size*4+obj_shape];
-
-          if(((lcd_y-y_coord)&0xff) <y_size*(double_size?2:1)){
-
-            int16_t x_coord = SB_BFE(attr1,0,9);
-            if (SB_BFE(x_coord,8,1))x_coord|=0xfe00;
-
-            int x_size = xsize_lookup[obj_size*4+obj_shape];
-            int x_start = x_coord>=0?x_coord:0;
-            int x_end   = x_coord+x_size*(double_size?2:1);
-            if(x_end>=NDS_LCD_W)x_end=NDS_LCD_W;
-            //Attr2
-            //Skip objects disabled by window
-            uint16_t attr2 = *(uint16_t*)(nds->mem.oam+o*8+4 +oam_offset);
-            int tile_base = SB_BFE(attr2,0,10);
-            // Always place sprites as the highest priority
-            int priority = SB_BFE(attr2,10,2);
-            int palette = SB_BFE(attr2,12,4);
-            for(int x = x_start; x< x_end;++x){
-              int sx = (x-x_coord);
-              int sy = (lcd_y-y_coord)&0xff;
-              if(mosaic){
-                uint16_t mos_reg = nds9_io_read16(nds,GBA_MOSAIC+reg_offset);
-                int mos_x = SB_BFE(mos_reg,8,4)+1;
-                int mos_y = SB_BFE(mos_reg,12,4)+1;
-                sx = ((x/mos_x)*mos_x-x_coord);
-                sy = (((lcd_y/mos_y)*mos_y-y_coord)&0xff);
-              }
-              if(rot_scale){
-                uint32_t param_base = rotscale_param*0x20+oam_offset; 
-                int32_t a = *(int16_t*)(nds->mem.oam+param_base+0x6);
-                int32_t b = *(int16_t*)(nds->mem.oam+param_base+0xe);
-                int32_t c = *(int16_t*)(nds->mem.oam+param_base+0x16);
-                int32_t d = *(int16_t*)(nds->mem.oam+param_base+0x1e);
-  
-                int64_t x1 = sx<<8;
-                int64_t y1 = sy<<8;
-                int64_t objref_x = (x_size<<(double_size?8:7));
-                int64_t objref_y = (y_size<<(double_size?8:7));
-              
-                int64_t x2 = a*(x1-objref_x) + b*(y1-objref_y)+(x_size<<15);
-                int64_t y2 = c*(x1-objref_x) + d*(y1-objref_y)+(y_size<<15);
-
-                sx = (x2>>16);
-                sy = (y2>>16);
-                if(sx>=x_size||sy>=y_size||sx<0||sy<0)continue;
-              }else{
-                if(h_flip)sx=x_size-sx-1;
-                if(v_flip)sy=y_size-sy-1;
-              }
-              uint32_t col =0;
-              if(obj_mode==3){
-
-                bool linear = SB_BFE(dispcnt,6,1);
-                //TODO: Bitmap sprites
-                if(linear){
-                  int boundry = SB_BFE(dispcnt,22,1);
-                  tile_base *= boundry? 256: 128;
-                  int p = sx+sy*x_size;
-                  col = nds_ppu_read16(nds,obj_vram_base+tile_base+p*2);
-                }else{
-                  bool size = SB_BFE(dispcnt,5,1);
-                  int p = 0;             
-                  if(size){
-                    int tile_x=SB_BFE(tile_base,0,5);
-                    int tile_y=SB_BFE(tile_base,5,5);
-                    p = (tile_x*8+sx)+(tile_y*8+sy)*32*8;
-                  }else{
-                    int tile_x=SB_BFE(tile_base,0,4);
-                    int tile_y=SB_BFE(tile_base,4,6);
-                    p = (tile_x*8+sx)+(tile_y*8+sy)*16*8;
-                  }
-                  col = nds_ppu_read16(nds,obj_vram_base+p*2);
-                  if(!SB_BFE(col,15,1))continue;
-                }
-              }else{
-                int tx = sx%8;
-                int ty = sy%8;
-                bool tile_obj_mapping = SB_BFE(dispcnt,4,1);
-                        
-                int y_tile_stride = obj_vram_map_2d? 32 : x_size/8*(colors_or_palettes? 2:1);
-
-                int tile_boundry = 32;
-                if(tile_obj_mapping ==true){
-                  int tile_obj_1d_boundry = SB_BFE(dispcnt,20,2);
-                  tile_boundry = 32<<tile_obj_1d_boundry;
-                  y_tile_stride=x_size/8*(colors_or_palettes? 2:1);
-                }
-                int tile = tile_base*tile_boundry/32 + (((sx/8))*(colors_or_palettes? 2:1)+(sy/8)*y_tile_stride);
-                //tile*=tile_boundry/32;
-                uint16_t palette_id;
-                bool use_obj_ext_palettes = SB_BFE(dispcnt,31,1);
-                if(colors_or_palettes==false){
-                  palette_id= nds_ppu_read8(nds,obj_vram_base+tile*32+tx/2+ty*4);
-                  palette_id= (palette_id>>((tx&1)*4))&0xf;
-                  if(palette_id==0)continue;
-                  palette_id+=palette*16;
-                  use_obj_ext_palettes=false; //Not supported in 16 color mode
-                }else{
-                  palette_id=nds_ppu_read8(nds,obj_vram_base+tile*32+tx+ty*8);
-                  if(palette_id==0)continue;
-                }
-                if(use_obj_ext_palettes){
-                  palette_id=(palette)*256+palette_id;
-                  uint32_t read_addr = (ppu_id?NDS_VRAM_OBJB_SLOT0:NDS_VRAM_OBJA_SLOT0)+palette_id*2;
-                  col = nds_ppu_read16(nds, read_addr);
-                }else{
-                  uint32_t pallete_offset = ppu_id?0x600:0x200; 
-                  col = *(uint16_t*)(nds->mem.palette+pallete_offset+palette_id*2);
-                }
-              }
-
-              //Handle window objects(not displayed but control the windowing of other things)
-              if(obj_mode==2){ppu->window[x]=obj_window_control; 
-              }else{
-                int type =4;
-                col=col|(type<<17)|((5-priority)<<28)|((0x7)<<25);
-                if(obj_mode==1)col|=1<<16;
-                if((col>>17)>(ppu->first_target_buffer[x]>>17))ppu->first_target_buffer[x]=col;
-              }  
-            }
-          }
-        }
-      }
-      int enabled_windows = SB_BFE(dispcnt,13,3); // [0: win0, 1:win1, 2: objwin]
-      if(enabled_windows){
-        for(int win=1;win>=0;--win){
-          bool win_enable = SB_BFE(dispcnt,13+win,1);
-          if(!win_enable)continue;
-          uint16_t WINH = nds9_io_read16(nds, GBA_WIN0H+2*win+reg_offset);
-          uint16_t WINV = nds9_io_read16(nds, GBA_WIN0V+2*win+reg_offset);
-          int win_xmin = SB_BFE(WINH,8,8);
-          int win_xmax = SB_BFE(WINH,0,8);
-          int win_ymin = SB_BFE(WINV,8,8);
-          int win_ymax = SB_BFE(WINV,0,8);
-          // Garbage values of X2>240 or X1>X2 are interpreted as X2=240.
-          // Garbage values of Y2>160 or Y1>Y2 are interpreted as Y2=160. 
-          if(win_xmin>win_xmax)win_xmax=NDS_LCD_W;
-          if(win_ymin>win_ymax)win_ymax=NDS_LCD_H+1;
-          if(win_xmax>NDS_LCD_W)win_xmax=NDS_LCD_W;
-          if(lcd_y<win_ymin||lcd_y>=win_ymax)continue;
-          uint16_t winin = nds9_io_read16(nds,GBA_WININ+reg_offset);
-          uint8_t win_value = SB_BFE(winin,win*8,6);
-          memset(ppu->window+win_xmin,win_value,win_xmax-win_xmin);
-        }
-        int backdrop_type = 5;
-        uint32_t backdrop_col = (*(uint16_t*)(nds->mem.palette + GBA_BG_PALETTE+0*2+ppu_id*1024))|(backdrop_type<<17);
-        for(int x=0;x<NDS_LCD_W;++x){
-          uint8_t window_control = ppu->window[x];
-          if(SB_BFE(window_control,4,1)==0)ppu->first_target_buffer[x]=backdrop_col;
-        }
-      }
-    }
-    if(visible){
-      #if NDS_SCANLINE_PPU == 1
-      if(lcd_x==0){while(lcd_x<NDS_LCD_W){
-      #endif
-      uint8_t window_control =ppu->window[lcd_x];
-      bool render_backgrounds = true; //TODO hook up power management
-      if(render_backgrounds){
-        for(int bg = 3; bg>=0;--bg){
-          #define NDS_BG_TEXT 0
-          #define NDS_BG_AFFINE 1
-          #define NDS_BG_BITMAP 2
-          #define NDS_BG_LARGE_BITMAP 3
-          #define NDS_BG_INVALID 4
-
-          const int bg_mode_table[8*4]={
-            /* mode 0: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_TEXT,
-            /* mode 1: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_AFFINE,
-            /* mode 2: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_AFFINE,NDS_BG_AFFINE,
-            /* mode 3: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_BITMAP,
-            /* mode 4: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_AFFINE,NDS_BG_BITMAP,
-            /* mode 5: */NDS_BG_TEXT,NDS_BG_TEXT,NDS_BG_BITMAP,NDS_BG_BITMAP,
-            /* mode 6: */NDS_BG_TEXT,NDS_BG_INVALID,NDS_BG_LARGE_BITMAP,NDS_BG_INVALID,
-            /* mode 7: */NDS_BG_INVALID,NDS_BG_INVALID,NDS_BG_INVALID,NDS_BG_INVALID,
-          };
-          const int bg_size_table[4*4*2]={
-            /* TEXT: */        
-            256,256,
-            512,256,
-            256,512,
-            512,512,
-            /* AFFINE: */ 
-            128,128,
-            256,256,
-            512,512,
-            1024,1024,
-            /* BITMAP: */ 
-            128,128,
-            256,256,
-            512,256,
-            512,512,
-            /* LARGE BITMAP: */
-            512,1024,
-            1024,512,
-            0,0, //INVALID
-            0,0, //INVALID
-          };
-          int bg_type = bg_mode_table[bg_mode*4+bg];
-          uint32_t col =0;         
-          bool bg_en = SB_BFE(dispcnt,8+bg,1)&&SB_BFE(ppu->dispcnt_pipeline[0],8+bg,1)&&bg_type!=NDS_BG_INVALID;
-          if(!bg_en || SB_BFE(window_control,bg,1)==0)continue;
-
-          bool rot_scale = bg_type!=NDS_BG_TEXT;
-          uint16_t bgcnt = nds9_io_read16(nds, GBA_BG0CNT+bg*2+reg_offset);
-          int priority = SB_BFE(bgcnt,0,2);
-          int character_base = SB_BFE(bgcnt,2,4);
-          bool mosaic = SB_BFE(bgcnt,6,1);
-          bool colors = SB_BFE(bgcnt,7,1);
-          int screen_base = SB_BFE(bgcnt,8,5);
-          bool display_overflow =SB_BFE(bgcnt,13,1);
-          int screen_size = SB_BFE(bgcnt,14,2); 
-
-          if(SB_UNLIKELY(enable_3d&&bg==0)){
-            int p = lcd_x+lcd_y*NDS_LCD_W;
-            col  = SB_BFE(nds->framebuffer_3d_disp[p*4+0],3,5);
-            col |= SB_BFE(nds->framebuffer_3d_disp[p*4+1],3,5)<<5;
-            col |= SB_BFE(nds->framebuffer_3d_disp[p*4+2],3,5)<<10;
-            if(SB_BFE(nds->framebuffer_3d_disp[p*4+3],3,5)==0)continue;
-          }else{
-            bool bitmap_mode = SB_BFE(bgcnt,7,1)&&(bg_type==NDS_BG_BITMAP||bg_type==NDS_BG_LARGE_BITMAP);
-            bool extended_bgmap=!SB_BFE(bgcnt,7,1)&&(bg_type==NDS_BG_BITMAP||bg_type==NDS_BG_LARGE_BITMAP);
-            //NDS can have an affine "bitmap" that is really a large affine tile map
-            uint32_t bg_type_for_size = (bg_type==2&&!bitmap_mode)? 1: bg_type; 
-            int screen_size_x = bg_size_table[(bg_type_for_size*4+screen_size)*2+0];
-            int screen_size_y = bg_size_table[(bg_type_for_size*4+screen_size)*2+1];
-          
-            int bg_x = 0;
-            int bg_y = 0;
-            uint32_t pallete_offset = ppu_id?0x400:0; 
-
-            bool use_ext_palettes = SB_BFE(dispcnt,30,1);
-
-            if(rot_scale){
-              colors = true;
-
-              int32_t bgx = ppu->aff[bg-2].internal_bgx;
-              int32_t bgy = ppu->aff[bg-2].internal_bgy;
-
-              int32_t a = (int16_t)nds9_io_read16(nds,GBA_BG2PA+(bg-2)*0x10+reg_offset);
-              int32_t c = (int16_t)nds9_io_read16(nds,GBA_BG2PC+(bg-2)*0x10+reg_offset);
-
-              // Shift lcd_coords into fixed point
-              int64_t x2 = a*lcd_x + (((int64_t)bgx));
-              int64_t y2 = c*lcd_x + (((int64_t)bgy));
-              if(mosaic){
-                int16_t mos_reg = nds9_io_read16(nds,GBA_MOSAIC+reg_offset);
-                int mos_x = SB_BFE(mos_reg,0,4)+1;
-                x2 = a*((lcd_x/mos_x)*mos_x) + (((int64_t)bgx));
-                y2 = c*((lcd_x/mos_x)*mos_x) + (((int64_t)bgy));
-              }
-              bg_x = (x2>>8);
-              bg_y = (y2>>8);
-
-              if(display_overflow==0){
-                if(bg_x<0||bg_x>=screen_size_x||bg_y<0||bg_y>=screen_size_y)continue; 
-              }else{
-                bg_x%=screen_size_x;
-                bg_y%=screen_size_y;
-              }
-            }else{
-              int16_t hoff = SB_BFE(nds9_io_read16(nds,GBA_BG0HOFS+bg*4+reg_offset),0,9);
-              int16_t voff = SB_BFE(nds9_io_read16(nds,GBA_BG0VOFS+bg*4+reg_offset),0,9);
-              hoff=(hoff<<7)>>7;
-              voff=(voff<<7)>>7;
-              bg_x = (hoff+lcd_x);
-              bg_y = (voff+lcd_y);
-              if(mosaic){
-                uint16_t mos_reg = nds9_io_read16(nds,GBA_MOSAIC+reg_offset);
-                int mos_x = SB_BFE(mos_reg,0,4)+1;
-                int mos_y = SB_BFE(mos_reg,4,4)+1;
-                bg_x = hoff+(lcd_x/mos_x)*mos_x;
-                bg_y = voff+(lcd_y/mos_y)*mos_y;
-              }
-            }
-            int screen_base_addr    = screen_base*2*1024;
-            int character_base_addr = character_base*16*1024;
-          
-            int32_t bg_base = ppu_id? 0x06200000:0x06000000;
-            if(bitmap_mode){
-              screen_base_addr=screen_base*16*1024;
-              int p = bg_x+(bg_y)*screen_size_x;
-              if(bitmap_mode){
-                bool direct_color = SB_BFE(bgcnt,2,1);
-                if(direct_color){
-                  col = nds_ppu_read16(nds,bg_base+screen_base_addr+p*2);
-                  if(!SB_BFE(col,15,1))continue;
-                }
-                else{
-                  int pallete_id  = nds_ppu_read8(nds,bg_base+screen_base_addr+p);
-                  if(pallete_id==0)continue;
-                  col = *(uint16_t*)(nds->mem.palette+pallete_offset+pallete_id*2);
-                }
-              }else{
-                col = nds_ppu_read16(nds,bg_base+screen_base_addr+p*2);
-              }
-            }else{
-              bg_x = bg_x&(screen_size_x-1);
-              bg_y = bg_y&(screen_size_y-1);
-              int bg_tile_x = bg_x/8;
-              int bg_tile_y = bg_y/8;
-
-              int tile_off = bg_tile_y*(screen_size_x/8)+bg_tile_x;
-
-              //engine A screen base: BGxCNT.bits*2K + DISPCNT.bits*64K
-              //engine A char base: BGxCNT.bits*16K + DISPCNT.bits*64K
-              if(ppu_id==0){
-                character_base_addr+=SB_BFE(dispcnt,24,3)*64*1024;
-                screen_base_addr+=SB_BFE(dispcnt,27,3)*64*1024;
-              }
-              uint16_t tile_data =0;
-
-              int px = bg_x%8;
-              int py = bg_y%8;
-
-              if(extended_bgmap){
-                tile_data=nds_ppu_read16(nds,bg_base+screen_base_addr+tile_off*2);
-                int h_flip = SB_BFE(tile_data,10,1);
-                int v_flip = SB_BFE(tile_data,11,1);
-                if(h_flip)px=7-px;
-                if(v_flip)py=7-py;
-              }else if(rot_scale){
-                tile_data=nds_ppu_read8(nds,bg_base+screen_base_addr+tile_off);
-                use_ext_palettes=false; //Not supported for 8bit bg map
-              }else{
-                int tile_off = (bg_tile_y%32)*32+(bg_tile_x%32);
-                if(bg_tile_x>=32)tile_off+=32*32;
-                if(bg_tile_y>=32)tile_off+=32*32*(screen_size==3?2:1);
-                tile_data=nds_ppu_read16(nds,bg_base+screen_base_addr+tile_off*2);
-                //printf("tx:%d ty:%d tile_off:%08x data:%08x\n",bg_tile_x,bg_tile_y,bg_base+screen_base_addr+tile_off,tile_data);
-                int h_flip = SB_BFE(tile_data,10,1);
-                int v_flip = SB_BFE(tile_data,11,1);
-                if(h_flip)px=7-px;
-                if(v_flip)py=7-py;
-              }
-              int tile_id = SB_BFE(tile_data,0,10);
-              int palette = SB_BFE(tile_data,12,4);
-
-              uint8_t tile_d=tile_id;
-              if(colors==false){
-                tile_d=nds_ppu_read8(nds,bg_base+character_base_addr+tile_id*8*4+px/2+py*4);
-                tile_d= (tile_d>>((px&1)*4))&0xf;
-                if(tile_d==0)continue;
-                tile_d+=palette*16;
-                use_ext_palettes=false;
-              }else{
-                tile_d=nds_ppu_read8(nds,bg_base+character_base_addr+tile_id*8*8+px+py*8);
-                if(tile_d==0)continue;
-              }
-              uint32_t palette_id = tile_d;
-              if(use_ext_palettes){
-                palette_id=(palette)*256+tile_d;
-                int ext_palette_slot = bg;
-                if(bg<2)ext_palette_slot+=SB_BFE(bgcnt,13,1)*2;
-                uint32_t read_addr = (ppu_id?NDS_VRAM_BGB_SLOT0:NDS_VRAM_BGA_SLOT0)+palette_id*2+0x2000*(ext_palette_slot);
-                col = nds_ppu_read16(nds, read_addr);
-              }else col = *(uint16_t*)(nds->mem.palette+pallete_offset+palette_id*2);
-            }
-          }
-          col |= (bg<<17) | ((5-priority)<<28)|((4-bg)<<25);
-          if(col>ppu->first_target_buffer[lcd_x]){
-            uint32_t t = ppu->first_target_buffer[lcd_x];
-            ppu->first_target_buffer[lcd_x]=col;
-            col = t;
-          }
-          if(col>ppu->second_target_buffer[lcd_x])ppu->second_target_buffer[lcd_x]=col;          
-        }
-      }
-      uint32_t col = ppu->first_target_buffer[lcd_x];
-      int r = SB_BFE(col,0,5);
-      int g = SB_BFE(col,5,5);
-      int b = SB_BFE(col,10,5);
-      uint32_t type = SB_BFE(col,17,3);
-
-      bool effect_enable = SB_BFE(window_control,5,1);
-      uint16_t bldcnt = nds9_io_read16(nds,GBA_BLDCNT+reg_offset);
-      int mode = SB_BFE(bldcnt,6,2);
-
-      //Semitransparent objects are always selected for blending
-      if(SB_BFE(col,16,1)){
-        uint32_t col2 = ppu->second_target_buffer[lcd_x];
-        uint32_t type2 = SB_BFE(col2,17,3);
-        bool blend = SB_BFE(bldcnt,8+type2,1);
-        if(blend){mode=1;effect_enable=true;}
-        else effect_enable &= SB_BFE(bldcnt,type,1);
-      }else effect_enable &= SB_BFE(bldcnt,type,1);
-      if(effect_enable){
-        uint16_t bldy = nds9_io_read16(nds,GBA_BLDY+reg_offset);
-        float evy = SB_BFE(bldy,0,5)/16.;
-        if(evy>1.0)evy=1;
-        switch(mode){
-          case 0: break; //None
-          case 1: {
-            uint32_t col2 = ppu->second_target_buffer[lcd_x];
-            uint32_t type2 = SB_BFE(col2,17,3);
-            bool blend = SB_BFE(bldcnt,8+type2,1);
-            if(blend){
-              uint16_t bldalpha= nds9_io_read16(nds,GBA_BLDALPHA+reg_offset);
-              //3d engines alpha blend based on the 3d alpha
-              
-              int r2 = SB_BFE(col2,0,5);
-              int g2 = SB_BFE(col2,5,5);
-              int b2 = SB_BFE(col2,10,5);
-              int eva = SB_BFE(bldalpha,0,5);
-              int evb = SB_BFE(bldalpha,8,5);
-              if(enable_3d&&type==0){
-                eva = nds->framebuffer_3d_disp[(lcd_x+lcd_y*NDS_LCD_W)*4+3]/16;
-                if(eva==15)eva=16;
-                evb = 16-eva;
-              }
-              if(eva>16)eva=16;
-              if(evb>16)evb=16;
-              r = (r*eva+r2*evb)/16;
-              g = (g*eva+g2*evb)/16;
-              b = (b*eva+b2*evb)/16;
-              if(r>31)r = 31;
-              if(g>31)g = 31;
-              if(b>31)b = 31;
-            }
-          }break; //Alpha Blend
-          case 2: //Lighten
-            r = r+(31-r)*evy;
-            g = g+(31-g)*evy;
-            b = b+(31-b)*evy;  
-            break; 
-          case 3: //Darken
-            r = r-(r)*evy;
-            g = g-(g)*evy;
-            b = b-(b)*evy;         
-            break; 
-        }
-      }
-
-      if(display_mode==2&&ppu_id==0){
-        int vram_block = SB_BFE(dispcnt,18,2);
-        uint16_t value = ((uint16_t*)nds->mem.vram)[lcd_x+lcd_y*NDS_LCD_W+vram_block*64*1024];
-        r = SB_BFE(value,0,5);
-        g = SB_BFE(value,5,5);
-        b = SB_BFE(value,10,5);
-      }else if(display_mode==0){
-        r=31;
-        g=31;
-        b=31;
-      }
-
-      if(enable_capture){
-        int size = SB_BFE(dispcapcnt, 20,2);
-        int szx = 128; int szy = 128;
-        if(size!=0){szx=256; szy= size*64;}
-        if(lcd_x<szx&&lcd_y<szy){
-          uint16_t color = (((uint16_t)r&0x1f))|(((uint16_t)g&0x1f)<<5)|(((uint16_t)b&0x1f)<<10);
-          //TODO: EVA/EVB, sources other than 0
-          int write_block = SB_BFE(dispcapcnt, 16,2);
-          int write_offset = SB_BFE(dispcapcnt, 18,2);
-          bool source_a = SB_BFE(dispcapcnt,24,1);
-          if(source_a&&lcd_x<NDS_LCD_W&&lcd_y<NDS_LCD_H){
-            int p = lcd_x+lcd_y*NDS_LCD_W;
-            color  = SB_BFE(nds->framebuffer_3d_disp[p*4+0],3,5);
-            color |= SB_BFE(nds->framebuffer_3d_disp[p*4+1],3,5)<<5;
-            color |= SB_BFE(nds->framebuffer_3d_disp[p*4+2],3,5)<<10;
-          }
-          int capture_mode = SB_BFE(dispcapcnt,29,2);
-          
-          if(capture_mode>=2){        
-            int r = SB_BFE(color,0,5);
-            int g = SB_BFE(color,5,5);
-            int b = SB_BFE(color,10,5);
-            int read_offset = SB_BFE(dispcapcnt, 26,2);
-            uint32_t read_address = 0x06800000;
-            read_address+=read_offset*0x08000;
-            read_address+=lcd_y*szx*2+lcd_x*2;
-            uint16_t color2=nds_ppu_read16(nds,read_address);
-            if(display_mode==2)color2=ppu->first_target_buffer[lcd_x];
-
-            int r2 = SB_BFE(color2,0,5);
-            int g2 = SB_BFE(color2,5,5);
-            int b2 = SB_BFE(color2,10,5);
-            int eva = SB_BFE(dispcapcnt,0,5);
-            int evb = SB_BFE(dispcapcnt,8,5);
-        
-            if(eva>16)eva=16;
-            if(evb>16)evb=16;
-            r = (r*eva+r2*evb)/16;
-            g = (g*eva+g2*evb)/16;
-            b = (b*eva+b2*evb)/16;
-            if(r>31)r = 31;
-            if(g>31)g = 31;
-            if(b>31)b = 31;
-            color  = SB_BFE(r,0,5);
-            color |= SB_BFE(g,0,5)<<5;
-            color |= SB_BFE(b,0,5)<<10;
-          }      
-          uint32_t write_address = 0x06800000;
-          write_address+=write_block*128*1024;
-          write_address+=write_offset*0x08000;
-          write_address+=lcd_y*szx*2+lcd_x*2;
-          color|=0x8000;//TODO: Confirm that captured alpha is always 1
-          nds9_write16(nds,write_address,color);
-        }
-      }
-
-      int disp_r = r; 
-      int disp_g = g; 
-      int disp_b = b; 
-      {
-        uint16_t master_brightness= nds9_io_read16(nds,ppu_id==0?NDS_A_MASTER_BRIGHT:NDS9_B_MASTER_BRIGHT);
-        int factor = SB_BFE(master_brightness,0,5);
-        int mode = SB_BFE(master_brightness,14,2);
-        if(factor>16)factor=16;
-        if(mode==1){
-          disp_r += (63-disp_r)*factor/16;
-          disp_g += (63-disp_g)*factor/16;
-          disp_b += (63-disp_b)*factor/16;
-        }else if(mode==2){
-          disp_r -= disp_r*factor/16;
-          disp_g -= disp_g*factor/16;
-          disp_b -= disp_b*factor/16;
-        }
-        if(disp_r<0)r=0;
-        if(disp_g<0)g=0;
-        if(disp_b<0)b=0;
-
-        if(disp_r>31)disp_r=31;
-        if(disp_g>31)disp_g=31;
-        if(disp_b>31)disp_b=31;
-      }
-      int p = (lcd_x+lcd_y*NDS_LCD_W)*4;
-      float screen_blend_factor = 1.0-(0.3*nds->ghosting_strength);
-      if(screen_blend_factor>1.0)screen_blend_factor=1;
-      if(screen_blend_factor<0.0)screen_blend_factor=0;
-      
-      uint8_t *framebuffer = (ppu_id==0)^nds->display_flip?nds->framebuffer_bottom: nds->framebuffer_top;
-      framebuffer[p+0] = disp_r*7*screen_blend_factor+framebuffer[p+0]*(1.0-screen_blend_factor);
-      framebuffer[p+1] = disp_g*7*screen_blend_factor+framebuffer[p+1]*(1.0-screen_blend_factor);
-      framebuffer[p+2] = disp_b*7*screen_blend_factor+framebuffer[p+2]*(1.0-screen_blend_factor); 
-      int backdrop_type = 5;
-      uint32_t backdrop_col = (*(uint16_t*)(nds->mem.palette + GBA_BG_PALETTE+0*2+ppu_id*1024))|(backdrop_type<<17);
-      
-      ppu->first_target_buffer[lcd_x] = backdrop_col;
-      ppu->second_target_buffer[lcd_x] = backdrop_col;
-    #if NDS_SCANLINE_PPU == 1
-    lcd_x++;
-    }
-    lcd_x = 0; 
-    }
-    #endif
-    }
+    render|=SB_BFE(dispcapcnt,31,1)&&ppu_id==0;
+    render&= !SB_BFE(dispcnt,7,1);
+    render_engine[ppu_id]=render;
+    engine_dispcapcnt[ppu_id]=dispcapcnt;
+  }
+#if NDS_THREADED_PPU
+  // Engine B draws its line on the worker while engine A draws here
+  nds_ppu_worker_t* worker = nds->ppu_worker;
+  if(worker&&worker->started&&render_engine[0]&&render_engine[1]&&lcd_x==0&&lcd_y<NDS_LCD_H){
+    nds_ppu_worker_post(worker,nds,lcd_x,lcd_y,engine_dispcapcnt[1]);
+    nds_ppu_render_engine(nds,0,lcd_x,lcd_y,engine_dispcapcnt[0]);
+    nds_ppu_worker_wait(worker);
+    return;
+  }
+#endif
+  for(int ppu_id=0;ppu_id<2;++ppu_id){
+    if(render_engine[ppu_id])nds_ppu_render_engine(nds,ppu_id,lcd_x,lcd_y,engine_dispcapcnt[ppu_id]);
   }
 }
 static void nds_tick_keypad(sb_joy_t*joy, nds_t* nds){
@@ -6664,9 +7226,253 @@ static FORCE_INLINE void nds_tick_audio(nds_t*nds, sb_emu_state_t*emu, double de
 }
 
 
+typedef struct{
+  sb_emu_state_t* emu;
+  nds_t* nds;
+  int executed;
+  // Set by nds_arm9_jit_boundary once it finished the current nds_tick iteration, resumed once it
+  // also ran the start of the next one (cpus_run is the result of nds_tick_arm7_slot)
+  bool iteration_done;
+  bool resumed;
+  bool cpus_run;
+  uint32_t pc; // Start of the ARM9 instruction that is running (see nds_arm9_slot_boundary)
+}nds_arm9_run_ctx_t;
+static FORCE_INLINE bool nds_cpu_idle(nds_t* nds, int cpu_id){
+  return (cpu_id? &nds->arm9: &nds->arm7)->wait_for_interrupt||nds->idle_loop_passes[cpu_id]>=2;
+}
+// Tracks the idle loop of a CPU after it ran the instruction at pc. A CPU is idle once it has
+// confirmed its loop twice in a row while the other CPU was idle, so every load of its last pass saw
+// the other CPU's final writes.
+static FORCE_INLINE void nds_update_idle_loop(nds_t* nds, int cpu_id, uint32_t pc, uint64_t clock){
+  arm7_t* cpu = cpu_id? &nds->arm9: &nds->arm7;
+  arm7_idle_loop_t* idle = &nds->idle_loop[cpu_id];
+  bool arrival = arm7_idle_loop_arrival(cpu,idle,pc,clock,cpu_id? nds9_idle_loop_read_ok: nds7_idle_loop_read_ok);
+  if(!idle->confirmed||cpu->registers[PC]-idle->head>idle->branch-idle->head)nds->idle_loop_passes[cpu_id]=0;
+  else if(arrival&&nds->idle_loop_passes[cpu_id]<2)nds->idle_loop_passes[cpu_id]++;
+  if(!nds_cpu_idle(nds,cpu_id))nds->idle_loop_passes[!cpu_id]=0;
+}
+// Runs between the two instructions of a fused Thumb pair, which takes both ARM9 instructions of a
+// nds_tick iteration
+static bool nds_arm9_fused_boundary(void* user_data){
+  nds_arm9_run_ctx_t* ctx = (nds_arm9_run_ctx_t*)user_data;
+  nds_t* nds = ctx->nds;
+  uint32_t pc = nds->arm9.registers[PC];
+  if(ctx->emu->idle_loop_skip)nds_update_idle_loop(nds,1,pc-2,nds->current_clock*2);
+  if(SB_UNLIKELY(pc== ctx->emu->pc_breakpoint)){nds->arm9.trigger_breakpoint=true;return false;}
+  return true;
+}
+// Cycles until one of the components has work to do: the IF pipeline shifts on every cycle while it
+// holds interrupts, the timers update once the deferred ticks reach timer_ticks_before_event, the PPU
+// when its fast forward runs out and the GX when it is done with a command and has another one (or a
+// swap) queued. An idle GX only refreshes GXSTAT, its IRQ and the GX FIFO DMA request, which
+// nds_tick_to_event does on the first and the last cycle of a step.
+static FORCE_INLINE int nds_cycles_to_next_event(nds_t* nds){
+  if(nds->active_if_pipe_stages)return 1;
+  int cycles = nds->ppu_fast_forward_ticks>0? nds->ppu_fast_forward_ticks+1: 1;
+  if(nds->deferred_timer_ticks+cycles>nds->timer_ticks_before_event){
+    cycles = nds->deferred_timer_ticks<nds->timer_ticks_before_event? nds->timer_ticks_before_event-nds->deferred_timer_ticks: 1;
+  }
+  nds_gpu_t* gpu = &nds->gpu;
+  if(gpu->cmd_busy_cycles){
+    if(gpu->cmd_busy_cycles<cycles)cycles=gpu->cmd_busy_cycles+1;
+  }else if(gpu->pending_swap)return 1;
+  else{
+    int sz = nds_gxfifo_size(nds);
+    if(sz&&sz>=nds_gpu_cmd_params(gpu->fifo_cmd[gpu->fifo_read_ptr%NDS_GXFIFO_STORAGE]))return 1;
+  }
+  return cycles;
+}
+// Same as cycles calls of nds_tick_interrupts, nds_tick_timers, nds_tick_ppu and nds_tick_gx when only
+// the last one can have an event (see nds_cycles_to_next_event)
+static FORCE_INLINE void nds_tick_to_event(nds_t* nds, int cycles, bool render){
+  nds_tick_interrupts(nds);
+  // The FIFO can't change until the CPUs run again, so the refresh on the first cycle holds for the
+  // rest of the step
+  if(cycles>1&&!nds->gpu.cmd_busy_cycles)nds_tick_gx(nds);
+  nds->deferred_timer_ticks+=cycles-1;
+  nds->ppu[0].scan_clock+=cycles-1;
+  nds->ppu_fast_forward_ticks-=cycles-1;
+  if(nds->gpu.cmd_busy_cycles)nds->gpu.cmd_busy_cycles-=cycles-1;
+  nds_tick_timers(nds);
+  nds_tick_ppu(nds,render);
+  nds_tick_gx(nds);
+}
+// Start of a nds_tick iteration: DMA and the ARM7 instruction. Returns false when a full GX FIFO
+// stalls both CPUs.
+static FORCE_INLINE bool nds_tick_arm7_slot(sb_emu_state_t* emu, nds_t* nds, bool idle_loop_skip, arm7_hle_verify_t* hle_verify){
+  if(nds_gxfifo_size(nds)>=NDS_GXFIFO_SIZE)return false;
+  nds_tick_dma(nds,true);
+  if(SB_LIKELY(!nds->dma_processed[0] &&!nds->mem.slow_bus_cycles)){
+    uint32_t int7_if = nds7_io_read32(nds,NDS7_IF);
+    if(int7_if){
+      uint32_t ie = nds7_io_read32(nds,NDS7_IE);
+      uint32_t ime = nds7_io_read32(nds,NDS7_IME);
+      int7_if&=ie;
+      if((ime&0x1)&&int7_if) arm7_process_interrupts(&nds->arm7, int7_if);
+    }
+    uint32_t pc = nds->arm7.registers[PC];
+    if(SB_UNLIKELY(pc== emu->pc_breakpoint))nds->arm7.trigger_breakpoint=true;
+    else if(nds->arm7.block_cache)arm7_exec_cached_instruction(&nds->arm7);
+    else arm7_exec_instruction(&nds->arm7);
+    if(idle_loop_skip)nds_update_idle_loop(nds,0,pc,nds->current_clock);
+    if(SB_UNLIKELY(hle_verify))arm7_hle_verify_check(&hle_verify[0],&nds->arm7,"NDS7");
+  }
+  return true;
+}
+static FORCE_INLINE void nds_arm9_process_interrupts(nds_t* nds){
+  uint32_t int9_if = nds9_io_read32(nds,NDS9_IF);
+  if(int9_if){
+    int9_if &= nds9_io_read32(nds,NDS9_IE);
+    uint32_t ime = nds9_io_read32(nds,NDS9_IME);
+    if((ime&0x1)&&int9_if) arm7_process_interrupts(&nds->arm9, int9_if);
+  }
+}
+// End of a nds_tick iteration: advances the hardware by the cycles the CPUs took (or to the next
+// event when they are idle)
+static FORCE_INLINE void nds_tick_hardware(sb_emu_state_t* emu, nds_t* nds){
+  int ticks = 1;
+  if(nds->mem.slow_bus_cycles){
+    ticks = nds->mem.slow_bus_cycles;
+    nds->mem.slow_bus_cycles = 0; 
+  }
+
+  if(SB_LIKELY(!nds->active_if_pipe_stages)){
+    int ppu_fast_forward = nds->ppu_fast_forward_ticks;
+    if(nds->gpu.cmd_busy_cycles&&nds->gpu.cmd_busy_cycles<=ppu_fast_forward)ppu_fast_forward=nds->gpu.cmd_busy_cycles; 
+    int timer_fast_forward = nds->timer_ticks_before_event-nds->deferred_timer_ticks;
+    int fast_forward_ticks=ppu_fast_forward<timer_fast_forward?ppu_fast_forward:timer_fast_forward; 
+    if(fast_forward_ticks){
+      if(fast_forward_ticks>ticks){
+        // CPUs spinning in idle loops are skipped like halted ones, to the next event
+        if(!(nds_cpu_idle(nds,0)&&nds_cpu_idle(nds,1)))fast_forward_ticks=ticks;
+        else for(int c=0;c<2;++c){
+          if(nds->idle_loop_passes[c]>=2)arm7_idle_loop_skip(&nds->idle_loop[c],(uint64_t)(fast_forward_ticks-ticks)<<c);
+        }
+      }
+      nds->deferred_timer_ticks+=fast_forward_ticks;
+      nds->ppu[0].scan_clock+=fast_forward_ticks;
+      nds->ppu_fast_forward_ticks-=fast_forward_ticks;
+      if(nds->gpu.cmd_busy_cycles){
+        nds->gpu.cmd_busy_cycles-=fast_forward_ticks-1;
+      }
+      nds_tick_gx(nds);
+      nds->current_clock+=fast_forward_ticks;
+      ticks =ticks<fast_forward_ticks?0:ticks-fast_forward_ticks;
+    }
+    double delta_t = ((double)ticks+fast_forward_ticks)/(33513982);
+    nds_tick_audio(nds, emu,delta_t,ticks+fast_forward_ticks);
+  }else{
+    double delta_t = ((double)ticks)/(33513982);
+    nds_tick_audio(nds,emu,delta_t,ticks);
+  }
+  //nds_tick_sio(nds);
+  for(int t = 0;t<ticks;){
+    int cycles = nds_cycles_to_next_event(nds);
+    if(cycles>ticks-t)cycles=ticks-t;
+    nds_tick_to_event(nds,cycles,emu->render_frame);
+    t+=cycles;
+  }
+  nds->current_clock+=ticks;
+}
+// Same as the end of a nds_tick iteration followed by the start of the next one, for ARM9 code run by
+// the JIT or the threaded interpreter. They keep running only while the next ARM9 slot is an ordinary
+// one. The threaded interpreter tracks idle loops like nds_tick does, ctx->pc is the start of the
+// instruction that just ran.
+static FORCE_INLINE bool nds_arm9_slot_boundary(nds_arm9_run_ctx_t* ctx, bool track_idle_loops){
+  sb_emu_state_t* emu = ctx->emu;
+  nds_t* nds = ctx->nds;
+  if(track_idle_loops)nds_update_idle_loop(nds,1,ctx->pc,nds->current_clock*2+ctx->executed);
+  if(++ctx->executed<2){
+    ctx->iteration_done=ctx->resumed=false;
+    ctx->pc = nds->arm9.registers[PC];
+    if(SB_UNLIKELY(ctx->pc== emu->pc_breakpoint)){nds->arm9.trigger_breakpoint=true;return false;}
+    return true;
+  }
+  ctx->executed=0;
+  if(SB_UNLIKELY(nds->arm7.trigger_breakpoint||nds->arm9.trigger_breakpoint))return false;
+  // Idle loops aren't tracked in compiled code
+  if(!track_idle_loops)nds->idle_loop_passes[0]=nds->idle_loop_passes[1]=0;
+  nds_tick_hardware(emu,nds);
+  ctx->iteration_done=true;
+  if(nds->ppu[0].new_frame)return false;
+  ctx->cpus_run = nds_tick_arm7_slot(emu,nds,emu->idle_loop_skip,NULL);
+  ctx->resumed=true;
+  if(!ctx->cpus_run||nds->dma_processed[1]||SB_UNLIKELY(nds->arm7.trigger_breakpoint))return false;
+  uint32_t pc = nds->arm9.registers[PC];
+  nds_arm9_process_interrupts(nds);
+  if(nds->arm9.registers[PC]!=pc||nds->arm9.wait_for_interrupt||SB_UNLIKELY(pc== emu->pc_breakpoint))return false;
+  ctx->pc = pc;
+  return true;
+}
+static bool nds_arm9_jit_boundary(void* user_data){
+  return nds_arm9_slot_boundary((nds_arm9_run_ctx_t*)user_data,false);
+}
+static bool nds_arm9_threaded_boundary(void* user_data){
+  nds_arm9_run_ctx_t* ctx = (nds_arm9_run_ctx_t*)user_data;
+  return nds_arm9_slot_boundary(ctx,ctx->emu->idle_loop_skip);
+}
+// Runs compiled ARM9 code like arm9_jit_run. One in every NDS_JIT_VERIFY_INTERVAL runs is replayed on
+// a copy of the state with arm9_exec_instruction and the results compared.
+#ifndef NDS_JIT_VERIFY_INTERVAL
+#define NDS_JIT_VERIFY_INTERVAL 1024
+#endif
+static bool nds_arm9_jit_verify_run(sb_emu_state_t* emu, nds_t* nds, nds_scratch_t* scratch, nds_arm9_run_ctx_t* ctx){
+  arm7_jit_verify_t* v = &scratch->arm9_jit_verify;
+  const uint8_t* entry = arm9_jit_entry(&scratch->arm9_jit,&nds->arm9,arm7_jit_verify_boundary);
+  if(!entry)return false;
+  v->boundary = nds_arm9_jit_boundary;
+  v->ctx = ctx;
+  bool verify = arm7_jit_verify_due(v,NDS_JIT_VERIFY_INTERVAL);
+  nds_t* replay = &scratch->jit_verify_nds;
+  nds_arm9_run_ctx_t replay_ctx = *ctx;
+  if(verify){
+    memcpy(replay,nds,sizeof(nds_t));
+    memcpy(&scratch->jit_verify_emu,emu,sizeof(sb_emu_state_t));
+  }
+  uint32_t start_pc = nds->arm9.registers[PC];
+  arm7_jit_enter(&scratch->arm9_jit,&nds->arm9,v,entry);
+  if(!verify)return true;
+
+  replay_ctx.emu = &scratch->jit_verify_emu;
+  replay_ctx.nds = replay;
+  for(int cpu=0;cpu<2;++cpu){
+    arm7_t* replay_cpu = cpu? &replay->arm9: &replay->arm7;
+    replay_cpu->user_data = replay;
+    replay_cpu->block_cache = NULL;
+    arm7_code_window_flush(replay_cpu);
+  }
+  for(uint32_t i=0;i<v->instructions;++i){
+    arm9_exec_instruction(&replay->arm9);
+    if(!nds_arm9_jit_boundary(&replay_ctx))break;
+  }
+  v->verified++;
+  // The ARM7 runs in the boundary function, so it's compared too
+  bool match = arm7_jit_verify_cpu(v,&nds->arm9,&replay->arm9,start_pc,"NDS9")&&
+               arm7_jit_verify_cpu(v,&nds->arm7,&replay->arm7,start_pc,"NDS9 (ARM7)");
+  if(match&&(replay_ctx.executed!=ctx->executed||replay_ctx.iteration_done!=ctx->iteration_done||
+             replay_ctx.resumed!=ctx->resumed||replay_ctx.cpus_run!=ctx->cpus_run)){
+    printf("NDS9 JIT mismatch after %u instructions from 0x%08x: the run ended differently\n",v->instructions,start_pc);
+    match = false;
+  }
+  if(match&&memcmp(replay,nds,sizeof(nds_t))){
+    size_t offset = 0;
+    while(((uint8_t*)replay)[offset]==((uint8_t*)nds)[offset])++offset;
+    printf("NDS9 JIT mismatch after %u instructions from 0x%08x: nds_t differs at offset %zu\n",v->instructions,start_pc,offset);
+    match = false;
+  }
+  if(match&&memcmp(&scratch->jit_verify_emu.audio_ring_buff,&emu->audio_ring_buff,sizeof(emu->audio_ring_buff))){
+    printf("NDS9 JIT mismatch after %u instructions from 0x%08x: the audio output differs\n",v->instructions,start_pc);
+    match = false;
+  }
+  if(!match)v->mismatches++;
+  return true;
+}
 void nds_tick(sb_emu_state_t* emu, nds_t* nds, nds_scratch_t* scratch){
   //printf("#####New Frame#####\n");
   nds->ghosting_strength = emu->screen_ghosting_strength;
+  // A BESS save leaves the registers of the state unbanked
+  arm7_update_bank(&nds->arm7);
+  arm7_update_bank(&nds->arm9);
 
   nds->arm7.read8      = nds7_arm_read8;
   nds->arm7.read16     = nds7_arm_read16;
@@ -6687,8 +7493,34 @@ void nds_tick(sb_emu_state_t* emu, nds_t* nds, nds_scratch_t* scratch){
   nds->arm9.coprocessor_read =  nds->arm7.coprocessor_read =nds_coprocessor_read;
   nds->arm9.coprocessor_write=  nds->arm7.coprocessor_write=nds_coprocessor_write;
 
+  nds->arm7.code_ptr = nds7_arm_code_ptr;
+  nds->arm9.code_ptr = nds9_arm_code_ptr;
+  nds->arm7.block_transfer = nds7_arm_block_transfer;
+  nds->arm9.block_transfer = nds9_arm_block_transfer;
+  nds->arm7.cached_fetch = nds7_arm_cached_fetch;
+  nds->arm9.cached_fetch = nds9_arm_cached_fetch;
+  nds->arm7.swi_hle = emu->bios_hle? nds7_bios_hle: NULL;
+  nds->arm9.swi_hle = emu->bios_hle? nds9_bios_hle: NULL;
+  nds->hle_verify = emu->bios_hle&&emu->bios_hle_verify? scratch->hle_verify: NULL;
+  if(!emu->bios_hle||nds->hle_verify)memset(nds->hle_intr_wait,0,sizeof(nds->hle_intr_wait));
+#if ARM7_STATIC_BUS
+  arm7_bind_bus_handlers(&nds->arm7,nds7_arm_handlers,nds7_thumb_handlers);
+  arm7_bind_bus_handlers(&nds->arm9,nds9_arm_handlers,nds9_thumb_handlers);
+#endif
+
   nds->arm7.user_data = (void*)nds;
   nds->arm9.user_data = (void*)nds;
+  nds->arm7.block_cache = emu->arm_block_cache||emu->arm_jit? &scratch->arm7_block_cache: NULL;
+  nds->arm9.block_cache = emu->arm_block_cache||emu->arm_jit? &scratch->arm9_block_cache: NULL;
+  // State loads, rewinds and resets replace the emulated memory without going through the bus, so
+  // blocks (and the ARM9's compiled code) are only kept when the core resumes exactly where the last
+  // tick stopped. Debugger and cheat writes between frames go through the bus and invalidate them.
+  if(scratch->block_cache_resume_clock!=nds->current_clock||!scratch->arm9_block_cache.epoch){
+    arm7_block_cache_flush(nds->arm7.block_cache);
+    arm7_block_cache_flush(nds->arm9.block_cache);
+  }
+  arm7_code_window_flush(&nds->arm7);
+  arm7_code_window_flush(&nds->arm9);
 
   nds->mem.nds7_bios=scratch->nds7_bios;
   nds->mem.nds9_bios=scratch->nds9_bios;
@@ -6702,6 +7534,12 @@ void nds_tick(sb_emu_state_t* emu, nds_t* nds, nds_scratch_t* scratch){
   nds->framebuffer_3d=scratch->framebuffer_3d;
   nds->framebuffer_3d_disp=scratch->framebuffer_3d_disp;
   nds->gpu.vert_buffer=scratch->vert_buffer;
+#if NDS_THREADED_PPU
+  nds_ppu_worker_start(&scratch->ppu_worker);
+  nds->ppu_worker = &scratch->ppu_worker;
+#else
+  nds->ppu_worker = NULL;
+#endif
   nds_tick_rtc(nds);
   nds_tick_keypad(&emu->joy,nds);
   nds_tick_touch(&emu->joy,nds);
@@ -6712,34 +7550,81 @@ void nds_tick(sb_emu_state_t* emu, nds_t* nds, nds_scratch_t* scratch){
     d[i]&=0x9191919191919191ULL;
   }
   nds->ppu[0].new_frame=false;
+  nds_arm9_run_ctx_t arm9_ctx = {emu,nds};
+  bool idle_loop_skip = emu->idle_loop_skip;
+  if(!idle_loop_skip)nds->idle_loop_passes[0]=nds->idle_loop_passes[1]=0;
+  // Verifying the BIOS HLE checks for the return of the SWIs after every instruction, which the
+  // threaded interpreter and fused Thumb pairs don't stop for
+  arm7_hle_verify_t* hle_verify = nds->hle_verify;
+  bool thumb_fusion = emu->thumb_fusion&&!hle_verify;
+  bool use_jit = emu->arm_jit&&nds->arm9.block_cache&&!hle_verify;
+  bool jit_verify = use_jit&&emu->arm_jit_verify;
+  if(use_jit){
+    // The ARM7 runs inside nds_arm9_jit_boundary, so it can't be skipped with a cycle budget
+    arm7_jit_system_t system;
+    memset(&system,0,sizeof(system));
+    system.pages = nds->mem.pages[NDS_ARM9];
+    system.page_shift = NDS_MEM_PAGE_SHIFT;
+    system.page_limit = NDS_MEM_PAGE_LIMIT;
+    system.read_flag = NDS_MEM_PAGE_READ;
+    system.write_flag = NDS_MEM_PAGE_WRITE;
+    system.write8_flag = NDS_MEM_PAGE_WRITE8;
+    system.code_flag = NDS_MEM_PAGE_CODE;
+    system.code_write = nds_jit_code_write;
+    system.slow_cycles = offsetof(nds_t,mem.slow_bus_cycles);
+    system.openbus = offsetof(nds_t,mem.openbus_word);
+    arm7_jit_set_system(&scratch->arm9_jit,&system);
+  }
   while(!nds->ppu[0].new_frame){
-    bool gx_fifo_full = nds_gxfifo_size(nds)>=NDS_GXFIFO_SIZE;
-    if(!gx_fifo_full){
-      nds_tick_dma(nds,true);
-      if(SB_LIKELY(!nds->dma_processed[0] &&!nds->mem.slow_bus_cycles)){
-        uint32_t int7_if = nds7_io_read32(nds,NDS7_IF);
-        if(int7_if){
-          uint32_t ie = nds7_io_read32(nds,NDS7_IE);
-          uint32_t ime = nds7_io_read32(nds,NDS7_IME);
-          int7_if&=ie;
-          if((ime&0x1)&&int7_if) arm7_process_interrupts(&nds->arm7, int7_if);
-        }
-        if(SB_UNLIKELY(nds->arm7.registers[PC]== emu->pc_breakpoint))nds->arm7.trigger_breakpoint=true;
-        else arm7_exec_instruction(&nds->arm7);
-      }
+    bool cpus_run = arm9_ctx.resumed? arm9_ctx.cpus_run: nds_tick_arm7_slot(emu,nds,idle_loop_skip,hle_verify);
+    arm9_ctx.resumed=false;
+    if(cpus_run){
       if(SB_LIKELY(!nds->dma_processed[1])){
-        uint32_t int9_if = nds9_io_read32(nds,NDS9_IF);
-        if(int9_if){
-          int9_if &= nds9_io_read32(nds,NDS9_IE);
-          uint32_t ime = nds9_io_read32(nds,NDS9_IME);
-          if((ime&0x1)&&int9_if) arm7_process_interrupts(&nds->arm9, int9_if);
-        }
+        nds_arm9_process_interrupts(nds);
         if(SB_LIKELY(!nds->arm9.wait_for_interrupt)){
-          if(SB_UNLIKELY(nds->arm9.registers[PC]== emu->pc_breakpoint))nds->arm9.trigger_breakpoint=true;
-          else{
+          // ARM9 idle loops are clocked in ARM9 cycles (two per tick)
+          uint32_t pc = nds->arm9.registers[PC];
+          arm9_ctx.pc = pc;
+          if(SB_UNLIKELY(pc== emu->pc_breakpoint))nds->arm9.trigger_breakpoint=true;
+          else if(use_jit&&(SB_UNLIKELY(jit_verify)? nds_arm9_jit_verify_run(emu,nds,scratch,&arm9_ctx):
+                                                     arm9_jit_run(&scratch->arm9_jit,&nds->arm9,nds_arm9_jit_boundary,&arm9_ctx))){
+            if(arm9_ctx.executed==1&&!nds->arm9.trigger_breakpoint)arm9_exec_cached_instruction(&nds->arm9);
+            arm9_ctx.executed=0;
+            nds->idle_loop_passes[0]=nds->idle_loop_passes[1]=0;
+            // The boundary may have run the hardware (and the start of the next iteration) already
+            if(arm9_ctx.iteration_done){arm9_ctx.iteration_done=false;continue;}
+          }else if(nds->arm9.block_cache){
+            // A fused pair runs in both slots (the boundary already stopped for a breakpoint on its second op)
+            int executed = 1;
+            if(thumb_fusion)executed = arm9_exec_cached_fused(&nds->arm9,nds_arm9_fused_boundary,&arm9_ctx);
+            else arm9_exec_cached_instruction(&nds->arm9);
+            if(executed==1){
+              if(idle_loop_skip)nds_update_idle_loop(nds,1,pc,nds->current_clock*2);
+              if(SB_UNLIKELY(hle_verify))arm7_hle_verify_check(&hle_verify[1],&nds->arm9,"NDS9");
+              pc = nds->arm9.registers[PC];
+              if(SB_UNLIKELY(pc== emu->pc_breakpoint))nds->arm9.trigger_breakpoint=true;
+              else arm9_exec_cached_instruction(&nds->arm9);
+            }else pc+=2;
+            if(idle_loop_skip)nds_update_idle_loop(nds,1,pc,nds->current_clock*2+1);
+            if(SB_UNLIKELY(hle_verify))arm7_hle_verify_check(&hle_verify[1],&nds->arm9,"NDS9");
+          }else if(ARM7_THREADED_INTERPRETER&&!hle_verify&&arm9_exec_threaded(&nds->arm9,nds_arm9_threaded_boundary,&arm9_ctx)){
+            // Halting after the first instruction still lets the second one see wait_for_interrupt
+            if(arm9_ctx.executed==1&&!nds->arm9.trigger_breakpoint){
+              pc = nds->arm9.registers[PC];
+              arm9_exec_instruction(&nds->arm9);
+              if(idle_loop_skip)nds_update_idle_loop(nds,1,pc,nds->current_clock*2+1);
+            }
+            arm9_ctx.executed=0;
+            if(arm9_ctx.iteration_done){arm9_ctx.iteration_done=false;continue;}
+          }else{
             arm9_exec_instruction(&nds->arm9);
-            if(SB_UNLIKELY(nds->arm9.registers[PC]== emu->pc_breakpoint))nds->arm9.trigger_breakpoint=true;
+            if(idle_loop_skip)nds_update_idle_loop(nds,1,pc,nds->current_clock*2);
+            if(SB_UNLIKELY(hle_verify))arm7_hle_verify_check(&hle_verify[1],&nds->arm9,"NDS9");
+            pc = nds->arm9.registers[PC];
+            if(SB_UNLIKELY(pc== emu->pc_breakpoint))nds->arm9.trigger_breakpoint=true;
             else arm9_exec_instruction(&nds->arm9);
+            if(idle_loop_skip)nds_update_idle_loop(nds,1,pc,nds->current_clock*2+1);
+            if(SB_UNLIKELY(hle_verify))arm7_hle_verify_check(&hle_verify[1],&nds->arm9,"NDS9");
           }
         }
       }
@@ -6749,45 +7634,10 @@ void nds_tick(sb_emu_state_t* emu, nds_t* nds, nds_scratch_t* scratch){
         nds->arm9.trigger_breakpoint=false;
         break;
       }
-    }      
-    int ticks = 1;
-    if(nds->mem.slow_bus_cycles){
-      ticks = nds->mem.slow_bus_cycles;
-      nds->mem.slow_bus_cycles = 0; 
     }
-
-    if(SB_LIKELY(!nds->active_if_pipe_stages)){
-      int ppu_fast_forward = nds->ppu_fast_forward_ticks;
-      if(nds->gpu.cmd_busy_cycles&&nds->gpu.cmd_busy_cycles<=ppu_fast_forward)ppu_fast_forward=nds->gpu.cmd_busy_cycles; 
-      int timer_fast_forward = nds->timer_ticks_before_event-nds->deferred_timer_ticks;
-      int fast_forward_ticks=ppu_fast_forward<timer_fast_forward?ppu_fast_forward:timer_fast_forward; 
-      if(fast_forward_ticks){
-        if(!(nds->arm9.wait_for_interrupt&&nds->arm7.wait_for_interrupt)&&fast_forward_ticks>ticks)fast_forward_ticks=ticks;
-        nds->deferred_timer_ticks+=fast_forward_ticks;
-        nds->ppu[0].scan_clock+=fast_forward_ticks;
-        nds->ppu_fast_forward_ticks-=fast_forward_ticks;
-        if(nds->gpu.cmd_busy_cycles){
-          nds->gpu.cmd_busy_cycles-=fast_forward_ticks-1;
-        }
-        nds_tick_gx(nds);
-        nds->current_clock+=fast_forward_ticks;
-        ticks =ticks<fast_forward_ticks?0:ticks-fast_forward_ticks;
-      }
-      double delta_t = ((double)ticks+fast_forward_ticks)/(33513982);
-      nds_tick_audio(nds, emu,delta_t,ticks+fast_forward_ticks);
-    }else{
-      double delta_t = ((double)ticks)/(33513982);
-      nds_tick_audio(nds,emu,delta_t,ticks);
-    }
-    //nds_tick_sio(nds);
-    for(int t = 0;t<ticks;++t){
-      nds_tick_interrupts(nds);
-      nds_tick_timers(nds);
-      nds_tick_ppu(nds,emu->render_frame);
-      nds_tick_gx(nds);
-    }
-    nds->current_clock+=ticks;
+    nds_tick_hardware(emu,nds);
   }
+  scratch->block_cache_resume_clock = nds->arm9.block_cache? nds->current_clock: UINT64_MAX;
 }
 // See: http://merry.usamimi.org/archex/SysReg_v84A_xml-00bet7/enc_index.xml#mcr_mrc_32
 uint32_t nds_coprocessor_read(void* user_data, int coproc,int opcode,int Cn, int Cm,int Cp){
@@ -6807,6 +7657,13 @@ void nds_coprocessor_write(void* user_data, int coproc,int opcode,int Cn, int Cm
   if(opcode!=0)printf("Unsupported opcode(%x) for coproc %d\n",opcode,coproc);
   nds_t * nds = (nds_t*)(user_data);
   nds->cp15.reg[(Cn*16+Cm)*8+Cp]=data;
+  // TCM changes remap the ARM9 address space
+  bool tcm_change = (Cn==1&&Cm==0)||(Cn==9&&Cm==1);
+  const uint32_t old_tcm[4]={nds->mem.dtcm_start_address,nds->mem.dtcm_end_address,nds->mem.itcm_start_address,nds->mem.itcm_end_address};
+  if(tcm_change){
+    arm7_block_cache_flush(nds->arm9.block_cache);
+    arm7_code_window_flush(&nds->arm9);
+  }
   //C9,C1,0 - Data TCM Size/Base (R/W)
   //C9,C1,1 - Instruction TCM Size/Base (R/W)
   if(Cn==1&&Cm==0){
@@ -6839,6 +7696,12 @@ void nds_coprocessor_write(void* user_data, int coproc,int opcode,int Cn, int Cm
   }else{
     printf("Unhandled: Cn:%d Cm:%d Cp:%d\n",Cn,Cm,Cp);
   }
+  if(tcm_change){
+    nds_update_mem_pages(nds,NDS_ARM9,old_tcm[0],old_tcm[1]);
+    nds_update_mem_pages(nds,NDS_ARM9,old_tcm[2],old_tcm[3]);
+    nds_update_mem_pages(nds,NDS_ARM9,nds->mem.dtcm_start_address,nds->mem.dtcm_end_address);
+    nds_update_mem_pages(nds,NDS_ARM9,nds->mem.itcm_start_address,nds->mem.itcm_end_address);
+  }
 }
 static bool nds_run_ar_cheat(nds_t* nds, const uint32_t* buffer, uint32_t size){
   if(!buffer){
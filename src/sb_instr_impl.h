@@ -59,11 +59,11 @@
 #define SB_C_BIT 4U
 
 uint16_t sb_read16(sb_gb_t *gb, int addr);
-uint8_t sb_read8(sb_gb_t *gb, int addr);
-void sb_store8(sb_gb_t *gb, int addr, int value);
+static FORCE_INLINE uint8_t sb_read8(sb_gb_t *gb, int addr);
+static FORCE_INLINE void sb_store8(sb_gb_t *gb, int addr, int value);
 void sb_store16(sb_gb_t *gb, int addr, unsigned int value);
 
-void sb_set_flags(sb_gb_t *gb, const uint8_t* flag_mask, int Z, int N, int H, int C){
+static FORCE_INLINE void sb_set_flags(sb_gb_t *gb, const uint8_t* flag_mask, int Z, int N, int H, int C){
   
   if(flag_mask[0]=='-')Z=-1;
   if(flag_mask[1]=='-')N=-1;
@@ -83,7 +83,7 @@ void sb_set_flags(sb_gb_t *gb, const uint8_t* flag_mask, int Z, int N, int H, in
   int flags = (Z<<SB_Z_BIT)|(N<<SB_N_BIT)|(H<<SB_H_BIT)|(C<<SB_C_BIT);
   gb->cpu.af = (gb->cpu.af&0xff00)|flags;
 }
-int sb_load_operand(sb_gb_t* gb, int operand){
+static FORCE_INLINE int sb_load_operand(sb_gb_t* gb, int operand){
   switch(operand){
     case SB_OP_0: { return 0; }
     case SB_OP_00H: { return 0; }
@@ -135,7 +135,7 @@ int sb_load_operand(sb_gb_t* gb, int operand){
   return 0;
 }
 
-void sb_store_operand(sb_gb_t* gb, int operand, unsigned int value){
+static FORCE_INLINE void sb_store_operand(sb_gb_t* gb, int operand, unsigned int value){
   switch(operand){
     case SB_OP_A: { SB_U16_HI_SET(gb->cpu.af,value); return; }
     case SB_OP_AF: { gb->cpu.af = value & 0xfff0; return; }
@@ -169,8 +169,8 @@ void sb_store_operand(sb_gb_t* gb, int operand, unsigned int value){
   printf("Unhandled write operand %d\n",operand);
   return;
 }
-static void sb_push_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask);
-static void sb_adc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_push_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask);
+static FORCE_INLINE void sb_adc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int C = SB_BFE(gb->cpu.af,SB_C_BIT,1);
   int r = ((op1&0xff)+(op2&0xff)+C)&0xff;
   //HL calculates half carry as the carry out from bit 11, carry as the carry out from bit 15
@@ -187,7 +187,7 @@ static void sb_adc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   
 }
 
-static void sb_add_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_add_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int r = ((op1&0xff)+(op2&0xff))&0xff;
   //HL calculates half carry as the carry out from bit 11, carry as the carry out from bit 15
   //ADD sp, i8 uses bits 3/7 respectively
@@ -210,33 +210,33 @@ static void sb_add_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_set_flags(gb, flag_mask, zero,0,half_carry,carry);
 }
 
-static void sb_and_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_and_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int res = SB_U16_HI(gb->cpu.af) & op2 ;
   SB_U16_HI_SET(gb->cpu.af, res );
   bool zero = res==0;
   sb_set_flags(gb, flag_mask, zero,0,1,0);
 }
 
-static void sb_bit_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_bit_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   bool Z = (op2& (1<<op1))==0;
   sb_set_flags(gb, flag_mask, Z,0,1,-1);
 }
 
-static void sb_call_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_call_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   sb_push_impl(gb,gb->cpu.pc,op2,op1_enum,op2_enum,flag_mask);
   gb->cpu.pc = op1;
 }
 
-static void sb_callc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_callc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   if(op1){sb_call_impl(gb, op2, 0, 0, 0, flag_mask);gb->cpu.branch_taken=true;}
 }
 
-static void sb_ccf_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_ccf_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   unsigned carry = SB_BFE(gb->cpu.af,SB_C_BIT,1);
   sb_set_flags(gb,flag_mask,-1,0,0,!carry);
 }
 
-static void sb_cp_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_cp_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   //HL calculates half carry as the carry out from bit 11, carry as the carry out from bit 15
   //ADD sp, i8 uses bits 3/7 respectively
   bool carry = op1<op2;
@@ -247,13 +247,13 @@ static void sb_cp_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum
   
 }
 
-static void sb_cpl_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_cpl_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int a = SB_U16_HI(gb->cpu.af)^0xff;
   SB_U16_HI_SET(gb->cpu.af, a);
   sb_set_flags(gb, flag_mask, -1,1,1,-1);
 }
 
-static void sb_daa_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_daa_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int a = SB_U16_HI(gb->cpu.af);
   bool H = SB_BFE(gb->cpu.af,SB_H_BIT,1);
   bool C = SB_BFE(gb->cpu.af,SB_C_BIT,1);
@@ -269,48 +269,48 @@ static void sb_daa_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_set_flags(gb, flag_mask, (a&0xff)==0,-1,0,C);
 }
 
-static void sb_dec_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_dec_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int r = op1-1;
   sb_set_flags(gb, flag_mask, (r&0xff)==0,1,((op1&0xf)-1)<0,-1);
   sb_store_operand(gb,op1_enum, r);
 }
 
-static void sb_di_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_di_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   gb->cpu.interrupt_enable = false;
   gb->cpu.deferred_interrupt_enable = false;
 }
 
-static void sb_ei_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_ei_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   gb->cpu.deferred_interrupt_enable = true;
 }
 
-static void sb_halt_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_halt_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   gb->cpu.wait_for_interrupt=true;
 }
 
-static void sb_inc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_inc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int r = op1+1;
   sb_set_flags(gb,flag_mask, (r&0xff)==0,0,((op1&0xf)+1)>0xf,-1);
   sb_store_operand(gb,op1_enum, r);
 }
 
-static void sb_jp_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_jp_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   gb->cpu.pc = op1;
 }
 
-static void sb_jpc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_jpc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   if(op1){sb_jp_impl(gb, op2, 0, 0, 0, flag_mask);gb->cpu.branch_taken=true;}
 }
 
-static void sb_jr_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_jr_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   gb->cpu.pc += (int8_t)op1;
 }
 
-static void sb_jrc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_jrc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   if(op1){ sb_jr_impl(gb, op2, 0, 0, 0, flag_mask);gb->cpu.branch_taken=true;}
 }
 
-static void sb_ld_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_ld_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   if(op1_enum == SB_OP_U16_INDIRECT && op2_enum==SB_OP_SP){
     sb_store16(gb, sb_read16(gb, gb->cpu.pc-2), op2);
   }else if(op1_enum == SB_OP_HL && op2_enum==SB_OP_SP_PLUS_I8){
@@ -324,56 +324,56 @@ static void sb_ld_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum
   }else sb_store_operand(gb,op1_enum,op2);
 }
 
-static void sb_nop_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_nop_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
 }
 
-static void sb_nop_no_instr_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_nop_no_instr_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   //This instruction should never be called, break if it does
   gb->cpu.trigger_breakpoint=true;
   printf("NOP_NO_INSTR executed\n");
 }
 
-static void sb_or_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_or_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int r = SB_U16_HI(gb->cpu.af) | op2;
   SB_U16_HI_SET(gb->cpu.af, r);
   bool zero = r==0;
   sb_set_flags(gb, flag_mask, zero,0,0,0);
 }
 
-static void sb_pop_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_pop_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   sb_store_operand(gb,op1_enum,sb_read16(gb,gb->cpu.sp));
   gb->cpu.sp+=2;
 }
 
-static void sb_prefix_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_prefix_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   gb->cpu.prefix_op = true;
 }
 
-static void sb_push_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_push_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   gb->cpu.sp-=2;
   sb_store16(gb,gb->cpu.sp,op1);
 }
 
-static void sb_res_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_res_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int r = op2& (~(1<<op1));
   sb_store_operand(gb,op2_enum,r);
 }
 
-static void sb_ret_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_ret_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   gb->cpu.pc=sb_read16(gb,gb->cpu.sp);
   gb->cpu.sp+=2;
 }
 
-static void sb_retc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_retc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   if(op1){sb_ret_impl(gb, op2, 0, 0, 0,flag_mask);gb->cpu.branch_taken=true;}
 }
 
-static void sb_reti_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_reti_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   sb_ret_impl(gb,op1,op2,op1_enum,op2_enum,flag_mask);
   sb_ei_impl(gb,op1,op2,op1_enum,op2_enum,flag_mask);
 }
 
-static void sb_rl_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_rl_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   unsigned carry = SB_BFE(gb->cpu.af,SB_C_BIT,1);
   unsigned int carry_out = SB_BFE(op1,7,1);
@@ -382,7 +382,7 @@ static void sb_rl_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum
   sb_set_flags(gb, flag_mask, (op1&0xff)==0,0,0,carry_out);
 }
 
-static void sb_rla_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_rla_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   op1 = SB_U16_HI(gb->cpu.af);
   unsigned carry = SB_BFE(gb->cpu.af,SB_C_BIT,1);
@@ -392,7 +392,7 @@ static void sb_rla_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_set_flags(gb, flag_mask, 0,0,0,carry_out);
 }
 
-static void sb_rlc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_rlc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   unsigned carry = SB_BFE(gb->cpu.af,SB_C_BIT,1);
   unsigned int carry_out = SB_BFE(op1,7,1);
@@ -401,7 +401,7 @@ static void sb_rlc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_set_flags(gb, flag_mask, (op1&0xff)==0,0,0,carry_out);
 }
 
-static void sb_rlca_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_rlca_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   op1 = SB_U16_HI(gb->cpu.af);
   unsigned carry = SB_BFE(gb->cpu.af,SB_C_BIT,1);
@@ -411,7 +411,7 @@ static void sb_rlca_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_en
   sb_set_flags(gb, flag_mask, 0,0,0,carry_out);
 }
 
-static void sb_rr_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_rr_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   unsigned carry = SB_BFE(gb->cpu.af,SB_C_BIT,1);
   unsigned int carry_out = op1&1;
@@ -421,7 +421,7 @@ static void sb_rr_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum
   
 }
 
-static void sb_rra_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_rra_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   unsigned int a = SB_U16_HI(gb->cpu.af);
   unsigned carry = SB_BFE(gb->cpu.af,SB_C_BIT,1);
@@ -431,7 +431,7 @@ static void sb_rra_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_set_flags(gb, flag_mask, 0,0,0,carry_out);
 }
 
-static void sb_rrc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_rrc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   unsigned carry = SB_BFE(gb->cpu.af,SB_C_BIT,1);
   unsigned int carry_out = SB_BFE(op1,0,1);
@@ -440,7 +440,7 @@ static void sb_rrc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_store_operand(gb,op1_enum,op1);
 }
 
-static void sb_rrca_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_rrca_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   op1 = SB_U16_HI(gb->cpu.af);
   unsigned carry = SB_BFE(gb->cpu.af,SB_C_BIT,1);
@@ -450,11 +450,11 @@ static void sb_rrca_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_en
   SB_U16_HI_SET(gb->cpu.af,op1);
 }
 
-static void sb_rst_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_rst_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   sb_call_impl(gb,op1,op2,op1_enum,op2_enum,flag_mask);
 }
 
-static void sb_sbc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_sbc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int C = SB_BFE(gb->cpu.af,SB_C_BIT,1);
   int r = ((op1&0xff)-(op2&0xff)-C)&0xff;
   //HL calculates half carry as the carry out from bit 11, carry as the carry out from bit 15
@@ -469,16 +469,16 @@ static void sb_sbc_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_store_operand(gb,op1_enum, r);
   sb_set_flags(gb, flag_mask,r==0,1,half_carry,carry);}
 
-static void sb_scf_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_scf_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   sb_set_flags(gb,flag_mask,-1,0,0,1);
 }
 
-static void sb_set_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_set_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int r = op2| (1<<op1);
   sb_store_operand(gb,op2_enum,r);
 }
 
-static void sb_sla_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_sla_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   unsigned int carry_out = SB_BFE(op1,7,1);
   op1 = (op1<<1);
@@ -486,7 +486,7 @@ static void sb_sla_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_set_flags(gb, flag_mask, (op1&0xff) ==0,0,0,carry_out);
 }
 
-static void sb_sra_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_sra_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   unsigned int carry_out = op1&1;
   op1 = (op1>>1)|(op1&0x80);
@@ -494,7 +494,7 @@ static void sb_sra_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_set_flags(gb, flag_mask, (op1&0xff) ==0,0,0,carry_out);
 }
 
-static void sb_srl_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_srl_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   // See: http://www.devrs.com/gb/files/opcodes.html
   unsigned int carry_out = op1&1;
   op1 = (op1>>1);
@@ -502,7 +502,7 @@ static void sb_srl_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   sb_set_flags(gb, flag_mask, (op1&0xff) ==0,0,0,carry_out);
 }
 
-static void sb_stop_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_stop_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   gb->cpu.wait_for_interrupt=true;
   gb->cpu.interrupt_enable = true; 
   // Div is reset on stop
@@ -510,7 +510,7 @@ static void sb_stop_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_en
   sb_store8(gb,0xff04,0);
 }
 
-static void sb_sub_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_sub_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int r = ((op1&0xff)-(op2&0xff))&0xff;
   //HL calculates half carry as the carry out from bit 11, carry as the carry out from bit 15
   //ADD sp, i8 uses bits 3/7 respectively
@@ -527,7 +527,7 @@ static void sb_sub_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enu
   
 }
 
-static void sb_swap_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_swap_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   int r = ((op1&0xf)<<4)|((op1&0xf0)>>4);
   bool zero = (r&0xff) ==0;
   sb_store_operand(gb,op1_enum, r);
@@ -535,7 +535,7 @@ static void sb_swap_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_en
   
 }
 
-static void sb_xor_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
+static FORCE_INLINE void sb_xor_impl(sb_gb_t* gb, int op1, int op2, int op1_enum, int op2_enum, const uint8_t * flag_mask){
   unsigned res = ((SB_U16_HI(gb->cpu.af)) ^op2)&0xff;
   bool zero = (res&0xff)==0;
   sb_set_flags(gb, flag_mask, zero,0,0,0);
@@ -0,0 +1,3450 @@
+
+// This file is autogenerated do not edit
+
+#ifndef SB_INSTR_SPECIALIZED
+#define SB_INSTR_SPECIALIZED 1
+
+#include "sb_instr_tables.h"
+
+// Runs opcode op (256+ for CB prefixed opcodes) whose byte(s) the PC points at. Returns the cycles
+// it takes before the fetch of the next opcode (see sb_tick).
+static FORCE_INLINE int sb_exec_specialized(sb_gb_t* gb, unsigned op){
+  switch(op){
+    case 0x000: { // NOP
+      gb->cpu.pc+=1;
+      sb_nop_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x001: { // LD BC,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_BC);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_ld_impl(gb,op1,op2,SB_OP_BC,SB_OP_U16,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x002: { // LD (BC),A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_BC_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_BC_INDIRECT,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x003: { // INC BC
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_BC);
+      sb_inc_impl(gb,op1,0,SB_OP_BC,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x004: { // INC B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_inc_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z0H-");
+      return 4;
+    }
+    case 0x005: { // DEC B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_dec_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z1H-");
+      return 4;
+    }
+    case 0x006: { // LD B,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_ld_impl(gb,op1,op2,SB_OP_B,SB_OP_U8,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x007: { // RLCA
+      gb->cpu.pc+=1;
+      sb_rlca_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"000C");
+      return 4;
+    }
+    case 0x008: { // LD (u16),SP
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_U16_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_SP);
+      sb_ld_impl(gb,op1,op2,SB_OP_U16_INDIRECT,SB_OP_SP,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x009: { // ADD HL,BC
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      int op2 = sb_load_operand(gb,SB_OP_BC);
+      sb_add_impl(gb,op1,op2,SB_OP_HL,SB_OP_BC,(const uint8_t*)"-0HC");
+      return 4;
+    }
+    case 0x00a: { // LD A,(BC)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_BC_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_BC_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x00b: { // DEC BC
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_BC);
+      sb_dec_impl(gb,op1,0,SB_OP_BC,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x00c: { // INC C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_inc_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z0H-");
+      return 4;
+    }
+    case 0x00d: { // DEC C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_dec_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z1H-");
+      return 4;
+    }
+    case 0x00e: { // LD C,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_ld_impl(gb,op1,op2,SB_OP_C,SB_OP_U8,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x00f: { // RRCA
+      gb->cpu.pc+=1;
+      sb_rrca_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"000C");
+      return 4;
+    }
+    case 0x010: { // STOP
+      gb->cpu.pc+=2;
+      sb_stop_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x011: { // LD DE,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_DE);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_ld_impl(gb,op1,op2,SB_OP_DE,SB_OP_U16,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x012: { // LD (DE),A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_DE_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_DE_INDIRECT,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x013: { // INC DE
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_DE);
+      sb_inc_impl(gb,op1,0,SB_OP_DE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x014: { // INC D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_inc_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z0H-");
+      return 4;
+    }
+    case 0x015: { // DEC D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_dec_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z1H-");
+      return 4;
+    }
+    case 0x016: { // LD D,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_ld_impl(gb,op1,op2,SB_OP_D,SB_OP_U8,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x017: { // RLA
+      gb->cpu.pc+=1;
+      sb_rla_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"000C");
+      return 4;
+    }
+    case 0x018: { // JR i8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_I8);
+      sb_jr_impl(gb,op1,0,SB_OP_I8,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x019: { // ADD HL,DE
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      int op2 = sb_load_operand(gb,SB_OP_DE);
+      sb_add_impl(gb,op1,op2,SB_OP_HL,SB_OP_DE,(const uint8_t*)"-0HC");
+      return 4;
+    }
+    case 0x01a: { // LD A,(DE)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_DE_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_DE_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x01b: { // DEC DE
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_DE);
+      sb_dec_impl(gb,op1,0,SB_OP_DE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x01c: { // INC E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_inc_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z0H-");
+      return 4;
+    }
+    case 0x01d: { // DEC E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_dec_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z1H-");
+      return 4;
+    }
+    case 0x01e: { // LD E,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_ld_impl(gb,op1,op2,SB_OP_E,SB_OP_U8,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x01f: { // RRA
+      gb->cpu.pc+=1;
+      sb_rra_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"000C");
+      return 4;
+    }
+    case 0x020: { // JRC NZ_FLAG,i8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_NZ_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_I8);
+      sb_jrc_impl(gb,op1,op2,SB_OP_NZ_FLAG,SB_OP_I8,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 8;}
+      return 4;
+    }
+    case 0x021: { // LD HL,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL,SB_OP_U16,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x022: { // LD (HL+),A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INC_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_INC_INDIRECT,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x023: { // INC HL
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      sb_inc_impl(gb,op1,0,SB_OP_HL,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x024: { // INC H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_inc_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z0H-");
+      return 4;
+    }
+    case 0x025: { // DEC H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_dec_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z1H-");
+      return 4;
+    }
+    case 0x026: { // LD H,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_ld_impl(gb,op1,op2,SB_OP_H,SB_OP_U8,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x027: { // DAA
+      gb->cpu.pc+=1;
+      sb_daa_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"Z-0C");
+      return 4;
+    }
+    case 0x028: { // JRC Z_FLAG,i8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_Z_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_I8);
+      sb_jrc_impl(gb,op1,op2,SB_OP_Z_FLAG,SB_OP_I8,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 8;}
+      return 4;
+    }
+    case 0x029: { // ADD HL,HL
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      int op2 = sb_load_operand(gb,SB_OP_HL);
+      sb_add_impl(gb,op1,op2,SB_OP_HL,SB_OP_HL,(const uint8_t*)"-0HC");
+      return 4;
+    }
+    case 0x02a: { // LD A,(HL+)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INC_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INC_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x02b: { // DEC HL
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      sb_dec_impl(gb,op1,0,SB_OP_HL,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x02c: { // INC L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_inc_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z0H-");
+      return 4;
+    }
+    case 0x02d: { // DEC L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_dec_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z1H-");
+      return 4;
+    }
+    case 0x02e: { // LD L,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_ld_impl(gb,op1,op2,SB_OP_L,SB_OP_U8,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x02f: { // CPL
+      gb->cpu.pc+=1;
+      sb_cpl_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"-11-");
+      return 4;
+    }
+    case 0x030: { // JRC NC_FLAG,i8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_NC_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_I8);
+      sb_jrc_impl(gb,op1,op2,SB_OP_NC_FLAG,SB_OP_I8,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 8;}
+      return 4;
+    }
+    case 0x031: { // LD SP,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_SP);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_ld_impl(gb,op1,op2,SB_OP_SP,SB_OP_U16,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x032: { // LD (HL-),A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_DEC_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_DEC_INDIRECT,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x033: { // INC SP
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_SP);
+      sb_inc_impl(gb,op1,0,SB_OP_SP,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x034: { // INC (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_inc_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z0H-");
+      return 4;
+    }
+    case 0x035: { // DEC (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_dec_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z1H-");
+      return 4;
+    }
+    case 0x036: { // LD (HL),u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_INDIRECT,SB_OP_U8,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x037: { // SCF
+      gb->cpu.pc+=1;
+      sb_scf_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"-001");
+      return 4;
+    }
+    case 0x038: { // JRC C_FLAG,i8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_C_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_I8);
+      sb_jrc_impl(gb,op1,op2,SB_OP_C_FLAG,SB_OP_I8,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 8;}
+      return 4;
+    }
+    case 0x039: { // ADD HL,SP
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      int op2 = sb_load_operand(gb,SB_OP_SP);
+      sb_add_impl(gb,op1,op2,SB_OP_HL,SB_OP_SP,(const uint8_t*)"-0HC");
+      return 4;
+    }
+    case 0x03a: { // LD A,(HL-)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_DEC_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_DEC_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x03b: { // DEC SP
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_SP);
+      sb_dec_impl(gb,op1,0,SB_OP_SP,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x03c: { // INC A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_inc_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z0H-");
+      return 4;
+    }
+    case 0x03d: { // DEC A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_dec_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z1H-");
+      return 4;
+    }
+    case 0x03e: { // LD A,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_U8,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x03f: { // CCF
+      gb->cpu.pc+=1;
+      sb_ccf_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"-00C");
+      return 4;
+    }
+    case 0x040: { // LD B,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_ld_impl(gb,op1,op2,SB_OP_B,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x041: { // LD B,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_ld_impl(gb,op1,op2,SB_OP_B,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x042: { // LD B,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_ld_impl(gb,op1,op2,SB_OP_B,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x043: { // LD B,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_ld_impl(gb,op1,op2,SB_OP_B,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x044: { // LD B,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_ld_impl(gb,op1,op2,SB_OP_B,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x045: { // LD B,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_ld_impl(gb,op1,op2,SB_OP_B,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x046: { // LD B,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_B,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x047: { // LD B,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_B,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x048: { // LD C,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_ld_impl(gb,op1,op2,SB_OP_C,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x049: { // LD C,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_ld_impl(gb,op1,op2,SB_OP_C,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x04a: { // LD C,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_ld_impl(gb,op1,op2,SB_OP_C,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x04b: { // LD C,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_ld_impl(gb,op1,op2,SB_OP_C,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x04c: { // LD C,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_ld_impl(gb,op1,op2,SB_OP_C,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x04d: { // LD C,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_ld_impl(gb,op1,op2,SB_OP_C,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x04e: { // LD C,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_C,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x04f: { // LD C,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_C,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x050: { // LD D,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_ld_impl(gb,op1,op2,SB_OP_D,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x051: { // LD D,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_ld_impl(gb,op1,op2,SB_OP_D,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x052: { // LD D,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_ld_impl(gb,op1,op2,SB_OP_D,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x053: { // LD D,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_ld_impl(gb,op1,op2,SB_OP_D,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x054: { // LD D,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_ld_impl(gb,op1,op2,SB_OP_D,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x055: { // LD D,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_ld_impl(gb,op1,op2,SB_OP_D,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x056: { // LD D,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_D,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x057: { // LD D,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_D,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x058: { // LD E,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_ld_impl(gb,op1,op2,SB_OP_E,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x059: { // LD E,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_ld_impl(gb,op1,op2,SB_OP_E,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x05a: { // LD E,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_ld_impl(gb,op1,op2,SB_OP_E,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x05b: { // LD E,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_ld_impl(gb,op1,op2,SB_OP_E,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x05c: { // LD E,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_ld_impl(gb,op1,op2,SB_OP_E,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x05d: { // LD E,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_ld_impl(gb,op1,op2,SB_OP_E,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x05e: { // LD E,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_E,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x05f: { // LD E,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_E,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x060: { // LD H,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_ld_impl(gb,op1,op2,SB_OP_H,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x061: { // LD H,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_ld_impl(gb,op1,op2,SB_OP_H,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x062: { // LD H,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_ld_impl(gb,op1,op2,SB_OP_H,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x063: { // LD H,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_ld_impl(gb,op1,op2,SB_OP_H,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x064: { // LD H,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_ld_impl(gb,op1,op2,SB_OP_H,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x065: { // LD H,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_ld_impl(gb,op1,op2,SB_OP_H,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x066: { // LD H,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_H,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x067: { // LD H,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_H,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x068: { // LD L,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_ld_impl(gb,op1,op2,SB_OP_L,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x069: { // LD L,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_ld_impl(gb,op1,op2,SB_OP_L,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x06a: { // LD L,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_ld_impl(gb,op1,op2,SB_OP_L,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x06b: { // LD L,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_ld_impl(gb,op1,op2,SB_OP_L,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x06c: { // LD L,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_ld_impl(gb,op1,op2,SB_OP_L,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x06d: { // LD L,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_ld_impl(gb,op1,op2,SB_OP_L,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x06e: { // LD L,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_L,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x06f: { // LD L,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_L,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x070: { // LD (HL),B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_INDIRECT,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x071: { // LD (HL),C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_INDIRECT,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x072: { // LD (HL),D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_INDIRECT,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x073: { // LD (HL),E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_INDIRECT,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x074: { // LD (HL),H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_INDIRECT,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x075: { // LD (HL),L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_INDIRECT,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x076: { // HALT
+      gb->cpu.pc+=1;
+      sb_halt_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x077: { // LD (HL),A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL_INDIRECT,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x078: { // LD A,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x079: { // LD A,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x07a: { // LD A,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x07b: { // LD A,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x07c: { // LD A,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x07d: { // LD A,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x07e: { // LD A,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x07f: { // LD A,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x080: { // ADD A,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_add_impl(gb,op1,op2,SB_OP_A,SB_OP_B,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x081: { // ADD A,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_add_impl(gb,op1,op2,SB_OP_A,SB_OP_C,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x082: { // ADD A,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_add_impl(gb,op1,op2,SB_OP_A,SB_OP_D,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x083: { // ADD A,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_add_impl(gb,op1,op2,SB_OP_A,SB_OP_E,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x084: { // ADD A,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_add_impl(gb,op1,op2,SB_OP_A,SB_OP_H,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x085: { // ADD A,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_add_impl(gb,op1,op2,SB_OP_A,SB_OP_L,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x086: { // ADD A,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_add_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INDIRECT,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x087: { // ADD A,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_add_impl(gb,op1,op2,SB_OP_A,SB_OP_A,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x088: { // ADC A,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_adc_impl(gb,op1,op2,SB_OP_A,SB_OP_B,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x089: { // ADC A,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_adc_impl(gb,op1,op2,SB_OP_A,SB_OP_C,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x08a: { // ADC A,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_adc_impl(gb,op1,op2,SB_OP_A,SB_OP_D,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x08b: { // ADC A,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_adc_impl(gb,op1,op2,SB_OP_A,SB_OP_E,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x08c: { // ADC A,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_adc_impl(gb,op1,op2,SB_OP_A,SB_OP_H,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x08d: { // ADC A,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_adc_impl(gb,op1,op2,SB_OP_A,SB_OP_L,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x08e: { // ADC A,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_adc_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INDIRECT,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x08f: { // ADC A,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_adc_impl(gb,op1,op2,SB_OP_A,SB_OP_A,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x090: { // SUB A,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_sub_impl(gb,op1,op2,SB_OP_A,SB_OP_B,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x091: { // SUB A,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_sub_impl(gb,op1,op2,SB_OP_A,SB_OP_C,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x092: { // SUB A,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_sub_impl(gb,op1,op2,SB_OP_A,SB_OP_D,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x093: { // SUB A,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_sub_impl(gb,op1,op2,SB_OP_A,SB_OP_E,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x094: { // SUB A,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_sub_impl(gb,op1,op2,SB_OP_A,SB_OP_H,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x095: { // SUB A,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_sub_impl(gb,op1,op2,SB_OP_A,SB_OP_L,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x096: { // SUB A,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_sub_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INDIRECT,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x097: { // SUB A,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_sub_impl(gb,op1,op2,SB_OP_A,SB_OP_A,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x098: { // SBC A,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_sbc_impl(gb,op1,op2,SB_OP_A,SB_OP_B,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x099: { // SBC A,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_sbc_impl(gb,op1,op2,SB_OP_A,SB_OP_C,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x09a: { // SBC A,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_sbc_impl(gb,op1,op2,SB_OP_A,SB_OP_D,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x09b: { // SBC A,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_sbc_impl(gb,op1,op2,SB_OP_A,SB_OP_E,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x09c: { // SBC A,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_sbc_impl(gb,op1,op2,SB_OP_A,SB_OP_H,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x09d: { // SBC A,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_sbc_impl(gb,op1,op2,SB_OP_A,SB_OP_L,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x09e: { // SBC A,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_sbc_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INDIRECT,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x09f: { // SBC A,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_sbc_impl(gb,op1,op2,SB_OP_A,SB_OP_A,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0a0: { // AND A,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_and_impl(gb,op1,op2,SB_OP_A,SB_OP_B,(const uint8_t*)"Z010");
+      return 4;
+    }
+    case 0x0a1: { // AND A,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_and_impl(gb,op1,op2,SB_OP_A,SB_OP_C,(const uint8_t*)"Z010");
+      return 4;
+    }
+    case 0x0a2: { // AND A,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_and_impl(gb,op1,op2,SB_OP_A,SB_OP_D,(const uint8_t*)"Z010");
+      return 4;
+    }
+    case 0x0a3: { // AND A,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_and_impl(gb,op1,op2,SB_OP_A,SB_OP_E,(const uint8_t*)"Z010");
+      return 4;
+    }
+    case 0x0a4: { // AND A,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_and_impl(gb,op1,op2,SB_OP_A,SB_OP_H,(const uint8_t*)"Z010");
+      return 4;
+    }
+    case 0x0a5: { // AND A,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_and_impl(gb,op1,op2,SB_OP_A,SB_OP_L,(const uint8_t*)"Z010");
+      return 4;
+    }
+    case 0x0a6: { // AND A,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_and_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INDIRECT,(const uint8_t*)"Z010");
+      return 4;
+    }
+    case 0x0a7: { // AND A,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_and_impl(gb,op1,op2,SB_OP_A,SB_OP_A,(const uint8_t*)"Z010");
+      return 4;
+    }
+    case 0x0a8: { // XOR A,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_xor_impl(gb,op1,op2,SB_OP_A,SB_OP_B,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0a9: { // XOR A,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_xor_impl(gb,op1,op2,SB_OP_A,SB_OP_C,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0aa: { // XOR A,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_xor_impl(gb,op1,op2,SB_OP_A,SB_OP_D,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0ab: { // XOR A,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_xor_impl(gb,op1,op2,SB_OP_A,SB_OP_E,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0ac: { // XOR A,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_xor_impl(gb,op1,op2,SB_OP_A,SB_OP_H,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0ad: { // XOR A,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_xor_impl(gb,op1,op2,SB_OP_A,SB_OP_L,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0ae: { // XOR A,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_xor_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INDIRECT,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0af: { // XOR A,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_xor_impl(gb,op1,op2,SB_OP_A,SB_OP_A,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0b0: { // OR A,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_or_impl(gb,op1,op2,SB_OP_A,SB_OP_B,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0b1: { // OR A,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_or_impl(gb,op1,op2,SB_OP_A,SB_OP_C,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0b2: { // OR A,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_or_impl(gb,op1,op2,SB_OP_A,SB_OP_D,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0b3: { // OR A,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_or_impl(gb,op1,op2,SB_OP_A,SB_OP_E,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0b4: { // OR A,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_or_impl(gb,op1,op2,SB_OP_A,SB_OP_H,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0b5: { // OR A,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_or_impl(gb,op1,op2,SB_OP_A,SB_OP_L,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0b6: { // OR A,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_or_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INDIRECT,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0b7: { // OR A,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_or_impl(gb,op1,op2,SB_OP_A,SB_OP_A,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0b8: { // CP A,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_cp_impl(gb,op1,op2,SB_OP_A,SB_OP_B,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0b9: { // CP A,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_cp_impl(gb,op1,op2,SB_OP_A,SB_OP_C,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0ba: { // CP A,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_cp_impl(gb,op1,op2,SB_OP_A,SB_OP_D,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0bb: { // CP A,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_cp_impl(gb,op1,op2,SB_OP_A,SB_OP_E,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0bc: { // CP A,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_cp_impl(gb,op1,op2,SB_OP_A,SB_OP_H,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0bd: { // CP A,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_cp_impl(gb,op1,op2,SB_OP_A,SB_OP_L,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0be: { // CP A,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_cp_impl(gb,op1,op2,SB_OP_A,SB_OP_HL_INDIRECT,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0bf: { // CP A,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_cp_impl(gb,op1,op2,SB_OP_A,SB_OP_A,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0c0: { // RETC NZ_FLAG
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_NZ_FLAG);
+      sb_retc_impl(gb,op1,0,SB_OP_NZ_FLAG,SB_OP_NONE,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 16;}
+      return 4;
+    }
+    case 0x0c1: { // POP BC
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_BC);
+      sb_pop_impl(gb,op1,0,SB_OP_BC,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0c2: { // JPC NZ_FLAG,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_NZ_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_jpc_impl(gb,op1,op2,SB_OP_NZ_FLAG,SB_OP_U16,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 8;}
+      return 4;
+    }
+    case 0x0c3: { // JP u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_U16);
+      sb_jp_impl(gb,op1,0,SB_OP_U16,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0c4: { // CALLC NZ_FLAG,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_NZ_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_callc_impl(gb,op1,op2,SB_OP_NZ_FLAG,SB_OP_U16,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 16;}
+      return 4;
+    }
+    case 0x0c5: { // PUSH BC
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_BC);
+      sb_push_impl(gb,op1,0,SB_OP_BC,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0c6: { // ADD A,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_add_impl(gb,op1,op2,SB_OP_A,SB_OP_U8,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x0c7: { // RST 00h
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_00H);
+      sb_rst_impl(gb,op1,0,SB_OP_00H,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0c8: { // RETC Z_FLAG
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_Z_FLAG);
+      sb_retc_impl(gb,op1,0,SB_OP_Z_FLAG,SB_OP_NONE,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 16;}
+      return 4;
+    }
+    case 0x0c9: { // RET
+      gb->cpu.pc+=1;
+      sb_ret_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0ca: { // JPC Z_FLAG,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_Z_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_jpc_impl(gb,op1,op2,SB_OP_Z_FLAG,SB_OP_U16,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 8;}
+      return 4;
+    }
+    case 0x0cb: { // PREFIX
+      gb->cpu.pc+=1;
+      sb_prefix_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0cc: { // CALLC Z_FLAG,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_Z_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_callc_impl(gb,op1,op2,SB_OP_Z_FLAG,SB_OP_U16,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 16;}
+      return 4;
+    }
+    case 0x0cd: { // CALL u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_U16);
+      sb_call_impl(gb,op1,0,SB_OP_U16,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0ce: { // ADC A,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_adc_impl(gb,op1,op2,SB_OP_A,SB_OP_U8,(const uint8_t*)"Z0HC");
+      return 4;
+    }
+    case 0x0cf: { // RST 08h
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_08H);
+      sb_rst_impl(gb,op1,0,SB_OP_08H,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0d0: { // RETC NC_FLAG
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_NC_FLAG);
+      sb_retc_impl(gb,op1,0,SB_OP_NC_FLAG,SB_OP_NONE,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 16;}
+      return 4;
+    }
+    case 0x0d1: { // POP DE
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_DE);
+      sb_pop_impl(gb,op1,0,SB_OP_DE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0d2: { // JPC NC_FLAG,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_NC_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_jpc_impl(gb,op1,op2,SB_OP_NC_FLAG,SB_OP_U16,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 8;}
+      return 4;
+    }
+    case 0x0d3: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0d4: { // CALLC NC_FLAG,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_NC_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_callc_impl(gb,op1,op2,SB_OP_NC_FLAG,SB_OP_U16,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 16;}
+      return 4;
+    }
+    case 0x0d5: { // PUSH DE
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_DE);
+      sb_push_impl(gb,op1,0,SB_OP_DE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0d6: { // SUB A,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_sub_impl(gb,op1,op2,SB_OP_A,SB_OP_U8,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0d7: { // RST 10h
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_10H);
+      sb_rst_impl(gb,op1,0,SB_OP_10H,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0d8: { // RETC C_FLAG
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C_FLAG);
+      sb_retc_impl(gb,op1,0,SB_OP_C_FLAG,SB_OP_NONE,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 16;}
+      return 4;
+    }
+    case 0x0d9: { // RETI
+      gb->cpu.pc+=1;
+      sb_reti_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0da: { // JPC C_FLAG,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_C_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_jpc_impl(gb,op1,op2,SB_OP_C_FLAG,SB_OP_U16,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 8;}
+      return 4;
+    }
+    case 0x0db: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0dc: { // CALLC C_FLAG,u16
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_C_FLAG);
+      int op2 = sb_load_operand(gb,SB_OP_U16);
+      sb_callc_impl(gb,op1,op2,SB_OP_C_FLAG,SB_OP_U16,(const uint8_t*)"----");
+      if(gb->cpu.branch_taken){gb->cpu.branch_taken=false;return 16;}
+      return 4;
+    }
+    case 0x0dd: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0de: { // SBC A,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_sbc_impl(gb,op1,op2,SB_OP_A,SB_OP_U8,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0df: { // RST 18h
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_18H);
+      sb_rst_impl(gb,op1,0,SB_OP_18H,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0e0: { // LD (FF00+u8),A
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_FF00_PLUS_U8_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_FF00_PLUS_U8_INDIRECT,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0e1: { // POP HL
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      sb_pop_impl(gb,op1,0,SB_OP_HL,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0e2: { // LD (FF00+C),A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_FF00_PLUS_C_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_FF00_PLUS_C_INDIRECT,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0e3: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0e4: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0e5: { // PUSH HL
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      sb_push_impl(gb,op1,0,SB_OP_HL,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0e6: { // AND A,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_and_impl(gb,op1,op2,SB_OP_A,SB_OP_U8,(const uint8_t*)"Z010");
+      return 4;
+    }
+    case 0x0e7: { // RST 20h
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_20H);
+      sb_rst_impl(gb,op1,0,SB_OP_20H,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0e8: { // ADD SP,i8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_SP);
+      int op2 = sb_load_operand(gb,SB_OP_I8);
+      sb_add_impl(gb,op1,op2,SB_OP_SP,SB_OP_I8,(const uint8_t*)"00HC");
+      return 4;
+    }
+    case 0x0e9: { // JP HL
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      sb_jp_impl(gb,op1,0,SB_OP_HL,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0ea: { // LD (u16),A
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_U16_INDIRECT);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_ld_impl(gb,op1,op2,SB_OP_U16_INDIRECT,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0eb: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0ec: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0ed: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0ee: { // XOR A,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_xor_impl(gb,op1,op2,SB_OP_A,SB_OP_U8,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0ef: { // RST 28h
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_28H);
+      sb_rst_impl(gb,op1,0,SB_OP_28H,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0f0: { // LD A,(FF00+u8)
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_FF00_PLUS_U8_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_FF00_PLUS_U8_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0f1: { // POP AF
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_AF);
+      sb_pop_impl(gb,op1,0,SB_OP_AF,SB_OP_NONE,(const uint8_t*)"ZNHC");
+      return 4;
+    }
+    case 0x0f2: { // LD A,(FF00+C)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_FF00_PLUS_C_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_FF00_PLUS_C_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0f3: { // DI
+      gb->cpu.pc+=1;
+      sb_di_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0f4: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0f5: { // PUSH AF
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_AF);
+      sb_push_impl(gb,op1,0,SB_OP_AF,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0f6: { // OR A,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_or_impl(gb,op1,op2,SB_OP_A,SB_OP_U8,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x0f7: { // RST 30h
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_30H);
+      sb_rst_impl(gb,op1,0,SB_OP_30H,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0f8: { // LD HL,SP+i8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_HL);
+      int op2 = sb_load_operand(gb,SB_OP_SP_PLUS_I8);
+      sb_ld_impl(gb,op1,op2,SB_OP_HL,SB_OP_SP_PLUS_I8,(const uint8_t*)"00HC");
+      return 4;
+    }
+    case 0x0f9: { // LD SP,HL
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_SP);
+      int op2 = sb_load_operand(gb,SB_OP_HL);
+      sb_ld_impl(gb,op1,op2,SB_OP_SP,SB_OP_HL,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0fa: { // LD A,(u16)
+      gb->cpu.pc+=3;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U16_INDIRECT);
+      sb_ld_impl(gb,op1,op2,SB_OP_A,SB_OP_U16_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0fb: { // EI
+      gb->cpu.pc+=1;
+      sb_ei_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0fc: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0fd: { // NOP_NO_INSTR
+      gb->cpu.pc+=1;
+      sb_nop_no_instr_impl(gb,0,0,SB_OP_NONE,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x0fe: { // CP A,u8
+      gb->cpu.pc+=2;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      int op2 = sb_load_operand(gb,SB_OP_U8);
+      sb_cp_impl(gb,op1,op2,SB_OP_A,SB_OP_U8,(const uint8_t*)"Z1HC");
+      return 4;
+    }
+    case 0x0ff: { // RST 38h
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_38H);
+      sb_rst_impl(gb,op1,0,SB_OP_38H,SB_OP_NONE,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x100: { // RLC B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_rlc_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x101: { // RLC C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_rlc_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x102: { // RLC D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_rlc_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x103: { // RLC E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_rlc_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x104: { // RLC H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_rlc_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x105: { // RLC L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_rlc_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x106: { // RLC (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_rlc_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x107: { // RLC A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_rlc_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x108: { // RRC B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_rrc_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x109: { // RRC C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_rrc_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x10a: { // RRC D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_rrc_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x10b: { // RRC E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_rrc_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x10c: { // RRC H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_rrc_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x10d: { // RRC L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_rrc_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x10e: { // RRC (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_rrc_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x10f: { // RRC A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_rrc_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x110: { // RL B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_rl_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x111: { // RL C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_rl_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x112: { // RL D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_rl_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x113: { // RL E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_rl_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x114: { // RL H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_rl_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x115: { // RL L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_rl_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x116: { // RL (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_rl_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x117: { // RL A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_rl_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x118: { // RR B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_rr_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x119: { // RR C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_rr_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x11a: { // RR D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_rr_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x11b: { // RR E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_rr_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x11c: { // RR H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_rr_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x11d: { // RR L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_rr_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x11e: { // RR (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_rr_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x11f: { // RR A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_rr_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x120: { // SLA B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_sla_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x121: { // SLA C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_sla_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x122: { // SLA D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_sla_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x123: { // SLA E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_sla_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x124: { // SLA H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_sla_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x125: { // SLA L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_sla_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x126: { // SLA (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_sla_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x127: { // SLA A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_sla_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x128: { // SRA B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_sra_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x129: { // SRA C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_sra_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x12a: { // SRA D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_sra_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x12b: { // SRA E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_sra_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x12c: { // SRA H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_sra_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x12d: { // SRA L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_sra_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x12e: { // SRA (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_sra_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x12f: { // SRA A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_sra_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x130: { // SWAP B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_swap_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x131: { // SWAP C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_swap_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x132: { // SWAP D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_swap_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x133: { // SWAP E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_swap_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x134: { // SWAP H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_swap_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x135: { // SWAP L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_swap_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x136: { // SWAP (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_swap_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x137: { // SWAP A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_swap_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z000");
+      return 4;
+    }
+    case 0x138: { // SRL B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_B);
+      sb_srl_impl(gb,op1,0,SB_OP_B,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x139: { // SRL C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_C);
+      sb_srl_impl(gb,op1,0,SB_OP_C,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x13a: { // SRL D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_D);
+      sb_srl_impl(gb,op1,0,SB_OP_D,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x13b: { // SRL E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_E);
+      sb_srl_impl(gb,op1,0,SB_OP_E,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x13c: { // SRL H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_H);
+      sb_srl_impl(gb,op1,0,SB_OP_H,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x13d: { // SRL L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_L);
+      sb_srl_impl(gb,op1,0,SB_OP_L,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x13e: { // SRL (HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_srl_impl(gb,op1,0,SB_OP_HL_INDIRECT,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x13f: { // SRL A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_A);
+      sb_srl_impl(gb,op1,0,SB_OP_A,SB_OP_NONE,(const uint8_t*)"Z00C");
+      return 4;
+    }
+    case 0x140: { // BIT 0,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_bit_impl(gb,op1,op2,SB_OP_0,SB_OP_B,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x141: { // BIT 0,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_bit_impl(gb,op1,op2,SB_OP_0,SB_OP_C,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x142: { // BIT 0,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_bit_impl(gb,op1,op2,SB_OP_0,SB_OP_D,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x143: { // BIT 0,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_bit_impl(gb,op1,op2,SB_OP_0,SB_OP_E,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x144: { // BIT 0,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_bit_impl(gb,op1,op2,SB_OP_0,SB_OP_H,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x145: { // BIT 0,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_bit_impl(gb,op1,op2,SB_OP_0,SB_OP_L,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x146: { // BIT 0,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_bit_impl(gb,op1,op2,SB_OP_0,SB_OP_HL_INDIRECT,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x147: { // BIT 0,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_bit_impl(gb,op1,op2,SB_OP_0,SB_OP_A,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x148: { // BIT 1,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_bit_impl(gb,op1,op2,SB_OP_1,SB_OP_B,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x149: { // BIT 1,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_bit_impl(gb,op1,op2,SB_OP_1,SB_OP_C,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x14a: { // BIT 1,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_bit_impl(gb,op1,op2,SB_OP_1,SB_OP_D,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x14b: { // BIT 1,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_bit_impl(gb,op1,op2,SB_OP_1,SB_OP_E,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x14c: { // BIT 1,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_bit_impl(gb,op1,op2,SB_OP_1,SB_OP_H,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x14d: { // BIT 1,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_bit_impl(gb,op1,op2,SB_OP_1,SB_OP_L,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x14e: { // BIT 1,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_bit_impl(gb,op1,op2,SB_OP_1,SB_OP_HL_INDIRECT,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x14f: { // BIT 1,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_bit_impl(gb,op1,op2,SB_OP_1,SB_OP_A,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x150: { // BIT 2,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_bit_impl(gb,op1,op2,SB_OP_2,SB_OP_B,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x151: { // BIT 2,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_bit_impl(gb,op1,op2,SB_OP_2,SB_OP_C,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x152: { // BIT 2,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_bit_impl(gb,op1,op2,SB_OP_2,SB_OP_D,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x153: { // BIT 2,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_bit_impl(gb,op1,op2,SB_OP_2,SB_OP_E,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x154: { // BIT 2,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_bit_impl(gb,op1,op2,SB_OP_2,SB_OP_H,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x155: { // BIT 2,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_bit_impl(gb,op1,op2,SB_OP_2,SB_OP_L,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x156: { // BIT 2,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_bit_impl(gb,op1,op2,SB_OP_2,SB_OP_HL_INDIRECT,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x157: { // BIT 2,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_bit_impl(gb,op1,op2,SB_OP_2,SB_OP_A,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x158: { // BIT 3,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_bit_impl(gb,op1,op2,SB_OP_3,SB_OP_B,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x159: { // BIT 3,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_bit_impl(gb,op1,op2,SB_OP_3,SB_OP_C,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x15a: { // BIT 3,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_bit_impl(gb,op1,op2,SB_OP_3,SB_OP_D,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x15b: { // BIT 3,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_bit_impl(gb,op1,op2,SB_OP_3,SB_OP_E,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x15c: { // BIT 3,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_bit_impl(gb,op1,op2,SB_OP_3,SB_OP_H,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x15d: { // BIT 3,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_bit_impl(gb,op1,op2,SB_OP_3,SB_OP_L,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x15e: { // BIT 3,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_bit_impl(gb,op1,op2,SB_OP_3,SB_OP_HL_INDIRECT,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x15f: { // BIT 3,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_bit_impl(gb,op1,op2,SB_OP_3,SB_OP_A,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x160: { // BIT 4,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_bit_impl(gb,op1,op2,SB_OP_4,SB_OP_B,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x161: { // BIT 4,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_bit_impl(gb,op1,op2,SB_OP_4,SB_OP_C,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x162: { // BIT 4,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_bit_impl(gb,op1,op2,SB_OP_4,SB_OP_D,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x163: { // BIT 4,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_bit_impl(gb,op1,op2,SB_OP_4,SB_OP_E,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x164: { // BIT 4,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_bit_impl(gb,op1,op2,SB_OP_4,SB_OP_H,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x165: { // BIT 4,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_bit_impl(gb,op1,op2,SB_OP_4,SB_OP_L,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x166: { // BIT 4,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_bit_impl(gb,op1,op2,SB_OP_4,SB_OP_HL_INDIRECT,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x167: { // BIT 4,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_bit_impl(gb,op1,op2,SB_OP_4,SB_OP_A,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x168: { // BIT 5,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_bit_impl(gb,op1,op2,SB_OP_5,SB_OP_B,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x169: { // BIT 5,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_bit_impl(gb,op1,op2,SB_OP_5,SB_OP_C,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x16a: { // BIT 5,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_bit_impl(gb,op1,op2,SB_OP_5,SB_OP_D,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x16b: { // BIT 5,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_bit_impl(gb,op1,op2,SB_OP_5,SB_OP_E,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x16c: { // BIT 5,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_bit_impl(gb,op1,op2,SB_OP_5,SB_OP_H,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x16d: { // BIT 5,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_bit_impl(gb,op1,op2,SB_OP_5,SB_OP_L,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x16e: { // BIT 5,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_bit_impl(gb,op1,op2,SB_OP_5,SB_OP_HL_INDIRECT,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x16f: { // BIT 5,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_bit_impl(gb,op1,op2,SB_OP_5,SB_OP_A,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x170: { // BIT 6,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_bit_impl(gb,op1,op2,SB_OP_6,SB_OP_B,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x171: { // BIT 6,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_bit_impl(gb,op1,op2,SB_OP_6,SB_OP_C,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x172: { // BIT 6,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_bit_impl(gb,op1,op2,SB_OP_6,SB_OP_D,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x173: { // BIT 6,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_bit_impl(gb,op1,op2,SB_OP_6,SB_OP_E,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x174: { // BIT 6,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_bit_impl(gb,op1,op2,SB_OP_6,SB_OP_H,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x175: { // BIT 6,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_bit_impl(gb,op1,op2,SB_OP_6,SB_OP_L,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x176: { // BIT 6,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_bit_impl(gb,op1,op2,SB_OP_6,SB_OP_HL_INDIRECT,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x177: { // BIT 6,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_bit_impl(gb,op1,op2,SB_OP_6,SB_OP_A,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x178: { // BIT 7,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_bit_impl(gb,op1,op2,SB_OP_7,SB_OP_B,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x179: { // BIT 7,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_bit_impl(gb,op1,op2,SB_OP_7,SB_OP_C,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x17a: { // BIT 7,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_bit_impl(gb,op1,op2,SB_OP_7,SB_OP_D,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x17b: { // BIT 7,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_bit_impl(gb,op1,op2,SB_OP_7,SB_OP_E,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x17c: { // BIT 7,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_bit_impl(gb,op1,op2,SB_OP_7,SB_OP_H,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x17d: { // BIT 7,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_bit_impl(gb,op1,op2,SB_OP_7,SB_OP_L,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x17e: { // BIT 7,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_bit_impl(gb,op1,op2,SB_OP_7,SB_OP_HL_INDIRECT,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x17f: { // BIT 7,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_bit_impl(gb,op1,op2,SB_OP_7,SB_OP_A,(const uint8_t*)"Z01-");
+      return 4;
+    }
+    case 0x180: { // RES 0,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_res_impl(gb,op1,op2,SB_OP_0,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x181: { // RES 0,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_res_impl(gb,op1,op2,SB_OP_0,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x182: { // RES 0,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_res_impl(gb,op1,op2,SB_OP_0,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x183: { // RES 0,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_res_impl(gb,op1,op2,SB_OP_0,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x184: { // RES 0,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_res_impl(gb,op1,op2,SB_OP_0,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x185: { // RES 0,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_res_impl(gb,op1,op2,SB_OP_0,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x186: { // RES 0,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_res_impl(gb,op1,op2,SB_OP_0,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x187: { // RES 0,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_res_impl(gb,op1,op2,SB_OP_0,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x188: { // RES 1,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_res_impl(gb,op1,op2,SB_OP_1,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x189: { // RES 1,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_res_impl(gb,op1,op2,SB_OP_1,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x18a: { // RES 1,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_res_impl(gb,op1,op2,SB_OP_1,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x18b: { // RES 1,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_res_impl(gb,op1,op2,SB_OP_1,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x18c: { // RES 1,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_res_impl(gb,op1,op2,SB_OP_1,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x18d: { // RES 1,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_res_impl(gb,op1,op2,SB_OP_1,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x18e: { // RES 1,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_res_impl(gb,op1,op2,SB_OP_1,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x18f: { // RES 1,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_res_impl(gb,op1,op2,SB_OP_1,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x190: { // RES 2,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_res_impl(gb,op1,op2,SB_OP_2,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x191: { // RES 2,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_res_impl(gb,op1,op2,SB_OP_2,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x192: { // RES 2,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_res_impl(gb,op1,op2,SB_OP_2,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x193: { // RES 2,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_res_impl(gb,op1,op2,SB_OP_2,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x194: { // RES 2,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_res_impl(gb,op1,op2,SB_OP_2,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x195: { // RES 2,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_res_impl(gb,op1,op2,SB_OP_2,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x196: { // RES 2,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_res_impl(gb,op1,op2,SB_OP_2,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x197: { // RES 2,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_res_impl(gb,op1,op2,SB_OP_2,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x198: { // RES 3,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_res_impl(gb,op1,op2,SB_OP_3,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x199: { // RES 3,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_res_impl(gb,op1,op2,SB_OP_3,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x19a: { // RES 3,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_res_impl(gb,op1,op2,SB_OP_3,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x19b: { // RES 3,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_res_impl(gb,op1,op2,SB_OP_3,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x19c: { // RES 3,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_res_impl(gb,op1,op2,SB_OP_3,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x19d: { // RES 3,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_res_impl(gb,op1,op2,SB_OP_3,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x19e: { // RES 3,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_res_impl(gb,op1,op2,SB_OP_3,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x19f: { // RES 3,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_res_impl(gb,op1,op2,SB_OP_3,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a0: { // RES 4,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_res_impl(gb,op1,op2,SB_OP_4,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a1: { // RES 4,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_res_impl(gb,op1,op2,SB_OP_4,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a2: { // RES 4,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_res_impl(gb,op1,op2,SB_OP_4,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a3: { // RES 4,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_res_impl(gb,op1,op2,SB_OP_4,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a4: { // RES 4,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_res_impl(gb,op1,op2,SB_OP_4,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a5: { // RES 4,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_res_impl(gb,op1,op2,SB_OP_4,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a6: { // RES 4,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_res_impl(gb,op1,op2,SB_OP_4,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a7: { // RES 4,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_res_impl(gb,op1,op2,SB_OP_4,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a8: { // RES 5,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_res_impl(gb,op1,op2,SB_OP_5,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1a9: { // RES 5,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_res_impl(gb,op1,op2,SB_OP_5,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1aa: { // RES 5,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_res_impl(gb,op1,op2,SB_OP_5,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ab: { // RES 5,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_res_impl(gb,op1,op2,SB_OP_5,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ac: { // RES 5,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_res_impl(gb,op1,op2,SB_OP_5,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ad: { // RES 5,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_res_impl(gb,op1,op2,SB_OP_5,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ae: { // RES 5,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_res_impl(gb,op1,op2,SB_OP_5,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1af: { // RES 5,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_res_impl(gb,op1,op2,SB_OP_5,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b0: { // RES 6,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_res_impl(gb,op1,op2,SB_OP_6,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b1: { // RES 6,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_res_impl(gb,op1,op2,SB_OP_6,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b2: { // RES 6,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_res_impl(gb,op1,op2,SB_OP_6,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b3: { // RES 6,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_res_impl(gb,op1,op2,SB_OP_6,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b4: { // RES 6,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_res_impl(gb,op1,op2,SB_OP_6,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b5: { // RES 6,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_res_impl(gb,op1,op2,SB_OP_6,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b6: { // RES 6,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_res_impl(gb,op1,op2,SB_OP_6,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b7: { // RES 6,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_res_impl(gb,op1,op2,SB_OP_6,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b8: { // RES 7,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_res_impl(gb,op1,op2,SB_OP_7,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1b9: { // RES 7,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_res_impl(gb,op1,op2,SB_OP_7,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ba: { // RES 7,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_res_impl(gb,op1,op2,SB_OP_7,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1bb: { // RES 7,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_res_impl(gb,op1,op2,SB_OP_7,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1bc: { // RES 7,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_res_impl(gb,op1,op2,SB_OP_7,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1bd: { // RES 7,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_res_impl(gb,op1,op2,SB_OP_7,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1be: { // RES 7,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_res_impl(gb,op1,op2,SB_OP_7,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1bf: { // RES 7,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_res_impl(gb,op1,op2,SB_OP_7,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c0: { // SET 0,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_set_impl(gb,op1,op2,SB_OP_0,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c1: { // SET 0,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_set_impl(gb,op1,op2,SB_OP_0,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c2: { // SET 0,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_set_impl(gb,op1,op2,SB_OP_0,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c3: { // SET 0,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_set_impl(gb,op1,op2,SB_OP_0,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c4: { // SET 0,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_set_impl(gb,op1,op2,SB_OP_0,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c5: { // SET 0,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_set_impl(gb,op1,op2,SB_OP_0,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c6: { // SET 0,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_set_impl(gb,op1,op2,SB_OP_0,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c7: { // SET 0,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_0);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_set_impl(gb,op1,op2,SB_OP_0,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c8: { // SET 1,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_set_impl(gb,op1,op2,SB_OP_1,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1c9: { // SET 1,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_set_impl(gb,op1,op2,SB_OP_1,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ca: { // SET 1,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_set_impl(gb,op1,op2,SB_OP_1,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1cb: { // SET 1,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_set_impl(gb,op1,op2,SB_OP_1,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1cc: { // SET 1,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_set_impl(gb,op1,op2,SB_OP_1,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1cd: { // SET 1,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_set_impl(gb,op1,op2,SB_OP_1,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ce: { // SET 1,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_set_impl(gb,op1,op2,SB_OP_1,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1cf: { // SET 1,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_1);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_set_impl(gb,op1,op2,SB_OP_1,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d0: { // SET 2,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_set_impl(gb,op1,op2,SB_OP_2,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d1: { // SET 2,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_set_impl(gb,op1,op2,SB_OP_2,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d2: { // SET 2,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_set_impl(gb,op1,op2,SB_OP_2,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d3: { // SET 2,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_set_impl(gb,op1,op2,SB_OP_2,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d4: { // SET 2,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_set_impl(gb,op1,op2,SB_OP_2,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d5: { // SET 2,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_set_impl(gb,op1,op2,SB_OP_2,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d6: { // SET 2,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_set_impl(gb,op1,op2,SB_OP_2,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d7: { // SET 2,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_2);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_set_impl(gb,op1,op2,SB_OP_2,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d8: { // SET 3,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_set_impl(gb,op1,op2,SB_OP_3,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1d9: { // SET 3,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_set_impl(gb,op1,op2,SB_OP_3,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1da: { // SET 3,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_set_impl(gb,op1,op2,SB_OP_3,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1db: { // SET 3,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_set_impl(gb,op1,op2,SB_OP_3,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1dc: { // SET 3,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_set_impl(gb,op1,op2,SB_OP_3,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1dd: { // SET 3,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_set_impl(gb,op1,op2,SB_OP_3,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1de: { // SET 3,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_set_impl(gb,op1,op2,SB_OP_3,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1df: { // SET 3,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_3);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_set_impl(gb,op1,op2,SB_OP_3,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e0: { // SET 4,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_set_impl(gb,op1,op2,SB_OP_4,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e1: { // SET 4,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_set_impl(gb,op1,op2,SB_OP_4,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e2: { // SET 4,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_set_impl(gb,op1,op2,SB_OP_4,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e3: { // SET 4,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_set_impl(gb,op1,op2,SB_OP_4,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e4: { // SET 4,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_set_impl(gb,op1,op2,SB_OP_4,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e5: { // SET 4,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_set_impl(gb,op1,op2,SB_OP_4,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e6: { // SET 4,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_set_impl(gb,op1,op2,SB_OP_4,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e7: { // SET 4,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_4);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_set_impl(gb,op1,op2,SB_OP_4,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e8: { // SET 5,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_set_impl(gb,op1,op2,SB_OP_5,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1e9: { // SET 5,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_set_impl(gb,op1,op2,SB_OP_5,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ea: { // SET 5,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_set_impl(gb,op1,op2,SB_OP_5,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1eb: { // SET 5,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_set_impl(gb,op1,op2,SB_OP_5,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ec: { // SET 5,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_set_impl(gb,op1,op2,SB_OP_5,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ed: { // SET 5,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_set_impl(gb,op1,op2,SB_OP_5,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ee: { // SET 5,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_set_impl(gb,op1,op2,SB_OP_5,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ef: { // SET 5,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_5);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_set_impl(gb,op1,op2,SB_OP_5,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f0: { // SET 6,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_set_impl(gb,op1,op2,SB_OP_6,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f1: { // SET 6,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_set_impl(gb,op1,op2,SB_OP_6,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f2: { // SET 6,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_set_impl(gb,op1,op2,SB_OP_6,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f3: { // SET 6,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_set_impl(gb,op1,op2,SB_OP_6,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f4: { // SET 6,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_set_impl(gb,op1,op2,SB_OP_6,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f5: { // SET 6,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_set_impl(gb,op1,op2,SB_OP_6,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f6: { // SET 6,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_set_impl(gb,op1,op2,SB_OP_6,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f7: { // SET 6,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_6);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_set_impl(gb,op1,op2,SB_OP_6,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f8: { // SET 7,B
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_B);
+      sb_set_impl(gb,op1,op2,SB_OP_7,SB_OP_B,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1f9: { // SET 7,C
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_C);
+      sb_set_impl(gb,op1,op2,SB_OP_7,SB_OP_C,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1fa: { // SET 7,D
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_D);
+      sb_set_impl(gb,op1,op2,SB_OP_7,SB_OP_D,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1fb: { // SET 7,E
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_E);
+      sb_set_impl(gb,op1,op2,SB_OP_7,SB_OP_E,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1fc: { // SET 7,H
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_H);
+      sb_set_impl(gb,op1,op2,SB_OP_7,SB_OP_H,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1fd: { // SET 7,L
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_L);
+      sb_set_impl(gb,op1,op2,SB_OP_7,SB_OP_L,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1fe: { // SET 7,(HL)
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_HL_INDIRECT);
+      sb_set_impl(gb,op1,op2,SB_OP_7,SB_OP_HL_INDIRECT,(const uint8_t*)"----");
+      return 4;
+    }
+    case 0x1ff: { // SET 7,A
+      gb->cpu.pc+=1;
+      int op1 = sb_load_operand(gb,SB_OP_7);
+      int op2 = sb_load_operand(gb,SB_OP_A);
+      sb_set_impl(gb,op1,op2,SB_OP_7,SB_OP_A,(const uint8_t*)"----");
+      return 4;
+    }
+  }
+  return 4;
+}
+#endif
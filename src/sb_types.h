@@ -22,6 +22,17 @@
 #else
   #define FORCE_INLINE inline
 #endif
+// NO_INLINE keeps cold helpers out of line, FLATTEN inlines every call made by a function's body
+#if defined(__GNUC__) || defined(__clang__)
+  #define NO_INLINE __attribute__((noinline))
+  #define FLATTEN __attribute__((flatten))
+#elif defined(_MSC_VER)
+  #define NO_INLINE __declspec(noinline)
+  #define FLATTEN
+#else
+  #define NO_INLINE
+  #define FLATTEN
+#endif
 
 // Macro for hinting that an expression is likely to be false.
 #if defined(__GNUC__) || defined(__clang__)
@@ -163,6 +174,14 @@ typedef struct {
   uint8_t *rom_data;
   char rom_path[SB_FILE_PATH_SIZE]; 
   bool force_dmg_mode; 
+  bool arm_block_cache; // Serve ARM/Thumb fetches from the decoded block cache
+  bool arm_jit;         // Compile hot decoded blocks to host code where supported (implies arm_block_cache)
+  bool arm_jit_verify;  // Replay compiled code in the interpreter and report where the results differ
+  bool thumb_fusion;    // Run common Thumb instruction pairs as one from the block cache
+  bool idle_loop_skip;  // Detect idle polling loops and skip ahead to the next event
+  bool bios_hle;        // Run common BIOS SWIs natively instead of in the BIOS
+  bool bios_hle_verify; // Run the SWIs in the BIOS and report where the native versions differ
+  bool gb_halt_skip_verify; // Step skipped GB HALTs cycle by cycle too and report where the results differ
 } sb_emu_state_t;
 typedef struct{
   bool read_since_reset;
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+# Generates src/arm7_specialized.h: a variant of every ARM/Thumb handler for each decode key it is
+# used with. The key bits of the opcode are replaced with constants so that the compiler resolves
+# the I/S/P/U/W/L, opcode and shift type branches of the (force inlined) handler at compile time.
+#
+# Also generates src/arm7_bus_handlers.h, a template a system includes to get handler tables bound
+# to its compile time bus (see ARM7_STATIC_BUS in arm7.h). The variants of the handlers that access
+# memory call <handler>_bus with the system's bus, the other entries reuse arm7_specialized.h.
+#
+# Usage: python3 gen_arm7_handlers.py   (run from the tools directory, reads ../src/arm7.h)
+import re
+
+ARM_KEY_BITS = [4,5,6,7,20,21,22,23,24,25,26,27]
+THUMB_KEY_BITS = [8,9,10,11,12,13,14,15]
+
+# Bitfield letters of key bits that only hold operands (offsets, register lists and numbers). Keys
+# that only differ in these bits share a variant and the bits are still read from the opcode.
+ARM_OPERAND_LETTERS = "Olmnd"
+THUMB_OPERAND_LETTERS = "Oldsbn"
+
+# Handlers that don't decode anything from the key bits are left generic
+GENERIC_HANDLERS = {
+  "arm7_undefined", "arm7t_unknown",
+  "arm7_software_interrupt", "arm7t_soft_interrupt",
+  "arm7_coproc_data_transfer", "arm7_coproc_data_op", "arm7_coproc_reg_transfer",
+}
+
+with open("../src/arm7.h") as f:
+  source = f.read()
+
+bus_handler_list = re.search(r"#define ARM7_BUS_HANDLERS\(X\)((?:[^\n]*\\\n)*[^\n]*)", source).group(1)
+BUS_HANDLERS = set(re.findall(r"X\((\w+)\)", bus_handler_list))
+
+def parse_classes(table_name):
+  body = re.search(r"arm7_instruction_t\s+" + table_name + r"\[\]\s*=\s*\{(.*?)\{NULL\}", source, re.S).group(1)
+  # Drop line comments so commented out classes are ignored
+  body = re.sub(r"//[^\n]*", "", body)
+  return re.findall(r"\{\s*(\w+)\s*,\s*\"([^\"]*)\"\s*,\s*\"([^\"]*)\"\s*\}", body)
+
+# Same matching rules as arm_lookup_arm_instruction_class/arm_lookup_thumb_instruction_class: the
+# last class that matches a key wins
+def lookup(classes, key, key_bits, width):
+  matched = None
+  for instruction_class in classes:
+    bitfield = instruction_class[2]
+    matches = True
+    for bit, b_off in enumerate(key_bits):
+      bit_value = (key >> bit) & 1
+      c = bitfield[width - 1 - b_off]
+      if (c == '1' and not bit_value) or (c == '0' and bit_value):
+        matches = False
+        break
+    if matches: matched = instruction_class
+  return matched
+
+tables = [
+  ("arm7_specialized_lookup_table",  "arm7_instruction_classes",  4096, ARM_KEY_BITS,   32, ARM_OPERAND_LETTERS,   "a"),
+  ("arm9_specialized_lookup_table",  "arm9_instruction_classes",  4096, ARM_KEY_BITS,   32, ARM_OPERAND_LETTERS,   "a"),
+  ("arm7t_specialized_lookup_table", "arm7t_instruction_classes", 256,  THUMB_KEY_BITS, 16, THUMB_OPERAND_LETTERS, "t"),
+  ("arm9t_specialized_lookup_table", "arm9t_instruction_classes", 256,  THUMB_KEY_BITS, 16, THUMB_OPERAND_LETTERS, "t"),
+]
+
+functions = {}
+table_entries = []
+for table, class_table, size, key_bits, width, operand_letters, suffix in tables:
+  classes = parse_classes(class_table)
+  entries = []
+  for key in range(size):
+    c = lookup(classes, key, key_bits, width)
+    if c is None: entries.append("NULL"); continue
+    handler, name, bitfield = c
+    if handler in GENERIC_HANDLERS:
+      entries.append(handler)
+      if handler in BUS_HANDLERS: functions[handler] = (handler, 0, 0, width)
+      continue
+    # Opcode bits replaced by constants and their values
+    mask = 0
+    value = 0
+    for bit, b_off in enumerate(key_bits):
+      if bitfield[width - 1 - b_off] in operand_letters: continue
+      mask |= 1 << b_off
+      value |= ((key >> bit) & 1) << b_off
+    masked_key = ((value >> 4) & 0xf) | ((value >> 16) & 0xff0) if width == 32 else value >> 8
+    name = "%s_%s%0*x" % (handler, suffix, 3 if width == 32 else 2, masked_key)
+    functions[name] = (handler, mask, value, width)
+    entries.append(name)
+  table_entries.append((table, size, entries))
+
+with open("../src/arm7_specialized.h", "w") as f:
+  f.write("""// This file is autogenerated by tools/gen_arm7_handlers.py do not edit
+
+#ifndef ARM7_SPECIALIZED_H
+#define ARM7_SPECIALIZED_H 1
+
+""")
+  for name in sorted(functions):
+    handler, mask, value, width = functions[name]
+    if handler in GENERIC_HANDLERS: continue
+    f.write("static void %s(arm7_t* cpu, uint32_t opcode){%s(cpu,(opcode&0x%0*xu)|0x%0*xu);}\n" %
+            (name, handler, width // 4, ~mask & ((1 << width) - 1), width // 4, value))
+  for table, size, entries in table_entries:
+    f.write("\nstatic const arm7_handler_t %s[%d]={\n" % (table, size))
+    for i in range(0, size, 4):
+      f.write("  " + " ".join(e + "," for e in entries[i:i+4]) + "\n")
+    f.write("};\n")
+  f.write("\n#endif\n")
+
+bus_functions = sorted(name for name in functions if functions[name][0] in BUS_HANDLERS)
+
+def bus_variant(name):
+  handler, mask, value, width = functions[name]
+  if handler in GENERIC_HANDLERS:
+    return "static void ARM7_BUS_PREFIX(%s)(arm7_t* cpu, uint32_t opcode){%s_bus(cpu,opcode,&ARM7_BUS);}\n" % (name, handler)
+  return "static void ARM7_BUS_PREFIX(%s)(arm7_t* cpu, uint32_t opcode){%s_bus(cpu,(opcode&0x%0*xu)|0x%0*xu,&ARM7_BUS);}\n" % (
+    name, handler, width // 4, ~mask & ((1 << width) - 1), width // 4, value)
+
+def bus_entry(name):
+  if name in functions and functions[name][0] in BUS_HANDLERS: return "ARM7_BUS_PREFIX(%s)" % name
+  return name
+
+with open("../src/arm7_bus_handlers.h", "w") as f:
+  f.write("""// This file is autogenerated by tools/gen_arm7_handlers.py do not edit
+
+// Template for the handler tables of a compile time bus, included once per bus with:
+//   ARM7_BUS             static const arm7_bus_t the memory handlers use
+//   ARM7_BUS_PREFIX(N)   pastes the system's prefix on N
+//   ARM7_BUS_ARM9        1 for the ARM9 instruction set, 0 for the ARM7
+// Defines ARM7_BUS_PREFIX(arm_handlers) and ARM7_BUS_PREFIX(thumb_handlers) for arm7_bind_bus_handlers
+
+#if ARM7_BUS_ARM9
+""")
+  for arm9 in (True, False):
+    if not arm9: f.write("#else\n")
+    used = set()
+    for table, size, entries in table_entries:
+      if table.startswith("arm9") == arm9: used.update(entries)
+    for name in bus_functions:
+      if name in used: f.write(bus_variant(name))
+    for table, size, entries in table_entries:
+      if table.startswith("arm9") != arm9: continue
+      thumb = table.startswith("arm7t") or table.startswith("arm9t")
+      f.write("\nstatic const arm7_handler_t ARM7_BUS_PREFIX(%s)[%d]={\n" % ("thumb_handlers" if thumb else "arm_handlers", size))
+      for i in range(0, size, 4):
+        f.write("  " + " ".join(bus_entry(e) + "," for e in entries[i:i+4]) + "\n")
+      f.write("};\n")
+  f.write("#endif\n\n#undef ARM7_BUS\n#undef ARM7_BUS_PREFIX\n#undef ARM7_BUS_ARM9\n")
+
+print("Generated %d specialized handlers, %d per bus" % (len(functions), len(bus_functions)))
@@ -1,4 +1,59 @@
 #!/usr/bin/env python3
+import re
+import sys
+
+# Writes sb_instr_specialized.h: one case per opcode (CB prefixed ones at 256+) with its operands, flag
+# mask, length and cycles baked in. The operand and impl functions are FORCE_INLINE so the compiler
+# folds the operand switches and flag masks of every case.
+def write_specialized(entries):
+  with open("../src/sb_instr_specialized.h","w") as f:
+    f.write("""
+// This file is autogenerated do not edit
+
+#ifndef SB_INSTR_SPECIALIZED
+#define SB_INSTR_SPECIALIZED 1
+
+#include "sb_instr_tables.h"
+
+// Runs opcode op (256+ for CB prefixed opcodes) whose byte(s) the PC points at. Returns the cycles
+// it takes before the fetch of the next opcode (see sb_tick).
+static FORCE_INLINE int sb_exec_specialized(sb_gb_t* gb, unsigned op){
+  switch(op){
+""")
+    for opcode_num, (impl_name, instr_name, flags, length, mcycles, taken, src1, src2) in enumerate(entries):
+      f.write(f'    case 0x{opcode_num:03x}: {{ // {instr_name}\n')
+      f.write(f'      gb->cpu.pc+={length};\n')
+      operands = []
+      for src in (src1, src2):
+        if src == "SB_OP_NONE":
+          operands += ["0"]
+        else:
+          f.write(f'      int op{len(operands)+1} = sb_load_operand(gb,{src});\n')
+          operands += [f'op{len(operands)+1}']
+      f.write(f'      {impl_name}(gb,{operands[0]},{operands[1]},{src1},{src2},(const uint8_t*)"{flags}");\n')
+      if taken != mcycles:
+        f.write(f'      if(gb->cpu.branch_taken){{gb->cpu.branch_taken=false;return {4*(taken-(mcycles-1))};}}\n')
+      f.write('      return 4;\n')
+      f.write('    }\n')
+    f.write("""  }
+  return 4;
+}
+#endif
+""")
+
+# Rebuilds sb_instr_specialized.h from the decode table in sb_instr_tables.h (no opcode table needed)
+if len(sys.argv) > 1 and sys.argv[1] == "--specialized":
+  entries = []
+  row = re.compile(r'\{ (\w+)\s*, "([^"]*)"\s*, "([^"]*)", (\d+),(\d+), (\d+), (\w+), (\w+) \},')
+  with open("../src/sb_instr_tables.h") as f:
+    for line in f:
+      m = row.search(line)
+      if m:
+        g = m.groups()
+        entries += [(g[0], g[1], g[2], int(g[3]), int(g[4]), int(g[5]), g[6], g[7])]
+  write_specialized(entries)
+  sys.exit(0)
+
 import pandas as panda
 tables = panda.read_html("../docs/gbops%20-%20The%20Game%20Boy%20opcode%20table.html")
 opcode_table = tables[0] #Selecting the first table (for example)
@@ -24,6 +79,7 @@ print(opcode_list);
 
 unique_ops ={}
 unique_src ={}
+decode_entries=[]
 
 with open("../src/sb_instr_tables.h","w") as f:
   f.write("""
@@ -118,6 +174,8 @@ const static sb_instr_t sb_decode_table[]={
         unique_src[p]=True;
 
     impl_name = "sb_"+op_name.lower()+"_impl";
+    decode_entries+=[(impl_name, splits[0], splits[3], length, non_taken_latency, taken_latency,
+                      "SB_OP_"+parameters[0], "SB_OP_"+parameters[1])]
     f.write(f'  {{ {impl_name:16}, {instr_name:16}, "{splits[3]}", {length},'
             f'{non_taken_latency}, {taken_latency}, SB_OP_{parameters[0]}, '
             f'SB_OP_{parameters[1]} }},\n') 
@@ -127,6 +185,8 @@ const static sb_instr_t sb_decode_table[]={
 #endif
 """);
 
+write_specialized(decode_entries)
+
 
 for op in opcode_list:
   unique_ops[op.split(' ')[0]] = True;
@@ -156,7 +216,7 @@ with open("../src/sb_instr_impl_template.h","w") as f:
     f.write("uint8_t sb_read8(sb_gb_t *gb, int addr);\n\n");                                        
     f.write("void sb_store8(sb_gb_t *gb, int addr, int value);\n\n");                                        
                                          
-    f.write("int sb_load_operand(sb_gb_t* gb, int operand){\n")
+    f.write("static FORCE_INLINE int sb_load_operand(sb_gb_t* gb, int operand){\n")
     f.write("  switch(operand){\n");
 
     for (src,_) in sorted(unique_src.items()):
@@ -167,7 +227,7 @@ with open("../src/sb_instr_impl_template.h","w") as f:
     f.write('  return 0;\n');
     f.write("}\n\n");
      
-    f.write("void sb_store_operand(sb_gb_t* gb, int operand, int value){\n")
+    f.write("static FORCE_INLINE void sb_store_operand(sb_gb_t* gb, int operand, int value){\n")
     f.write("  switch(operand){\n");
 
     for (src,_) in sorted(unique_src.items()):
@@ -179,7 +239,7 @@ with open("../src/sb_instr_impl_template.h","w") as f:
     f.write("}\n\n");    
 
     for (op,_) in sorted(unique_ops.items()):
-        f.write("static void sb_"+op.lower()+"_impl(sb_gb_t* gb, int op1, int op2, int op1_enum){\n");
+        f.write("static FORCE_INLINE void sb_"+op.lower()+"_impl(sb_gb_t* gb, int op1, int op2, int op1_enum){\n");
         f.write('  printf("Stubbed opcode '+op+' executed\\n");\n');
 
         f.write("}\n\n");